@@ -196,6 +196,52 @@ void Adaptor3d_Curve::D2(const Standard_Real , gp_Pnt& , gp_Vec& , gp_Vec& ) con
 }
 
 
+//=======================================================================
+//function : D0Array
+//purpose  : 
+//=======================================================================
+
+void Adaptor3d_Curve::D0Array (const TColStd_Array1OfReal& theParams,
+                               TColgp_Array1OfPnt& thePoints) const
+{
+  for (Standard_Integer anIter = theParams.Lower(); anIter <= theParams.Upper(); ++anIter)
+  {
+    D0 (theParams (anIter), thePoints.ChangeValue (anIter));
+  }
+}
+
+//=======================================================================
+//function : D1Array
+//purpose  : 
+//=======================================================================
+
+void Adaptor3d_Curve::D1Array (const TColStd_Array1OfReal& theParams,
+                               TColgp_Array1OfPnt& thePoints,
+                               TColgp_Array1OfVec& theD1) const
+{
+  for (Standard_Integer anIter = theParams.Lower(); anIter <= theParams.Upper(); ++anIter)
+  {
+    D1 (theParams (anIter), thePoints.ChangeValue (anIter), theD1.ChangeValue (anIter));
+  }
+}
+
+//=======================================================================
+//function : D2Array
+//purpose  : 
+//=======================================================================
+
+void Adaptor3d_Curve::D2Array (const TColStd_Array1OfReal& theParams,
+                               TColgp_Array1OfPnt& thePoints,
+                               TColgp_Array1OfVec& theD1,
+                               TColgp_Array1OfVec& theD2) const
+{
+  for (Standard_Integer anIter = theParams.Lower(); anIter <= theParams.Upper(); ++anIter)
+  {
+    D2 (theParams (anIter), thePoints.ChangeValue (anIter),
+        theD1.ChangeValue (anIter), theD2.ChangeValue (anIter));
+  }
+}
+
 //=======================================================================
 //function : D3
 //purpose  : 
@@ -26,6 +26,8 @@
 #include <Standard_DefineAlloc.hxx>
 #include <Standard_Handle.hxx>
 #include <TColStd_Array1OfReal.hxx>
+#include <TColgp_Array1OfPnt.hxx>
+#include <TColgp_Array1OfVec.hxx>
 #include <GeomAbs_CurveType.hxx>
 
 class gp_Pnt;
@@ -111,6 +113,28 @@ public:
   //! Raised if the continuity of the current interval
   //! is not C3.
   Standard_EXPORT virtual void D3 (const Standard_Real U, gp_Pnt& P, gp_Vec& V1, gp_Vec& V2, gp_Vec& V3) const;
+
+  //! Computes the points of the array of parameters:
+  //! thePoints (i) is the point of parameter theParams (i),
+  //! thePoints should have the same bounds as theParams.
+  //! The default implementation calls D0() for each parameter,
+  //! the sub-classes may evaluate the array more efficiently,
+  //! e.g. visiting the parameters lying in the same span together.
+  Standard_EXPORT virtual void D0Array (const TColStd_Array1OfReal& theParams,
+                                        TColgp_Array1OfPnt& thePoints) const;
+
+  //! Computes the points and the first derivatives of the array of parameters,
+  //! see D0Array() for the layout of the results.
+  Standard_EXPORT virtual void D1Array (const TColStd_Array1OfReal& theParams,
+                                        TColgp_Array1OfPnt& thePoints,
+                                        TColgp_Array1OfVec& theD1) const;
+
+  //! Computes the points, the first and the second derivatives of the array of parameters,
+  //! see D0Array() for the layout of the results.
+  Standard_EXPORT virtual void D2Array (const TColStd_Array1OfReal& theParams,
+                                        TColgp_Array1OfPnt& thePoints,
+                                        TColgp_Array1OfVec& theD1,
+                                        TColgp_Array1OfVec& theD2) const;
   
 
   //! The returned vector gives the value of the derivative for the
@@ -25,6 +25,7 @@
 #include <gp_Dir.hxx>
 #include <gp_Pln.hxx>
 #include <gp_Pnt.hxx>
+#include <gp_Pnt2d.hxx>
 #include <gp_Sphere.hxx>
 #include <gp_Torus.hxx>
 #include <gp_Vec.hxx>
@@ -301,6 +302,128 @@ void Adaptor3d_Surface::D2(const Standard_Real , const Standard_Real , gp_Pnt& ,
 }
 
 
+//=======================================================================
+//function : D0Grid
+//purpose  : 
+//=======================================================================
+
+void Adaptor3d_Surface::D0Grid (const TColStd_Array1OfReal& theU,
+                                const TColStd_Array1OfReal& theV,
+                                TColgp_Array2OfPnt& thePoints) const
+{
+  for (Standard_Integer anUIter = theU.Lower(); anUIter <= theU.Upper(); ++anUIter)
+  {
+    for (Standard_Integer aVIter = theV.Lower(); aVIter <= theV.Upper(); ++aVIter)
+    {
+      D0 (theU (anUIter), theV (aVIter), thePoints.ChangeValue (anUIter, aVIter));
+    }
+  }
+}
+
+//=======================================================================
+//function : D1Grid
+//purpose  : 
+//=======================================================================
+
+void Adaptor3d_Surface::D1Grid (const TColStd_Array1OfReal& theU,
+                                const TColStd_Array1OfReal& theV,
+                                TColgp_Array2OfPnt& thePoints,
+                                TColgp_Array2OfVec& theD1U,
+                                TColgp_Array2OfVec& theD1V) const
+{
+  for (Standard_Integer anUIter = theU.Lower(); anUIter <= theU.Upper(); ++anUIter)
+  {
+    for (Standard_Integer aVIter = theV.Lower(); aVIter <= theV.Upper(); ++aVIter)
+    {
+      D1 (theU (anUIter), theV (aVIter), thePoints.ChangeValue (anUIter, aVIter),
+          theD1U.ChangeValue (anUIter, aVIter), theD1V.ChangeValue (anUIter, aVIter));
+    }
+  }
+}
+
+//=======================================================================
+//function : D2Grid
+//purpose  : 
+//=======================================================================
+
+void Adaptor3d_Surface::D2Grid (const TColStd_Array1OfReal& theU,
+                                const TColStd_Array1OfReal& theV,
+                                TColgp_Array2OfPnt& thePoints,
+                                TColgp_Array2OfVec& theD1U,
+                                TColgp_Array2OfVec& theD1V,
+                                TColgp_Array2OfVec& theD2U,
+                                TColgp_Array2OfVec& theD2V,
+                                TColgp_Array2OfVec& theD2UV) const
+{
+  for (Standard_Integer anUIter = theU.Lower(); anUIter <= theU.Upper(); ++anUIter)
+  {
+    for (Standard_Integer aVIter = theV.Lower(); aVIter <= theV.Upper(); ++aVIter)
+    {
+      D2 (theU (anUIter), theV (aVIter), thePoints.ChangeValue (anUIter, aVIter),
+          theD1U.ChangeValue (anUIter, aVIter), theD1V.ChangeValue (anUIter, aVIter),
+          theD2U.ChangeValue (anUIter, aVIter), theD2V.ChangeValue (anUIter, aVIter),
+          theD2UV.ChangeValue (anUIter, aVIter));
+    }
+  }
+}
+
+//=======================================================================
+//function : D0Array
+//purpose  : 
+//=======================================================================
+
+void Adaptor3d_Surface::D0Array (const TColgp_Array1OfPnt2d& theUV,
+                                 TColgp_Array1OfPnt& thePoints) const
+{
+  for (Standard_Integer anIter = theUV.Lower(); anIter <= theUV.Upper(); ++anIter)
+  {
+    const gp_Pnt2d& aUV = theUV (anIter);
+    D0 (aUV.X(), aUV.Y(), thePoints.ChangeValue (anIter));
+  }
+}
+
+//=======================================================================
+//function : D1Array
+//purpose  : 
+//=======================================================================
+
+void Adaptor3d_Surface::D1Array (const TColgp_Array1OfPnt2d& theUV,
+                                 TColgp_Array1OfPnt& thePoints,
+                                 TColgp_Array1OfVec& theD1U,
+                                 TColgp_Array1OfVec& theD1V) const
+{
+  for (Standard_Integer anIter = theUV.Lower(); anIter <= theUV.Upper(); ++anIter)
+  {
+    const gp_Pnt2d& aUV = theUV (anIter);
+    D1 (aUV.X(), aUV.Y(), thePoints.ChangeValue (anIter),
+        theD1U.ChangeValue (anIter), theD1V.ChangeValue (anIter));
+  }
+}
+
+//=======================================================================
+//function : D2Array
+//purpose  : 
+//=======================================================================
+
+void Adaptor3d_Surface::D2Array (const TColgp_Array1OfPnt2d& theUV,
+                                 TColgp_Array1OfPnt& thePoints,
+                                 TColgp_Array1OfVec& theD1U,
+                                 TColgp_Array1OfVec& theD1V,
+                                 TColgp_Array1OfVec& theD2U,
+                                 TColgp_Array1OfVec& theD2V,
+                                 TColgp_Array1OfVec& theD2UV) const
+{
+  for (Standard_Integer anIter = theUV.Lower(); anIter <= theUV.Upper(); ++anIter)
+  {
+    const gp_Pnt2d& aUV = theUV (anIter);
+    D2 (aUV.X(), aUV.Y(), thePoints.ChangeValue (anIter),
+        theD1U.ChangeValue (anIter), theD1V.ChangeValue (anIter),
+        theD2U.ChangeValue (anIter), theD2V.ChangeValue (anIter),
+        theD2UV.ChangeValue (anIter));
+  }
+}
+
+
 //=======================================================================
 //function : D3
 //purpose  : 
@@ -30,6 +30,9 @@
 #include <Standard_DefineAlloc.hxx>
 #include <Standard_Handle.hxx>
 #include <TColStd_Array1OfReal.hxx>
+#include <TColgp_Array1OfPnt2d.hxx>
+#include <TColgp_Array2OfPnt.hxx>
+#include <TColgp_Array2OfVec.hxx>
 
 class Geom_BezierSurface;
 class Geom_BSplineSurface;
@@ -139,6 +142,62 @@ public:
   //! Raised  if   the   continuity   of the current
   //! intervals is not C3.
   Standard_EXPORT virtual void D3 (const Standard_Real U, const Standard_Real V, gp_Pnt& P, gp_Vec& D1U, gp_Vec& D1V, gp_Vec& D2U, gp_Vec& D2V, gp_Vec& D2UV, gp_Vec& D3U, gp_Vec& D3V, gp_Vec& D3UUV, gp_Vec& D3UVV) const;
+
+  //! Computes the points on the grid of parameters:
+  //! thePoints(i, j) is the point of parameters theU(i), theV(j),
+  //! so that the row bounds of thePoints should be the bounds of theU
+  //! and the column bounds should be the bounds of theV.
+  //! The default implementation evaluates the points one by one by D0();
+  //! the sub-classes may evaluate the grid more efficiently, sharing the evaluation
+  //! along the grid lines in the plain scalar code (no explicit vector instructions are used).
+  Standard_EXPORT virtual void D0Grid (const TColStd_Array1OfReal& theU,
+                                       const TColStd_Array1OfReal& theV,
+                                       TColgp_Array2OfPnt& thePoints) const;
+
+  //! Computes the points and the first derivatives on the grid of parameters,
+  //! see D0Grid() for the layout of the results.
+  Standard_EXPORT virtual void D1Grid (const TColStd_Array1OfReal& theU,
+                                       const TColStd_Array1OfReal& theV,
+                                       TColgp_Array2OfPnt& thePoints,
+                                       TColgp_Array2OfVec& theD1U,
+                                       TColgp_Array2OfVec& theD1V) const;
+
+  //! Computes the points, the first and the second derivatives on the grid of parameters,
+  //! see D0Grid() for the layout of the results.
+  Standard_EXPORT virtual void D2Grid (const TColStd_Array1OfReal& theU,
+                                       const TColStd_Array1OfReal& theV,
+                                       TColgp_Array2OfPnt& thePoints,
+                                       TColgp_Array2OfVec& theD1U,
+                                       TColgp_Array2OfVec& theD1V,
+                                       TColgp_Array2OfVec& theD2U,
+                                       TColgp_Array2OfVec& theD2V,
+                                       TColgp_Array2OfVec& theD2UV) const;
+
+  //! Computes the points of the array of scattered parameters:
+  //! thePoints (i) is the point of parameters theUV (i).X() and theUV (i).Y(),
+  //! all output arrays should have the same bounds as theUV.
+  //! The default implementation calls D0() for each pair of parameters,
+  //! the sub-classes may evaluate the array more efficiently,
+  //! e.g. visiting the parameters lying in the same patch together.
+  Standard_EXPORT virtual void D0Array (const TColgp_Array1OfPnt2d& theUV,
+                                        TColgp_Array1OfPnt& thePoints) const;
+
+  //! Computes the points and the first derivatives of the array of scattered parameters,
+  //! see D0Array() for the layout of the results.
+  Standard_EXPORT virtual void D1Array (const TColgp_Array1OfPnt2d& theUV,
+                                        TColgp_Array1OfPnt& thePoints,
+                                        TColgp_Array1OfVec& theD1U,
+                                        TColgp_Array1OfVec& theD1V) const;
+
+  //! Computes the points, the first and the second derivatives
+  //! of the array of scattered parameters, see D0Array() for the layout of the results.
+  Standard_EXPORT virtual void D2Array (const TColgp_Array1OfPnt2d& theUV,
+                                        TColgp_Array1OfPnt& thePoints,
+                                        TColgp_Array1OfVec& theD1U,
+                                        TColgp_Array1OfVec& theD1V,
+                                        TColgp_Array1OfVec& theD2U,
+                                        TColgp_Array1OfVec& theD2V,
+                                        TColgp_Array1OfVec& theD2UV) const;
   
   //! Computes the derivative of order Nu in the direction U and Nv
   //! in the direction V at the point P(U, V).
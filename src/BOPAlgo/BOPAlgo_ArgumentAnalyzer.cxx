@@ -58,6 +58,7 @@ myMergeVertexMode(Standard_False),
 myMergeEdgeMode(Standard_False),
 myContinuityMode(Standard_False),
 myCurveOnSurfaceMode(Standard_False),
+myMaxNbSelfInter(0),
 myEmpty1(Standard_False),
 myEmpty2(Standard_False)
 {
@@ -368,6 +369,7 @@ void BOPAlgo_ArgumentAnalyzer::TestSelfInterferences(const Message_ProgressRange
     aChecker.SetNonDestructive(Standard_True);
     aChecker.SetRunParallel(myRunParallel);
     aChecker.SetFuzzyValue(myFuzzyValue);
+    aChecker.SetMaxNbDefects(myStopOnFirst ? 1 : myMaxNbSelfInter);
     //
     aChecker.Perform(aPS.Next());
     Standard_Boolean hasError = aChecker.HasErrors();
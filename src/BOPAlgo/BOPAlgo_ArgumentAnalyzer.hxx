@@ -93,6 +93,12 @@ Standard_EXPORT virtual ~BOPAlgo_ArgumentAnalyzer();
   //! checking of problem of invalid curve on surface.
     Standard_Boolean& CurveOnSurfaceMode();
   
+  //! Returns (modifiable) maximal number of self-interferences
+  //! to look for in each shape (see BOPAlgo_CheckerSI::SetMaxNbDefects()).
+  //! Zero value means that all self-interferences are looked for.
+  //! In StopOnFirstFaulty mode the check is stopped on the first found one.
+    Standard_Integer& MaxNbSelfInterferences();
+  
   //! performs analysis
   Standard_EXPORT void Perform(const Message_ProgressRange& theRange = Message_ProgressRange());
   
@@ -146,6 +152,7 @@ private:
   Standard_Boolean myMergeEdgeMode;
   Standard_Boolean myContinuityMode;
   Standard_Boolean myCurveOnSurfaceMode;
+  Standard_Integer myMaxNbSelfInter;
   Standard_Boolean myEmpty1;
   Standard_Boolean myEmpty2;
   BOPAlgo_ListOfCheckResult myResult;
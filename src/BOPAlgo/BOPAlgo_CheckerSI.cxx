@@ -25,6 +25,7 @@
 #include <BOPDS_MapOfPair.hxx>
 #include <BOPDS_Pair.hxx>
 #include <BOPDS_PIteratorSI.hxx>
+#include <BOPDS_Tools.hxx>
 #include <BOPDS_VectorOfInterfEF.hxx>
 #include <BOPDS_VectorOfInterfFF.hxx>
 #include <BOPDS_VectorOfInterfVE.hxx>
@@ -104,14 +105,37 @@ class BOPAlgo_FaceSelfIntersect :
 
 typedef NCollection_Vector<BOPAlgo_FaceSelfIntersect> BOPAlgo_VectorOfFaceSelfIntersect;
 
+//=======================================================================
+// Types of the shapes for each interference type, numbered as in
+// BOPDS_Tools::TypeToInteger() method
+static const TopAbs_ShapeEnum BOPAlgo_InterfShapeTypes[10][2] =
+{
+  { TopAbs_VERTEX, TopAbs_VERTEX },
+  { TopAbs_VERTEX, TopAbs_EDGE   },
+  { TopAbs_EDGE,   TopAbs_EDGE   },
+  { TopAbs_VERTEX, TopAbs_FACE   },
+  { TopAbs_EDGE,   TopAbs_FACE   },
+  { TopAbs_FACE,   TopAbs_FACE   },
+  { TopAbs_VERTEX, TopAbs_SOLID  },
+  { TopAbs_EDGE,   TopAbs_SOLID  },
+  { TopAbs_FACE,   TopAbs_SOLID  },
+  { TopAbs_SOLID,  TopAbs_SOLID  }
+};
+
 //=======================================================================
 //function : 
 //purpose  : 
 //=======================================================================
 BOPAlgo_CheckerSI::BOPAlgo_CheckerSI()
 :
-  BOPAlgo_PaveFiller()
+  BOPAlgo_PaveFiller(),
+  myMaxNbDefects(0),
+  myIsMaxNbDefectsReached(Standard_False),
+  myNbCandidates(0, BOPDS_DS::NbInterfTypes()-1),
+  myNbDefects(0, BOPDS_DS::NbInterfTypes()-1)
 {
+  myNbCandidates.Init(0);
+  myNbDefects.Init(0);
   myLevelOfCheck=BOPDS_DS::NbInterfTypes()-1;
   myNonDestructive=Standard_True;
   SetAvoidBuildPCurve(Standard_True);
@@ -137,6 +161,32 @@ void BOPAlgo_CheckerSI::SetLevelOfCheck(const Standard_Integer theLevel)
   }
 }
 //=======================================================================
+//function : NbCandidates
+//purpose  : 
+//=======================================================================
+Standard_Integer BOPAlgo_CheckerSI::NbCandidates
+  (const Standard_Integer theInterfType) const
+{
+  if (theInterfType < myNbCandidates.Lower() ||
+      theInterfType > myNbCandidates.Upper()) {
+    return 0;
+  }
+  return myNbCandidates(theInterfType);
+}
+//=======================================================================
+//function : NbDefects
+//purpose  : 
+//=======================================================================
+Standard_Integer BOPAlgo_CheckerSI::NbDefects
+  (const Standard_Integer theInterfType) const
+{
+  if (theInterfType < myNbDefects.Lower() ||
+      theInterfType > myNbDefects.Upper()) {
+    return 0;
+  }
+  return myNbDefects(theInterfType);
+}
+//=======================================================================
 //function : Init
 //purpose  : 
 //=======================================================================
@@ -144,6 +194,10 @@ void BOPAlgo_CheckerSI::Init(const Message_ProgressRange& /*theRange*/)
 {
   Clear();
   //
+  myIsMaxNbDefectsReached = Standard_False;
+  myNbCandidates.Init(0);
+  myNbDefects.Init(0);
+  //
   // 1. myDS
   myDS=new BOPDS_DS(myAllocator);
   myDS->SetArguments(myArguments);
@@ -158,6 +212,13 @@ void BOPAlgo_CheckerSI::Init(const Message_ProgressRange& /*theRange*/)
   theIterSI->Prepare(myContext, myUseOBB, myFuzzyValue);
   theIterSI->UpdateByLevelOfCheck(myLevelOfCheck);
   //
+  // 4. Statistics of the candidate pairs
+  for (Standard_Integer i = 0; i <= myLevelOfCheck; ++i) {
+    theIterSI->Initialize(BOPAlgo_InterfShapeTypes[i][0],
+                          BOPAlgo_InterfShapeTypes[i][1]);
+    myNbCandidates(i) = theIterSI->ExpectedLength();
+  }
+  //
   myIterator=theIterSI;
 }
 //=======================================================================
@@ -186,16 +247,16 @@ void BOPAlgo_CheckerSI::Perform(const Message_ProgressRange& theRange)
     
     Message_ProgressScope aPSZZ(aPS.Next(), NULL, 4);
     // Perform intersection with solids
-    if (!HasErrors())
+    if (!HasErrors() && !CheckMaxNbDefects())
       PerformVZ(aPSZZ.Next());
     //
-    if (!HasErrors())
+    if (!HasErrors() && !CheckMaxNbDefects())
       PerformEZ(aPSZZ.Next());
     //
-    if (!HasErrors())
+    if (!HasErrors() && !CheckMaxNbDefects())
       PerformFZ(aPSZZ.Next());
     //
-    if (!HasErrors())
+    if (!HasErrors() && !CheckMaxNbDefects())
       PerformZZ(aPSZZ.Next());
     //
     if (HasErrors())
@@ -210,16 +271,125 @@ void BOPAlgo_CheckerSI::Perform(const Message_ProgressRange& theRange)
   }
 }
 //=======================================================================
+//function : PerformVE
+//purpose  : 
+//=======================================================================
+void BOPAlgo_CheckerSI::PerformVE(const Message_ProgressRange& theRange)
+{
+  if (CheckMaxNbDefects()) {
+    return;
+  }
+  BOPAlgo_PaveFiller::PerformVE(theRange);
+}
+//=======================================================================
+//function : PerformEE
+//purpose  : 
+//=======================================================================
+void BOPAlgo_CheckerSI::PerformEE(const Message_ProgressRange& theRange)
+{
+  if (CheckMaxNbDefects()) {
+    return;
+  }
+  BOPAlgo_PaveFiller::PerformEE(theRange);
+}
+//=======================================================================
+//function : PerformVF
+//purpose  : 
+//=======================================================================
+void BOPAlgo_CheckerSI::PerformVF(const Message_ProgressRange& theRange)
+{
+  if (CheckMaxNbDefects()) {
+    return;
+  }
+  BOPAlgo_PaveFiller::PerformVF(theRange);
+}
+//=======================================================================
+//function : PerformEF
+//purpose  : 
+//=======================================================================
+void BOPAlgo_CheckerSI::PerformEF(const Message_ProgressRange& theRange)
+{
+  if (CheckMaxNbDefects()) {
+    return;
+  }
+  BOPAlgo_PaveFiller::PerformEF(theRange);
+}
+//=======================================================================
+//function : PerformFF
+//purpose  : 
+//=======================================================================
+void BOPAlgo_CheckerSI::PerformFF(const Message_ProgressRange& theRange)
+{
+  if (CheckMaxNbDefects()) {
+    return;
+  }
+  BOPAlgo_PaveFiller::PerformFF(theRange);
+}
+//=======================================================================
+//function : CheckMaxNbDefects
+//purpose  : 
+//=======================================================================
+Standard_Boolean BOPAlgo_CheckerSI::CheckMaxNbDefects()
+{
+  if (myIsMaxNbDefectsReached) {
+    return Standard_True;
+  }
+  //
+  if (myMaxNbDefects <= 0 || myDS == NULL) {
+    return Standard_False;
+  }
+  //
+  BOPDS_MapOfPair aMPK;
+  CollectInterferences(aMPK);
+  //
+  // Self-interferences of the faces are stored directly in the DS
+  Standard_Integer n1, n2;
+  BOPDS_MapIteratorOfMapOfPair aItMPK(myDS->Interferences());
+  for (; aItMPK.More(); aItMPK.Next()) {
+    aItMPK.Value().Indices(n1, n2);
+    if (n1 == n2) {
+      aMPK.Add(aItMPK.Value());
+    }
+  }
+  //
+  myIsMaxNbDefectsReached = (aMPK.Extent() >= myMaxNbDefects);
+  return myIsMaxNbDefectsReached;
+}
+//=======================================================================
 //function : PostTreat
 //purpose  : 
 //=======================================================================
 void BOPAlgo_CheckerSI::PostTreat()
 {
-  Standard_Integer i, aNb, n1, n2; 
-  BOPDS_Pair aPK;
+  Standard_Integer n1, n2, iT;
   //
   BOPDS_MapOfPair& aMPK=
     *((BOPDS_MapOfPair*)&myDS->Interferences());
+  //
+  CollectInterferences(aMPK);
+  //
+  // Statistics of the found interferences
+  BOPDS_MapIteratorOfMapOfPair aItMPK(aMPK);
+  for (; aItMPK.More(); aItMPK.Next()) {
+    aItMPK.Value().Indices(n1, n2);
+    if (myDS->IsNewShape(n1) || myDS->IsNewShape(n2)) {
+      continue;
+    }
+    iT=BOPDS_Tools::TypeToInteger(myDS->ShapeInfo(n1).ShapeType(),
+                                  myDS->ShapeInfo(n2).ShapeType());
+    if (iT >= 0) {
+      ++myNbDefects(iT);
+    }
+  }
+}
+//=======================================================================
+//function : CollectInterferences
+//purpose  : 
+//=======================================================================
+void BOPAlgo_CheckerSI::CollectInterferences(BOPDS_MapOfPair& theMPK)
+{
+  Standard_Integer i, aNb, n1, n2; 
+  BOPDS_Pair aPK;
 
   // 0
   BOPDS_VectorOfInterfVV& aVVs=myDS->InterfVV();
@@ -231,7 +401,7 @@ void BOPAlgo_CheckerSI::PostTreat()
       continue;
     }
     aPK.SetIndices(n1, n2);
-    aMPK.Add(aPK);
+    theMPK.Add(aPK);
   }
   //
   // 1
@@ -244,7 +414,7 @@ void BOPAlgo_CheckerSI::PostTreat()
       continue;
     }
     aPK.SetIndices(n1, n2);
-    aMPK.Add(aPK);
+    theMPK.Add(aPK);
   }
   //
   // 2
@@ -257,7 +427,7 @@ void BOPAlgo_CheckerSI::PostTreat()
       continue;
     }
     aPK.SetIndices(n1, n2);
-    aMPK.Add(aPK);
+    theMPK.Add(aPK);
   }
   //
   // 3
@@ -270,7 +440,7 @@ void BOPAlgo_CheckerSI::PostTreat()
       continue;
     }
     aPK.SetIndices(n1, n2);
-    aMPK.Add(aPK);
+    theMPK.Add(aPK);
   }
   //
   // 4
@@ -286,7 +456,7 @@ void BOPAlgo_CheckerSI::PostTreat()
       continue;
     }
     aPK.SetIndices(n1, n2);
-    aMPK.Add(aPK);
+    theMPK.Add(aPK);
   }
   //
   // 5
@@ -337,7 +507,7 @@ void BOPAlgo_CheckerSI::PostTreat()
     }
     //
     aPK.SetIndices(n1, n2);
-    aMPK.Add(aPK);
+    theMPK.Add(aPK);
   }
   //
   //
@@ -352,7 +522,7 @@ void BOPAlgo_CheckerSI::PostTreat()
       continue;
     }
     aPK.SetIndices(n1, n2);
-    aMPK.Add(aPK);
+    theMPK.Add(aPK);
   }
   //
   // 7
@@ -363,7 +533,7 @@ void BOPAlgo_CheckerSI::PostTreat()
     const BOPDS_InterfEZ& aEZ=aEZs(i);
     aEZ.Indices(n1, n2);
     aPK.SetIndices(n1, n2);
-    aMPK.Add(aPK);
+    theMPK.Add(aPK);
   }
   //
   // 8
@@ -374,7 +544,7 @@ void BOPAlgo_CheckerSI::PostTreat()
     const BOPDS_InterfFZ& aFZ=aFZs(i);
     aFZ.Indices(n1, n2);
     aPK.SetIndices(n1, n2);
-    aMPK.Add(aPK);
+    theMPK.Add(aPK);
   }
   //
   // 9
@@ -385,7 +555,7 @@ void BOPAlgo_CheckerSI::PostTreat()
     const BOPDS_InterfZZ& aZZ=aZZs(i);
     aZZ.Indices(n1, n2);
     aPK.SetIndices(n1, n2);
-    aMPK.Add(aPK);
+    theMPK.Add(aPK);
   }
 }
 
@@ -403,6 +573,9 @@ void BOPAlgo_CheckerSI::CheckFaceSelfIntersection(const Message_ProgressRange& t
   BOPDS_MapOfPair& aMPK=
     *((BOPDS_MapOfPair*)&myDS->Interferences());
   aMPK.Clear();
+
+  if (CheckMaxNbDefects())
+    return;
   
   BOPAlgo_VectorOfFaceSelfIntersect aVFace;
   
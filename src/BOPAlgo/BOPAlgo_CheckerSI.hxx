@@ -23,6 +23,7 @@
 #include <Standard_Handle.hxx>
 
 #include <BOPAlgo_PaveFiller.hxx>
+#include <TColStd_Array1OfInteger.hxx>
 
 
 //! Checks the shape on self-interference.
@@ -33,6 +34,16 @@
 //! In case the error has occurred during intersection of sub-shapes, i.e.
 //! in BOPAlgo_PaveFiller::PerformInternal() method, the errors from this method
 //! directly will be returned.
+//!
+//! The number of the self-interferences to look for may be limited
+//! (see SetMaxNbDefects()). In this case the intersection steps which
+//! are left after reaching the limit are skipped, which allows getting
+//! the quick answer on whether the shape is self-interfered or not.
+//!
+//! After the check the statistics of the candidate pairs of sub-shapes
+//! selected by the overlapping of their bounding boxes and of the found
+//! self-interferences is available for each interference type
+//! (see NbCandidates() and NbDefects()).
 
 class BOPAlgo_CheckerSI  : public BOPAlgo_PaveFiller
 {
@@ -60,6 +71,41 @@ public:
   //! 9 - V/V, V/E, E/E, V/F, E/F, F/F, V/S, E/S, F/S and S/S - all interferences (Default value)
   Standard_EXPORT void SetLevelOfCheck (const Standard_Integer theLevel);
 
+  //! Sets the maximal number of self-interferences to look for.<br>
+  //! As soon as the given number of interfering pairs of sub-shapes is found
+  //! the remaining intersection steps are skipped. Thus, the result contains
+  //! at least the given number of interferences (if the shape has them),
+  //! but not necessarily all of them.<br>
+  //! The value 1 should be used when only the answer on whether
+  //! the shape is self-interfered or not is required.<br>
+  //! Zero or negative value means that all interferences should be found (Default value).
+  void SetMaxNbDefects (const Standard_Integer theNbDefects)
+  {
+    myMaxNbDefects = theNbDefects;
+  }
+
+  //! Returns the maximal number of self-interferences to look for.
+  Standard_Integer MaxNbDefects() const
+  {
+    return myMaxNbDefects;
+  }
+
+  //! Returns TRUE if the check has been stopped earlier
+  //! because the maximal number of self-interferences has been found.
+  Standard_Boolean IsMaxNbDefectsReached() const
+  {
+    return myIsMaxNbDefectsReached;
+  }
+
+  //! Returns the number of the candidate pairs of sub-shapes of the given
+  //! interference type (the types are numbered as in SetLevelOfCheck() method)
+  //! selected for intersection by the overlapping of their bounding boxes.
+  Standard_EXPORT Standard_Integer NbCandidates (const Standard_Integer theInterfType) const;
+
+  //! Returns the number of found self-interferences of the given type
+  //! (the types are numbered as in SetLevelOfCheck() method).
+  Standard_EXPORT Standard_Integer NbDefects (const Standard_Integer theInterfType) const;
+
 protected:
 
   Standard_EXPORT virtual void Init(const Message_ProgressRange& theRange) Standard_OVERRIDE;
@@ -67,6 +113,32 @@ protected:
   //! Treats the intersection results
   Standard_EXPORT void PostTreat();
 
+  //! Collects the pairs of interfering sub-shapes of the argument
+  //! from the intersection results obtained so far.
+  Standard_EXPORT void CollectInterferences (BOPDS_MapOfPair& theMPK);
+
+  //! Checks if the maximal number of self-interferences has already been found
+  //! and sets the flag of stopping the check if it has.
+  Standard_EXPORT Standard_Boolean CheckMaxNbDefects();
+
+  //! Methods for intersection of sub-shapes skipping the intersection
+  //! in case the maximal number of self-interferences has been found
+
+  //! Edge/Vertex intersection
+  Standard_EXPORT virtual void PerformVE(const Message_ProgressRange& theRange) Standard_OVERRIDE;
+
+  //! Edge/Edge intersection
+  Standard_EXPORT virtual void PerformEE(const Message_ProgressRange& theRange) Standard_OVERRIDE;
+
+  //! Vertex/Face intersection
+  Standard_EXPORT virtual void PerformVF(const Message_ProgressRange& theRange) Standard_OVERRIDE;
+
+  //! Edge/Face intersection
+  Standard_EXPORT virtual void PerformEF(const Message_ProgressRange& theRange) Standard_OVERRIDE;
+
+  //! Face/Face intersection
+  Standard_EXPORT virtual void PerformFF(const Message_ProgressRange& theRange) Standard_OVERRIDE;
+
   Standard_EXPORT void CheckFaceSelfIntersection(const Message_ProgressRange& theRange);
 
   //! Methods for intersection with solids
@@ -87,6 +159,10 @@ protected:
   Standard_EXPORT virtual void PerformSZ(const TopAbs_ShapeEnum aTS, const Message_ProgressRange& theRange);
 
   Standard_Integer myLevelOfCheck;
+  Standard_Integer myMaxNbDefects;          //!< Maximal number of self-interferences to look for
+  Standard_Boolean myIsMaxNbDefectsReached; //!< Flag indicating that the check has been stopped earlier
+  TColStd_Array1OfInteger myNbCandidates;   //!< Number of candidate pairs of each interference type
+  TColStd_Array1OfInteger myNbDefects;      //!< Number of found interferences of each type
 
 private:
 
@@ -0,0 +1,597 @@
+// Copyright (c) 2024 OPEN CASCADE SAS
+//
+// This file is part of Open CASCADE Technology software library.
+//
+// This library is free software; you can redistribute it and/or modify it under
+// the terms of the GNU Lesser General Public License version 2.1 as published
+// by the Free Software Foundation, with special exception defined in the file
+// OCCT_LGPL_EXCEPTION.txt. Consult the file LICENSE_LGPL_21.txt included in OCCT
+// distribution for complete text of the license and disclaimer of any warranty.
+//
+// Alternatively, this file may be used under the terms of Open CASCADE
+// commercial license or contractual agreement.
+
+#include <BOPAlgo_IncrementalBuilder.hxx>
+
+#include <BOPAlgo_Alerts.hxx>
+#include <BOPAlgo_Builder.hxx>
+
+#include <BOPTools_AlgoTools.hxx>
+
+#include <BRep_Builder.hxx>
+#include <BRepBndLib.hxx>
+
+#include <Message_ProgressScope.hxx>
+
+#include <TopExp.hxx>
+#include <TopExp_Explorer.hxx>
+#include <TopoDS_Compound.hxx>
+#include <TopTools_IndexedMapOfShape.hxx>
+#include <TopTools_MapOfShape.hxx>
+
+namespace
+{
+  //=======================================================================
+  //function : CollectParts
+  //purpose  : Collects the parts of the argument of the types supported
+  //           by the history, i.e. solids, faces, edges and vertices
+  //=======================================================================
+  void CollectParts (const TopoDS_Shape& theS,
+                     TopTools_ListOfShape& theParts)
+  {
+    TopTools_ListOfShape aLS;
+    TopTools_MapOfShape aMFence;
+    BOPTools_AlgoTools::TreatCompound (theS, aLS, &aMFence);
+
+    TopTools_ListOfShape::Iterator aItLS (aLS);
+    for (; aItLS.More(); aItLS.Next())
+    {
+      const TopoDS_Shape& aS = aItLS.Value();
+      if (BRepTools_History::IsSupportedType (aS))
+      {
+        theParts.Append (aS);
+        continue;
+      }
+      // Shells, wires and compsolids
+      TopAbs_ShapeEnum aType = TopAbs_SHAPE;
+      switch (aS.ShapeType())
+      {
+        case TopAbs_COMPSOLID: aType = TopAbs_SOLID; break;
+        case TopAbs_SHELL:     aType = TopAbs_FACE;  break;
+        case TopAbs_WIRE:      aType = TopAbs_EDGE;  break;
+        default: break;
+      }
+      if (aType == TopAbs_SHAPE)
+        continue;
+
+      for (TopExp_Explorer anExp (aS, aType); anExp.More(); anExp.Next())
+      {
+        if (aMFence.Add (anExp.Current()))
+          theParts.Append (anExp.Current());
+      }
+    }
+  }
+
+  //=======================================================================
+  //function : CopyHistory
+  //purpose  : Copies the relations of the sub-shapes of the argument
+  //=======================================================================
+  void CopyHistory (const TopoDS_Shape& theArg,
+                    const Handle(BRepTools_History)& theFrom,
+                    const Handle(BRepTools_History)& theTo)
+  {
+    TopTools_IndexedMapOfShape aMS;
+    TopExp::MapShapes (theArg, aMS);
+    const Standard_Integer aNbS = aMS.Extent();
+    for (Standard_Integer i = 1; i <= aNbS; ++i)
+    {
+      const TopoDS_Shape& aS = aMS (i);
+      if (!BRepTools_History::IsSupportedType (aS))
+        continue;
+
+      TopTools_ListOfShape::Iterator aItG (theFrom->Generated (aS));
+      for (; aItG.More(); aItG.Next())
+        theTo->AddGenerated (aS, aItG.Value());
+
+      TopTools_ListOfShape::Iterator aItM (theFrom->Modified (aS));
+      for (; aItM.More(); aItM.Next())
+        theTo->AddModified (aS, aItM.Value());
+
+      if (theFrom->IsRemoved (aS))
+        theTo->Remove (aS);
+    }
+  }
+}
+
+//=======================================================================
+//function : BOPAlgo_IncrementalBuilder
+//purpose  :
+//=======================================================================
+BOPAlgo_IncrementalBuilder::BOPAlgo_IncrementalBuilder()
+:
+  BOPAlgo_Options(),
+  myHistory(new BRepTools_History),
+  myIsDone(Standard_False)
+{
+}
+
+//=======================================================================
+//function : Clear
+//purpose  :
+//=======================================================================
+void BOPAlgo_IncrementalBuilder::Clear()
+{
+  BOPAlgo_Options::Clear();
+  myImages.Clear();
+  myBoxes.Clear();
+  myHistory = new BRepTools_History;
+  myShape.Nullify();
+  myIsDone = Standard_False;
+  myIntersected.Clear();
+}
+
+//=======================================================================
+//function : SetArguments
+//purpose  :
+//=======================================================================
+void BOPAlgo_IncrementalBuilder::SetArguments (const TopTools_ListOfShape& theArgs)
+{
+  Clear();
+  myArguments = theArgs;
+}
+
+//=======================================================================
+//function : Images
+//purpose  :
+//=======================================================================
+const TopTools_ListOfShape& BOPAlgo_IncrementalBuilder::Images (const TopoDS_Shape& theArg) const
+{
+  static const TopTools_ListOfShape anEmptyList;
+  const TopTools_ListOfShape* pLImages = myImages.Seek (theArg);
+  return (pLImages ? *pLImages : anEmptyList);
+}
+
+//=======================================================================
+//function : Perform
+//purpose  :
+//=======================================================================
+void BOPAlgo_IncrementalBuilder::Perform (const Message_ProgressRange& theRange)
+{
+  Clear();
+
+  if (myArguments.IsEmpty())
+  {
+    AddError (new BOPAlgo_AlertTooFewArguments);
+    return;
+  }
+
+  Message_ProgressScope aPS (theRange, "Building the partition", 1);
+
+  Handle(BRepTools_History) aStepHistory;
+  if (!BuildPartition (myArguments, aPS.Next(), aStepHistory))
+    return;
+
+  myHistory->Merge (aStepHistory);
+
+  TopTools_ListOfShape::Iterator aItLA (myArguments);
+  for (; aItLA.More(); aItLA.Next())
+  {
+    const TopoDS_Shape& anArg = aItLA.Value();
+    myImages.Bind (anArg, TopTools_ListOfShape());
+    Bnd_Box aBox;
+    BoundingBox (anArg, aBox);
+    myBoxes.Bind (anArg, aBox);
+  }
+  UpdateImages (myArguments, aStepHistory, Standard_True);
+
+  for (aItLA.Initialize (myArguments); aItLA.More(); aItLA.Next())
+    myIntersected.Add (aItLA.Value());
+  myIsDone = Standard_True;
+  MakeResult();
+}
+
+//=======================================================================
+//function : AddArgument
+//purpose  :
+//=======================================================================
+void BOPAlgo_IncrementalBuilder::AddArgument (const TopoDS_Shape& theS,
+                                              const Message_ProgressRange& theRange)
+{
+  GetReport()->Clear();
+  myIntersected.Clear();
+  AddToPartition (theS, theRange);
+}
+
+//=======================================================================
+//function : RemoveArgument
+//purpose  :
+//=======================================================================
+void BOPAlgo_IncrementalBuilder::RemoveArgument (const TopoDS_Shape& theS,
+                                                 const Message_ProgressRange& theRange)
+{
+  GetReport()->Clear();
+  myIntersected.Clear();
+  RemoveFromPartition (theS, theRange);
+}
+
+//=======================================================================
+//function : ReplaceArgument
+//purpose  :
+//=======================================================================
+void BOPAlgo_IncrementalBuilder::ReplaceArgument (const TopoDS_Shape& theOld,
+                                                  const TopoDS_Shape& theNew,
+                                                  const Message_ProgressRange& theRange)
+{
+  GetReport()->Clear();
+  myIntersected.Clear();
+  if (theNew.IsNull())
+  {
+    AddError (new BOPAlgo_AlertNullInputShapes);
+    return;
+  }
+
+  Message_ProgressScope aPS (theRange, "Replacing the argument", 2);
+  RemoveFromPartition (theOld, aPS.Next());
+  if (HasErrors())
+    return;
+
+  // The arguments intersected on both steps are counted once
+  AddToPartition (theNew, aPS.Next());
+}
+
+//=======================================================================
+//function : AddToPartition
+//purpose  :
+//=======================================================================
+void BOPAlgo_IncrementalBuilder::AddToPartition (const TopoDS_Shape& theS,
+                                                 const Message_ProgressRange& theRange)
+{
+  if (theS.IsNull())
+  {
+    AddError (new BOPAlgo_AlertNullInputShapes);
+    return;
+  }
+
+  if (!myIsDone)
+  {
+    // The partition is not built yet
+    myArguments.Append (theS);
+    return;
+  }
+
+  if (myImages.IsBound (theS))
+    // The shape is already an argument
+    return;
+
+  Bnd_Box aBox;
+  BoundingBox (theS, aBox);
+
+  // Collect the splits of the current result located near the new argument.
+  // The splits are already connected, thus, they are put into single compound
+  // to avoid their intersection among each other.
+  TopoDS_Compound aCSplits;
+  BRep_Builder().MakeCompound (aCSplits);
+  Standard_Boolean hasSplits = Standard_False;
+
+  TopTools_ListOfShape aLArgsNear;
+  TopTools_MapOfShape aMFence;
+  TopTools_ListOfShape::Iterator aItLA (myArguments);
+  for (; aItLA.More(); aItLA.Next())
+  {
+    const TopoDS_Shape& anArg = aItLA.Value();
+    if (myBoxes.Find (anArg).IsOut (aBox))
+      continue;
+
+    aLArgsNear.Append (anArg);
+    TopTools_ListOfShape::Iterator aItLI (myImages.Find (anArg));
+    for (; aItLI.More(); aItLI.Next())
+    {
+      const TopoDS_Shape& aSplit = aItLI.Value();
+      if (!aMFence.Add (aSplit))
+        continue;
+
+      Bnd_Box aBoxSp;
+      BoundingBox (aSplit, aBoxSp);
+      if (!aBoxSp.IsOut (aBox))
+      {
+        BRep_Builder().Add (aCSplits, aSplit);
+        hasSplits = Standard_True;
+      }
+    }
+  }
+
+  Handle(BRepTools_History) aStepHistory;
+  if (hasSplits)
+  {
+    TopTools_ListOfShape aLGF;
+    aLGF.Append (theS);
+    aLGF.Append (aCSplits);
+    if (!BuildPartition (aLGF, theRange, aStepHistory))
+      return;
+
+    myHistory->Merge (aStepHistory);
+    UpdateImages (aLArgsNear, aStepHistory, Standard_False);
+  }
+  else
+  {
+    // Nothing to intersect with
+    aStepHistory = new BRepTools_History;
+  }
+
+  myArguments.Append (theS);
+  myImages.Bind (theS, TopTools_ListOfShape());
+  myBoxes.Bind (theS, aBox);
+
+  TopTools_ListOfShape aLNew;
+  aLNew.Append (theS);
+  UpdateImages (aLNew, aStepHistory, Standard_True);
+
+  if (hasSplits)
+  {
+    for (aItLA.Initialize (aLArgsNear); aItLA.More(); aItLA.Next())
+      myIntersected.Add (aItLA.Value());
+    myIntersected.Add (theS);
+  }
+  MakeResult();
+}
+
+//=======================================================================
+//function : RemoveFromPartition
+//purpose  :
+//=======================================================================
+void BOPAlgo_IncrementalBuilder::RemoveFromPartition (const TopoDS_Shape& theS,
+                                                      const Message_ProgressRange& theRange)
+{
+  if (!myIsDone)
+  {
+    // The partition is not built yet
+    TopTools_ListOfShape::Iterator aItLA (myArguments);
+    for (; aItLA.More(); aItLA.Next())
+    {
+      if (aItLA.Value().IsSame (theS))
+      {
+        myArguments.Remove (aItLA);
+        return;
+      }
+    }
+    AddError (new BOPAlgo_AlertUnknownShape (theS));
+    return;
+  }
+
+  if (!myImages.IsBound (theS))
+  {
+    AddError (new BOPAlgo_AlertUnknownShape (theS));
+    return;
+  }
+
+  const Bnd_Box aBox = myBoxes.Find (theS);
+
+  // Split the rest arguments on the ones interfering with the removed
+  // argument, which have to be intersected again from their original shapes,
+  // and the other ones, which splits are kept.
+  TopTools_ListOfShape aLTouched, aLOthers;
+  NCollection_List<Bnd_Box> aLBoxesTouched;
+  TopTools_ListOfShape::Iterator aItLA (myArguments);
+  for (; aItLA.More(); aItLA.Next())
+  {
+    const TopoDS_Shape& anArg = aItLA.Value();
+    if (anArg.IsSame (theS))
+      continue;
+
+    const Bnd_Box& aBoxArg = myBoxes.Find (anArg);
+    if (aBoxArg.IsOut (aBox))
+    {
+      aLOthers.Append (anArg);
+    }
+    else
+    {
+      aLTouched.Append (anArg);
+      aLBoxesTouched.Append (aBoxArg);
+    }
+  }
+
+  // Collect the splits of the other arguments located
+  // near the arguments to intersect
+  TopoDS_Compound aCSplits;
+  BRep_Builder().MakeCompound (aCSplits);
+  Standard_Boolean hasSplits = Standard_False;
+
+  TopTools_ListOfShape aLOthersNear;
+  if (!aLTouched.IsEmpty())
+  {
+    TopTools_MapOfShape aMFence;
+    for (aItLA.Initialize (aLOthers); aItLA.More(); aItLA.Next())
+    {
+      const TopoDS_Shape& anArg = aItLA.Value();
+      const Bnd_Box& aBoxArg = myBoxes.Find (anArg);
+
+      Standard_Boolean isNear = Standard_False;
+      NCollection_List<Bnd_Box>::Iterator aItLB (aLBoxesTouched);
+      for (; aItLB.More() && !isNear; aItLB.Next())
+        isNear = !aBoxArg.IsOut (aItLB.Value());
+
+      if (!isNear)
+        continue;
+
+      aLOthersNear.Append (anArg);
+      TopTools_ListOfShape::Iterator aItLI (myImages.Find (anArg));
+      for (; aItLI.More(); aItLI.Next())
+      {
+        const TopoDS_Shape& aSplit = aItLI.Value();
+        if (!aMFence.Add (aSplit))
+          continue;
+
+        Bnd_Box aBoxSp;
+        BoundingBox (aSplit, aBoxSp);
+        for (aItLB.Initialize (aLBoxesTouched); aItLB.More(); aItLB.Next())
+        {
+          if (!aBoxSp.IsOut (aItLB.Value()))
+          {
+            BRep_Builder().Add (aCSplits, aSplit);
+            hasSplits = Standard_True;
+            break;
+          }
+        }
+      }
+    }
+  }
+
+  Handle(BRepTools_History) aStepHistory;
+  if (!aLTouched.IsEmpty())
+  {
+    TopTools_ListOfShape aLGF = aLTouched;
+    if (hasSplits)
+      aLGF.Append (aCSplits);
+    if (!BuildPartition (aLGF, theRange, aStepHistory))
+      return;
+  }
+
+  // Rebuild the history: keep the relations of the untouched arguments
+  // and add the relations of the intersection step
+  Handle(BRepTools_History) aHistory = new BRepTools_History;
+  for (aItLA.Initialize (aLOthers); aItLA.More(); aItLA.Next())
+    CopyHistory (aItLA.Value(), myHistory, aHistory);
+
+  if (!aStepHistory.IsNull())
+    aHistory->Merge (aStepHistory);
+  myHistory = aHistory;
+
+  // Remove the argument
+  for (aItLA.Initialize (myArguments); aItLA.More(); aItLA.Next())
+  {
+    if (aItLA.Value().IsSame (theS))
+    {
+      myArguments.Remove (aItLA);
+      break;
+    }
+  }
+  myImages.UnBind (theS);
+  myBoxes.UnBind (theS);
+
+  if (!aStepHistory.IsNull())
+  {
+    UpdateImages (aLOthersNear, aStepHistory, Standard_False);
+    UpdateImages (aLTouched, aStepHistory, Standard_True);
+  }
+
+  for (aItLA.Initialize (aLTouched); aItLA.More(); aItLA.Next())
+    myIntersected.Add (aItLA.Value());
+  MakeResult();
+}
+
+//=======================================================================
+//function : BuildPartition
+//purpose  :
+//=======================================================================
+Standard_Boolean BOPAlgo_IncrementalBuilder::BuildPartition
+  (const TopTools_ListOfShape& theArgs,
+   const Message_ProgressRange& theRange,
+   Handle(BRepTools_History)& theStepHistory)
+{
+  if (theArgs.Extent() < 2)
+  {
+    // Single argument has nothing to be intersected with,
+    // its parts are kept unmodified
+    theStepHistory = new BRepTools_History;
+    return Standard_True;
+  }
+
+  BOPAlgo_Builder aBuilder;
+  aBuilder.SetArguments (theArgs);
+  aBuilder.SetRunParallel (myRunParallel);
+  aBuilder.SetFuzzyValue (myFuzzyValue);
+  aBuilder.SetUseOBB (myUseOBB);
+  aBuilder.SetToFillHistory (Standard_True);
+  aBuilder.Perform (theRange);
+
+  GetReport()->Merge (aBuilder.GetReport());
+  if (aBuilder.HasErrors())
+  {
+    if (!HasError (STANDARD_TYPE(BOPAlgo_AlertUserBreak)))
+      AddError (new BOPAlgo_AlertBuilderFailed);
+    return Standard_False;
+  }
+
+  theStepHistory = aBuilder.History();
+  return Standard_True;
+}
+
+//=======================================================================
+//function : UpdateImages
+//purpose  :
+//=======================================================================
+void BOPAlgo_IncrementalBuilder::UpdateImages (const TopTools_ListOfShape& theArgs,
+                                               const Handle(BRepTools_History)& theHistory,
+                                               const Standard_Boolean theFromOrigin)
+{
+  TopTools_ListOfShape::Iterator aItLA (theArgs);
+  for (; aItLA.More(); aItLA.Next())
+  {
+    const TopoDS_Shape& anArg = aItLA.Value();
+    TopTools_ListOfShape* pLImages = myImages.ChangeSeek (anArg);
+    if (!pLImages)
+      continue;
+
+    TopTools_ListOfShape aLParts;
+    if (theFromOrigin)
+      CollectParts (anArg, aLParts);
+    else
+      aLParts = *pLImages;
+
+    pLImages->Clear();
+    TopTools_MapOfShape aMFence;
+    TopTools_ListOfShape::Iterator aItLP (aLParts);
+    for (; aItLP.More(); aItLP.Next())
+    {
+      const TopoDS_Shape& aPart = aItLP.Value();
+      const TopTools_ListOfShape& aLM = theHistory->Modified (aPart);
+      if (aLM.IsEmpty())
+      {
+        if (!theHistory->IsRemoved (aPart) && aMFence.Add (aPart))
+          pLImages->Append (aPart);
+        continue;
+      }
+
+      TopTools_ListOfShape::Iterator aItLM (aLM);
+      for (; aItLM.More(); aItLM.Next())
+      {
+        if (aMFence.Add (aItLM.Value()))
+          pLImages->Append (aItLM.Value());
+      }
+    }
+  }
+}
+
+//=======================================================================
+//function : MakeResult
+//purpose  :
+//=======================================================================
+void BOPAlgo_IncrementalBuilder::MakeResult()
+{
+  TopoDS_Compound aResult;
+  BRep_Builder().MakeCompound (aResult);
+
+  TopTools_MapOfShape aMFence;
+  TopTools_ListOfShape::Iterator aItLA (myArguments);
+  for (; aItLA.More(); aItLA.Next())
+  {
+    TopTools_ListOfShape::Iterator aItLI (myImages.Find (aItLA.Value()));
+    for (; aItLI.More(); aItLI.Next())
+    {
+      if (aMFence.Add (aItLI.Value()))
+        BRep_Builder().Add (aResult, aItLI.Value());
+    }
+  }
+  myShape = aResult;
+}
+
+//=======================================================================
+//function : BoundingBox
+//purpose  :
+//=======================================================================
+void BOPAlgo_IncrementalBuilder::BoundingBox (const TopoDS_Shape& theS,
+                                              Bnd_Box& theBox) const
+{
+  BRepBndLib::Add (theS, theBox);
+  theBox.Enlarge (myFuzzyValue);
+}
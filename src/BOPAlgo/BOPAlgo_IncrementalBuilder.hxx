@@ -0,0 +1,213 @@
+// Copyright (c) 2024 OPEN CASCADE SAS
+//
+// This file is part of Open CASCADE Technology software library.
+//
+// This library is free software; you can redistribute it and/or modify it under
+// the terms of the GNU Lesser General Public License version 2.1 as published
+// by the Free Software Foundation, with special exception defined in the file
+// OCCT_LGPL_EXCEPTION.txt. Consult the file LICENSE_LGPL_21.txt included in OCCT
+// distribution for complete text of the license and disclaimer of any warranty.
+//
+// Alternatively, this file may be used under the terms of Open CASCADE
+// commercial license or contractual agreement.
+
+#ifndef _BOPAlgo_IncrementalBuilder_HeaderFile
+#define _BOPAlgo_IncrementalBuilder_HeaderFile
+
+#include <Standard.hxx>
+#include <Standard_DefineAlloc.hxx>
+#include <Standard_Handle.hxx>
+
+#include <BOPAlgo_Options.hxx>
+#include <Bnd_Box.hxx>
+#include <BRepTools_History.hxx>
+#include <Message_ProgressRange.hxx>
+#include <NCollection_DataMap.hxx>
+#include <TopTools_ListOfShape.hxx>
+#include <TopTools_MapOfShape.hxx>
+#include <TopTools_ShapeMapHasher.hxx>
+#include <TopoDS_Shape.hxx>
+
+//! BOPAlgo_IncrementalBuilder is the algorithm maintaining the result
+//! of the General Fuse operation (the partition of the arguments) while
+//! the arguments are added, removed or replaced one by one.
+//!
+//! The first result is built by the *Perform()* method which performs
+//! the General Fuse of all arguments. After that the following
+//! modifications of the set of arguments are possible:
+//! - *AddArgument()* - intersects the new argument only with the splits
+//!   of the current result which bounding boxes overlap the box of the
+//!   new argument. All these splits are given to the General Fuse algorithm
+//!   as a single argument, so that the interferences among them
+//!   (which are already treated in the current result) are not computed again;
+//! - *RemoveArgument()* - drops the splits of the removed argument. The arguments
+//!   which interfered with the removed one (by the bounding boxes) are
+//!   intersected again, from their original shapes, with the splits of the
+//!   rest arguments located nearby. The splits of the other arguments remain
+//!   untouched;
+//! - *ReplaceArgument()* - combines the two above operations.
+//!
+//! Thus, the costs of the modification depend only on the number of the
+//! arguments located near the modified one, but not on the total number of arguments.
+//!
+//! The history of modification of the arguments is kept consistent through
+//! all modifications, i.e. it always maps the current arguments on the current
+//! result shape (see *History()*). The splits of each argument are available
+//! with *Images()* method.
+//!
+//! The algorithm returns the following Error/Warning messages:
+//! - *BOPAlgo_AlertTooFewArguments* - error alert is given on the attempt to run
+//!     the algorithm without the arguments;
+//! - *BOPAlgo_AlertNullInputShapes* - error alert is given on the attempt to
+//!     add a null shape;
+//! - *BOPAlgo_AlertUnknownShape* - error alert is given on the attempt to remove
+//!     the shape which is not an argument of the operation;
+//! - *BOPAlgo_AlertBuilderFailed* - error alert is given if the General Fuse
+//!     algorithm has failed. In this case the result of the previous step
+//!     is kept untouched.
+//!
+//! Here is the example of usage of the algorithm:
+//! ~~~~
+//! TopTools_ListOfShape anArguments = ...;  // Shapes to partition
+//!
+//! BOPAlgo_IncrementalBuilder aBuilder;
+//! aBuilder.SetArguments(anArguments);
+//! aBuilder.SetRunParallel(Standard_True);
+//! aBuilder.Perform();                      // Initial partition
+//!
+//! const TopoDS_Shape& aMoved = ...;        // The argument to move
+//! TopoDS_Shape aNewPosition = aMoved.Moved(aLoc);
+//! aBuilder.ReplaceArgument(aMoved, aNewPosition);
+//! if (aBuilder.HasErrors())
+//! {
+//!   // errors treatment
+//! }
+//! const TopoDS_Shape& aResult = aBuilder.Shape();
+//! ~~~~
+class BOPAlgo_IncrementalBuilder : public BOPAlgo_Options
+{
+public:
+
+  DEFINE_STANDARD_ALLOC
+
+public: //! @name Constructor
+
+  //! Empty constructor
+  Standard_EXPORT BOPAlgo_IncrementalBuilder();
+
+public: //! @name Setting the arguments
+
+  //! Sets the arguments for the initial partition.
+  //! The results of the previous runs are cleared.
+  Standard_EXPORT void SetArguments (const TopTools_ListOfShape& theArgs);
+
+  //! Returns the current list of arguments.
+  const TopTools_ListOfShape& Arguments() const
+  {
+    return myArguments;
+  }
+
+public: //! @name Performing the operations
+
+  //! Performs the General Fuse of all arguments.
+  Standard_EXPORT void Perform (const Message_ProgressRange& theRange = Message_ProgressRange());
+
+  //! Adds the new argument into the partition.
+  //! If the partition has not been built yet, only adds the shape to the arguments.
+  //! @param theS [in] The shape to add.
+  Standard_EXPORT void AddArgument (const TopoDS_Shape& theS,
+                                    const Message_ProgressRange& theRange = Message_ProgressRange());
+
+  //! Removes the argument from the partition.
+  //! @param theS [in] The argument to remove.
+  Standard_EXPORT void RemoveArgument (const TopoDS_Shape& theS,
+                                       const Message_ProgressRange& theRange = Message_ProgressRange());
+
+  //! Replaces the argument in the partition with the new shape.
+  //! @param theOld [in] The argument to replace.
+  //! @param theNew [in] The new argument.
+  Standard_EXPORT void ReplaceArgument (const TopoDS_Shape& theOld,
+                                        const TopoDS_Shape& theNew,
+                                        const Message_ProgressRange& theRange = Message_ProgressRange());
+
+public: //! @name Getting the results
+
+  //! Returns the result of the operation - the compound of the splits of all arguments.
+  const TopoDS_Shape& Shape() const
+  {
+    return myShape;
+  }
+
+  //! Returns the splits of the given argument in the current result.
+  Standard_EXPORT const TopTools_ListOfShape& Images (const TopoDS_Shape& theArg) const;
+
+  //! Returns the history of modification of the current arguments
+  //! into the current result.
+  const Handle(BRepTools_History)& History() const
+  {
+    return myHistory;
+  }
+
+  //! Returns the number of arguments (including the added one)
+  //! which have been intersected on the last step.
+  //! For the initial partition it is the number of all arguments.
+  //! The argument intersected both on the removal and on the addition
+  //! of the replacement is counted once.
+  Standard_Integer NbIntersectedArguments() const
+  {
+    return myIntersected.Extent();
+  }
+
+public: //! @name Clearing the contents of the algorithm
+
+  //! Clears the contents of the algorithm.
+  Standard_EXPORT virtual void Clear() Standard_OVERRIDE;
+
+protected: //! @name Protected methods performing the operation
+
+  //! Intersects the new argument with the splits of the current result
+  //! located nearby and adds it to the arguments.
+  Standard_EXPORT void AddToPartition (const TopoDS_Shape& theS,
+                                       const Message_ProgressRange& theRange);
+
+  //! Removes the argument from the partition, intersecting again
+  //! the arguments which interfered with it.
+  Standard_EXPORT void RemoveFromPartition (const TopoDS_Shape& theS,
+                                            const Message_ProgressRange& theRange);
+
+  //! Performs the General Fuse of the given arguments and returns
+  //! the history of this step. Returns FALSE in case of failure.
+  Standard_EXPORT Standard_Boolean BuildPartition (const TopTools_ListOfShape& theArgs,
+                                                   const Message_ProgressRange& theRange,
+                                                   Handle(BRepTools_History)& theStepHistory);
+
+  //! Updates the splits of the arguments using the history of the last step.
+  //! @param theArgs [in] The arguments which splits should be updated.
+  //! @param theHistory [in] The history of the last step.
+  //! @param theFromOrigin [in] Defines whether the new splits should be taken
+  //!                           from the original argument or from its current splits.
+  Standard_EXPORT void UpdateImages (const TopTools_ListOfShape& theArgs,
+                                     const Handle(BRepTools_History)& theHistory,
+                                     const Standard_Boolean theFromOrigin);
+
+  //! Builds the result compound from the splits of all arguments.
+  Standard_EXPORT void MakeResult();
+
+  //! Computes the bounding box of the shape.
+  Standard_EXPORT void BoundingBox (const TopoDS_Shape& theS, Bnd_Box& theBox) const;
+
+protected: //! @name Fields
+
+  TopTools_ListOfShape myArguments;                        //!< Current arguments
+  NCollection_DataMap<TopoDS_Shape, TopTools_ListOfShape,
+                      TopTools_ShapeMapHasher> myImages;   //!< Splits of the arguments
+  NCollection_DataMap<TopoDS_Shape, Bnd_Box,
+                      TopTools_ShapeMapHasher> myBoxes;    //!< Bounding boxes of the arguments
+  Handle(BRepTools_History) myHistory;                     //!< History of the arguments
+  TopoDS_Shape myShape;                                    //!< Result shape
+  Standard_Boolean myIsDone;                               //!< Defines whether the partition has been built
+  TopTools_MapOfShape myIntersected;                       //!< Arguments intersected on the last step
+
+};
+
+#endif // _BOPAlgo_IncrementalBuilder_HeaderFile
@@ -17,6 +17,7 @@
 #include <Message_MsgFile.hxx>
 #include <Message_ProgressScope.hxx>
 #include <NCollection_BaseAllocator.hxx>
+#include <NCollection_IncAllocator.hxx>
 #include <TCollection_AsciiString.hxx>
 #include <Precision.hxx>
 #include <Standard_NotImplemented.hxx>
@@ -99,6 +100,17 @@ void BOPAlgo_Options::DumpWarnings(Standard_OStream& theOS) const
   myReport->Dump (theOS, Message_Warning);
 }
 
+//=======================================================================
+//function : AllocatedMemSize
+//purpose  : 
+//=======================================================================
+Standard_Size BOPAlgo_Options::AllocatedMemSize() const
+{
+  Handle(NCollection_IncAllocator) anIncAlloc =
+    Handle(NCollection_IncAllocator)::DownCast (myAllocator);
+  return !anIncAlloc.IsNull() ? anIncAlloc->GetMemSize() : 0;
+}
+
 //=======================================================================
 // function: 
 // purpose: 
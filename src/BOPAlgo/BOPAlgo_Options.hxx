@@ -165,6 +165,17 @@ public:
     return myUseOBB;
   }
 
+public:
+  //!@name Memory usage
+
+  //! Returns the size of memory (in bytes) taken from the system by the
+  //! allocator of the algorithm in case it is the incremental allocator
+  //! (NCollection_IncAllocator). As such allocator does not return the memory
+  //! until it is destroyed, the value is the high-water mark of the memory
+  //! used by the data structures of the operation.
+  //! Returns zero for other allocators.
+  Standard_EXPORT Standard_Size AllocatedMemSize() const;
+
 protected:
 
   //! Adds error to the report if the break signal was caught. Returns true in this case, false otherwise.
@@ -55,6 +55,7 @@ void  BOPTest::AllCommands(Draw_Interpretor& theCommands)
   BOPTest::RemoveFeaturesCommands(theCommands);
   BOPTest::PeriodicityCommands(theCommands);
   BOPTest::MkConnectedCommands(theCommands);
+  BOPTest::IncrementalCommands(theCommands);
 }
 //=======================================================================
 //function : Factory
@@ -144,10 +144,14 @@ Standard_Integer bapibop(Draw_Interpretor& di,
   pBuilder->SetGlue(aGlue);
   pBuilder->SetCheckInverted(BOPTest_Objects::CheckInverted());
   pBuilder->SetUseOBB(BOPTest_Objects::UseOBB());
+  pBuilder->SetUseIncAllocator(BOPTest_Objects::UseIncAllocator());
   pBuilder->SetToFillHistory(BRepTest_Objects::IsHistoryNeeded());
   //
   Handle(Draw_ProgressIndicator) aProgress = new Draw_ProgressIndicator(di, 1);
   pBuilder->Build(aProgress->Start());
+  if (pBuilder->UseIncAllocator()) {
+    di << "Memory of the incremental allocator: " << (Standard_Integer )pBuilder->AllocatedMemSize() << " bytes\n";
+  }
   pBuilder->SimplifyResult(BOPTest_Objects::UnifyEdges(),
                            BOPTest_Objects::UnifyFaces(),
                            BOPTest_Objects::Angular());
@@ -212,10 +216,14 @@ Standard_Integer bapibuild(Draw_Interpretor& di,
   aBuilder.SetGlue(aGlue);
   aBuilder.SetCheckInverted(BOPTest_Objects::CheckInverted());
   aBuilder.SetUseOBB(BOPTest_Objects::UseOBB());
+  aBuilder.SetUseIncAllocator(BOPTest_Objects::UseIncAllocator());
   aBuilder.SetToFillHistory(BRepTest_Objects::IsHistoryNeeded());
   //
   Handle(Draw_ProgressIndicator) aProgress = new Draw_ProgressIndicator(di, 1);
   aBuilder.Build(aProgress->Start());
+  if (aBuilder.UseIncAllocator()) {
+    di << "Memory of the incremental allocator: " << (Standard_Integer )aBuilder.AllocatedMemSize() << " bytes\n";
+  }
   aBuilder.SimplifyResult(BOPTest_Objects::UnifyEdges(),
                           BOPTest_Objects::UnifyFaces(),
                           BOPTest_Objects::Angular());
@@ -272,11 +280,15 @@ Standard_Integer bapisplit(Draw_Interpretor& di,
   aSplitter.SetGlue(BOPTest_Objects::Glue());
   aSplitter.SetCheckInverted(BOPTest_Objects::CheckInverted());
   aSplitter.SetUseOBB(BOPTest_Objects::UseOBB());
+  aSplitter.SetUseIncAllocator(BOPTest_Objects::UseIncAllocator());
   aSplitter.SetToFillHistory(BRepTest_Objects::IsHistoryNeeded());
   //
   // performing operation
   Handle(Draw_ProgressIndicator) aProgress = new Draw_ProgressIndicator(di, 1);
   aSplitter.Build(aProgress->Start());
+  if (aSplitter.UseIncAllocator()) {
+    di << "Memory of the incremental allocator: " << (Standard_Integer )aSplitter.AllocatedMemSize() << " bytes\n";
+  }
   aSplitter.SimplifyResult(BOPTest_Objects::UnifyEdges(),
                            BOPTest_Objects::UnifyFaces(),
                            BOPTest_Objects::Angular());
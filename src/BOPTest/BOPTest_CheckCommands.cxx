@@ -71,7 +71,7 @@ void  BOPTest::CheckCommands(Draw_Interpretor& theCommands)
   const char* g = "BOPTest commands";
   //
   theCommands.Add("bopcheck",  
-                  "use bopcheck Shape [level of check: 0 - 9] [-t]",
+                  "use bopcheck Shape [level of check: 0 - 9] [-n NbDefects] [-t]",
                   __FILE__, bopcheck, g);
   theCommands.Add("bopargcheck" , 
                   "use bopargcheck without parameters to get ",  
@@ -157,7 +157,7 @@ Standard_Integer bopcheck (Draw_Interpretor& di,
                            const char** a )
 {
   if (n<2) {
-    di << " use bopcheck Shape [level of check: 0 - 9] [-t]\n";
+    di << " use bopcheck Shape [level of check: 0 - 9] [-n NbDefects] [-t]\n";
     di << " The level of check defines "; 
     di << " which interferences will be checked:\n";
     di << " 0 - V/V only\n"; 
@@ -171,6 +171,10 @@ Standard_Integer bopcheck (Draw_Interpretor& di,
     di << " 8 - V/V, V/E, E/E, V/F, E/F, F/F, E/Z, F/Z\n";
     di << " 9 - V/V, V/E, E/E, V/F, E/F, F/F, E/Z, F/Z, Z/Z\n";
     di << " Default level is 9\n";
+    di << " -n NbDefects - stops the check after finding the given number\n";
+    di << "                of self-interferences (by default all are found)\n";
+    di << " -t - outputs the time of the check and the statistics\n";
+    di << "      of candidate pairs and found interferences\n";
     return 1;
   }
   //
@@ -181,7 +185,7 @@ Standard_Integer bopcheck (Draw_Interpretor& di,
   }
   //
   Standard_Boolean bRunParallel, bShowTime;
-  Standard_Integer i, aLevel, aNbInterfTypes;
+  Standard_Integer i, aLevel, aNbInterfTypes, aMaxNbDefects;
   Standard_Real aTol;
   //
   aNbInterfTypes=BOPDS_DS::NbInterfTypes();
@@ -200,6 +204,7 @@ Standard_Integer bopcheck (Draw_Interpretor& di,
   }
   //
   bShowTime=Standard_False;
+  aMaxNbDefects=0;
   aTol=BOPTest_Objects::FuzzyValue();
   bRunParallel=BOPTest_Objects::RunParallel(); 
   //
@@ -207,7 +212,10 @@ Standard_Integer bopcheck (Draw_Interpretor& di,
     if (!strcmp(a[i], "-t")) {
       bShowTime=Standard_True;
     }
-      }
+    else if (!strcmp(a[i], "-n") && (i+1 < n)) {
+      aMaxNbDefects=Draw::Atoi(a[++i]);
+    }
+  }
   //
   //aLevel = (n==3) ? Draw::Atoi(a[2]) : aNbInterfTypes-1;
   //-------------------------------------------------------------------
@@ -238,6 +246,7 @@ Standard_Integer bopcheck (Draw_Interpretor& di,
   aLS.Append(aS);
   aChecker.SetArguments(aLS);
   aChecker.SetLevelOfCheck(aLevel);
+  aChecker.SetMaxNbDefects(aMaxNbDefects);
   aChecker.SetRunParallel(bRunParallel);
   aChecker.SetFuzzyValue(aTol);
   //
@@ -318,6 +327,12 @@ Standard_Integer bopcheck (Draw_Interpretor& di,
     di << "so the list may be incomplete.\n";
   }
   //
+  if (aChecker.IsMaxNbDefectsReached()) {
+    di << "The check has been stopped after finding "
+       << aMaxNbDefects << " interference(s), ";
+    di << "so the list may be incomplete.\n";
+  }
+  //
   if (!iCnt) {
     di << " This shape seems to be OK.\n";
   }
@@ -325,6 +340,11 @@ Standard_Integer bopcheck (Draw_Interpretor& di,
   {
     Sprintf(buf, "  Tps: %7.2lf\n", aTimer.ElapsedTime());
     di << buf;
+    for (i=0; i<=aLevel; ++i) {
+      Sprintf(buf, "  %s: candidates: %d, interferences: %d\n",
+              aInterfTypes[i], aChecker.NbCandidates(i), aChecker.NbDefects(i));
+      di << buf;
+    }
   }
   return 0;
 }
@@ -0,0 +1,217 @@
+// Copyright (c) 2024 OPEN CASCADE SAS
+//
+// This file is part of Open CASCADE Technology software library.
+//
+// This library is free software; you can redistribute it and/or modify it under
+// the terms of the GNU Lesser General Public License version 2.1 as published
+// by the Free Software Foundation, with special exception defined in the file
+// OCCT_LGPL_EXCEPTION.txt. Consult the file LICENSE_LGPL_21.txt included in OCCT
+// distribution for complete text of the license and disclaimer of any warranty.
+//
+// Alternatively, this file may be used under the terms of Open CASCADE
+// commercial license or contractual agreement.
+
+#include <BOPTest.hxx>
+
+#include <BOPAlgo_IncrementalBuilder.hxx>
+
+#include <BOPTest_Objects.hxx>
+
+#include <BRepTest_Objects.hxx>
+
+#include <DBRep.hxx>
+#include <Draw.hxx>
+#include <Draw_ProgressIndicator.hxx>
+
+static Standard_Integer bincbuild  (Draw_Interpretor&, Standard_Integer, const char**);
+static Standard_Integer bincadd    (Draw_Interpretor&, Standard_Integer, const char**);
+static Standard_Integer bincremove (Draw_Interpretor&, Standard_Integer, const char**);
+static Standard_Integer bincreplace(Draw_Interpretor&, Standard_Integer, const char**);
+
+namespace
+{
+  static BOPAlgo_IncrementalBuilder& getIncrementalBuilder()
+  {
+    static BOPAlgo_IncrementalBuilder TheIncrementalBuilder;
+    return TheIncrementalBuilder;
+  }
+
+  //! Reports the alerts, saves the history and draws the result of the last step
+  static void ProcessResult (Draw_Interpretor& theDI,
+                             const char* theName)
+  {
+    BOPAlgo_IncrementalBuilder& aBuilder = getIncrementalBuilder();
+
+    // Print Error/Warning messages
+    BOPTest::ReportAlerts(aBuilder.GetReport());
+
+    if (aBuilder.HasErrors())
+      return;
+
+    // Set the history of the operation in session
+    if (BRepTest_Objects::IsHistoryNeeded())
+      BRepTest_Objects::SetHistory(aBuilder.History());
+
+    theDI << "Number of intersected arguments: " << aBuilder.NbIntersectedArguments() << "\n";
+
+    // Draw the result shape
+    DBRep::Set(theName, aBuilder.Shape());
+  }
+}
+
+//=======================================================================
+//function : IncrementalCommands
+//purpose  :
+//=======================================================================
+void BOPTest::IncrementalCommands(Draw_Interpretor& theCommands)
+{
+  static Standard_Boolean done = Standard_False;
+  if (done) return;
+  done = Standard_True;
+  // Chapter's name
+  const char* group = "BOPTest commands";
+  // Commands
+  theCommands.Add("bincbuild", "bincbuild result shape1 shape2 ...\n"
+                  "\t\tBuilds the initial partition of the given shapes for the incremental\n"
+                  "\t\tGeneral Fuse algorithm. The options set by bfuzzyvalue, brunparallel\n"
+                  "\t\tand buseobb commands are taken into account.",
+                  __FILE__, bincbuild, group);
+
+  theCommands.Add("bincadd", "bincadd result shape\n"
+                  "\t\tAdds the new argument into the partition built by bincbuild command.\n"
+                  "\t\tOnly the splits located near the new argument are intersected again.",
+                  __FILE__, bincadd, group);
+
+  theCommands.Add("bincremove", "bincremove result shape\n"
+                  "\t\tRemoves the argument from the partition built by bincbuild command.",
+                  __FILE__, bincremove, group);
+
+  theCommands.Add("bincreplace", "bincreplace result old new\n"
+                  "\t\tReplaces the argument of the partition built by bincbuild command\n"
+                  "\t\twith the new shape.",
+                  __FILE__, bincreplace, group);
+}
+
+//=======================================================================
+//function : bincbuild
+//purpose  :
+//=======================================================================
+Standard_Integer bincbuild(Draw_Interpretor& theDI,
+                           Standard_Integer  theArgc,
+                           const char ** theArgv)
+{
+  if (theArgc < 3)
+  {
+    theDI.PrintHelp(theArgv[0]);
+    return 1;
+  }
+
+  TopTools_ListOfShape anArgs;
+  for (Standard_Integer i = 2; i < theArgc; ++i)
+  {
+    TopoDS_Shape aS = DBRep::Get(theArgv[i]);
+    if (aS.IsNull())
+    {
+      theDI << "Error: " << theArgv[i] << " is a null shape. Skip it.\n";
+      continue;
+    }
+    anArgs.Append(aS);
+  }
+
+  BOPAlgo_IncrementalBuilder& aBuilder = getIncrementalBuilder();
+  aBuilder.SetArguments(anArgs);
+  aBuilder.SetRunParallel(BOPTest_Objects::RunParallel());
+  aBuilder.SetFuzzyValue(BOPTest_Objects::FuzzyValue());
+  aBuilder.SetUseOBB(BOPTest_Objects::UseOBB());
+
+  Handle(Draw_ProgressIndicator) aProgress = new Draw_ProgressIndicator(theDI, 1);
+  aBuilder.Perform(aProgress->Start());
+
+  ProcessResult(theDI, theArgv[1]);
+  return 0;
+}
+
+//=======================================================================
+//function : bincadd
+//purpose  :
+//=======================================================================
+Standard_Integer bincadd(Draw_Interpretor& theDI,
+                         Standard_Integer  theArgc,
+                         const char ** theArgv)
+{
+  if (theArgc != 3)
+  {
+    theDI.PrintHelp(theArgv[0]);
+    return 1;
+  }
+
+  TopoDS_Shape aS = DBRep::Get(theArgv[2]);
+  if (aS.IsNull())
+  {
+    theDI << "Error: " << theArgv[2] << " is a null shape.\n";
+    return 1;
+  }
+
+  Handle(Draw_ProgressIndicator) aProgress = new Draw_ProgressIndicator(theDI, 1);
+  getIncrementalBuilder().AddArgument(aS, aProgress->Start());
+
+  ProcessResult(theDI, theArgv[1]);
+  return 0;
+}
+
+//=======================================================================
+//function : bincremove
+//purpose  :
+//=======================================================================
+Standard_Integer bincremove(Draw_Interpretor& theDI,
+                            Standard_Integer  theArgc,
+                            const char ** theArgv)
+{
+  if (theArgc != 3)
+  {
+    theDI.PrintHelp(theArgv[0]);
+    return 1;
+  }
+
+  TopoDS_Shape aS = DBRep::Get(theArgv[2]);
+  if (aS.IsNull())
+  {
+    theDI << "Error: " << theArgv[2] << " is a null shape.\n";
+    return 1;
+  }
+
+  Handle(Draw_ProgressIndicator) aProgress = new Draw_ProgressIndicator(theDI, 1);
+  getIncrementalBuilder().RemoveArgument(aS, aProgress->Start());
+
+  ProcessResult(theDI, theArgv[1]);
+  return 0;
+}
+
+//=======================================================================
+//function : bincreplace
+//purpose  :
+//=======================================================================
+Standard_Integer bincreplace(Draw_Interpretor& theDI,
+                             Standard_Integer  theArgc,
+                             const char ** theArgv)
+{
+  if (theArgc != 4)
+  {
+    theDI.PrintHelp(theArgv[0]);
+    return 1;
+  }
+
+  TopoDS_Shape anOld = DBRep::Get(theArgv[2]);
+  TopoDS_Shape aNew  = DBRep::Get(theArgv[3]);
+  if (anOld.IsNull() || aNew.IsNull())
+  {
+    theDI << "Error: null shapes are given.\n";
+    return 1;
+  }
+
+  Handle(Draw_ProgressIndicator) aProgress = new Draw_ProgressIndicator(theDI, 1);
+  getIncrementalBuilder().ReplaceArgument(anOld, aNew, aProgress->Start());
+
+  ProcessResult(theDI, theArgv[1]);
+  return 0;
+}
@@ -94,6 +94,10 @@ public:
 
   Standard_EXPORT static Standard_Boolean UseOBB();
 
+  Standard_EXPORT static void SetUseIncAllocator(const Standard_Boolean bUse);
+
+  Standard_EXPORT static Standard_Boolean UseIncAllocator();
+
   Standard_EXPORT static void SetUnifyEdges(const Standard_Boolean bUE);
   Standard_EXPORT static Standard_Boolean UnifyEdges();
 
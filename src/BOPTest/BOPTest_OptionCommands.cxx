@@ -28,6 +28,7 @@ static Standard_Integer bGlue(Draw_Interpretor&, Standard_Integer, const char**)
 static Standard_Integer bdrawwarnshapes(Draw_Interpretor&, Standard_Integer, const char**);
 static Standard_Integer bcheckinverted(Draw_Interpretor&, Standard_Integer, const char**);
 static Standard_Integer buseobb(Draw_Interpretor&, Standard_Integer, const char**);
+static Standard_Integer buseincallocator(Draw_Interpretor&, Standard_Integer, const char**);
 static Standard_Integer bsimplify(Draw_Interpretor&, Standard_Integer, const char**);
 
 //=======================================================================
@@ -75,6 +76,11 @@ void BOPTest::OptionCommands(Draw_Interpretor& theCommands)
                              "\t\tUsage: buseobb 0 (off) / 1 (on)",
                   __FILE__, buseobb, g);
 
+  theCommands.Add("buseincallocator", "Enables/disables the usage of the dedicated incremental allocator\n"
+                                      "\t\tfor each run of the BOP API algorithms (bapibop, bapibuild, bapisplit)\n"
+                                      "\t\tUsage: buseincallocator 0 (off) / 1 (on)",
+                  __FILE__, buseincallocator, g);
+
   theCommands.Add("bsimplify", "Enables/Disables the result simplification after BOP\n"
                                "\t\tUsage: bsimplify [-e 0/1] [-f 0/1] [-a tol]\n"
                                "\t\t-e 0/1 - enables/disables edges unification\n"
@@ -134,6 +140,9 @@ Standard_Integer boptions(Draw_Interpretor& di,
   Sprintf(buf, " Use OBB: %s \t\t\t(%s)\n", BOPTest_Objects::UseOBB() ? "Yes" : "No",
                "use \"buseobb\" command to change");
   di << buf;
+  Sprintf(buf, " Use IncAllocator: %s \t\t(%s)\n", BOPTest_Objects::UseIncAllocator() ? "Yes" : "No",
+               "use \"buseincallocator\" command to change");
+  di << buf;
   Sprintf(buf, " Unify Edges: %s \t\t(%s)\n", BOPTest_Objects::UnifyEdges() ? "Yes" : "No",
                "use \"bsimplify -e\" command to change");
   di << buf;
@@ -285,6 +294,25 @@ Standard_Integer buseobb(Draw_Interpretor& di,
   return 0;
 }
 
+//=======================================================================
+//function : buseincallocator
+//purpose  : 
+//=======================================================================
+Standard_Integer buseincallocator(Draw_Interpretor& di,
+                                  Standard_Integer n,
+                                  const char** a)
+{
+  if (n != 2)
+  {
+    di.PrintHelp(a[0]);
+    return 1;
+  }
+
+  Standard_Integer iUse = Draw::Atoi(a[1]);
+  BOPTest_Objects::SetUseIncAllocator(iUse != 0);
+  return 0;
+}
+
 //=======================================================================
 //function : bsimplify
 //purpose  : 
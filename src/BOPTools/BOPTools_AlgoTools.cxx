@@ -43,6 +43,7 @@
 #include <gp_Torus.hxx>
 #include <gp_XYZ.hxx>
 #include <IntTools_Context.hxx>
+#include <IntTools_Predicates.hxx>
 #include <IntTools_Range.hxx>
 #include <IntTools_ShrunkRange.hxx>
 #include <IntTools_Tools.hxx>
@@ -1858,7 +1859,10 @@ Standard_Real AngleWithRef(const gp_Dir& theD1,
     aBeta=2.*M_PI-aHalfPI*(3.+aCosinus);
   }
   //
-  aScPr=aXYZ.Dot(theDRef.XYZ());
+  // The orientation of the directions is defined by the sign of
+  // the triple product, which is computed exactly for the nearly
+  // degenerated cases to get the consistent classification.
+  aScPr=IntTools_Predicates::TripleProduct(aXYZ1, aXYZ2, theDRef.XYZ());
   if (aScPr<0.) {
     aBeta=-aBeta;
   }
@@ -35,6 +35,7 @@
 #include <Precision.hxx>
 #include <ProjLib_ProjectedCurve.hxx>
 #include <ProjLib.hxx>
+#include <ProjLib_ProjectionCache.hxx>
 #include <Standard_ConstructionError.hxx>
 #include <TopExp.hxx>
 #include <TopExp_Explorer.hxx>
@@ -45,6 +46,25 @@
 static
   Standard_Real MaxToleranceEdge (const TopoDS_Face& );
 
+static
+  void MakePCurveOnFaceCached (const TopoDS_Face& aF,
+                               const Handle(Geom_Curve)& aC3D,
+                               const Handle(Geom_Curve)& aC3DKey,
+                               const TopLoc_Location& aLocKey,
+                               const Standard_Real aT1,
+                               const Standard_Real aT2,
+                               Handle(Geom2d_Curve)& aC2D,
+                               Standard_Real& TolReached2d,
+                               const Handle(IntTools_Context)& theContext);
+
+static
+  void ComputePCurveOnFace (const BRepAdaptor_Surface& aBAS,
+                            const Handle(Geom_Curve)& aC3D,
+                            const Standard_Real aT1,
+                            const Standard_Real aT2,
+                            Handle(Geom2d_Curve)& aC2D,
+                            Standard_Real& TolReached2d);
+
 //=======================================================================
 //function : BuildPCurveForEdgeOnFace
 //purpose  : 
@@ -481,7 +501,9 @@ void BOPTools_AlgoTools2D::Make2D (const TopoDS_Edge& aE,
   
   //
   aToler = BRep_Tool::Tolerance(aE);
-  BOPTools_AlgoTools2D::MakePCurveOnFace(aF, C3D2, f3d, l3d, aC2D, aToler, theContext);
+  // the transformed curve is a new object each time, so the original
+  // curve with its location identifies the projection in the cache
+  MakePCurveOnFaceCached(aF, C3D2, C3D, aLoc, f3d, l3d, aC2D, aToler, theContext);
   //
   aFirst = f3d; 
   aLast  = l3d;
@@ -520,6 +542,26 @@ void BOPTools_AlgoTools2D::MakePCurveOnFace
    Handle(Geom2d_Curve)& aC2D,
    Standard_Real& TolReached2d,
    const Handle(IntTools_Context)& theContext)
+{
+  MakePCurveOnFaceCached
+    (aF, aC3D, aC3D, TopLoc_Location(), aT1, aT2, aC2D, TolReached2d, theContext);
+}
+
+//=======================================================================
+//function : MakePCurveOnFaceCached
+//purpose  : Makes the pcurve or takes it from the projection cache
+//           of the context; the curve aC3DKey with location aLocKey is the
+//           curve aC3D identifying the projection in the cache
+//=======================================================================
+void MakePCurveOnFaceCached (const TopoDS_Face& aF,
+                             const Handle(Geom_Curve)& aC3D,
+                             const Handle(Geom_Curve)& aC3DKey,
+                             const TopLoc_Location& aLocKey,
+                             const Standard_Real aT1,
+                             const Standard_Real aT2,
+                             Handle(Geom2d_Curve)& aC2D,
+                             Standard_Real& TolReached2d,
+                             const Handle(IntTools_Context)& theContext)
 {
   BRepAdaptor_Surface aBASTmp;
   const BRepAdaptor_Surface* pBAS;
@@ -531,6 +573,49 @@ void BOPTools_AlgoTools2D::MakePCurveOnFace
     pBAS = &aBASTmp;
   }
   //
+  // the cache is passed by the context to the parallel workers
+  const Handle(ProjLib_ProjectionCache) aCache = !theContext.IsNull() ?
+    theContext->ProjectionCache() : ProjLib_ProjectionCache::Current();
+  if (aCache.IsNull()) {
+    ComputePCurveOnFace(*pBAS, aC3D, aT1, aT2, aC2D, TolReached2d);
+    return;
+  }
+  //
+  // the projection depends on the surface with the bounds of the face
+  // and on the tolerance requested
+  ProjLib_ProjectionCache::Key aKey;
+  aKey.Curve = aC3DKey;
+  aKey.CurveLocation = aLocKey;
+  aKey.Surface = BRep_Tool::Surface(aF, aKey.SurfaceLocation);
+  aKey.First = aT1;
+  aKey.Last = aT2;
+  aKey.UMin = pBAS->FirstUParameter();
+  aKey.UMax = pBAS->LastUParameter();
+  aKey.VMin = pBAS->FirstVParameter();
+  aKey.VMax = pBAS->LastVParameter();
+  aKey.Tolerance = TolReached2d;
+  aKey.ComputeStamps();
+  //
+  if (aCache->Find(aKey, aC2D, TolReached2d)) {
+    return;
+  }
+  //
+  ComputePCurveOnFace(*pBAS, aC3D, aT1, aT2, aC2D, TolReached2d);
+  aCache->Add(aKey, aC2D, TolReached2d);
+}
+
+//=======================================================================
+//function : ComputePCurveOnFace
+//purpose  : 
+//=======================================================================
+void ComputePCurveOnFace (const BRepAdaptor_Surface& aBAS,
+                          const Handle(Geom_Curve)& aC3D,
+                          const Standard_Real aT1,
+                          const Standard_Real aT2,
+                          Handle(Geom2d_Curve)& aC2D,
+                          Standard_Real& TolReached2d)
+{
+  const BRepAdaptor_Surface* pBAS = &aBAS;
   Handle(BRepAdaptor_Surface) aBAHS = new BRepAdaptor_Surface(*pBAS);
   Handle(GeomAdaptor_Curve) aBAHC = new GeomAdaptor_Curve(aC3D, aT1, aT2);
   //
@@ -17,6 +17,7 @@
 
 #include <BVH_Traverse.hxx>
 #include <BVH_BoxSet.hxx>
+#include <BVH_Tools.hxx>
 
 #include <Standard_Integer.hxx>
 #include <algorithm>
@@ -76,9 +77,12 @@ public: //! @name public interfaces
   //! not contain pairs in which IDs are the same (pair (1, 1) will be rejected).
   //! If it is required to have a full vector of pairs even
   //! for the same BVH trees, just keep the false value of this flag.
+  //! The mirrored pairs of nodes are not traversed at all (see BVH_PairTraverse::SetUniquePairs()),
+  //! and the IDs in the selected pairs are kept in the ascending order.
   void SetSame (const Standard_Boolean theIsSame)
   {
     mySameBVHs = theIsSame;
+    this->SetUniquePairs (theIsSame);
   }
 
   //! Returns the list of accepted indices
@@ -96,14 +100,16 @@ public: //! @name Rejection/Acceptance rules
                                        const BVH_VecNd& theCMax2,
                                        Standard_Real&) const Standard_OVERRIDE
   {
-    return BVH_Box<Standard_Real, 3> (theCMin1, theCMax1).IsOut (theCMin2, theCMax2);
+    return !BVH_Tools<Standard_Real, Dimension>::BoxBoxOverlap (theCMin1, theCMax1, theCMin2, theCMax2);
   }
 
   //! Checks if the pair of elements should be rejected.
+  //! The mirrored pairs of elements of the same tree are not given
+  //! by the traverse, thus, only the pairs of the same element are rejected here.
   Standard_Boolean RejectElement (const Standard_Integer theID1,
                                   const Standard_Integer theID2)
   {
-    return (mySameBVHs && theID1 >= theID2) ||
+    return (mySameBVHs && theID1 == theID2) ||
             this->myBVHSet1->Box (theID1).IsOut(
             this->myBVHSet2->Box (theID2));
   }
@@ -114,8 +120,13 @@ public: //! @name Rejection/Acceptance rules
   {
     if (!RejectElement (theID1, theID2))
     {
-      myPairs.push_back (PairIDs (this->myBVHSet1->Element (theID1),
-                                  this->myBVHSet2->Element (theID2)));
+      const Standard_Integer anID1 = this->myBVHSet1->Element (theID1);
+      const Standard_Integer anID2 = this->myBVHSet2->Element (theID2);
+      // For the same trees keep the pair in the ascending order
+      if (mySameBVHs && anID2 < anID1)
+        myPairs.push_back (PairIDs (anID2, anID1));
+      else
+        myPairs.push_back (PairIDs (anID1, anID2));
       return Standard_True;
     }
     return Standard_False;
@@ -20,8 +20,12 @@
 #include <NCollection_DataMap.hxx>
 #include <Standard_Mutex.hxx>
 #include <OSD_Thread.hxx>
+#include <ProjLib_ProjectionCacheScope.hxx>
 
-//! Implementation of Functors/Starters
+//! Implementation of Functors/Starters.
+//! The projection cache of the calling thread (or of the context of the algorithm)
+//! is set as the current one in the threads performing the solvers,
+//! and is passed to the contexts created for these threads.
 class BOPTools_Parallel
 {
   template<class TypeSolverVector>
@@ -29,11 +33,14 @@ class BOPTools_Parallel
   {
   public:
     //! Constructor.
-    explicit Functor(TypeSolverVector& theSolverVec) : mySolvers (theSolverVec) {}
+    explicit Functor(TypeSolverVector& theSolverVec)
+    : mySolvers (theSolverVec),
+      myProjectionCache (ProjLib_ProjectionCache::Current()) {}
 
     //! Defines functor interface.
     void operator() (const Standard_Integer theIndex) const
     {
+      ProjLib_ProjectionCacheScope aCacheScope (myProjectionCache);
       typename TypeSolverVector::value_type& aSolver = mySolvers[theIndex];
       aSolver.Perform();
     }
@@ -44,6 +51,7 @@ class BOPTools_Parallel
 
   private:
     TypeSolverVector& mySolvers;
+    Handle(ProjLib_ProjectionCache) myProjectionCache;
   };
 
   //! Functor storing map of thread id -> algorithm context
@@ -72,12 +80,18 @@ class BOPTools_Parallel
   public:
 
     //! Constructor
-    explicit ContextFunctor (TypeSolverVector& theVector) : mySolverVector(theVector) {}
+    explicit ContextFunctor (TypeSolverVector& theVector)
+    : mySolverVector(theVector),
+      myProjectionCache (ProjLib_ProjectionCache::Current()) {}
 
     //! Binds main thread context
     void SetContext (const opencascade::handle<TypeContext>& theContext)
     {
       myContextMap.Bind (OSD_Thread::Current(), theContext);
+      if (!theContext.IsNull())
+      {
+        myProjectionCache = theContext->ProjectionCache();
+      }
     }
 
     //! Returns current thread context
@@ -94,6 +108,7 @@ class BOPTools_Parallel
 
       // Create new context
       opencascade::handle<TypeContext> aContext = new TypeContext (NCollection_BaseAllocator::CommonBaseAllocator());
+      aContext->SetProjectionCache (myProjectionCache);
 
       Standard_Mutex::Sentry aLocker (myMutex);
       myContextMap.Bind (aThreadID, aContext);
@@ -104,6 +119,7 @@ class BOPTools_Parallel
     void operator()( const Standard_Integer theIndex ) const
     {
       const opencascade::handle<TypeContext>& aContext = GetThreadContext();
+      ProjLib_ProjectionCacheScope aCacheScope (aContext->ProjectionCache());
       typename TypeSolverVector::value_type& aSolver = mySolverVector[theIndex];
 
       aSolver.SetContext(aContext);
@@ -118,6 +134,7 @@ class BOPTools_Parallel
     TypeSolverVector& mySolverVector;
     mutable NCollection_DataMap<Standard_ThreadId, opencascade::handle<TypeContext>, Hasher> myContextMap;
     mutable Standard_Mutex myMutex;
+    Handle(ProjLib_ProjectionCache) myProjectionCache;
   };
 
   //! Functor storing array of algorithm contexts per thread in pool
@@ -129,12 +146,17 @@ class BOPTools_Parallel
     //! Constructor
     explicit ContextFunctor2 (TypeSolverVector& theVector, const OSD_ThreadPool::Launcher& thePoolLauncher)
     : mySolverVector(theVector),
-      myContextArray (thePoolLauncher.LowerThreadIndex(), thePoolLauncher.UpperThreadIndex()) {}
+      myContextArray (thePoolLauncher.LowerThreadIndex(), thePoolLauncher.UpperThreadIndex()),
+      myProjectionCache (ProjLib_ProjectionCache::Current()) {}
 
     //! Binds main thread context
     void SetContext (const opencascade::handle<TypeContext>& theContext)
     {
       myContextArray.ChangeLast() = theContext; // OSD_ThreadPool::Launcher::UpperThreadIndex() is reserved for a main thread
+      if (!theContext.IsNull())
+      {
+        myProjectionCache = theContext->ProjectionCache();
+      }
     }
 
     //! Defines functor interface with serialized thread index.
@@ -145,7 +167,9 @@ class BOPTools_Parallel
       if (aContext.IsNull())
       {
         aContext = new TypeContext (NCollection_BaseAllocator::CommonBaseAllocator());
+        aContext->SetProjectionCache (myProjectionCache);
       }
+      ProjLib_ProjectionCacheScope aCacheScope (aContext->ProjectionCache());
       typename TypeSolverVector::value_type& aSolver = mySolverVector[theIndex];
       aSolver.SetContext (aContext);
       aSolver.Perform();
@@ -158,6 +182,7 @@ class BOPTools_Parallel
   private:
     TypeSolverVector& mySolverVector;
     mutable NCollection_Array1< opencascade::handle<TypeContext> > myContextArray;
+    Handle(ProjLib_ProjectionCache) myProjectionCache;
   };
 
 public:
@@ -48,6 +48,7 @@
 #include <Poly_Triangulation.hxx>
 #include <Precision.hxx>
 #include <ProjLib_ProjectedCurve.hxx>
+#include <ProjLib_ProjectionCache.hxx>
 #include <Standard_NoSuchObject.hxx>
 #include <Standard_NullObject.hxx>
 #include <TopExp.hxx>
@@ -379,6 +380,28 @@ Handle(Geom2d_Curve) BRep_Tool::CurveOnPlane(const TopoDS_Edge& E,
   aCurveLocation = aCurveLocation.Predivided(L);
   First = f; Last = l;
 
+  // Check the pcurve computed earlier in the scope of the projection cache;
+  // the negative tolerance distinguishes the projections onto the plane
+  const Handle(ProjLib_ProjectionCache) aCache = ProjLib_ProjectionCache::Current();
+  ProjLib_ProjectionCache::Key aCacheKey;
+  if (!aCache.IsNull())
+  {
+    aCacheKey.Curve         = C3D;
+    aCacheKey.CurveLocation = aCurveLocation;
+    aCacheKey.Surface       = GP;
+    aCacheKey.First         = f;
+    aCacheKey.Last          = l;
+    aCacheKey.Tolerance     = -1.0;
+    aCacheKey.ComputeStamps();
+
+    Handle(Geom2d_Curve) aCachedPC;
+    Standard_Real aTol = 0.0;
+    if (aCache->Find (aCacheKey, aCachedPC, aTol))
+    {
+      return aCachedPC;
+    }
+  }
+
   // Transform curve and update parameters in account of scale factor
   if (!aCurveLocation.IsIdentity())
   {
@@ -406,6 +429,10 @@ Handle(Geom2d_Curve) BRep_Tool::CurveOnPlane(const TopoDS_Edge& E,
     pc = TC->BasisCurve();
   }
 
+  if (!aCache.IsNull())
+  {
+    aCache->Add (aCacheKey, pc, 0.0);
+  }
   return pc;
 }
 
@@ -277,6 +277,136 @@ void  BRepAdaptor_Surface::D2(const Standard_Real U,
   D2UV.Transform(myTrsf);
 }
 
+//=======================================================================
+//function : D0Grid
+//purpose  : 
+//=======================================================================
+
+void BRepAdaptor_Surface::D0Grid (const TColStd_Array1OfReal& theU,
+                                  const TColStd_Array1OfReal& theV,
+                                  TColgp_Array2OfPnt& thePoints) const
+{
+  mySurf.D0Grid (theU, theV, thePoints);
+  for (Standard_Integer anUIter = theU.Lower(); anUIter <= theU.Upper(); ++anUIter)
+  {
+    for (Standard_Integer aVIter = theV.Lower(); aVIter <= theV.Upper(); ++aVIter)
+    {
+      thePoints.ChangeValue (anUIter, aVIter).Transform (myTrsf);
+    }
+  }
+}
+
+//=======================================================================
+//function : D1Grid
+//purpose  : 
+//=======================================================================
+
+void BRepAdaptor_Surface::D1Grid (const TColStd_Array1OfReal& theU,
+                                  const TColStd_Array1OfReal& theV,
+                                  TColgp_Array2OfPnt& thePoints,
+                                  TColgp_Array2OfVec& theD1U,
+                                  TColgp_Array2OfVec& theD1V) const
+{
+  mySurf.D1Grid (theU, theV, thePoints, theD1U, theD1V);
+  for (Standard_Integer anUIter = theU.Lower(); anUIter <= theU.Upper(); ++anUIter)
+  {
+    for (Standard_Integer aVIter = theV.Lower(); aVIter <= theV.Upper(); ++aVIter)
+    {
+      thePoints.ChangeValue (anUIter, aVIter).Transform (myTrsf);
+      theD1U   .ChangeValue (anUIter, aVIter).Transform (myTrsf);
+      theD1V   .ChangeValue (anUIter, aVIter).Transform (myTrsf);
+    }
+  }
+}
+
+//=======================================================================
+//function : D2Grid
+//purpose  : 
+//=======================================================================
+
+void BRepAdaptor_Surface::D2Grid (const TColStd_Array1OfReal& theU,
+                                  const TColStd_Array1OfReal& theV,
+                                  TColgp_Array2OfPnt& thePoints,
+                                  TColgp_Array2OfVec& theD1U,
+                                  TColgp_Array2OfVec& theD1V,
+                                  TColgp_Array2OfVec& theD2U,
+                                  TColgp_Array2OfVec& theD2V,
+                                  TColgp_Array2OfVec& theD2UV) const
+{
+  mySurf.D2Grid (theU, theV, thePoints, theD1U, theD1V, theD2U, theD2V, theD2UV);
+  for (Standard_Integer anUIter = theU.Lower(); anUIter <= theU.Upper(); ++anUIter)
+  {
+    for (Standard_Integer aVIter = theV.Lower(); aVIter <= theV.Upper(); ++aVIter)
+    {
+      thePoints.ChangeValue (anUIter, aVIter).Transform (myTrsf);
+      theD1U   .ChangeValue (anUIter, aVIter).Transform (myTrsf);
+      theD1V   .ChangeValue (anUIter, aVIter).Transform (myTrsf);
+      theD2U   .ChangeValue (anUIter, aVIter).Transform (myTrsf);
+      theD2V   .ChangeValue (anUIter, aVIter).Transform (myTrsf);
+      theD2UV  .ChangeValue (anUIter, aVIter).Transform (myTrsf);
+    }
+  }
+}
+
+//=======================================================================
+//function : D0Array
+//purpose  : 
+//=======================================================================
+
+void BRepAdaptor_Surface::D0Array (const TColgp_Array1OfPnt2d& theUV,
+                                   TColgp_Array1OfPnt& thePoints) const
+{
+  mySurf.D0Array (theUV, thePoints);
+  for (Standard_Integer anIter = theUV.Lower(); anIter <= theUV.Upper(); ++anIter)
+  {
+    thePoints.ChangeValue (anIter).Transform (myTrsf);
+  }
+}
+
+//=======================================================================
+//function : D1Array
+//purpose  : 
+//=======================================================================
+
+void BRepAdaptor_Surface::D1Array (const TColgp_Array1OfPnt2d& theUV,
+                                   TColgp_Array1OfPnt& thePoints,
+                                   TColgp_Array1OfVec& theD1U,
+                                   TColgp_Array1OfVec& theD1V) const
+{
+  mySurf.D1Array (theUV, thePoints, theD1U, theD1V);
+  for (Standard_Integer anIter = theUV.Lower(); anIter <= theUV.Upper(); ++anIter)
+  {
+    thePoints.ChangeValue (anIter).Transform (myTrsf);
+    theD1U   .ChangeValue (anIter).Transform (myTrsf);
+    theD1V   .ChangeValue (anIter).Transform (myTrsf);
+  }
+}
+
+//=======================================================================
+//function : D2Array
+//purpose  : 
+//=======================================================================
+
+void BRepAdaptor_Surface::D2Array (const TColgp_Array1OfPnt2d& theUV,
+                                   TColgp_Array1OfPnt& thePoints,
+                                   TColgp_Array1OfVec& theD1U,
+                                   TColgp_Array1OfVec& theD1V,
+                                   TColgp_Array1OfVec& theD2U,
+                                   TColgp_Array1OfVec& theD2V,
+                                   TColgp_Array1OfVec& theD2UV) const
+{
+  mySurf.D2Array (theUV, thePoints, theD1U, theD1V, theD2U, theD2V, theD2UV);
+  for (Standard_Integer anIter = theUV.Lower(); anIter <= theUV.Upper(); ++anIter)
+  {
+    thePoints.ChangeValue (anIter).Transform (myTrsf);
+    theD1U   .ChangeValue (anIter).Transform (myTrsf);
+    theD1V   .ChangeValue (anIter).Transform (myTrsf);
+    theD2U   .ChangeValue (anIter).Transform (myTrsf);
+    theD2V   .ChangeValue (anIter).Transform (myTrsf);
+    theD2UV  .ChangeValue (anIter).Transform (myTrsf);
+  }
+}
+
 //=======================================================================
 //function : D3
 //purpose  : 
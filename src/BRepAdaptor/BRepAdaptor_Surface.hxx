@@ -164,6 +164,47 @@ public:
   //! Raised  if   the   continuity   of the current
   //! intervals is not C3.
   Standard_EXPORT void D3 (const Standard_Real U, const Standard_Real V, gp_Pnt& P, gp_Vec& D1U, gp_Vec& D1V, gp_Vec& D2U, gp_Vec& D2V, gp_Vec& D2UV, gp_Vec& D3U, gp_Vec& D3V, gp_Vec& D3UUV, gp_Vec& D3UVV) const Standard_OVERRIDE;
+
+  //! Computes the points on the grid of parameters, see Adaptor3d_Surface::D0Grid().
+  Standard_EXPORT virtual void D0Grid (const TColStd_Array1OfReal& theU,
+                                       const TColStd_Array1OfReal& theV,
+                                       TColgp_Array2OfPnt& thePoints) const Standard_OVERRIDE;
+
+  //! Computes the points and the first derivatives on the grid of parameters.
+  Standard_EXPORT virtual void D1Grid (const TColStd_Array1OfReal& theU,
+                                       const TColStd_Array1OfReal& theV,
+                                       TColgp_Array2OfPnt& thePoints,
+                                       TColgp_Array2OfVec& theD1U,
+                                       TColgp_Array2OfVec& theD1V) const Standard_OVERRIDE;
+
+  //! Computes the points, the first and the second derivatives on the grid of parameters.
+  Standard_EXPORT virtual void D2Grid (const TColStd_Array1OfReal& theU,
+                                       const TColStd_Array1OfReal& theV,
+                                       TColgp_Array2OfPnt& thePoints,
+                                       TColgp_Array2OfVec& theD1U,
+                                       TColgp_Array2OfVec& theD1V,
+                                       TColgp_Array2OfVec& theD2U,
+                                       TColgp_Array2OfVec& theD2V,
+                                       TColgp_Array2OfVec& theD2UV) const Standard_OVERRIDE;
+
+  //! Computes the points of the array of scattered parameters, see Adaptor3d_Surface::D0Array().
+  Standard_EXPORT virtual void D0Array (const TColgp_Array1OfPnt2d& theUV,
+                                        TColgp_Array1OfPnt& thePoints) const Standard_OVERRIDE;
+
+  //! Computes the points and the first derivatives of the array of scattered parameters.
+  Standard_EXPORT virtual void D1Array (const TColgp_Array1OfPnt2d& theUV,
+                                        TColgp_Array1OfPnt& thePoints,
+                                        TColgp_Array1OfVec& theD1U,
+                                        TColgp_Array1OfVec& theD1V) const Standard_OVERRIDE;
+
+  //! Computes the points, the first and the second derivatives of the array of scattered parameters.
+  Standard_EXPORT virtual void D2Array (const TColgp_Array1OfPnt2d& theUV,
+                                        TColgp_Array1OfPnt& thePoints,
+                                        TColgp_Array1OfVec& theD1U,
+                                        TColgp_Array1OfVec& theD1V,
+                                        TColgp_Array1OfVec& theD2U,
+                                        TColgp_Array1OfVec& theD2V,
+                                        TColgp_Array1OfVec& theD2UV) const Standard_OVERRIDE;
   
   //! Computes the derivative of order Nu in the direction
   //! U and Nv in the direction V at the point P(U, V).
@@ -15,6 +15,7 @@
 
 #include <BRepAlgoAPI_Algo.hxx>
 #include <NCollection_BaseAllocator.hxx>
+#include <NCollection_IncAllocator.hxx>
 #include <TopoDS_Shape.hxx>
 
 //=======================================================================
@@ -23,7 +24,8 @@
 //=======================================================================
 BRepAlgoAPI_Algo::BRepAlgoAPI_Algo()
 :
-  BOPAlgo_Options(NCollection_BaseAllocator::CommonBaseAllocator())
+  BOPAlgo_Options(NCollection_BaseAllocator::CommonBaseAllocator()),
+  myUseIncAllocator(Standard_False)
 {}
 //=======================================================================
 // function: 
@@ -32,7 +34,8 @@ BRepAlgoAPI_Algo::BRepAlgoAPI_Algo()
 BRepAlgoAPI_Algo::BRepAlgoAPI_Algo
   (const Handle(NCollection_BaseAllocator)& theAllocator)
 :
-  BOPAlgo_Options(theAllocator)
+  BOPAlgo_Options(theAllocator),
+  myUseIncAllocator(Standard_False)
 {}
 
 //=======================================================================
@@ -50,3 +53,22 @@ const TopoDS_Shape& BRepAlgoAPI_Algo::Shape()
 {
   return myShape;
 }
+//=======================================================================
+//function : PrepareAllocator
+//purpose  : 
+//=======================================================================
+void BRepAlgoAPI_Algo::PrepareAllocator()
+{
+  if (myUseIncAllocator)
+  {
+    // The previous allocator (if not used anymore) is destroyed
+    // here together with all the memory of the previous run
+    Handle(NCollection_IncAllocator) anAlloc = new NCollection_IncAllocator;
+    anAlloc->SetThreadSafe (myRunParallel);
+    myAllocator = anAlloc;
+  }
+  else if (!Handle(NCollection_IncAllocator)::DownCast (myAllocator).IsNull())
+  {
+    myAllocator = NCollection_BaseAllocator::CommonBaseAllocator();
+  }
+}
@@ -54,6 +54,26 @@ public:
   using BOPAlgo_Options::ClearWarnings;
   using BOPAlgo_Options::GetReport;
   using BOPAlgo_Options::SetUseOBB;
+  using BOPAlgo_Options::AllocatedMemSize;
+
+  //! Enables/Disables the usage of the dedicated incremental allocator
+  //! (NCollection_IncAllocator) for each run of the operation.
+  //! All data structures of the operation are allocated in this allocator
+  //! avoiding the contention on the global memory manager when several
+  //! operations are performed concurrently. The memory is released at once
+  //! on the next run of the operation or on destruction of the algorithm.
+  //! The peak memory of the run is available via AllocatedMemSize() method.
+  //! Disabled by default.
+  void SetUseIncAllocator (const Standard_Boolean theToUse)
+  {
+    myUseIncAllocator = theToUse;
+  }
+
+  //! Returns the flag defining the usage of the dedicated incremental allocator.
+  Standard_Boolean UseIncAllocator() const
+  {
+    return myUseIncAllocator;
+  }
 
 protected:
 
@@ -66,6 +86,16 @@ protected:
   //! Empty constructor
   Standard_EXPORT BRepAlgoAPI_Algo(const Handle(NCollection_BaseAllocator)& theAllocator);
 
+  //! Prepares the allocator for the new run of the operation.
+  //! In case of usage of the incremental allocator replaces it with the new one,
+  //! releasing the memory of the previous run. Should be called after
+  //! destruction of all tools of the previous run.
+  Standard_EXPORT void PrepareAllocator();
+
+protected:
+
+  Standard_Boolean myUseIncAllocator; //!< Flag defining the usage of the dedicated incremental allocator
+
 private:
 
 };
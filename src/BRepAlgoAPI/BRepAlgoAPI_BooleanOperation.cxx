@@ -144,6 +144,8 @@ void BRepAlgoAPI_BooleanOperation::Build(const Message_ProgressRange& theRange)
   NotDone();
   // Clear from previous runs
   Clear();
+  // Release the memory of the previous run
+  PrepareAllocator();
   // Check for availability of arguments and tools
   // Both should be present
   if (myArguments.IsEmpty() || myTools.IsEmpty())
@@ -93,6 +93,8 @@ void BRepAlgoAPI_BuilderAlgo::Build(const Message_ProgressRange& theRange)
   NotDone();
   // Destroy the tools if necessary
   Clear();
+  // Release the memory of the previous run
+  PrepareAllocator();
   Message_ProgressScope aPS(theRange, "Performing General Fuse operation", 100);
   // If necessary perform intersection of the argument shapes
   IntersectShapes(myArguments, aPS.Next(70));
@@ -28,7 +28,8 @@ BRepAlgoAPI_Check::BRepAlgoAPI_Check()
   BOPAlgo_Options(),
   myTestSE(Standard_True),
   myTestSI(Standard_True),
-  myOperation(BOPAlgo_UNKNOWN)
+  myOperation(BOPAlgo_UNKNOWN),
+  myMaxNbSI(0)
 {
 }
 
@@ -45,7 +46,8 @@ BRepAlgoAPI_Check::BRepAlgoAPI_Check(const TopoDS_Shape& theS,
   myS1(theS),
   myTestSE(bTestSE),
   myTestSI(bTestSI),
-  myOperation(BOPAlgo_UNKNOWN)
+  myOperation(BOPAlgo_UNKNOWN),
+  myMaxNbSI(0)
 {
   Perform(theRange);
 }
@@ -66,7 +68,8 @@ BRepAlgoAPI_Check::BRepAlgoAPI_Check(const TopoDS_Shape& theS1,
   myS2(theS2),
   myTestSE(bTestSE),
   myTestSI(bTestSI),
-  myOperation(theOp)
+  myOperation(theOp),
+  myMaxNbSI(0)
 {
   Perform(theRange);
 }
@@ -94,6 +97,7 @@ void BRepAlgoAPI_Check::Perform(const Message_ProgressRange& theRange)
   anAnalyzer.ArgumentTypeMode() = Standard_True;
   anAnalyzer.SmallEdgeMode() = myTestSE;
   anAnalyzer.SelfInterMode() = myTestSI;
+  anAnalyzer.MaxNbSelfInterferences() = myMaxNbSI;
   // Set options from BOPAlgo_Options
   anAnalyzer.SetRunParallel(myRunParallel);
   anAnalyzer.SetFuzzyValue(myFuzzyValue);
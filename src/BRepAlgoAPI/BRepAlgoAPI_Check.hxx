@@ -141,6 +141,25 @@ public: //! @name Initializing the algorithm
   }
 
 
+public: //! @name Options
+
+  //! Sets the maximal number of self-interferences to look for in each shape.
+  //! When the given number of interfering pairs of sub-shapes is found
+  //! the rest of the self-interference check is skipped.
+  //! The value 1 is enough to answer whether the shape is self-interfered or not.
+  //! Zero or negative value means that all self-interferences are looked for (default).
+  void SetMaxNbSelfInterferences (const Standard_Integer theNbSI)
+  {
+    myMaxNbSI = theNbSI;
+  }
+
+  //! Returns the maximal number of self-interferences to look for in each shape.
+  Standard_Integer MaxNbSelfInterferences() const
+  {
+    return myMaxNbSI;
+  }
+
+
 public: //! @name Performing the operation
 
   //! Performs the check.
@@ -170,6 +189,7 @@ protected: //! @name Fields
   Standard_Boolean myTestSE;                //!< Flag defining whether to look for small edges in the given shapes or not
   Standard_Boolean myTestSI;                //!< Flag defining whether to check the input edges on self-interference or not
   BOPAlgo_Operation myOperation;            //!< Type of Boolean operation for which the validity of input shapes should be checked
+  Standard_Integer myMaxNbSI;               //!< Maximal number of self-interferences to look for in each shape
 
   // Results
   BOPAlgo_ListOfCheckResult myFaultyShapes; //!< Found faulty shapes
@@ -41,6 +41,8 @@ void BRepAlgoAPI_Splitter::Build(const Message_ProgressRange& theRange)
   NotDone();
   // Clear the contents
   Clear();
+  // Release the memory of the previous run
+  PrepareAllocator();
   // Check for availability of arguments and tools
   if (myArguments.IsEmpty() ||
      (myArguments.Extent() + myTools.Extent()) < 2)
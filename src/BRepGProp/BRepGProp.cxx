@@ -27,6 +27,8 @@
 #include <BRep_Tool.hxx>  
 #include <TopTools_MapOfShape.hxx>
 #include <BRepCheck_Shell.hxx>
+#include <NCollection_Vector.hxx>
+#include <OSD_Parallel.hxx>
 
 #ifdef OCCT_DEBUG
 static Standard_Integer AffichEps = 0;
@@ -110,22 +112,147 @@ void  BRepGProp::LinearProperties(const TopoDS_Shape& S, GProp_GProps& SProps, c
   }
 }
 
-static Standard_Real surfaceProperties(const TopoDS_Shape& S, GProp_GProps& Props, const Standard_Real Eps, const Standard_Boolean SkipShared,
-                                       const Standard_Boolean UseTriangulation)
+namespace
+{
+  //! Face of the shape and its global properties.
+  struct FaceProps
+  {
+    TopoDS_Face      Face;      //!< face to be computed
+    Standard_Integer Index;     //!< index of the face in the explorer of the shape
+    Standard_Boolean ToUseMesh; //!< flag to compute the properties by the triangulation of the face
+    GProp_GProps     Props;     //!< computed properties of the face
+    Standard_Real    Error;     //!< reached error of the adaptive integration
+
+    FaceProps() : Index (0), ToUseMesh (Standard_False), Error (0.0) {}
+  };
+
+  //! Computes the surface or volume properties of the faces.
+  //! Each face is computed by its own integration tools, so that
+  //! the faces may be processed in parallel threads.
+  class FacePropsFunctor
+  {
+  public:
+
+    FacePropsFunctor (NCollection_Vector<FaceProps>& theFaces,
+                      const gp_Pnt&                  theLocation,
+                      const Standard_Real            theEps,
+                      const Standard_Boolean         theIsVolume)
+    : myFaces (theFaces),
+      myLocation (theLocation),
+      myEps (theEps),
+      myIsVolume (theIsVolume) {}
+
+    void operator() (const Standard_Integer theIndex) const
+    {
+      FaceProps& aFaceProps = myFaces.ChangeValue (theIndex);
+      const TopoDS_Face& aFace = aFaceProps.Face;
+      if (aFaceProps.ToUseMesh)
+      {
+        BRepGProp_MeshProps aMeshProps (myIsVolume ? BRepGProp_MeshProps::Vinert : BRepGProp_MeshProps::Sinert);
+        aMeshProps.SetLocation (myLocation);
+        TopLoc_Location aLoc;
+        const Handle(Poly_Triangulation)& aTri = BRep_Tool::Triangulation (aFace, aLoc);
+        aMeshProps.Perform (aTri, aLoc, aFace.Orientation());
+        aFaceProps.Props = aMeshProps;
+        return;
+      }
+
+      if (myIsVolume)
+      {
+        BRepGProp_Vinert aProps;
+        perform (aProps, aFaceProps);
+      }
+      else
+      {
+        BRepGProp_Sinert aProps;
+        perform (aProps, aFaceProps);
+      }
+    }
+
+  private:
+
+    //! Computes the properties of the face by the Gauss integration.
+    template<class TheInertia>
+    void perform (TheInertia& theProps, FaceProps& theFaceProps) const
+    {
+      const TopoDS_Face& aFace = theFaceProps.Face;
+      BRepGProp_Face   aPropFace;
+      BRepGProp_Domain aPropDomain;
+      theProps.SetLocation (myLocation);
+      aPropFace.Load (aFace);
+      const Standard_Boolean isNatRestr = (aFace.NbChildren() == 0);
+      if (!isNatRestr) aPropDomain.Init (aFace);
+      if (myEps < 1.0)
+      {
+        theProps.Perform (aPropFace, aPropDomain, myEps);
+        theFaceProps.Error = theProps.GetEpsilon();
+      }
+      else
+      {
+        if (isNatRestr) theProps.Perform (aPropFace);
+        else theProps.Perform (aPropFace, aPropDomain);
+      }
+      theFaceProps.Props = theProps;
+    }
+
+  private:
+    FacePropsFunctor (const FacePropsFunctor&);
+    FacePropsFunctor& operator= (const FacePropsFunctor&);
+
+  private:
+    NCollection_Vector<FaceProps>& myFaces;
+    const gp_Pnt                   myLocation;
+    const Standard_Real            myEps;
+    const Standard_Boolean         myIsVolume;
+  };
+}
+
+//=======================================================================
+//function : facesProperties
+//purpose  : Computes the properties of the collected faces and adds them
+//           to <Props> in the order of the faces, so that the result
+//           does not depend on the number of threads.
+//=======================================================================
+
+static Standard_Real facesProperties(NCollection_Vector<FaceProps>& theFaces, GProp_GProps& Props, const gp_Pnt& P,
+                                     const Standard_Real Eps, const Standard_Boolean theIsVolume,
+                                     const Standard_Boolean theToRunParallel)
 {
-  Standard_Integer i;
 #ifdef OCCT_DEBUG
   Standard_Integer iErrorMax = 0;
 #endif
-  Standard_Real ErrorMax = 0.0, Error;
+  Standard_Real ErrorMax = 0.0;
+  FacePropsFunctor aFunctor(theFaces, P, Eps, theIsVolume);
+  OSD_Parallel::For(0, theFaces.Length(), aFunctor, !theToRunParallel || theFaces.Length() < 2);
+
+  for (NCollection_Vector<FaceProps>::Iterator anIt(theFaces); anIt.More(); anIt.Next()) {
+    const FaceProps& aFaceProps = anIt.Value();
+    Props.Add(aFaceProps.Props);
+    if (aFaceProps.ToUseMesh) continue;
+    if (Eps < 1.0 && ErrorMax < aFaceProps.Error) {
+      ErrorMax = aFaceProps.Error;
+#ifdef OCCT_DEBUG
+      iErrorMax = aFaceProps.Index;
+#endif
+    }
+#ifdef OCCT_DEBUG
+    if(AffichEps) std::cout<<"\n"<<aFaceProps.Index<<(theIsVolume ? ":\tEpsVolume = " : ":\tEpsArea = ")<< aFaceProps.Error;
+#endif
+  }
+#ifdef OCCT_DEBUG
+  if(AffichEps) std::cout<<"\n-----------------\n"<<iErrorMax<<":\tMaxError = "<<ErrorMax<<"\n";
+#endif
+  return ErrorMax;
+}
+
+static Standard_Real surfaceProperties(const TopoDS_Shape& S, GProp_GProps& Props, const Standard_Real Eps, const Standard_Boolean SkipShared,
+                                       const Standard_Boolean UseTriangulation, const Standard_Boolean theToRunParallel)
+{
+  Standard_Integer i;
   TopExp_Explorer ex; 
   gp_Pnt P(roughBaryCenter(S));
-  BRepGProp_Sinert G;  G.SetLocation(P);
-  BRepGProp_MeshProps MG(BRepGProp_MeshProps::Sinert);  
-  MG.SetLocation(P);
 
-  BRepGProp_Face   BF;
-  BRepGProp_Domain BD;
+  NCollection_Vector<FaceProps> aFaces;
   TopTools_MapOfShape aFMap;
   TopLoc_Location aLocDummy;
 
@@ -154,57 +281,28 @@ static Standard_Real surfaceProperties(const TopoDS_Shape& S, GProp_GProps& Prop
       }
     }
 
-    if ((UseTriangulation && !NoTri) || (NoSurf && !NoTri))
-    {
-      TopAbs_Orientation anOri = F.Orientation();
-      const Handle(Poly_Triangulation)& aTri = BRep_Tool::Triangulation(F, aLocDummy);
-      MG.Perform(aTri, aLocDummy, anOri);
-      Props.Add(MG);
-    }
-    else
-    {
-      BF.Load(F);
-      Standard_Boolean IsNatRestr = (F.NbChildren() == 0);
-      if (!IsNatRestr) BD.Init(F);
-      if (Eps < 1.0) {
-        G.Perform(BF, BD, Eps);
-        Error = G.GetEpsilon();
-        if (ErrorMax < Error) {
-          ErrorMax = Error;
-#ifdef OCCT_DEBUG
-          iErrorMax = i;
-#endif
-        }
-      }
-      else {
-        if (IsNatRestr) G.Perform(BF);
-        else G.Perform(BF, BD);
-      }
-      Props.Add(G);
-#ifdef OCCT_DEBUG
-      if(AffichEps) std::cout<<"\n"<<i<<":\tEpsArea = "<< G.GetEpsilon();
-#endif
-    }
+    FaceProps& aFaceProps = aFaces.Appended();
+    aFaceProps.Face      = F;
+    aFaceProps.Index     = i;
+    aFaceProps.ToUseMesh = (UseTriangulation && !NoTri) || (NoSurf && !NoTri);
   }
-#ifdef OCCT_DEBUG
-  if(AffichEps) std::cout<<"\n-----------------\n"<<iErrorMax<<":\tMaxError = "<<ErrorMax<<"\n";
-#endif
-  return ErrorMax;
+  return facesProperties(aFaces, Props, P, Eps, Standard_False, theToRunParallel);
 }
 void  BRepGProp::SurfaceProperties(const TopoDS_Shape& S, GProp_GProps& Props, const Standard_Boolean SkipShared,
-                                   const Standard_Boolean UseTriangulation)
+                                   const Standard_Boolean UseTriangulation, const Standard_Boolean theToRunParallel)
 {
   // find the origin
   gp_Pnt P(0,0,0);
   P.Transform(S.Location());
   Props = GProp_GProps(P);
-  surfaceProperties(S,Props,1.0, SkipShared, UseTriangulation);
+  surfaceProperties(S,Props,1.0, SkipShared, UseTriangulation, theToRunParallel);
 }
-Standard_Real BRepGProp::SurfaceProperties(const TopoDS_Shape& S, GProp_GProps& Props, const Standard_Real Eps, const Standard_Boolean SkipShared){ 
+Standard_Real BRepGProp::SurfaceProperties(const TopoDS_Shape& S, GProp_GProps& Props, const Standard_Real Eps, const Standard_Boolean SkipShared,
+                                           const Standard_Boolean theToRunParallel){ 
   // find the origin
   gp_Pnt P(0,0,0);  P.Transform(S.Location());
   Props = GProp_GProps(P);
-  Standard_Real ErrorMax = surfaceProperties(S,Props,Eps,SkipShared, Standard_False);
+  Standard_Real ErrorMax = surfaceProperties(S,Props,Eps,SkipShared, Standard_False, theToRunParallel);
   return ErrorMax;
 }
 
@@ -214,21 +312,13 @@ Standard_Real BRepGProp::SurfaceProperties(const TopoDS_Shape& S, GProp_GProps&
 //=======================================================================
 
 static Standard_Real volumeProperties(const TopoDS_Shape& S, GProp_GProps& Props, const Standard_Real Eps, const Standard_Boolean SkipShared,
-                                      const Standard_Boolean UseTriangulation)
+                                      const Standard_Boolean UseTriangulation, const Standard_Boolean theToRunParallel)
 {
   Standard_Integer i;
-#ifdef OCCT_DEBUG
-  Standard_Integer iErrorMax = 0;
-#endif
-  Standard_Real ErrorMax = 0.0, Error = 0.0;
   TopExp_Explorer ex; 
   gp_Pnt P(roughBaryCenter(S)); 
-  BRepGProp_Vinert G;  G.SetLocation(P);
-  BRepGProp_MeshProps MG(BRepGProp_MeshProps::Vinert);
-  MG.SetLocation(P);
 
-  BRepGProp_Face   BF;
-  BRepGProp_Domain BD;
+  NCollection_Vector<FaceProps> aFaces;
   TopTools_MapOfShape aFwdFMap;
   TopTools_MapOfShape aRvsFMap;
   TopLoc_Location aLocDummy;
@@ -269,45 +359,16 @@ static Standard_Real volumeProperties(const TopoDS_Shape& S, GProp_GProps& Props
 
     if (isFwd || isRvs)
     {
-      if ((UseTriangulation && !NoTri) || (NoSurf && !NoTri))
-      {
-        const Handle(Poly_Triangulation)& aTri = BRep_Tool::Triangulation(F, aLocDummy);
-        MG.Perform(aTri, aLocDummy, anOri);
-        Props.Add(MG);
-      }
-      else
-      {
-        BF.Load(F);
-        Standard_Boolean IsNatRestr = (F.NbChildren () == 0);
-        if (!IsNatRestr) BD.Init(F);
-        if (Eps < 1.0) {
-          G.Perform(BF, BD, Eps);
-          Error = G.GetEpsilon();
-          if (ErrorMax < Error) {
-            ErrorMax = Error;
-#ifdef OCCT_DEBUG
-            iErrorMax = i;
-#endif
-          }
-        }
-        else {
-          if (IsNatRestr) G.Perform(BF);
-          else G.Perform(BF, BD);
-        }
-        Props.Add(G);
-#ifdef OCCT_DEBUG
-        if(AffichEps) std::cout<<"\n"<<i<<":\tEpsVolume = "<< G.GetEpsilon();
-#endif
-      }
+      FaceProps& aFaceProps = aFaces.Appended();
+      aFaceProps.Face      = F;
+      aFaceProps.Index     = i;
+      aFaceProps.ToUseMesh = (UseTriangulation && !NoTri) || (NoSurf && !NoTri);
     }
   }
-#ifdef OCCT_DEBUG
-  if(AffichEps) std::cout<<"\n-----------------\n"<<iErrorMax<<":\tMaxError = "<<ErrorMax<<"\n";
-#endif
-  return ErrorMax;
+  return facesProperties(aFaces, Props, P, Eps, Standard_True, theToRunParallel);
 }
 void  BRepGProp::VolumeProperties(const TopoDS_Shape& S, GProp_GProps& Props, const Standard_Boolean OnlyClosed, const Standard_Boolean SkipShared,
-                                  const Standard_Boolean UseTriangulation)
+                                  const Standard_Boolean UseTriangulation, const Standard_Boolean theToRunParallel)
 {
   // find the origin
   gp_Pnt P(0,0,0);  P.Transform(S.Location());
@@ -321,9 +382,9 @@ void  BRepGProp::VolumeProperties(const TopoDS_Shape& S, GProp_GProps& Props, co
       {
         continue;
       }
-      if(BRep_Tool::IsClosed(Sh)) volumeProperties(Sh,Props,1.0,SkipShared, UseTriangulation);
+      if(BRep_Tool::IsClosed(Sh)) volumeProperties(Sh,Props,1.0,SkipShared, UseTriangulation, theToRunParallel);
     }
-  } else volumeProperties(S,Props,1.0,SkipShared, UseTriangulation);
+  } else volumeProperties(S,Props,1.0,SkipShared, UseTriangulation, theToRunParallel);
 }
 
 //=======================================================================
@@ -332,7 +393,8 @@ void  BRepGProp::VolumeProperties(const TopoDS_Shape& S, GProp_GProps& Props, co
 //=======================================================================
 
 Standard_Real BRepGProp::VolumeProperties(const TopoDS_Shape& S, GProp_GProps& Props, 
-  const Standard_Real Eps, const Standard_Boolean OnlyClosed, const Standard_Boolean SkipShared)
+  const Standard_Real Eps, const Standard_Boolean OnlyClosed, const Standard_Boolean SkipShared,
+  const Standard_Boolean theToRunParallel)
 { 
   // find the origin
   gp_Pnt P(0,0,0);  P.Transform(S.Location());
@@ -352,7 +414,7 @@ Standard_Real BRepGProp::VolumeProperties(const TopoDS_Shape& S, GProp_GProps& P
         continue;
       }
       if(BRep_Tool::IsClosed(Sh)) {
-        Error = volumeProperties(Sh,Props,Eps,SkipShared, Standard_False);
+        Error = volumeProperties(Sh,Props,Eps,SkipShared, Standard_False, theToRunParallel);
         if(ErrorMax < Error) {
           ErrorMax = Error;
 #ifdef OCCT_DEBUG
@@ -361,7 +423,7 @@ Standard_Real BRepGProp::VolumeProperties(const TopoDS_Shape& S, GProp_GProps& P
         }
       }
     }
-  } else ErrorMax = volumeProperties(S,Props,Eps,SkipShared, Standard_False);
+  } else ErrorMax = volumeProperties(S,Props,Eps,SkipShared, Standard_False, theToRunParallel);
 #ifdef OCCT_DEBUG
   if(AffichEps) std::cout<<"\n\n==================="<<iErrorMax<<":\tMaxEpsVolume = "<<ErrorMax<<"\n";
 #endif
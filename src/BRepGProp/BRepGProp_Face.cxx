@@ -222,6 +222,30 @@ void BRepGProp_Face::Normal (const Standard_Real  U,
   
 }
 
+//=======================================================================
+//function : Normals
+//purpose  : 
+//=======================================================================
+
+void BRepGProp_Face::Normals (const TColStd_Array1OfReal& theU,
+                              const TColStd_Array1OfReal& theV,
+                              TColgp_Array2OfPnt&         thePoints,
+                              TColgp_Array2OfVec&         theNormals) const
+{
+  // the derivatives along U are computed in place of the normals
+  TColgp_Array2OfVec aD1V (theU.Lower(), theU.Upper(), theV.Lower(), theV.Upper());
+  mySurface.D1Grid (theU, theV, thePoints, theNormals, aD1V);
+  for (Standard_Integer i = theU.Lower(); i <= theU.Upper(); ++i)
+  {
+    for (Standard_Integer j = theV.Lower(); j <= theV.Upper(); ++j)
+    {
+      gp_Vec& aNormal = theNormals.ChangeValue (i, j);
+      aNormal = aNormal.Crossed (aD1V (i, j));
+      if (mySReverse) aNormal.Reverse();
+    }
+  }
+}
+
 //  APO 17.04.2002 (OCC104)
 // This is functions that calculate coeff. to optimize "integration order".
 // They had been produced experimentally for some hard example.
@@ -26,6 +26,8 @@
 #include <Standard_Integer.hxx>
 #include <gp_Pnt2d.hxx>
 #include <TColStd_Array1OfReal.hxx>
+#include <TColgp_Array2OfPnt.hxx>
+#include <TColgp_Array2OfVec.hxx>
 #include <GeomAbs_IsoType.hxx>
 #include <TColStd_HArray1OfReal.hxx>
 class TopoDS_Face;
@@ -97,6 +99,15 @@ public:
   //! Computes the point of parameter U, V on the Face <S> and
   //! the normal to the face at this point.
   Standard_EXPORT void Normal (const Standard_Real U, const Standard_Real V, gp_Pnt& P, gp_Vec& VNor) const;
+
+  //! Computes the points and the normals to the face on the grid
+  //! of parameters <theU> x <theV> by the grid evaluator of the surface
+  //! (see Adaptor3d_Surface::D1Grid() for the layout of the arrays).
+  //! The results are the same as of Normal() in each node of the grid.
+  Standard_EXPORT void Normals (const TColStd_Array1OfReal& theU,
+                                const TColStd_Array1OfReal& theV,
+                                TColgp_Array2OfPnt&         thePoints,
+                                TColgp_Array2OfVec&         theNormals) const;
   
   //! Loading the boundary arc.
   //! Returns FALSE if edge has no P-Curve.
@@ -611,6 +611,18 @@ Standard_Real BRepGProp_Gauss::Compute(
   math::GaussPoints (NbUGaussP[1], *UGaussP[1]);
   math::GaussWeights(NbUGaussP[1], *UGaussW[1]);
 
+  // Buffers for the evaluation of the surface at the Gauss points along U
+  NCollection_Handle<TColStd_Array1OfReal> aGridU[2];
+  NCollection_Handle<TColgp_Array2OfPnt>   aGridPnt[2];
+  NCollection_Handle<TColgp_Array2OfVec>   aGridNorm[2];
+  TColStd_Array1OfReal aGridV(1, 1);
+  for (Standard_Integer iGU = 0; iGU < 2; ++iGU)
+  {
+    aGridU[iGU]    = new TColStd_Array1OfReal(1, NbUGaussP[iGU]);
+    aGridPnt[iGU]  = new TColgp_Array2OfPnt(1, NbUGaussP[iGU], 1, 1);
+    aGridNorm[iGU] = new TColgp_Array2OfVec(1, NbUGaussP[iGU], 1, 1);
+  }
+
   const Standard_Integer aNbUSubs = theSurface.SUIntSubs();
   TColStd_Array1OfReal UKnots(1, aNbUSubs + 1);
   theSurface.UKnots(UKnots);
@@ -794,8 +806,7 @@ Standard_Real BRepGProp_Gauss::Compute(
                     }
                   else
                   {
-                    gp_Pnt aPoint;
-                    gp_Vec aNormal;
+                    aGridV(1) = v;
 
                     for (kU = 0; kU < kUEnd; ++kU)
                     {
@@ -811,10 +822,15 @@ Standard_Real BRepGProp_Gauss::Compute(
                       {
                         for (Standard_Integer iU = 1; iU <= NbUGaussP[iGU]; ++iU)
                         {
-                          Standard_Real w = UGaussW[iGU]->Value(iU);
-                          const Standard_Real u = um + ur * UGaussP[iGU]->Value(iU);
+                          aGridU[iGU]->ChangeValue(iU) = um + ur * UGaussP[iGU]->Value(iU);
+                        }
+                        theSurface.Normals(*aGridU[iGU], aGridV, *aGridPnt[iGU], *aGridNorm[iGU]);
 
-                          theSurface.Normal(u, v, aPoint, aNormal);
+                        for (Standard_Integer iU = 1; iU <= NbUGaussP[iGU]; ++iU)
+                        {
+                          Standard_Real w = UGaussW[iGU]->Value(iU);
+                          const gp_Pnt& aPoint  = aGridPnt[iGU]->Value(iU, 1);
+                          const gp_Vec& aNormal = aGridNorm[iGU]->Value(iU, 1);
 
                           if (myType == Vinert)
                           {
@@ -1116,6 +1132,11 @@ void BRepGProp_Gauss::Compute(BRepGProp_Face&   theSurface,
   math::GaussPoints (NbGaussgp_Pnts, GaussSPV);
   math::GaussWeights(NbGaussgp_Pnts, GaussSWV);
 
+  // Buffers for the evaluation of the surface at the Gauss points along U
+  TColStd_Array1OfReal aGridU(1, NbGaussgp_Pnts), aGridV(1, 1);
+  TColgp_Array2OfPnt   aGridPnt (1, NbGaussgp_Pnts, 1, 1);
+  TColgp_Array2OfVec   aGridNorm(1, NbGaussgp_Pnts, 1, 1);
+
   BRepGProp_Gauss::Inertia anInertia;
   for (; theDomain.More(); theDomain.Next())
   {
@@ -1156,17 +1177,19 @@ void BRepGProp_Gauss::Compute(BRepGProp_Face&   theSurface,
       const Standard_Real um  = 0.5 * (u2 + u1);
       const Standard_Real ur  = 0.5 * (u2 - u1);
 
+      for (Standard_Integer j = 1; j <= NbGaussgp_Pnts; ++j)
+      {
+        aGridU(j) = add(um, mult(ur, GaussSPV(j)));
+      }
+      aGridV(1) = v;
+      theSurface.Normals(aGridU, aGridV, aGridPnt, aGridNorm);
+
       BRepGProp_Gauss::Inertia aLocalInertia;
       for (Standard_Integer j = 1; j <= NbGaussgp_Pnts; ++j)
       {
-        const Standard_Real u = add(um, mult(ur, GaussSPV(j)));
         const Standard_Real aWeight = Dul * GaussSWV(j);
 
-        gp_Pnt aPoint;
-        gp_Vec aNormal;
-        theSurface.Normal (u, v, aPoint, aNormal);
-
-        computeSInertiaOfElementaryPart(aPoint, aNormal, theLocation, aWeight, aLocalInertia);
+        computeSInertiaOfElementaryPart(aGridPnt(j, 1), aGridNorm(j, 1), theLocation, aWeight, aLocalInertia);
       }
 
       multAndRestoreInertia(ur, aLocalInertia);
@@ -1220,6 +1243,11 @@ void BRepGProp_Gauss::Compute(BRepGProp_Face&         theSurface,
     math::GaussPoints (aNbGaussgp_Pnts, GaussP);
     math::GaussWeights(aNbGaussgp_Pnts, GaussW);
 
+    // Buffers for the evaluation of the surface at the Gauss points along U
+    TColStd_Array1OfReal aGridU(1, aNbGaussgp_Pnts), aGridV(1, 1);
+    TColgp_Array2OfPnt   aGridPnt (1, aNbGaussgp_Pnts, 1, 1);
+    TColgp_Array2OfVec   aGridNorm(1, aNbGaussgp_Pnts, 1, 1);
+
     const Standard_Real l1 = theSurface.FirstParameter();
     const Standard_Real l2 = theSurface.LastParameter();
     const Standard_Real lm = 0.5 * (l2 + l1);
@@ -1243,20 +1271,21 @@ void BRepGProp_Gauss::Compute(BRepGProp_Face&         theSurface,
       const Standard_Real um  = 0.5 * (u2 + u1);
       const Standard_Real ur  = 0.5 * (u2 - u1);
 
+      for (Standard_Integer j = 1; j <= aNbGaussgp_Pnts; ++j)
+      {
+        aGridU(j) = um + ur * GaussP(j);
+      }
+      aGridV(1) = v;
+      theSurface.Normals(aGridU, aGridV, aGridPnt, aGridNorm);
+
       BRepGProp_Gauss::Inertia aLocalInertia;
       for (Standard_Integer j = 1; j <= aNbGaussgp_Pnts; ++j)
       {
-        const Standard_Real u = um + ur * GaussP(j);
         const Standard_Real aWeight = Dul * GaussW(j);
 
-        gp_Pnt aPoint;
-        gp_Vec aNormal;
-
-        theSurface.Normal(u, v, aPoint, aNormal);
-
         computeVInertiaOfElementaryPart(
-          aPoint,
-          aNormal,
+          aGridPnt(j, 1),
+          aGridNorm(j, 1),
           theLocation,
           aWeight,
           theCoeff,
@@ -1312,20 +1341,30 @@ void BRepGProp_Gauss::Compute(const BRepGProp_Face&  theSurface,
   Standard_Real ur = 0.5 * add(UpperU, -LowerU);
   Standard_Real vr = 0.5 * add(UpperV, -LowerV);
 
-  gp_Pnt aPoint;
-  gp_Vec aNormal;
+  // Evaluation of the surface on the whole grid of Gauss points
+  TColStd_Array1OfReal aGridU(1, UOrder), aGridV(1, VOrder);
+  for (Standard_Integer i = 1; i <= UOrder; ++i)
+  {
+    aGridU(i) = add(um, mult(ur, GaussPU (i)));
+  }
+  for (Standard_Integer j = 1; j <= VOrder; ++j)
+  {
+    aGridV(j) = add(vm, mult(vr, GaussPV(j)));
+  }
+  TColgp_Array2OfPnt aGridPnt (1, UOrder, 1, VOrder);
+  TColgp_Array2OfVec aGridNorm(1, UOrder, 1, VOrder);
+  theSurface.Normals(aGridU, aGridV, aGridPnt, aGridNorm);
 
   BRepGProp_Gauss::Inertia anInertia;
   for (Standard_Integer j = 1; j <= VOrder; ++j)
   {
     BRepGProp_Gauss::Inertia anInertiaOfElementaryPart;
-    const Standard_Real v = add(vm, mult(vr, GaussPV(j)));
 
     for (Standard_Integer i = 1; i <= UOrder; ++i)
     {
       const Standard_Real aWeight = GaussWU(i);
-      const Standard_Real u = add(um, mult(ur, GaussPU (i)));
-      theSurface.Normal(u, v, aPoint, aNormal);
+      const gp_Pnt& aPoint  = aGridPnt (i, j);
+      const gp_Vec& aNormal = aGridNorm(i, j);
 
       if (myType == Vinert)
       {
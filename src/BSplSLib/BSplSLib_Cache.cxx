@@ -16,6 +16,7 @@
 
 #include <NCollection_LocalArray.hxx>
 
+#include <TColgp_Array2OfVec.hxx>
 #include <TColgp_HArray2OfPnt.hxx>
 #include <TColStd_HArray2OfReal.hxx>
 
@@ -86,115 +87,133 @@ void BSplSLib_Cache::BuildCache(const Standard_Real&           theParameterU,
 }
 
 
-void BSplSLib_Cache::D0(const Standard_Real& theU, 
-                        const Standard_Real& theV, 
-                              gp_Pnt&        thePoint) const
+//=======================================================================
+//function : normalizedParams
+//purpose  :
+//=======================================================================
+void BSplSLib_Cache::normalizedParams (const Standard_Real    theU,
+                                       const Standard_Real    theV,
+                                       const Standard_Integer theDeriv,
+                                       Standard_Real&         theParamMin,
+                                       Standard_Real&         theParamMax) const
 {
-  Standard_Real aNewU = myParamsU.PeriodicNormalization (theU);
-  Standard_Real aNewV = myParamsV.PeriodicNormalization (theV);
+  Standard_Real aNewU = normalizedParam (myParamsU, theU, theDeriv);
+  Standard_Real aNewV = normalizedParam (myParamsV, theV, theDeriv);
+  if (myParamsU.Degree > myParamsV.Degree)
+  {
+    theParamMin = aNewV;
+    theParamMax = aNewU;
+  }
+  else
+  {
+    theParamMin = aNewU;
+    theParamMax = aNewV;
+  }
+}
 
+//=======================================================================
+//function : normalizedParam
+//purpose  :
+//=======================================================================
+Standard_Real BSplSLib_Cache::normalizedParam (const BSplCLib_CacheParams& theParams,
+                                               const Standard_Real         theParam,
+                                               const Standard_Integer      theDeriv)
+{
   // BSplSLib uses different convention for span parameters than BSplCLib
   // (Start is in the middle of the span and length is half-span),
   // thus we need to amend them here
-  Standard_Real aSpanLengthU = 0.5 * myParamsU.SpanLength;
-  Standard_Real aSpanStartU = myParamsU.SpanStart + aSpanLengthU;
-  Standard_Real aSpanLengthV = 0.5 * myParamsV.SpanLength;
-  Standard_Real aSpanStartV = myParamsV.SpanStart + aSpanLengthV;
-
-  aNewU = (aNewU - aSpanStartU) / aSpanLengthU;
-  aNewV = (aNewV - aSpanStartV) / aSpanLengthV;
+  Standard_Real aSpanLength = 0.5 * theParams.SpanLength;
+  Standard_Real aSpanStart  = theParams.SpanStart + aSpanLength;
+  Standard_Real aNewParam   = theParams.PeriodicNormalization (theParam);
+  if (theDeriv == 0)
+  {
+    return (aNewParam - aSpanStart) / aSpanLength;
+  }
+  // the inverted length is used for scaling of the derivatives as well
+  Standard_Real anInv = 1.0 / aSpanLength;
+  return (aNewParam - aSpanStart) * anInv;
+}
 
+//=======================================================================
+//function : evalMajor
+//purpose  :
+//=======================================================================
+void BSplSLib_Cache::evalMajor (const Standard_Real    theParamMax,
+                                const Standard_Integer theDeriv,
+                                Standard_Real*         theCoeffs) const
+{
   Standard_Real* aPolesArray = ConvertArray(myPolesWeights);
-  Standard_Real aPoint[4];
-
-  Standard_Integer aDimension = myIsRational ? 4 : 3;
   Standard_Integer aCacheCols = myPolesWeights->RowLength();
-  Standard_Integer aMinMaxDegree[2] = {Min(myParamsU.Degree, myParamsV.Degree),
-                                       Max(myParamsU.Degree, myParamsV.Degree)};
-  Standard_Real aParameters[2];
-  if (myParamsU.Degree > myParamsV.Degree)
+  Standard_Integer aMaxDegree = Max(myParamsU.Degree, myParamsV.Degree);
+  if (theDeriv == 0)
   {
-    aParameters[0] = aNewV;
-    aParameters[1] = aNewU;
+    // Calculate intermediate value of cached polynomial along columns
+    PLib::NoDerivativeEvalPolynomial(theParamMax, aMaxDegree,
+                                     aCacheCols, aMaxDegree * aCacheCols,
+                                     aPolesArray[0], theCoeffs[0]);
+    return;
   }
-  else
+
+  // Nulling transient coefficients when max derivative is less than the requested one
+  Standard_Integer aMaxDeriv = Min(theDeriv, aMaxDegree);
+  for (Standard_Integer i = aMaxDeriv + 1; i <= theDeriv; i++)
   {
-    aParameters[0] = aNewU;
-    aParameters[1] = aNewV;
+    Standard_Integer index = i * aCacheCols;
+    for (Standard_Integer j = 0; j < aCacheCols; j++)
+      theCoeffs[index++] = 0.0;
   }
 
-  NCollection_LocalArray<Standard_Real> aTransientCoeffs(aCacheCols); // array for intermediate results
+  // Calculate intermediate values and derivatives of bivariate polynomial along variable with maximal degree
+  PLib::EvalPolynomial(theParamMax, aMaxDeriv, aMaxDegree, aCacheCols, aPolesArray[0], theCoeffs[0]);
+}
 
-  // Calculate intermediate value of cached polynomial along columns
-  PLib::NoDerivativeEvalPolynomial(aParameters[1], aMinMaxDegree[1],
-                                   aCacheCols, aMinMaxDegree[1] * aCacheCols,
-                                   aPolesArray[0], aTransientCoeffs[0]);
+//=======================================================================
+//function : evalMinor0
+//purpose  :
+//=======================================================================
+void BSplSLib_Cache::evalMinor0 (const Standard_Real  theParamMin,
+                                 const Standard_Real* theCoeffs,
+                                 gp_Pnt&              thePoint) const
+{
+  Standard_Real aPoint[4];
+  Standard_Integer aDimension = myIsRational ? 4 : 3;
+  Standard_Integer aMinDegree = Min(myParamsU.Degree, myParamsV.Degree);
+  Standard_Real* aCoeffs = (Standard_Real* )theCoeffs;
 
   // Calculate total value
-  PLib::NoDerivativeEvalPolynomial(aParameters[0], aMinMaxDegree[0],
-                                   aDimension, aDimension * aMinMaxDegree[0],
-                                   aTransientCoeffs[0], aPoint[0]);
+  PLib::NoDerivativeEvalPolynomial(theParamMin, aMinDegree,
+                                   aDimension, aDimension * aMinDegree,
+                                   aCoeffs[0], aPoint[0]);
 
   thePoint.SetCoord(aPoint[0], aPoint[1], aPoint[2]);
   if (myIsRational)
     thePoint.ChangeCoord().Divide(aPoint[3]);
 }
 
-
-void BSplSLib_Cache::D1(const Standard_Real& theU, 
-                        const Standard_Real& theV, 
-                              gp_Pnt&        thePoint, 
-                              gp_Vec&        theTangentU, 
-                              gp_Vec&        theTangentV) const
+//=======================================================================
+//function : evalMinor1
+//purpose  :
+//=======================================================================
+void BSplSLib_Cache::evalMinor1 (const Standard_Real  theParamMin,
+                                 const Standard_Real* theCoeffs,
+                                 gp_Pnt&              thePoint,
+                                 gp_Vec&              theTangentU,
+                                 gp_Vec&              theTangentV) const
 {
-  Standard_Real aNewU = myParamsU.PeriodicNormalization (theU);
-  Standard_Real aNewV = myParamsV.PeriodicNormalization (theV);
-
-  // BSplSLib uses different convention for span parameters than BSplCLib
-  // (Start is in the middle of the span and length is half-span),
-  // thus we need to amend them here
-  Standard_Real aSpanLengthU = 0.5 * myParamsU.SpanLength;
-  Standard_Real aSpanStartU = myParamsU.SpanStart + aSpanLengthU;
-  Standard_Real aSpanLengthV = 0.5 * myParamsV.SpanLength;
-  Standard_Real aSpanStartV = myParamsV.SpanStart + aSpanLengthV;
-
-  Standard_Real anInvU = 1.0 / aSpanLengthU;
-  Standard_Real anInvV = 1.0 / aSpanLengthV;
-  aNewU = (aNewU - aSpanStartU) * anInvU;
-  aNewV = (aNewV - aSpanStartV) * anInvV;
-
-  Standard_Real* aPolesArray = ConvertArray(myPolesWeights);
   Standard_Real aPntDeriv[16]; // result storage (point and derivative coordinates)
   for (Standard_Integer i = 0; i< 16; i++) aPntDeriv[i] = 0.0;
 
   Standard_Integer aDimension = myIsRational ? 4 : 3;
   Standard_Integer aCacheCols = myPolesWeights->RowLength();
-  Standard_Integer aMinMaxDegree[2] = {Min(myParamsU.Degree, myParamsV.Degree),
-                                       Max(myParamsU.Degree, myParamsV.Degree)};
-
-  Standard_Real aParameters[2];
-  if (myParamsU.Degree > myParamsV.Degree)
-  {
-    aParameters[0] = aNewV;
-    aParameters[1] = aNewU;
-  }
-  else
-  {
-    aParameters[0] = aNewU;
-    aParameters[1] = aNewV;
-  }
-
-  NCollection_LocalArray<Standard_Real> aTransientCoeffs(aCacheCols<<1); // array for intermediate results
-
-  // Calculate intermediate values and derivatives of bivariate polynomial along variable with maximal degree
-  PLib::EvalPolynomial(aParameters[1], 1, aMinMaxDegree[1], aCacheCols, aPolesArray[0], aTransientCoeffs[0]);
+  Standard_Integer aMinDegree = Min(myParamsU.Degree, myParamsV.Degree);
+  Standard_Real* aCoeffs = (Standard_Real* )theCoeffs;
 
   // Calculate a point on surface and a derivative along variable with minimal degree
-  PLib::EvalPolynomial(aParameters[0], 1, aMinMaxDegree[0], aDimension, aTransientCoeffs[0], aPntDeriv[0]);
+  PLib::EvalPolynomial(theParamMin, 1, aMinDegree, aDimension, aCoeffs[0], aPntDeriv[0]);
 
   // Calculate derivative along variable with maximal degree
-  PLib::NoDerivativeEvalPolynomial(aParameters[0], aMinMaxDegree[0], aDimension, 
-                                   aMinMaxDegree[0] * aDimension, aTransientCoeffs[aCacheCols], 
+  PLib::NoDerivativeEvalPolynomial(theParamMin, aMinDegree, aDimension,
+                                   aMinDegree * aDimension, aCoeffs[aCacheCols],
                                    aPntDeriv[aDimension<<1]);
 
   Standard_Real* aResult = aPntDeriv;
@@ -219,84 +238,43 @@ void BSplSLib_Cache::D1(const Standard_Real& theU,
     Standard_Integer aShift = aDimension<<1;
     theTangentV.SetCoord(aResult[aShift], aResult[aShift + 1], aResult[aShift + 2]);
   }
-  theTangentU.Multiply(anInvU);
-  theTangentV.Multiply(anInvV);
+  theTangentU.Multiply(1.0 / (0.5 * myParamsU.SpanLength));
+  theTangentV.Multiply(1.0 / (0.5 * myParamsV.SpanLength));
 }
 
-
-void BSplSLib_Cache::D2(const Standard_Real& theU, 
-                        const Standard_Real& theV, 
-                              gp_Pnt&        thePoint, 
-                              gp_Vec&        theTangentU, 
-                              gp_Vec&        theTangentV, 
-                              gp_Vec&        theCurvatureU, 
-                              gp_Vec&        theCurvatureV, 
-                              gp_Vec&        theCurvatureUV) const
+//=======================================================================
+//function : evalMinor2
+//purpose  :
+//=======================================================================
+void BSplSLib_Cache::evalMinor2 (const Standard_Real  theParamMin,
+                                 const Standard_Real* theCoeffs,
+                                 gp_Pnt&              thePoint,
+                                 gp_Vec&              theTangentU,
+                                 gp_Vec&              theTangentV,
+                                 gp_Vec&              theCurvatureU,
+                                 gp_Vec&              theCurvatureV,
+                                 gp_Vec&              theCurvatureUV) const
 {
-  Standard_Real aNewU = myParamsU.PeriodicNormalization (theU);
-  Standard_Real aNewV = myParamsV.PeriodicNormalization (theV);
-
-  // BSplSLib uses different convention for span parameters than BSplCLib
-  // (Start is in the middle of the span and length is half-span),
-  // thus we need to amend them here
-  Standard_Real aSpanLengthU = 0.5 * myParamsU.SpanLength;
-  Standard_Real aSpanStartU = myParamsU.SpanStart + aSpanLengthU;
-  Standard_Real aSpanLengthV = 0.5 * myParamsV.SpanLength;
-  Standard_Real aSpanStartV = myParamsV.SpanStart + aSpanLengthV;
-
-  Standard_Real anInvU = 1.0 / aSpanLengthU;
-  Standard_Real anInvV = 1.0 / aSpanLengthV;
-  aNewU = (aNewU - aSpanStartU) * anInvU;
-  aNewV = (aNewV - aSpanStartV) * anInvV;
-
-  Standard_Real* aPolesArray = ConvertArray(myPolesWeights);
   Standard_Real aPntDeriv[36]; // result storage (point and derivative coordinates)
   for (Standard_Integer i = 0; i < 36; i++) aPntDeriv[i] = 0.0;
 
   Standard_Integer aDimension = myIsRational ? 4 : 3;
   Standard_Integer aCacheCols = myPolesWeights->RowLength();
-  Standard_Integer aMinMaxDegree[2] = {Min(myParamsU.Degree, myParamsV.Degree),
-                                       Max(myParamsU.Degree, myParamsV.Degree)};
-
-  Standard_Real aParameters[2];
-  if (myParamsU.Degree > myParamsV.Degree)
-  {
-    aParameters[0] = aNewV;
-    aParameters[1] = aNewU;
-  }
-  else
-  {
-    aParameters[0] = aNewU;
-    aParameters[1] = aNewV;
-  }
-
-  NCollection_LocalArray<Standard_Real> aTransientCoeffs(3 * aCacheCols); // array for intermediate results
-  // Calculating derivative to be evaluate and
-  // nulling transient coefficients when max or min derivative is less than 2
-  Standard_Integer aMinMaxDeriv[2] = {Min(2, aMinMaxDegree[0]), 
-                                      Min(2, aMinMaxDegree[1])};
-  for (Standard_Integer i = aMinMaxDeriv[1] + 1; i < 3; i++)
-  {
-    Standard_Integer index = i * aCacheCols;
-    for (Standard_Integer j = 0; j < aCacheCols; j++) 
-      aTransientCoeffs[index++] = 0.0;
-  }
-
-  // Calculate intermediate values and derivatives of bivariate polynomial along variable with maximal degree
-  PLib::EvalPolynomial(aParameters[1], aMinMaxDeriv[1], aMinMaxDegree[1], 
-                       aCacheCols, aPolesArray[0], aTransientCoeffs[0]);
+  Standard_Integer aMinDegree = Min(myParamsU.Degree, myParamsV.Degree);
+  Standard_Integer aMinDeriv  = Min(2, aMinDegree);
+  Standard_Real* aCoeffs = (Standard_Real* )theCoeffs;
 
   // Calculate a point on surface and a derivatives along variable with minimal degree
-  PLib::EvalPolynomial(aParameters[0], aMinMaxDeriv[0], aMinMaxDegree[0], 
-                       aDimension, aTransientCoeffs[0], aPntDeriv[0]);
+  PLib::EvalPolynomial(theParamMin, aMinDeriv, aMinDegree,
+                       aDimension, aCoeffs[0], aPntDeriv[0]);
 
   // Calculate derivative along variable with maximal degree and mixed derivative
-  PLib::EvalPolynomial(aParameters[0], 1, aMinMaxDegree[0], aDimension, 
-                       aTransientCoeffs[aCacheCols], aPntDeriv[3 * aDimension]);
+  PLib::EvalPolynomial(theParamMin, 1, aMinDegree, aDimension,
+                       aCoeffs[aCacheCols], aPntDeriv[3 * aDimension]);
 
   // Calculate second derivative along variable with maximal degree
-  PLib::NoDerivativeEvalPolynomial(aParameters[0], aMinMaxDegree[0], aDimension, 
-                                   aMinMaxDegree[0] * aDimension, aTransientCoeffs[aCacheCols<<1], 
+  PLib::NoDerivativeEvalPolynomial(theParamMin, aMinDegree, aDimension,
+                                   aMinDegree * aDimension, aCoeffs[aCacheCols<<1],
                                    aPntDeriv[6 * aDimension]);
 
   Standard_Real* aResult = aPntDeriv;
@@ -333,6 +311,8 @@ void BSplSLib_Cache::D2(const Standard_Real& theU,
     aShift += (aDimension << 1);
     theCurvatureV.SetCoord(aResult[aShift], aResult[aShift + 1], aResult[aShift + 2]);
   }
+  Standard_Real anInvU = 1.0 / (0.5 * myParamsU.SpanLength);
+  Standard_Real anInvV = 1.0 / (0.5 * myParamsV.SpanLength);
   theTangentU.Multiply(anInvU);
   theTangentV.Multiply(anInvV);
   theCurvatureU.Multiply(anInvU * anInvU);
@@ -340,3 +320,176 @@ void BSplSLib_Cache::D2(const Standard_Real& theU,
   theCurvatureUV.Multiply(anInvU * anInvV);
 }
 
+//=======================================================================
+//function : D0
+//purpose  :
+//=======================================================================
+void BSplSLib_Cache::D0(const Standard_Real& theU, 
+                        const Standard_Real& theV, 
+                              gp_Pnt&        thePoint) const
+{
+  Standard_Real aParamMin = 0.0, aParamMax = 0.0;
+  normalizedParams (theU, theV, 0, aParamMin, aParamMax);
+
+  NCollection_LocalArray<Standard_Real> aTransientCoeffs(myPolesWeights->RowLength()); // array for intermediate results
+  evalMajor (aParamMax, 0, aTransientCoeffs);
+  evalMinor0 (aParamMin, aTransientCoeffs, thePoint);
+}
+
+//=======================================================================
+//function : D1
+//purpose  :
+//=======================================================================
+void BSplSLib_Cache::D1(const Standard_Real& theU, 
+                        const Standard_Real& theV, 
+                              gp_Pnt&        thePoint, 
+                              gp_Vec&        theTangentU, 
+                              gp_Vec&        theTangentV) const
+{
+  Standard_Real aParamMin = 0.0, aParamMax = 0.0;
+  normalizedParams (theU, theV, 1, aParamMin, aParamMax);
+
+  NCollection_LocalArray<Standard_Real> aTransientCoeffs(myPolesWeights->RowLength()<<1); // array for intermediate results
+  evalMajor (aParamMax, 1, aTransientCoeffs);
+  evalMinor1 (aParamMin, aTransientCoeffs, thePoint, theTangentU, theTangentV);
+}
+
+//=======================================================================
+//function : D2
+//purpose  :
+//=======================================================================
+void BSplSLib_Cache::D2(const Standard_Real& theU, 
+                        const Standard_Real& theV, 
+                              gp_Pnt&        thePoint, 
+                              gp_Vec&        theTangentU, 
+                              gp_Vec&        theTangentV, 
+                              gp_Vec&        theCurvatureU, 
+                              gp_Vec&        theCurvatureV, 
+                              gp_Vec&        theCurvatureUV) const
+{
+  Standard_Real aParamMin = 0.0, aParamMax = 0.0;
+  normalizedParams (theU, theV, 2, aParamMin, aParamMax);
+
+  NCollection_LocalArray<Standard_Real> aTransientCoeffs(3 * myPolesWeights->RowLength()); // array for intermediate results
+  evalMajor (aParamMax, 2, aTransientCoeffs);
+  evalMinor2 (aParamMin, aTransientCoeffs, thePoint, theTangentU, theTangentV,
+              theCurvatureU, theCurvatureV, theCurvatureUV);
+}
+
+//=======================================================================
+//function : evalGrid
+//purpose  :
+//=======================================================================
+void BSplSLib_Cache::evalGrid (const Standard_Integer      theDeriv,
+                               const TColStd_Array1OfReal& theU,
+                               const Standard_Integer      theUFirst,
+                               const Standard_Integer      theULast,
+                               const TColStd_Array1OfReal& theV,
+                               const Standard_Integer      theVFirst,
+                               const Standard_Integer      theVLast,
+                               TColgp_Array2OfPnt&         thePoints,
+                               TColgp_Array2OfVec*         theD1U,
+                               TColgp_Array2OfVec*         theD1V,
+                               TColgp_Array2OfVec*         theD2U,
+                               TColgp_Array2OfVec*         theD2V,
+                               TColgp_Array2OfVec*         theD2UV) const
+{
+  // the polynomial along the direction of maximal degree is evaluated once for each parameter
+  // of this direction, the result is reused for all parameters along the other direction
+  const Standard_Boolean isUMajor = myParamsU.Degree > myParamsV.Degree;
+  const TColStd_Array1OfReal& aMajorParams = isUMajor ? theU : theV;
+  const TColStd_Array1OfReal& aMinorParams = isUMajor ? theV : theU;
+  const BSplCLib_CacheParams& aMajorCache  = isUMajor ? myParamsU : myParamsV;
+  const BSplCLib_CacheParams& aMinorCache  = isUMajor ? myParamsV : myParamsU;
+  const Standard_Integer aMajorFirst = isUMajor ? theUFirst : theVFirst;
+  const Standard_Integer aMajorLast  = isUMajor ? theULast  : theVLast;
+  const Standard_Integer aMinorFirst = isUMajor ? theVFirst : theUFirst;
+  const Standard_Integer aMinorLast  = isUMajor ? theVLast  : theULast;
+
+  NCollection_LocalArray<Standard_Real> aMinorNormParams(aMinorLast - aMinorFirst + 1);
+  for (Standard_Integer aMinorIter = aMinorFirst; aMinorIter <= aMinorLast; ++aMinorIter)
+  {
+    aMinorNormParams[aMinorIter - aMinorFirst] = normalizedParam (aMinorCache, aMinorParams (aMinorIter), theDeriv);
+  }
+
+  NCollection_LocalArray<Standard_Real> aTransientCoeffs((theDeriv + 1) * myPolesWeights->RowLength());
+  for (Standard_Integer aMajorIter = aMajorFirst; aMajorIter <= aMajorLast; ++aMajorIter)
+  {
+    evalMajor (normalizedParam (aMajorCache, aMajorParams (aMajorIter), theDeriv), theDeriv, aTransientCoeffs);
+    for (Standard_Integer aMinorIter = aMinorFirst; aMinorIter <= aMinorLast; ++aMinorIter)
+    {
+      const Standard_Real aParamMin = aMinorNormParams[aMinorIter - aMinorFirst];
+      const Standard_Integer aRow = isUMajor ? aMajorIter : aMinorIter;
+      const Standard_Integer aCol = isUMajor ? aMinorIter : aMajorIter;
+      switch (theDeriv)
+      {
+        case 0:
+          evalMinor0 (aParamMin, aTransientCoeffs, thePoints.ChangeValue (aRow, aCol));
+          break;
+        case 1:
+          evalMinor1 (aParamMin, aTransientCoeffs, thePoints.ChangeValue (aRow, aCol),
+                      theD1U->ChangeValue (aRow, aCol), theD1V->ChangeValue (aRow, aCol));
+          break;
+        default:
+          evalMinor2 (aParamMin, aTransientCoeffs, thePoints.ChangeValue (aRow, aCol),
+                      theD1U->ChangeValue (aRow, aCol), theD1V->ChangeValue (aRow, aCol),
+                      theD2U->ChangeValue (aRow, aCol), theD2V->ChangeValue (aRow, aCol),
+                      theD2UV->ChangeValue (aRow, aCol));
+          break;
+      }
+    }
+  }
+}
+
+//=======================================================================
+//function : D0Grid
+//purpose  :
+//=======================================================================
+void BSplSLib_Cache::D0Grid (const TColStd_Array1OfReal& theU,
+                             const Standard_Integer      theUFirst,
+                             const Standard_Integer      theULast,
+                             const TColStd_Array1OfReal& theV,
+                             const Standard_Integer      theVFirst,
+                             const Standard_Integer      theVLast,
+                             TColgp_Array2OfPnt&         thePoints) const
+{
+  evalGrid (0, theU, theUFirst, theULast, theV, theVFirst, theVLast, thePoints, NULL, NULL, NULL, NULL, NULL);
+}
+
+//=======================================================================
+//function : D1Grid
+//purpose  :
+//=======================================================================
+void BSplSLib_Cache::D1Grid (const TColStd_Array1OfReal& theU,
+                             const Standard_Integer      theUFirst,
+                             const Standard_Integer      theULast,
+                             const TColStd_Array1OfReal& theV,
+                             const Standard_Integer      theVFirst,
+                             const Standard_Integer      theVLast,
+                             TColgp_Array2OfPnt&         thePoints,
+                             TColgp_Array2OfVec&         theD1U,
+                             TColgp_Array2OfVec&         theD1V) const
+{
+  evalGrid (1, theU, theUFirst, theULast, theV, theVFirst, theVLast, thePoints, &theD1U, &theD1V, NULL, NULL, NULL);
+}
+
+//=======================================================================
+//function : D2Grid
+//purpose  :
+//=======================================================================
+void BSplSLib_Cache::D2Grid (const TColStd_Array1OfReal& theU,
+                             const Standard_Integer      theUFirst,
+                             const Standard_Integer      theULast,
+                             const TColStd_Array1OfReal& theV,
+                             const Standard_Integer      theVFirst,
+                             const Standard_Integer      theVLast,
+                             TColgp_Array2OfPnt&         thePoints,
+                             TColgp_Array2OfVec&         theD1U,
+                             TColgp_Array2OfVec&         theD1V,
+                             TColgp_Array2OfVec&         theD2U,
+                             TColgp_Array2OfVec&         theD2V,
+                             TColgp_Array2OfVec&         theD2UV) const
+{
+  evalGrid (2, theU, theUFirst, theULast, theV, theVFirst, theVLast, thePoints,
+            &theD1U, &theD1V, &theD2U, &theD2V, &theD2UV);
+}
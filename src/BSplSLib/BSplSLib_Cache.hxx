@@ -16,6 +16,8 @@
 
 #include <TColStd_HArray2OfReal.hxx>
 #include <TColStd_Array2OfReal.hxx>
+#include <TColgp_Array2OfPnt.hxx>
+#include <TColgp_Array2OfVec.hxx>
 
 #include <BSplCLib_CacheParams.hxx>
 
@@ -103,9 +105,117 @@ public:
                                 gp_Vec&        theCurvatureV, 
                                 gp_Vec&        theCurvatureUV) const;
 
+  //! Calculates the points of the surface on the grid of parameters theU(i), theV(j),
+  //! where i is in [theUFirst, theULast] and j is in [theVFirst, theVLast].
+  //! All parameters should be within the span of the cache (see IsCacheValid()).
+  //! The polynomial along the direction of the maximal degree is evaluated only once
+  //! for each parameter of this direction, so that the evaluation of the grid is
+  //! considerably faster than the evaluation of its points one by one.
+  //! \param[in]  theU       parameters along U axis
+  //! \param[in]  theUFirst  first index of the parameters along U axis to be used
+  //! \param[in]  theULast   last index of the parameters along U axis to be used
+  //! \param[in]  theV       parameters along V axis
+  //! \param[in]  theVFirst  first index of the parameters along V axis to be used
+  //! \param[in]  theVLast   last index of the parameters along V axis to be used
+  //! \param[out] thePoints  the points, thePoints(i, j) corresponds to theU(i) and theV(j)
+  Standard_EXPORT void D0Grid (const TColStd_Array1OfReal& theU,
+                               const Standard_Integer      theUFirst,
+                               const Standard_Integer      theULast,
+                               const TColStd_Array1OfReal& theV,
+                               const Standard_Integer      theVFirst,
+                               const Standard_Integer      theVLast,
+                               TColgp_Array2OfPnt&         thePoints) const;
+
+  //! Calculates the points of the surface and the first derivatives on the grid of parameters,
+  //! see D0Grid() for the description of the arguments.
+  Standard_EXPORT void D1Grid (const TColStd_Array1OfReal& theU,
+                               const Standard_Integer      theUFirst,
+                               const Standard_Integer      theULast,
+                               const TColStd_Array1OfReal& theV,
+                               const Standard_Integer      theVFirst,
+                               const Standard_Integer      theVLast,
+                               TColgp_Array2OfPnt&         thePoints,
+                               TColgp_Array2OfVec&         theD1U,
+                               TColgp_Array2OfVec&         theD1V) const;
+
+  //! Calculates the points of the surface and the derivatives till second order on the grid of parameters,
+  //! see D0Grid() for the description of the arguments.
+  Standard_EXPORT void D2Grid (const TColStd_Array1OfReal& theU,
+                               const Standard_Integer      theUFirst,
+                               const Standard_Integer      theULast,
+                               const TColStd_Array1OfReal& theV,
+                               const Standard_Integer      theVFirst,
+                               const Standard_Integer      theVLast,
+                               TColgp_Array2OfPnt&         thePoints,
+                               TColgp_Array2OfVec&         theD1U,
+                               TColgp_Array2OfVec&         theD1V,
+                               TColgp_Array2OfVec&         theD2U,
+                               TColgp_Array2OfVec&         theD2V,
+                               TColgp_Array2OfVec&         theD2UV) const;
+
 
   DEFINE_STANDARD_RTTIEXT(BSplSLib_Cache,Standard_Transient)
 
+private:
+
+  //! Returns the parameter normalized within the span of the cache.
+  //! \param theDeriv order of derivatives to be computed, defines the way of normalization
+  static Standard_Real normalizedParam (const BSplCLib_CacheParams& theParams,
+                                        const Standard_Real         theParam,
+                                        const Standard_Integer      theDeriv);
+
+  //! Returns the parameters normalized within the span of the cache
+  //! along the directions of the minimal and the maximal degree.
+  void normalizedParams (const Standard_Real    theU,
+                         const Standard_Real    theV,
+                         const Standard_Integer theDeriv,
+                         Standard_Real&         theParamMin,
+                         Standard_Real&         theParamMax) const;
+
+  //! Evaluates the cached polynomial along the direction of the maximal degree
+  //! with the derivatives till theDeriv order; the result is the coefficients
+  //! of the polynomials along the direction of the minimal degree.
+  void evalMajor (const Standard_Real    theParamMax,
+                  const Standard_Integer theDeriv,
+                  Standard_Real*         theCoeffs) const;
+
+  //! Calculates the point from the coefficients computed by evalMajor() without derivatives.
+  void evalMinor0 (const Standard_Real  theParamMin,
+                   const Standard_Real* theCoeffs,
+                   gp_Pnt&              thePoint) const;
+
+  //! Calculates the point and the first derivatives from the coefficients computed by evalMajor().
+  void evalMinor1 (const Standard_Real  theParamMin,
+                   const Standard_Real* theCoeffs,
+                   gp_Pnt&              thePoint,
+                   gp_Vec&              theTangentU,
+                   gp_Vec&              theTangentV) const;
+
+  //! Calculates the point and the derivatives till second order from the coefficients computed by evalMajor().
+  void evalMinor2 (const Standard_Real  theParamMin,
+                   const Standard_Real* theCoeffs,
+                   gp_Pnt&              thePoint,
+                   gp_Vec&              theTangentU,
+                   gp_Vec&              theTangentV,
+                   gp_Vec&              theCurvatureU,
+                   gp_Vec&              theCurvatureV,
+                   gp_Vec&              theCurvatureUV) const;
+
+  //! Evaluates the grid of parameters with the derivatives till theDeriv order.
+  void evalGrid (const Standard_Integer      theDeriv,
+                 const TColStd_Array1OfReal& theU,
+                 const Standard_Integer      theUFirst,
+                 const Standard_Integer      theULast,
+                 const TColStd_Array1OfReal& theV,
+                 const Standard_Integer      theVFirst,
+                 const Standard_Integer      theVLast,
+                 TColgp_Array2OfPnt&         thePoints,
+                 TColgp_Array2OfVec*         theD1U,
+                 TColgp_Array2OfVec*         theD1V,
+                 TColgp_Array2OfVec*         theD2U,
+                 TColgp_Array2OfVec*         theD2V,
+                 TColgp_Array2OfVec*         theD2UV) const;
+
 private:
   // copying is prohibited
   BSplSLib_Cache (const BSplSLib_Cache&);
@@ -226,41 +226,42 @@ BVH_Tree<T, N, BVH_QuadTree>* BVH_Tree<T, N, BVH_BinaryTree>::CollapseToQuadTree
     }
     else
     {
-      NCollection_Vector<int> aGrandChildNodes;
+      int aGrandChildNodes[4];
+      int aNbGrandChildNodes = 0;
 
       const int aLftChild = Child<0> (std::get<0> (aNode));
       const int aRghChild = Child<1> (std::get<0> (aNode));
       if (this->IsOuter (aLftChild)) // is leaf node
       {
-        aGrandChildNodes.Append (aLftChild);
+        aGrandChildNodes[aNbGrandChildNodes++] = aLftChild;
       }
       else
       {
-        aGrandChildNodes.Append (Child<0> (aLftChild));
-        aGrandChildNodes.Append (Child<1> (aLftChild));
+        aGrandChildNodes[aNbGrandChildNodes++] = Child<0> (aLftChild);
+        aGrandChildNodes[aNbGrandChildNodes++] = Child<1> (aLftChild);
       }
 
       if (this->IsOuter (aRghChild)) // is leaf node
       {
-        aGrandChildNodes.Append (aRghChild);
+        aGrandChildNodes[aNbGrandChildNodes++] = aRghChild;
       }
       else
       {
-        aGrandChildNodes.Append (Child<0> (aRghChild));
-        aGrandChildNodes.Append (Child<1> (aRghChild));
+        aGrandChildNodes[aNbGrandChildNodes++] = Child<0> (aRghChild);
+        aGrandChildNodes[aNbGrandChildNodes++] = Child<1> (aRghChild);
       }
 
-      for (int aNodeIdx = 0; aNodeIdx < aGrandChildNodes.Size(); ++aNodeIdx)
+      for (int aNodeIdx = 0; aNodeIdx < aNbGrandChildNodes; ++aNodeIdx)
       {
-        aQueue.push_back (std::make_pair (aGrandChildNodes (aNodeIdx), std::get<1> (aNode) + 1));
+        aQueue.push_back (std::make_pair (aGrandChildNodes[aNodeIdx], std::get<1> (aNode) + 1));
       }
 
       aNodeInfo = BVH_Vec4i (0 /* inner flag */,
-        aNbNodes, aGrandChildNodes.Size() - 1, std::get<1> (aNode) /* level */);
+        aNbNodes, aNbGrandChildNodes - 1, std::get<1> (aNode) /* level */);
 
       aQBVH->myDepth = Max (aQBVH->myDepth, std::get<1> (aNode) + 1);
 
-      aNbNodes += aGrandChildNodes.Size();
+      aNbNodes += aNbGrandChildNodes;
     }
 
     BVH::Array<int, 4>::Append (aQBVH->myNodeInfoBuffer, aNodeInfo);
@@ -68,6 +68,27 @@ public: //! @name Box-Box Square distance
     return aDist;
   }
 
+public: //! @name Box-Box overlap
+
+  //! Checks if the Axis aligned bounding boxes overlap.
+  //! In contrast to BVH_Box::IsOut() the check is performed without
+  //! branching on each dimension, which allows the compiler to
+  //! vectorize it. It is intended for the hot paths of the tree
+  //! traversal, where the boxes of the nodes are always valid.
+  static Standard_Boolean BoxBoxOverlap (const BVH_VecNt& theCMin1,
+                                         const BVH_VecNt& theCMax1,
+                                         const BVH_VecNt& theCMin2,
+                                         const BVH_VecNt& theCMax2)
+  {
+    int anIsOut = 0;
+    for (int i = 0; i < Min (N, 3); ++i)
+    {
+      anIsOut |= static_cast<int> (theCMin1[i] > theCMax2[i]) |
+                 static_cast<int> (theCMax1[i] < theCMin2[i]);
+    }
+    return anIsOut == 0;
+  }
+
 public: //! @name Point-Box Square distance
 
   //! Computes square distance between point and bounding box
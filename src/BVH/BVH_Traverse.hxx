@@ -17,6 +17,7 @@
 #define _BVH_Traverse_Header
 
 #include <BVH_Box.hxx>
+#include <BVH_QuadTree.hxx>
 #include <BVH_Tree.hxx>
 
 //! The classes implement the traverse of the BVH tree.
@@ -25,6 +26,12 @@
 //! - Traverse of the single tree
 //! - Parallel traverse of two trees
 //!
+//! Both methods are available for binary trees as well as for quad trees (QBVH),
+//! which may be obtained from the binary ones by BVH_Tree::CollapseToQuadTree().
+//! The quad trees are twice shallower, and the boxes of all children of the node
+//! are tested at once, which reduces the number of stack operations and improves
+//! the memory locality of the traverse on large trees.
+//!
 //! To perform Selection of the elements from BVH_Tree using
 //! the traverse methods implemented here it is
 //! required to define Acceptance/Rejection rules in the
@@ -251,6 +258,12 @@ public: //! @name Selection
   //! Returns the number of accepted elements.
   Standard_Integer Select (const opencascade::handle<BVH_Tree <NumType, Dimension>>& theBVH);
 
+  //! Performs selection of the elements from the quad BVH tree by the
+  //! rules defined in Accept/Reject methods.
+  //! The children of the node are processed in the order defined by their metrics.
+  //! Returns the number of accepted elements.
+  Standard_Integer Select (const opencascade::handle<BVH_Tree <NumType, Dimension, BVH_QuadTree>>& theBVH);
+
 protected: //! @name Fields
 
   BVHSetType* myBVHSet;
@@ -278,7 +291,8 @@ public: //! @name Constructor
   BVH_PairTraverse()
     : BVH_BaseTraverse<MetricType>(),
       myBVHSet1 (NULL),
-      myBVHSet2 (NULL)
+      myBVHSet2 (NULL),
+      myIsUniquePairs (Standard_False)
   {
   }
 
@@ -292,6 +306,25 @@ public: //! @name Setting the sets to access the elements and BVH trees
     myBVHSet2 = theBVHSet2;
   }
 
+public: //! @name Selection from the same tree
+
+  //! Sets the flag requiring only unique pairs of elements when the
+  //! same tree is given for both trees. In this case the mirrored pairs of nodes
+  //! are not traversed, thus, the mirrored pairs of elements (e.g. (2, 1) for (1, 2))
+  //! and the pairs of the same element are not passed into Accept() method.
+  //! The order of the elements in the accepted pairs is not defined.
+  //! The flag has no effect if different trees are given.
+  void SetUniquePairs (const Standard_Boolean theIsUnique)
+  {
+    myIsUniquePairs = theIsUnique;
+  }
+
+  //! Returns the flag requiring only unique pairs of elements from the same tree.
+  Standard_Boolean IsUniquePairs() const
+  {
+    return myIsUniquePairs;
+  }
+
 public: //! @name Rules for Accept/Reject
 
   //! Rejection of the pair of nodes by bounding boxes.
@@ -331,10 +364,17 @@ public: //! @name Selection
   Standard_Integer Select (const opencascade::handle<BVH_Tree <NumType, Dimension>>& theBVH1,
                            const opencascade::handle<BVH_Tree <NumType, Dimension>>& theBVH2);
 
+  //! Performs selection of the elements from two quad BVH trees by the
+  //! rules defined in Accept/Reject methods.
+  //! Returns the number of accepted pairs of elements.
+  Standard_Integer Select (const opencascade::handle<BVH_Tree <NumType, Dimension, BVH_QuadTree>>& theBVH1,
+                           const opencascade::handle<BVH_Tree <NumType, Dimension, BVH_QuadTree>>& theBVH2);
+
 protected: //! @name Fields
 
   BVHSetType* myBVHSet1;
   BVHSetType* myBVHSet2;
+  Standard_Boolean myIsUniquePairs; //!< Select only unique pairs from the same tree
 
 };
 
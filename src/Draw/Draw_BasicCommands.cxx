@@ -880,6 +880,14 @@ static int dmeminfo (Draw_Interpretor& theDI,
     {
       aCounters.Add (OSD_MemInfo::MemPrivate);
     }
+    else if (anArg == "alloc")
+    {
+      aCounters.Add (OSD_MemInfo::MemAllocatorReserved);
+    }
+    else if (anArg == "allocinuse")
+    {
+      aCounters.Add (OSD_MemInfo::MemAllocatorInUse);
+    }
     else
     {
       theDI << "Syntax error at '" << theArgVec[anIter] << "'!\n";
@@ -1341,7 +1349,7 @@ void Draw::BasicCommands(Draw_Interpretor& theCommands)
                   "debug memory allocation/deallocation, w/o args for help",
                   __FILE__, mallochook, g);
   theCommands.Add ("meminfo",
-    "meminfo [virt|v] [heap|h] [wset|w] [wsetpeak] [swap] [swappeak] [private]"
+    "meminfo [virt|v] [heap|h] [wset|w] [wsetpeak] [swap] [swappeak] [private] [alloc] [allocinuse]"
     " : memory counters for this process",
 	  __FILE__, dmeminfo, g);
   theCommands.Add("dperf","dperf [reset] -- show performance counters, reset if argument is provided",
@@ -31,6 +31,7 @@
 #include <gp_Trsf.hxx>
 #include <gp_Vec.hxx>
 #include <gp_XYZ.hxx>
+#include <NCollection_LocalArray.hxx>
 
 static Standard_Real PIPI = M_PI + M_PI;
 
@@ -1339,6 +1340,22 @@ void ElSLib::PlaneParameters (const gp_Ax3& Pos,
   V = Ploc.Y();
 }
 
+//=======================================================================
+//function : CylinderLocalParameters
+//purpose  : Computes the parameters of the point given in the local
+//           coordinate system of the cylinder
+//=======================================================================
+
+static void CylinderLocalParameters (const gp_Pnt& Ploc,
+                                     Standard_Real& U,
+                                     Standard_Real& V)
+{
+  U = atan2(Ploc.Y(),Ploc.X());
+  if      (U < -1.e-16)  U += PIPI;
+  else if (U < 0)        U = 0;
+  V = Ploc.Z();
+}
+
 //=======================================================================
 //function : CylindreParameters
 //purpose  : 
@@ -1352,29 +1369,21 @@ void ElSLib::CylinderParameters (const gp_Ax3& Pos,
 {
   gp_Trsf T;
   T.SetTransformation (Pos);
-  gp_Pnt Ploc = P.Transformed (T);
-  U = atan2(Ploc.Y(),Ploc.X());
-  if      (U < -1.e-16)  U += PIPI;
-  else if (U < 0)        U = 0;
-  V = Ploc.Z();
+  CylinderLocalParameters (P.Transformed (T), U, V);
 }
 
 //=======================================================================
-//function : ConeParameters
-//purpose  : 
+//function : ConeLocalParameters
+//purpose  : Computes the parameters of the point given in the local
+//           coordinate system of the cone
 //=======================================================================
 
-void ElSLib::ConeParameters(const gp_Ax3& Pos,
-			    const Standard_Real Radius,
-			    const Standard_Real SAngle,
-			    const gp_Pnt& P,
-			    Standard_Real& U,
-			    Standard_Real& V)
+static void ConeLocalParameters (const gp_Pnt& Ploc,
+                                 const Standard_Real Radius,
+                                 const Standard_Real SAngle,
+                                 Standard_Real& U,
+                                 Standard_Real& V)
 {
-  gp_Trsf T;
-  T.SetTransformation (Pos);
-  gp_Pnt Ploc = P.Transformed (T);
-
   if(Ploc.X() ==0.0  &&  Ploc.Y()==0.0 ) {
     U = 0.0;
   }
@@ -1402,19 +1411,32 @@ void ElSLib::ConeParameters(const gp_Ax3& Pos,
 }
 
 //=======================================================================
-//function : SphereParameters
+//function : ConeParameters
 //purpose  : 
 //=======================================================================
 
-void ElSLib::SphereParameters(const gp_Ax3& Pos,
-			      const Standard_Real,
-			      const gp_Pnt& P,
-			      Standard_Real& U,
-			      Standard_Real& V)
+void ElSLib::ConeParameters(const gp_Ax3& Pos,
+			    const Standard_Real Radius,
+			    const Standard_Real SAngle,
+			    const gp_Pnt& P,
+			    Standard_Real& U,
+			    Standard_Real& V)
 {
   gp_Trsf T;
   T.SetTransformation (Pos);
-  gp_Pnt Ploc = P.Transformed (T);
+  ConeLocalParameters (P.Transformed (T), Radius, SAngle, U, V);
+}
+
+//=======================================================================
+//function : SphereLocalParameters
+//purpose  : Computes the parameters of the point given in the local
+//           coordinate system of the sphere
+//=======================================================================
+
+static void SphereLocalParameters (const gp_Pnt& Ploc,
+                                   Standard_Real& U,
+                                   Standard_Real& V)
+{
   Standard_Real x, y, z;
   Ploc.Coord (x, y, z);
   Standard_Real l = sqrt (x * x + y * y);
@@ -1434,20 +1456,33 @@ void ElSLib::SphereParameters(const gp_Ax3& Pos,
 }
 
 //=======================================================================
-//function : TorusParameters
+//function : SphereParameters
 //purpose  : 
 //=======================================================================
 
-void ElSLib::TorusParameters(const gp_Ax3& Pos,
-			     const Standard_Real MajorRadius,
-			     const Standard_Real MinorRadius,
-			     const gp_Pnt& P,
-			     Standard_Real& U,
-			     Standard_Real& V)
+void ElSLib::SphereParameters(const gp_Ax3& Pos,
+			      const Standard_Real,
+			      const gp_Pnt& P,
+			      Standard_Real& U,
+			      Standard_Real& V)
+{
+  gp_Trsf T;
+  T.SetTransformation (Pos);
+  SphereLocalParameters (P.Transformed (T), U, V);
+}
+
+//=======================================================================
+//function : TorusLocalParameters
+//purpose  : Computes the parameters of the point given in the local
+//           coordinate system of the torus
+//=======================================================================
+
+static void TorusLocalParameters (const gp_Pnt& Ploc,
+                                  const Standard_Real MajorRadius,
+                                  const Standard_Real MinorRadius,
+                                  Standard_Real& U,
+                                  Standard_Real& V)
 {
-  gp_Trsf Tref;
-  Tref.SetTransformation (Pos);
-  gp_Pnt Ploc = P.Transformed (Tref);
   Standard_Real x, y, z;
   Ploc.Coord (x, y, z);
 
@@ -1494,6 +1529,765 @@ void ElSLib::TorusParameters(const gp_Ax3& Pos,
   else if (V < 0)        V = 0;
 }
 
+//=======================================================================
+//function : TorusParameters
+//purpose  : 
+//=======================================================================
+
+void ElSLib::TorusParameters(const gp_Ax3& Pos,
+			     const Standard_Real MajorRadius,
+			     const Standard_Real MinorRadius,
+			     const gp_Pnt& P,
+			     Standard_Real& U,
+			     Standard_Real& V)
+{
+  gp_Trsf Tref;
+  Tref.SetTransformation (Pos);
+  TorusLocalParameters (P.Transformed (Tref), MajorRadius, MinorRadius, U, V);
+}
+
+//=======================================================================
+//function : SinCos
+//purpose  : Computes the sines and the cosines of the parameters
+//           of the grid line
+//=======================================================================
+
+static void SinCos (const TColStd_Array1OfReal& theParams,
+                    NCollection_LocalArray<Standard_Real>& theCos,
+                    NCollection_LocalArray<Standard_Real>& theSin)
+{
+  const Standard_Integer aLower = theParams.Lower();
+  theCos.Allocate (theParams.Length());
+  theSin.Allocate (theParams.Length());
+  for (Standard_Integer i = 0; i < theParams.Length(); ++i)
+  {
+    theCos[i] = cos (theParams (aLower + i));
+    theSin[i] = sin (theParams (aLower + i));
+  }
+}
+
+//=======================================================================
+//function : PlaneD0Grid
+//purpose  : 
+//=======================================================================
+
+void ElSLib::PlaneD0Grid (const TColStd_Array1OfReal& theU,
+                          const TColStd_Array1OfReal& theV,
+                          const gp_Ax3& thePos,
+                          TColgp_Array2OfPnt& thePoints)
+{
+  const gp_XYZ& XDir = thePos.XDirection().XYZ();
+  const gp_XYZ& YDir = thePos.YDirection().XYZ();
+  const gp_XYZ& PLoc = thePos.Location  ().XYZ();
+  for (Standard_Integer i = theU.Lower(); i <= theU.Upper(); ++i)
+  {
+    const Standard_Real U = theU (i);
+    for (Standard_Integer j = theV.Lower(); j <= theV.Upper(); ++j)
+    {
+      const Standard_Real V = theV (j);
+      gp_Pnt& P = thePoints.ChangeValue (i, j);
+      P.SetX(U * XDir.X() + V * YDir.X() + PLoc.X());
+      P.SetY(U * XDir.Y() + V * YDir.Y() + PLoc.Y());
+      P.SetZ(U * XDir.Z() + V * YDir.Z() + PLoc.Z());
+    }
+  }
+}
+
+//=======================================================================
+//function : CylinderD0Grid
+//purpose  : 
+//=======================================================================
+
+void ElSLib::CylinderD0Grid (const TColStd_Array1OfReal& theU,
+                             const TColStd_Array1OfReal& theV,
+                             const gp_Ax3& thePos,
+                             const Standard_Real theRadius,
+                             TColgp_Array2OfPnt& thePoints)
+{
+  const gp_XYZ& XDir = thePos.XDirection().XYZ();
+  const gp_XYZ& YDir = thePos.YDirection().XYZ();
+  const gp_XYZ& ZDir = thePos.Direction ().XYZ();
+  const gp_XYZ& PLoc = thePos.Location  ().XYZ();
+  for (Standard_Integer i = theU.Lower(); i <= theU.Upper(); ++i)
+  {
+    const Standard_Real A1 = theRadius * cos(theU (i));
+    const Standard_Real A2 = theRadius * sin(theU (i));
+    for (Standard_Integer j = theV.Lower(); j <= theV.Upper(); ++j)
+    {
+      const Standard_Real V = theV (j);
+      gp_Pnt& P = thePoints.ChangeValue (i, j);
+      P.SetX(A1 * XDir.X() + A2 * YDir.X() + V * ZDir.X() + PLoc.X());
+      P.SetY(A1 * XDir.Y() + A2 * YDir.Y() + V * ZDir.Y() + PLoc.Y());
+      P.SetZ(A1 * XDir.Z() + A2 * YDir.Z() + V * ZDir.Z() + PLoc.Z());
+    }
+  }
+}
+
+//=======================================================================
+//function : ConeD0Grid
+//purpose  : 
+//=======================================================================
+
+void ElSLib::ConeD0Grid (const TColStd_Array1OfReal& theU,
+                         const TColStd_Array1OfReal& theV,
+                         const gp_Ax3& thePos,
+                         const Standard_Real theRadius,
+                         const Standard_Real theSAngle,
+                         TColgp_Array2OfPnt& thePoints)
+{
+  const gp_XYZ& XDir = thePos.XDirection().XYZ();
+  const gp_XYZ& YDir = thePos.YDirection().XYZ();
+  const gp_XYZ& ZDir = thePos.Direction ().XYZ();
+  const gp_XYZ& PLoc = thePos.Location  ().XYZ();
+  const Standard_Real CosA = cos(theSAngle);
+  const Standard_Real SinA = sin(theSAngle);
+  NCollection_LocalArray<Standard_Real> aCosU, aSinU;
+  SinCos (theU, aCosU, aSinU);
+  for (Standard_Integer j = theV.Lower(); j <= theV.Upper(); ++j)
+  {
+    const Standard_Real R  = theRadius + theV (j) * SinA;
+    const Standard_Real A3 =             theV (j) * CosA;
+    for (Standard_Integer i = theU.Lower(), k = 0; i <= theU.Upper(); ++i, ++k)
+    {
+      const Standard_Real A1 = R * aCosU[k];
+      const Standard_Real A2 = R * aSinU[k];
+      gp_Pnt& P = thePoints.ChangeValue (i, j);
+      P.SetX(A1 * XDir.X() + A2 * YDir.X() + A3 * ZDir.X() + PLoc.X());
+      P.SetY(A1 * XDir.Y() + A2 * YDir.Y() + A3 * ZDir.Y() + PLoc.Y());
+      P.SetZ(A1 * XDir.Z() + A2 * YDir.Z() + A3 * ZDir.Z() + PLoc.Z());
+    }
+  }
+}
+
+//=======================================================================
+//function : SphereD0Grid
+//purpose  : 
+//=======================================================================
+
+void ElSLib::SphereD0Grid (const TColStd_Array1OfReal& theU,
+                           const TColStd_Array1OfReal& theV,
+                           const gp_Ax3& thePos,
+                           const Standard_Real theRadius,
+                           TColgp_Array2OfPnt& thePoints)
+{
+  const gp_XYZ& XDir = thePos.XDirection().XYZ();
+  const gp_XYZ& YDir = thePos.YDirection().XYZ();
+  const gp_XYZ& ZDir = thePos.Direction ().XYZ();
+  const gp_XYZ& PLoc = thePos.Location  ().XYZ();
+  NCollection_LocalArray<Standard_Real> aCosU, aSinU;
+  SinCos (theU, aCosU, aSinU);
+  for (Standard_Integer j = theV.Lower(); j <= theV.Upper(); ++j)
+  {
+    const Standard_Real R  = theRadius * cos(theV (j));
+    const Standard_Real A3 = theRadius * sin(theV (j));
+    for (Standard_Integer i = theU.Lower(), k = 0; i <= theU.Upper(); ++i, ++k)
+    {
+      const Standard_Real A1 = R * aCosU[k];
+      const Standard_Real A2 = R * aSinU[k];
+      gp_Pnt& P = thePoints.ChangeValue (i, j);
+      P.SetX(A1 * XDir.X() + A2 * YDir.X() + A3 * ZDir.X() + PLoc.X());
+      P.SetY(A1 * XDir.Y() + A2 * YDir.Y() + A3 * ZDir.Y() + PLoc.Y());
+      P.SetZ(A1 * XDir.Z() + A2 * YDir.Z() + A3 * ZDir.Z() + PLoc.Z());
+    }
+  }
+}
+
+//=======================================================================
+//function : TorusD0Grid
+//purpose  : 
+//=======================================================================
+
+void ElSLib::TorusD0Grid (const TColStd_Array1OfReal& theU,
+                          const TColStd_Array1OfReal& theV,
+                          const gp_Ax3& thePos,
+                          const Standard_Real theMajorRadius,
+                          const Standard_Real theMinorRadius,
+                          TColgp_Array2OfPnt& thePoints)
+{
+  const gp_XYZ& XDir = thePos.XDirection().XYZ();
+  const gp_XYZ& YDir = thePos.YDirection().XYZ();
+  const gp_XYZ& ZDir = thePos.Direction ().XYZ();
+  const gp_XYZ& PLoc = thePos.Location  ().XYZ();
+  const Standard_Real eps = 10.*(theMinorRadius + theMajorRadius)*RealEpsilon();
+  NCollection_LocalArray<Standard_Real> aCosU, aSinU;
+  SinCos (theU, aCosU, aSinU);
+  for (Standard_Integer j = theV.Lower(); j <= theV.Upper(); ++j)
+  {
+    const Standard_Real R  = theMajorRadius + theMinorRadius * cos(theV (j));
+    Standard_Real       A3 =                  theMinorRadius * sin(theV (j));
+    if (Abs(A3) <= eps)
+      A3 = 0.;
+    for (Standard_Integer i = theU.Lower(), k = 0; i <= theU.Upper(); ++i, ++k)
+    {
+      Standard_Real A1 = R * aCosU[k];
+      Standard_Real A2 = R * aSinU[k];
+      if (Abs(A1) <= eps)
+        A1 = 0.;
+      if (Abs(A2) <= eps)
+        A2 = 0.;
+      gp_Pnt& P = thePoints.ChangeValue (i, j);
+      P.SetX(A1 * XDir.X() + A2 * YDir.X() + A3 * ZDir.X() + PLoc.X());
+      P.SetY(A1 * XDir.Y() + A2 * YDir.Y() + A3 * ZDir.Y() + PLoc.Y());
+      P.SetZ(A1 * XDir.Z() + A2 * YDir.Z() + A3 * ZDir.Z() + PLoc.Z());
+    }
+  }
+}
+
+//=======================================================================
+//function : PlaneD1Grid
+//purpose  : 
+//=======================================================================
+
+void ElSLib::PlaneD1Grid (const TColStd_Array1OfReal& theU,
+                          const TColStd_Array1OfReal& theV,
+                          const gp_Ax3& thePos,
+                          TColgp_Array2OfPnt& thePoints,
+                          TColgp_Array2OfVec& theD1U,
+                          TColgp_Array2OfVec& theD1V)
+{
+  PlaneD0Grid (theU, theV, thePos, thePoints);
+  theD1U.Init (gp_Vec (thePos.XDirection()));
+  theD1V.Init (gp_Vec (thePos.YDirection()));
+}
+
+//=======================================================================
+//function : CylinderD1Grid
+//purpose  : 
+//=======================================================================
+
+void ElSLib::CylinderD1Grid (const TColStd_Array1OfReal& theU,
+                             const TColStd_Array1OfReal& theV,
+                             const gp_Ax3& thePos,
+                             const Standard_Real theRadius,
+                             TColgp_Array2OfPnt& thePoints,
+                             TColgp_Array2OfVec& theD1U,
+                             TColgp_Array2OfVec& theD1V)
+{
+  CylinderD0Grid (theU, theV, thePos, theRadius, thePoints);
+  const gp_XYZ& XDir = thePos.XDirection().XYZ();
+  const gp_XYZ& YDir = thePos.YDirection().XYZ();
+  for (Standard_Integer i = theU.Lower(); i <= theU.Upper(); ++i)
+  {
+    const Standard_Real A1 = theRadius * cos(theU (i));
+    const Standard_Real A2 = theRadius * sin(theU (i));
+    const gp_Vec Vu (- A2 * XDir.X() + A1 * YDir.X(),
+                     - A2 * XDir.Y() + A1 * YDir.Y(),
+                     - A2 * XDir.Z() + A1 * YDir.Z());
+    for (Standard_Integer j = theV.Lower(); j <= theV.Upper(); ++j)
+    {
+      theD1U.SetValue (i, j, Vu);
+    }
+  }
+  theD1V.Init (gp_Vec (thePos.Direction()));
+}
+
+//=======================================================================
+//function : ConeD1Grid
+//purpose  : 
+//=======================================================================
+
+void ElSLib::ConeD1Grid (const TColStd_Array1OfReal& theU,
+                         const TColStd_Array1OfReal& theV,
+                         const gp_Ax3& thePos,
+                         const Standard_Real theRadius,
+                         const Standard_Real theSAngle,
+                         TColgp_Array2OfPnt& thePoints,
+                         TColgp_Array2OfVec& theD1U,
+                         TColgp_Array2OfVec& theD1V)
+{
+  const gp_XYZ& XDir = thePos.XDirection().XYZ();
+  const gp_XYZ& YDir = thePos.YDirection().XYZ();
+  const gp_XYZ& ZDir = thePos.Direction ().XYZ();
+  const gp_XYZ& PLoc = thePos.Location  ().XYZ();
+  const Standard_Real CosA = cos(theSAngle);
+  const Standard_Real SinA = sin(theSAngle);
+  NCollection_LocalArray<Standard_Real> aCosU, aSinU;
+  SinCos (theU, aCosU, aSinU);
+  for (Standard_Integer j = theV.Lower(); j <= theV.Upper(); ++j)
+  {
+    const Standard_Real R  = theRadius + theV (j) * SinA;
+    const Standard_Real A3 =             theV (j) * CosA;
+    for (Standard_Integer i = theU.Lower(), k = 0; i <= theU.Upper(); ++i, ++k)
+    {
+      const Standard_Real A1 = R * aCosU[k];
+      const Standard_Real A2 = R * aSinU[k];
+      const Standard_Real R1 = SinA * aCosU[k];
+      const Standard_Real R2 = SinA * aSinU[k];
+      gp_Pnt& P  = thePoints.ChangeValue (i, j);
+      gp_Vec& Vu = theD1U   .ChangeValue (i, j);
+      gp_Vec& Vv = theD1V   .ChangeValue (i, j);
+      P .SetX(  A1 * XDir.X() + A2 * YDir.X() + A3 * ZDir.X() + PLoc.X());
+      P .SetY(  A1 * XDir.Y() + A2 * YDir.Y() + A3 * ZDir.Y() + PLoc.Y());
+      P .SetZ(  A1 * XDir.Z() + A2 * YDir.Z() + A3 * ZDir.Z() + PLoc.Z());
+      Vu.SetX(- A2 * XDir.X() + A1 * YDir.X());
+      Vu.SetY(- A2 * XDir.Y() + A1 * YDir.Y());
+      Vu.SetZ(- A2 * XDir.Z() + A1 * YDir.Z());
+      Vv.SetX(  R1 * XDir.X() + R2 * YDir.X() + CosA * ZDir.X());
+      Vv.SetY(  R1 * XDir.Y() + R2 * YDir.Y() + CosA * ZDir.Y());
+      Vv.SetZ(  R1 * XDir.Z() + R2 * YDir.Z() + CosA * ZDir.Z());
+    }
+  }
+}
+
+//=======================================================================
+//function : SphereD1Grid
+//purpose  : 
+//=======================================================================
+
+void ElSLib::SphereD1Grid (const TColStd_Array1OfReal& theU,
+                           const TColStd_Array1OfReal& theV,
+                           const gp_Ax3& thePos,
+                           const Standard_Real theRadius,
+                           TColgp_Array2OfPnt& thePoints,
+                           TColgp_Array2OfVec& theD1U,
+                           TColgp_Array2OfVec& theD1V)
+{
+  const gp_XYZ& XDir = thePos.XDirection().XYZ();
+  const gp_XYZ& YDir = thePos.YDirection().XYZ();
+  const gp_XYZ& ZDir = thePos.Direction ().XYZ();
+  const gp_XYZ& PLoc = thePos.Location  ().XYZ();
+  NCollection_LocalArray<Standard_Real> aCosU, aSinU;
+  SinCos (theU, aCosU, aSinU);
+  for (Standard_Integer j = theV.Lower(); j <= theV.Upper(); ++j)
+  {
+    const Standard_Real R1 = theRadius * cos(theV (j));
+    const Standard_Real R2 = theRadius * sin(theV (j));
+    for (Standard_Integer i = theU.Lower(), k = 0; i <= theU.Upper(); ++i, ++k)
+    {
+      const Standard_Real A1 = R1 * aCosU[k];
+      const Standard_Real A2 = R1 * aSinU[k];
+      const Standard_Real A3 = R2 * aCosU[k];
+      const Standard_Real A4 = R2 * aSinU[k];
+      gp_Pnt& P  = thePoints.ChangeValue (i, j);
+      gp_Vec& Vu = theD1U   .ChangeValue (i, j);
+      gp_Vec& Vv = theD1V   .ChangeValue (i, j);
+      P .SetX(  A1 * XDir.X() + A2 * YDir.X() + R2 * ZDir.X() + PLoc.X());
+      P .SetY(  A1 * XDir.Y() + A2 * YDir.Y() + R2 * ZDir.Y() + PLoc.Y());
+      P .SetZ(  A1 * XDir.Z() + A2 * YDir.Z() + R2 * ZDir.Z() + PLoc.Z());
+      Vu.SetX(- A2 * XDir.X() + A1 * YDir.X());
+      Vu.SetY(- A2 * XDir.Y() + A1 * YDir.Y());
+      Vu.SetZ(- A2 * XDir.Z() + A1 * YDir.Z());
+      Vv.SetX(- A3 * XDir.X() - A4 * YDir.X() + R1 * ZDir.X());
+      Vv.SetY(- A3 * XDir.Y() - A4 * YDir.Y() + R1 * ZDir.Y());
+      Vv.SetZ(- A3 * XDir.Z() - A4 * YDir.Z() + R1 * ZDir.Z());
+    }
+  }
+}
+
+//=======================================================================
+//function : TorusD1Grid
+//purpose  : 
+//=======================================================================
+
+void ElSLib::TorusD1Grid (const TColStd_Array1OfReal& theU,
+                          const TColStd_Array1OfReal& theV,
+                          const gp_Ax3& thePos,
+                          const Standard_Real theMajorRadius,
+                          const Standard_Real theMinorRadius,
+                          TColgp_Array2OfPnt& thePoints,
+                          TColgp_Array2OfVec& theD1U,
+                          TColgp_Array2OfVec& theD1V)
+{
+  const gp_XYZ& XDir = thePos.XDirection().XYZ();
+  const gp_XYZ& YDir = thePos.YDirection().XYZ();
+  const gp_XYZ& ZDir = thePos.Direction ().XYZ();
+  const gp_XYZ& PLoc = thePos.Location  ().XYZ();
+  const Standard_Real eps = 10.*(theMinorRadius + theMajorRadius)*RealEpsilon();
+  NCollection_LocalArray<Standard_Real> aCosU, aSinU;
+  SinCos (theU, aCosU, aSinU);
+  for (Standard_Integer j = theV.Lower(); j <= theV.Upper(); ++j)
+  {
+    const Standard_Real R1 = theMinorRadius * cos(theV (j));
+    const Standard_Real R2 = theMinorRadius * sin(theV (j));
+    const Standard_Real R  = theMajorRadius + R1;
+    for (Standard_Integer i = theU.Lower(), k = 0; i <= theU.Upper(); ++i, ++k)
+    {
+      Standard_Real A1 = R  * aCosU[k];
+      Standard_Real A2 = R  * aSinU[k];
+      Standard_Real A3 = R2 * aCosU[k];
+      Standard_Real A4 = R2 * aSinU[k];
+      if (Abs(A1) <= eps)
+        A1 = 0.;
+      if (Abs(A2) <= eps)
+        A2 = 0.;
+      if (Abs(A3) <= eps)
+        A3 = 0.;
+      if (Abs(A4) <= eps)
+        A4 = 0.;
+      gp_Pnt& P  = thePoints.ChangeValue (i, j);
+      gp_Vec& Vu = theD1U   .ChangeValue (i, j);
+      gp_Vec& Vv = theD1V   .ChangeValue (i, j);
+      P .SetX(  A1 * XDir.X() + A2 * YDir.X() + R2 * ZDir.X() + PLoc.X());
+      P .SetY(  A1 * XDir.Y() + A2 * YDir.Y() + R2 * ZDir.Y() + PLoc.Y());
+      P .SetZ(  A1 * XDir.Z() + A2 * YDir.Z() + R2 * ZDir.Z() + PLoc.Z());
+      Vu.SetX(- A2 * XDir.X() + A1 * YDir.X());
+      Vu.SetY(- A2 * XDir.Y() + A1 * YDir.Y());
+      Vu.SetZ(- A2 * XDir.Z() + A1 * YDir.Z());
+      Vv.SetX(- A3 * XDir.X() - A4 * YDir.X() + R1 * ZDir.X());
+      Vv.SetY(- A3 * XDir.Y() - A4 * YDir.Y() + R1 * ZDir.Y());
+      Vv.SetZ(- A3 * XDir.Z() - A4 * YDir.Z() + R1 * ZDir.Z());
+    }
+  }
+}
+
+//=======================================================================
+//function : CylinderD2Grid
+//purpose  : 
+//=======================================================================
+
+void ElSLib::CylinderD2Grid (const TColStd_Array1OfReal& theU,
+                             const TColStd_Array1OfReal& theV,
+                             const gp_Ax3& thePos,
+                             const Standard_Real theRadius,
+                             TColgp_Array2OfPnt& thePoints,
+                             TColgp_Array2OfVec& theD1U,
+                             TColgp_Array2OfVec& theD1V,
+                             TColgp_Array2OfVec& theD2U,
+                             TColgp_Array2OfVec& theD2V,
+                             TColgp_Array2OfVec& theD2UV)
+{
+  const gp_XYZ& XDir = thePos.XDirection().XYZ();
+  const gp_XYZ& YDir = thePos.YDirection().XYZ();
+  const gp_XYZ& ZDir = thePos.Direction ().XYZ();
+  const gp_XYZ& PLoc = thePos.Location  ().XYZ();
+  for (Standard_Integer i = theU.Lower(); i <= theU.Upper(); ++i)
+  {
+    const Standard_Real A1 = theRadius * cos(theU (i));
+    const Standard_Real A2 = theRadius * sin(theU (i));
+    const Standard_Real Som1X = A1 * XDir.X() + A2 * YDir.X();
+    const Standard_Real Som1Y = A1 * XDir.Y() + A2 * YDir.Y();
+    const Standard_Real Som1Z = A1 * XDir.Z() + A2 * YDir.Z();
+    const gp_Vec Vu (- A2 * XDir.X() + A1 * YDir.X(),
+                     - A2 * XDir.Y() + A1 * YDir.Y(),
+                     - A2 * XDir.Z() + A1 * YDir.Z());
+    const gp_Vec Vuu (- Som1X, - Som1Y, - Som1Z);
+    for (Standard_Integer j = theV.Lower(); j <= theV.Upper(); ++j)
+    {
+      const Standard_Real V = theV (j);
+      gp_Pnt& P = thePoints.ChangeValue (i, j);
+      P.SetX(  Som1X + V * ZDir.X() + PLoc.X());
+      P.SetY(  Som1Y + V * ZDir.Y() + PLoc.Y());
+      P.SetZ(  Som1Z + V * ZDir.Z() + PLoc.Z());
+      theD1U.SetValue (i, j, Vu);
+      theD2U.SetValue (i, j, Vuu);
+    }
+  }
+  theD1V .Init (gp_Vec (thePos.Direction()));
+  theD2V .Init (gp_Vec (0.0, 0.0, 0.0));
+  theD2UV.Init (gp_Vec (0.0, 0.0, 0.0));
+}
+
+//=======================================================================
+//function : ConeD2Grid
+//purpose  : 
+//=======================================================================
+
+void ElSLib::ConeD2Grid (const TColStd_Array1OfReal& theU,
+                         const TColStd_Array1OfReal& theV,
+                         const gp_Ax3& thePos,
+                         const Standard_Real theRadius,
+                         const Standard_Real theSAngle,
+                         TColgp_Array2OfPnt& thePoints,
+                         TColgp_Array2OfVec& theD1U,
+                         TColgp_Array2OfVec& theD1V,
+                         TColgp_Array2OfVec& theD2U,
+                         TColgp_Array2OfVec& theD2V,
+                         TColgp_Array2OfVec& theD2UV)
+{
+  const gp_XYZ& XDir = thePos.XDirection().XYZ();
+  const gp_XYZ& YDir = thePos.YDirection().XYZ();
+  const gp_XYZ& ZDir = thePos.Direction ().XYZ();
+  const gp_XYZ& PLoc = thePos.Location  ().XYZ();
+  const Standard_Real CosA = cos(theSAngle);
+  const Standard_Real SinA = sin(theSAngle);
+  NCollection_LocalArray<Standard_Real> aCosU, aSinU;
+  SinCos (theU, aCosU, aSinU);
+  for (Standard_Integer j = theV.Lower(); j <= theV.Upper(); ++j)
+  {
+    const Standard_Real R  = theRadius + theV (j) * SinA;
+    const Standard_Real A3 =             theV (j) * CosA;
+    for (Standard_Integer i = theU.Lower(), k = 0; i <= theU.Upper(); ++i, ++k)
+    {
+      const Standard_Real A1 = R * aCosU[k];
+      const Standard_Real A2 = R * aSinU[k];
+      const Standard_Real R1 = SinA * aCosU[k];
+      const Standard_Real R2 = SinA * aSinU[k];
+      const Standard_Real Som1X = A1 * XDir.X() + A2 * YDir.X();
+      const Standard_Real Som1Y = A1 * XDir.Y() + A2 * YDir.Y();
+      const Standard_Real Som1Z = A1 * XDir.Z() + A2 * YDir.Z();
+      gp_Pnt& P   = thePoints.ChangeValue (i, j);
+      gp_Vec& Vu  = theD1U   .ChangeValue (i, j);
+      gp_Vec& Vv  = theD1V   .ChangeValue (i, j);
+      gp_Vec& Vuu = theD2U   .ChangeValue (i, j);
+      gp_Vec& Vuv = theD2UV  .ChangeValue (i, j);
+      P  .SetX(  Som1X + A3 * ZDir.X() + PLoc.X());
+      P  .SetY(  Som1Y + A3 * ZDir.Y() + PLoc.Y());
+      P  .SetZ(  Som1Z + A3 * ZDir.Z() + PLoc.Z());
+      Vu .SetX(- A2 * XDir.X() + A1 * YDir.X());
+      Vu .SetY(- A2 * XDir.Y() + A1 * YDir.Y());
+      Vu .SetZ(- A2 * XDir.Z() + A1 * YDir.Z());
+      Vv .SetX(  R1 * XDir.X() + R2 * YDir.X() + CosA * ZDir.X());
+      Vv .SetY(  R1 * XDir.Y() + R2 * YDir.Y() + CosA * ZDir.Y());
+      Vv .SetZ(  R1 * XDir.Z() + R2 * YDir.Z() + CosA * ZDir.Z());
+      Vuu.SetX(- Som1X);
+      Vuu.SetY(- Som1Y);
+      Vuu.SetZ(- Som1Z);
+      Vuv.SetX(- R2 * XDir.X() + R1 * YDir.X());
+      Vuv.SetY(- R2 * XDir.Y() + R1 * YDir.Y());
+      Vuv.SetZ(- R2 * XDir.Z() + R1 * YDir.Z());
+    }
+  }
+  theD2V.Init (gp_Vec (0.0, 0.0, 0.0));
+}
+
+//=======================================================================
+//function : SphereD2Grid
+//purpose  : 
+//=======================================================================
+
+void ElSLib::SphereD2Grid (const TColStd_Array1OfReal& theU,
+                           const TColStd_Array1OfReal& theV,
+                           const gp_Ax3& thePos,
+                           const Standard_Real theRadius,
+                           TColgp_Array2OfPnt& thePoints,
+                           TColgp_Array2OfVec& theD1U,
+                           TColgp_Array2OfVec& theD1V,
+                           TColgp_Array2OfVec& theD2U,
+                           TColgp_Array2OfVec& theD2V,
+                           TColgp_Array2OfVec& theD2UV)
+{
+  const gp_XYZ& XDir = thePos.XDirection().XYZ();
+  const gp_XYZ& YDir = thePos.YDirection().XYZ();
+  const gp_XYZ& ZDir = thePos.Direction ().XYZ();
+  const gp_XYZ& PLoc = thePos.Location  ().XYZ();
+  NCollection_LocalArray<Standard_Real> aCosU, aSinU;
+  SinCos (theU, aCosU, aSinU);
+  for (Standard_Integer j = theV.Lower(); j <= theV.Upper(); ++j)
+  {
+    const Standard_Real R1 = theRadius * cos(theV (j));
+    const Standard_Real R2 = theRadius * sin(theV (j));
+    const Standard_Real R2ZX = R2 * ZDir.X();
+    const Standard_Real R2ZY = R2 * ZDir.Y();
+    const Standard_Real R2ZZ = R2 * ZDir.Z();
+    for (Standard_Integer i = theU.Lower(), k = 0; i <= theU.Upper(); ++i, ++k)
+    {
+      const Standard_Real A1 = R1 * aCosU[k];
+      const Standard_Real A2 = R1 * aSinU[k];
+      const Standard_Real A3 = R2 * aCosU[k];
+      const Standard_Real A4 = R2 * aSinU[k];
+      const Standard_Real Som1X = A1 * XDir.X() + A2 * YDir.X();
+      const Standard_Real Som1Y = A1 * XDir.Y() + A2 * YDir.Y();
+      const Standard_Real Som1Z = A1 * XDir.Z() + A2 * YDir.Z();
+      gp_Pnt& P   = thePoints.ChangeValue (i, j);
+      gp_Vec& Vu  = theD1U   .ChangeValue (i, j);
+      gp_Vec& Vv  = theD1V   .ChangeValue (i, j);
+      gp_Vec& Vuu = theD2U   .ChangeValue (i, j);
+      gp_Vec& Vvv = theD2V   .ChangeValue (i, j);
+      gp_Vec& Vuv = theD2UV  .ChangeValue (i, j);
+      P  .SetX(  Som1X + R2ZX + PLoc.X());
+      P  .SetY(  Som1Y + R2ZY + PLoc.Y());
+      P  .SetZ(  Som1Z + R2ZZ + PLoc.Z());
+      Vu .SetX(- A2 * XDir.X() + A1 * YDir.X());
+      Vu .SetY(- A2 * XDir.Y() + A1 * YDir.Y());
+      Vu .SetZ(- A2 * XDir.Z() + A1 * YDir.Z());
+      Vv .SetX(- A3 * XDir.X() - A4 * YDir.X() + R1 * ZDir.X());
+      Vv .SetY(- A3 * XDir.Y() - A4 * YDir.Y() + R1 * ZDir.Y());
+      Vv .SetZ(- A3 * XDir.Z() - A4 * YDir.Z() + R1 * ZDir.Z());
+      Vuu.SetX(- Som1X);
+      Vuu.SetY(- Som1Y);
+      Vuu.SetZ(- Som1Z);
+      Vvv.SetX(- Som1X - R2ZX);
+      Vvv.SetY(- Som1Y - R2ZY);
+      Vvv.SetZ(- Som1Z - R2ZZ);
+      Vuv.SetX(  A4 * XDir.X() - A3 * YDir.X());
+      Vuv.SetY(  A4 * XDir.Y() - A3 * YDir.Y());
+      Vuv.SetZ(  A4 * XDir.Z() - A3 * YDir.Z());
+    }
+  }
+}
+
+//=======================================================================
+//function : TorusD2Grid
+//purpose  : 
+//=======================================================================
+
+void ElSLib::TorusD2Grid (const TColStd_Array1OfReal& theU,
+                          const TColStd_Array1OfReal& theV,
+                          const gp_Ax3& thePos,
+                          const Standard_Real theMajorRadius,
+                          const Standard_Real theMinorRadius,
+                          TColgp_Array2OfPnt& thePoints,
+                          TColgp_Array2OfVec& theD1U,
+                          TColgp_Array2OfVec& theD1V,
+                          TColgp_Array2OfVec& theD2U,
+                          TColgp_Array2OfVec& theD2V,
+                          TColgp_Array2OfVec& theD2UV)
+{
+  const gp_XYZ& XDir = thePos.XDirection().XYZ();
+  const gp_XYZ& YDir = thePos.YDirection().XYZ();
+  const gp_XYZ& ZDir = thePos.Direction ().XYZ();
+  const gp_XYZ& PLoc = thePos.Location  ().XYZ();
+  const Standard_Real eps = 10.*(theMinorRadius + theMajorRadius)*RealEpsilon();
+  NCollection_LocalArray<Standard_Real> aCosU, aSinU;
+  SinCos (theU, aCosU, aSinU);
+  for (Standard_Integer j = theV.Lower(); j <= theV.Upper(); ++j)
+  {
+    const Standard_Real R1 = theMinorRadius * cos(theV (j));
+    const Standard_Real R2 = theMinorRadius * sin(theV (j));
+    const Standard_Real R  = theMajorRadius + R1;
+    const Standard_Real R2ZX = R2 * ZDir.X();
+    const Standard_Real R2ZY = R2 * ZDir.Y();
+    const Standard_Real R2ZZ = R2 * ZDir.Z();
+    for (Standard_Integer i = theU.Lower(), k = 0; i <= theU.Upper(); ++i, ++k)
+    {
+      Standard_Real A1 = R  * aCosU[k];
+      Standard_Real A2 = R  * aSinU[k];
+      Standard_Real A3 = R2 * aCosU[k];
+      Standard_Real A4 = R2 * aSinU[k];
+      Standard_Real A5 = R1 * aCosU[k];
+      Standard_Real A6 = R1 * aSinU[k];
+      if (Abs(A1) <= eps)
+        A1 = 0.;
+      if (Abs(A2) <= eps)
+        A2 = 0.;
+      if (Abs(A3) <= eps)
+        A3 = 0.;
+      if (Abs(A4) <= eps)
+        A4 = 0.;
+      if (Abs(A5) <= eps)
+        A5 = 0.;
+      if (Abs(A6) <= eps)
+        A6 = 0.;
+      const Standard_Real Som1X = A1 * XDir.X() + A2 * YDir.X();
+      const Standard_Real Som1Y = A1 * XDir.Y() + A2 * YDir.Y();
+      const Standard_Real Som1Z = A1 * XDir.Z() + A2 * YDir.Z();
+      gp_Pnt& P   = thePoints.ChangeValue (i, j);
+      gp_Vec& Vu  = theD1U   .ChangeValue (i, j);
+      gp_Vec& Vv  = theD1V   .ChangeValue (i, j);
+      gp_Vec& Vuu = theD2U   .ChangeValue (i, j);
+      gp_Vec& Vvv = theD2V   .ChangeValue (i, j);
+      gp_Vec& Vuv = theD2UV  .ChangeValue (i, j);
+      P  .SetX(  Som1X + R2ZX + PLoc.X());
+      P  .SetY(  Som1Y + R2ZY + PLoc.Y());
+      P  .SetZ(  Som1Z + R2ZZ + PLoc.Z());
+      Vu .SetX(- A2 * XDir.X() + A1 * YDir.X());
+      Vu .SetY(- A2 * XDir.Y() + A1 * YDir.Y());
+      Vu .SetZ(- A2 * XDir.Z() + A1 * YDir.Z());
+      Vv .SetX(- A3 * XDir.X() - A4 * YDir.X() + R1 * ZDir.X());
+      Vv .SetY(- A3 * XDir.Y() - A4 * YDir.Y() + R1 * ZDir.Y());
+      Vv .SetZ(- A3 * XDir.Z() - A4 * YDir.Z() + R1 * ZDir.Z());
+      Vuu.SetX(- Som1X);
+      Vuu.SetY(- Som1Y);
+      Vuu.SetZ(- Som1Z);
+      Vvv.SetX(- A5 * XDir.X() - A6 * YDir.X() - R2ZX);
+      Vvv.SetY(- A5 * XDir.Y() - A6 * YDir.Y() - R2ZY);
+      Vvv.SetZ(- A5 * XDir.Z() - A6 * YDir.Z() - R2ZZ);
+      Vuv.SetX(  A4 * XDir.X() - A3 * YDir.X());
+      Vuv.SetY(  A4 * XDir.Y() - A3 * YDir.Y());
+      Vuv.SetZ(  A4 * XDir.Z() - A3 * YDir.Z());
+    }
+  }
+}
+
+//=======================================================================
+//function : PlaneParameters
+//purpose  : 
+//=======================================================================
+
+void ElSLib::PlaneParameters (const gp_Ax3& thePos,
+                              const TColgp_Array1OfPnt& thePoints,
+                              TColStd_Array1OfReal& theU,
+                              TColStd_Array1OfReal& theV)
+{
+  gp_Trsf T;
+  T.SetTransformation (thePos);
+  for (Standard_Integer i = thePoints.Lower(); i <= thePoints.Upper(); ++i)
+  {
+    const gp_Pnt Ploc = thePoints (i).Transformed (T);
+    theU (i) = Ploc.X();
+    theV (i) = Ploc.Y();
+  }
+}
+
+//=======================================================================
+//function : CylinderParameters
+//purpose  : 
+//=======================================================================
+
+void ElSLib::CylinderParameters (const gp_Ax3& thePos,
+                                 const Standard_Real,
+                                 const TColgp_Array1OfPnt& thePoints,
+                                 TColStd_Array1OfReal& theU,
+                                 TColStd_Array1OfReal& theV)
+{
+  gp_Trsf T;
+  T.SetTransformation (thePos);
+  for (Standard_Integer i = thePoints.Lower(); i <= thePoints.Upper(); ++i)
+  {
+    CylinderLocalParameters (thePoints (i).Transformed (T), theU (i), theV (i));
+  }
+}
+
+//=======================================================================
+//function : ConeParameters
+//purpose  : 
+//=======================================================================
+
+void ElSLib::ConeParameters (const gp_Ax3& thePos,
+                             const Standard_Real theRadius,
+                             const Standard_Real theSAngle,
+                             const TColgp_Array1OfPnt& thePoints,
+                             TColStd_Array1OfReal& theU,
+                             TColStd_Array1OfReal& theV)
+{
+  gp_Trsf T;
+  T.SetTransformation (thePos);
+  for (Standard_Integer i = thePoints.Lower(); i <= thePoints.Upper(); ++i)
+  {
+    ConeLocalParameters (thePoints (i).Transformed (T), theRadius, theSAngle, theU (i), theV (i));
+  }
+}
+
+//=======================================================================
+//function : SphereParameters
+//purpose  : 
+//=======================================================================
+
+void ElSLib::SphereParameters (const gp_Ax3& thePos,
+                               const Standard_Real,
+                               const TColgp_Array1OfPnt& thePoints,
+                               TColStd_Array1OfReal& theU,
+                               TColStd_Array1OfReal& theV)
+{
+  gp_Trsf T;
+  T.SetTransformation (thePos);
+  for (Standard_Integer i = thePoints.Lower(); i <= thePoints.Upper(); ++i)
+  {
+    SphereLocalParameters (thePoints (i).Transformed (T), theU (i), theV (i));
+  }
+}
+
+//=======================================================================
+//function : TorusParameters
+//purpose  : 
+//=======================================================================
+
+void ElSLib::TorusParameters (const gp_Ax3& thePos,
+                              const Standard_Real theMajorRadius,
+                              const Standard_Real theMinorRadius,
+                              const TColgp_Array1OfPnt& thePoints,
+                              TColStd_Array1OfReal& theU,
+                              TColStd_Array1OfReal& theV)
+{
+  gp_Trsf T;
+  T.SetTransformation (thePos);
+  for (Standard_Integer i = thePoints.Lower(); i <= thePoints.Upper(); ++i)
+  {
+    TorusLocalParameters (thePoints (i).Transformed (T), theMajorRadius, theMinorRadius,
+                          theU (i), theV (i));
+  }
+}
+
 //=======================================================================
 //function : PlaneUIso
 //purpose  : 
@@ -23,6 +23,10 @@
 
 #include <gp_Pnt.hxx>
 #include <gp_Vec.hxx>
+#include <TColgp_Array1OfPnt.hxx>
+#include <TColgp_Array2OfPnt.hxx>
+#include <TColgp_Array2OfVec.hxx>
+#include <TColStd_Array1OfReal.hxx>
 class gp_Pnt;
 class gp_Pln;
 class gp_Cone;
@@ -276,6 +280,55 @@ public:
   //! MinorRadius * Sin(U) * ZDirection
   Standard_EXPORT static void TorusParameters (const gp_Ax3& Pos, const Standard_Real MajorRadius, const Standard_Real MinorRadius, const gp_Pnt& P, Standard_Real& U, Standard_Real& V);
   
+  //! Grid evaluation
+  //! The following functions compute the points and the derivatives
+  //! on the grid of parameters: thePoints(i, j) is the point of parameters
+  //! theU(i), theV(j), so that the row bounds of the resulting arrays
+  //! should be the bounds of theU and the column bounds should be the bounds of theV.
+  //! The sines and cosines of the parameters are computed once per grid line,
+  //! and the results are the same as of the functions D0(), D1() and D2() above.
+  Standard_EXPORT static void PlaneD0Grid (const TColStd_Array1OfReal& theU, const TColStd_Array1OfReal& theV, const gp_Ax3& thePos, TColgp_Array2OfPnt& thePoints);
+  
+  Standard_EXPORT static void CylinderD0Grid (const TColStd_Array1OfReal& theU, const TColStd_Array1OfReal& theV, const gp_Ax3& thePos, const Standard_Real theRadius, TColgp_Array2OfPnt& thePoints);
+  
+  Standard_EXPORT static void ConeD0Grid (const TColStd_Array1OfReal& theU, const TColStd_Array1OfReal& theV, const gp_Ax3& thePos, const Standard_Real theRadius, const Standard_Real theSAngle, TColgp_Array2OfPnt& thePoints);
+  
+  Standard_EXPORT static void SphereD0Grid (const TColStd_Array1OfReal& theU, const TColStd_Array1OfReal& theV, const gp_Ax3& thePos, const Standard_Real theRadius, TColgp_Array2OfPnt& thePoints);
+  
+  Standard_EXPORT static void TorusD0Grid (const TColStd_Array1OfReal& theU, const TColStd_Array1OfReal& theV, const gp_Ax3& thePos, const Standard_Real theMajorRadius, const Standard_Real theMinorRadius, TColgp_Array2OfPnt& thePoints);
+  
+  Standard_EXPORT static void PlaneD1Grid (const TColStd_Array1OfReal& theU, const TColStd_Array1OfReal& theV, const gp_Ax3& thePos, TColgp_Array2OfPnt& thePoints, TColgp_Array2OfVec& theD1U, TColgp_Array2OfVec& theD1V);
+  
+  Standard_EXPORT static void CylinderD1Grid (const TColStd_Array1OfReal& theU, const TColStd_Array1OfReal& theV, const gp_Ax3& thePos, const Standard_Real theRadius, TColgp_Array2OfPnt& thePoints, TColgp_Array2OfVec& theD1U, TColgp_Array2OfVec& theD1V);
+  
+  Standard_EXPORT static void ConeD1Grid (const TColStd_Array1OfReal& theU, const TColStd_Array1OfReal& theV, const gp_Ax3& thePos, const Standard_Real theRadius, const Standard_Real theSAngle, TColgp_Array2OfPnt& thePoints, TColgp_Array2OfVec& theD1U, TColgp_Array2OfVec& theD1V);
+  
+  Standard_EXPORT static void SphereD1Grid (const TColStd_Array1OfReal& theU, const TColStd_Array1OfReal& theV, const gp_Ax3& thePos, const Standard_Real theRadius, TColgp_Array2OfPnt& thePoints, TColgp_Array2OfVec& theD1U, TColgp_Array2OfVec& theD1V);
+  
+  Standard_EXPORT static void TorusD1Grid (const TColStd_Array1OfReal& theU, const TColStd_Array1OfReal& theV, const gp_Ax3& thePos, const Standard_Real theMajorRadius, const Standard_Real theMinorRadius, TColgp_Array2OfPnt& thePoints, TColgp_Array2OfVec& theD1U, TColgp_Array2OfVec& theD1V);
+  
+  Standard_EXPORT static void CylinderD2Grid (const TColStd_Array1OfReal& theU, const TColStd_Array1OfReal& theV, const gp_Ax3& thePos, const Standard_Real theRadius, TColgp_Array2OfPnt& thePoints, TColgp_Array2OfVec& theD1U, TColgp_Array2OfVec& theD1V, TColgp_Array2OfVec& theD2U, TColgp_Array2OfVec& theD2V, TColgp_Array2OfVec& theD2UV);
+  
+  Standard_EXPORT static void ConeD2Grid (const TColStd_Array1OfReal& theU, const TColStd_Array1OfReal& theV, const gp_Ax3& thePos, const Standard_Real theRadius, const Standard_Real theSAngle, TColgp_Array2OfPnt& thePoints, TColgp_Array2OfVec& theD1U, TColgp_Array2OfVec& theD1V, TColgp_Array2OfVec& theD2U, TColgp_Array2OfVec& theD2V, TColgp_Array2OfVec& theD2UV);
+  
+  Standard_EXPORT static void SphereD2Grid (const TColStd_Array1OfReal& theU, const TColStd_Array1OfReal& theV, const gp_Ax3& thePos, const Standard_Real theRadius, TColgp_Array2OfPnt& thePoints, TColgp_Array2OfVec& theD1U, TColgp_Array2OfVec& theD1V, TColgp_Array2OfVec& theD2U, TColgp_Array2OfVec& theD2V, TColgp_Array2OfVec& theD2UV);
+  
+  Standard_EXPORT static void TorusD2Grid (const TColStd_Array1OfReal& theU, const TColStd_Array1OfReal& theV, const gp_Ax3& thePos, const Standard_Real theMajorRadius, const Standard_Real theMinorRadius, TColgp_Array2OfPnt& thePoints, TColgp_Array2OfVec& theD1U, TColgp_Array2OfVec& theD1V, TColgp_Array2OfVec& theD2U, TColgp_Array2OfVec& theD2V, TColgp_Array2OfVec& theD2UV);
+  
+  //! The following functions compute the parameters of the array of points,
+  //! the parameters of thePoints(i) are theU(i), theV(i).
+  //! The transformation to the local coordinate system of the surface is computed once,
+  //! and the results are the same as of the functions computing the parameters of one point.
+  Standard_EXPORT static void PlaneParameters (const gp_Ax3& thePos, const TColgp_Array1OfPnt& thePoints, TColStd_Array1OfReal& theU, TColStd_Array1OfReal& theV);
+  
+  Standard_EXPORT static void CylinderParameters (const gp_Ax3& thePos, const Standard_Real theRadius, const TColgp_Array1OfPnt& thePoints, TColStd_Array1OfReal& theU, TColStd_Array1OfReal& theV);
+  
+  Standard_EXPORT static void ConeParameters (const gp_Ax3& thePos, const Standard_Real theRadius, const Standard_Real theSAngle, const TColgp_Array1OfPnt& thePoints, TColStd_Array1OfReal& theU, TColStd_Array1OfReal& theV);
+  
+  Standard_EXPORT static void SphereParameters (const gp_Ax3& thePos, const Standard_Real theRadius, const TColgp_Array1OfPnt& thePoints, TColStd_Array1OfReal& theU, TColStd_Array1OfReal& theV);
+  
+  Standard_EXPORT static void TorusParameters (const gp_Ax3& thePos, const Standard_Real theMajorRadius, const Standard_Real theMinorRadius, const TColgp_Array1OfPnt& thePoints, TColStd_Array1OfReal& theU, TColStd_Array1OfReal& theV);
+  
   //! compute the U Isoparametric gp_Lin of the plane.
   Standard_EXPORT static gp_Lin PlaneUIso (const gp_Ax3& Pos, const Standard_Real U);
   
@@ -0,0 +1,336 @@
+// Copyright (c) 2024 OPEN CASCADE SAS
+//
+// This file is part of Open CASCADE Technology software library.
+//
+// This library is free software; you can redistribute it and/or modify it under
+// the terms of the GNU Lesser General Public License version 2.1 as published
+// by the Free Software Foundation, with special exception defined in the file
+// OCCT_LGPL_EXCEPTION.txt. Consult the file LICENSE_LGPL_21.txt included in OCCT
+// distribution for complete text of the license and disclaimer of any warranty.
+//
+// Alternatively, this file may be used under the terms of Open CASCADE
+// commercial license or contractual agreement.
+
+#include <Extrema_CurveBoxSet.hxx>
+
+#include <Adaptor2d_Curve2d.hxx>
+#include <Adaptor3d_Curve.hxx>
+#include <BndLib_Add2dCurve.hxx>
+#include <BndLib_Add3dCurve.hxx>
+#include <Bnd_Box.hxx>
+#include <Bnd_Box2d.hxx>
+#include <BVH_LinearBuilder.hxx>
+#include <BVH_Traverse.hxx>
+#include <BVH_Tools.hxx>
+#include <Geom2d_BezierCurve.hxx>
+#include <Geom2d_BSplineCurve.hxx>
+#include <Geom_BezierCurve.hxx>
+#include <Geom_BSplineCurve.hxx>
+#include <Precision.hxx>
+
+#include <algorithm>
+
+namespace
+{
+  //! Converts the 3d point into the BVH vector.
+  static BVH_Vec3d toVec (const gp_Pnt& thePnt)
+  {
+    return BVH_Vec3d (thePnt.X(), thePnt.Y(), thePnt.Z());
+  }
+
+  //! Converts the 2d point into the BVH vector in the plane Z = 0.
+  static BVH_Vec3d toVec (const gp_Pnt2d& thePnt)
+  {
+    return BVH_Vec3d (thePnt.X(), thePnt.Y(), 0.0);
+  }
+
+  //! Adds the poles of the knot spans of non-periodic B-spline curve covering
+  //! the interval [theFirst, theLast] into the box.
+  template<class BSplineCurveType>
+  static void addSpanPoles (const BSplineCurveType& theCurve,
+                            const Standard_Real theFirst,
+                            const Standard_Real theLast,
+                            BVH_Box<Standard_Real, 3>& theBox)
+  {
+    // the span [FlatKnots(k), FlatKnots(k + 1)] with k in [Degree + 1, NbPoles]
+    // is defined by the poles [k - Degree, k]
+    const TColStd_Array1OfReal& aFlatKnots = theCurve->KnotSequence();
+    const Standard_Integer aDegree  = theCurve->Degree();
+    const Standard_Integer aNbPoles = theCurve->NbPoles();
+    const Standard_Real* aSpanKnots = &aFlatKnots (aDegree + 1);
+    const Standard_Real* aSpanKnotsEnd = &aFlatKnots (aNbPoles + 1) + 1;
+
+    Standard_Integer aSpan1 = aDegree + static_cast<Standard_Integer> (
+      std::upper_bound (aSpanKnots, aSpanKnotsEnd, theFirst) - aSpanKnots);
+    Standard_Integer aSpan2 = aDegree + static_cast<Standard_Integer> (
+      std::lower_bound (aSpanKnots, aSpanKnotsEnd, theLast) - aSpanKnots);
+    aSpan1 = Max (aDegree + 1, Min (aSpan1, aNbPoles));
+    aSpan2 = Max (aSpan1, Min (aSpan2, aNbPoles));
+    for (Standard_Integer aPoleIter = aSpan1 - aDegree; aPoleIter <= aSpan2; ++aPoleIter)
+    {
+      theBox.Add (toVec (theCurve->Pole (aPoleIter)));
+    }
+  }
+
+  //! Adds the poles of Bezier curve into the box.
+  template<class BezierCurveType>
+  static void addPoles (const BezierCurveType& theCurve,
+                        BVH_Box<Standard_Real, 3>& theBox)
+  {
+    for (Standard_Integer aPoleIter = 1; aPoleIter <= theCurve->NbPoles(); ++aPoleIter)
+    {
+      theBox.Add (toVec (theCurve->Pole (aPoleIter)));
+    }
+  }
+
+  //! Selector of the pairs of intervals of two curves which may contain the minimal distance.
+  class PairSelector : public BVH_PairTraverse<Standard_Real, 3, Extrema_CurveBoxSet>
+  {
+  public:
+
+    PairSelector (const Standard_Real theSqTolerance,
+                  NCollection_Vector<Extrema_CurveBoxSet::IntervalPair>& thePairs)
+    : mySqTolerance (theSqTolerance),
+      myUpperSqDistance (RealLast()),
+      myPairs (thePairs)
+    {}
+
+    //! Returns the square distance which the selected pairs should not exceed.
+    Standard_Real Threshold() const
+    {
+      return myUpperSqDistance + mySqTolerance;
+    }
+
+    virtual Standard_Boolean IsMetricBetter (const Standard_Real& theLeft,
+                                             const Standard_Real& theRight) const Standard_OVERRIDE
+    {
+      return theLeft < theRight;
+    }
+
+    virtual Standard_Boolean RejectMetric (const Standard_Real& theMetric) const Standard_OVERRIDE
+    {
+      return theMetric > Threshold();
+    }
+
+    virtual Standard_Boolean RejectNode (const BVH_Vec3d& theCornerMin1,
+                                         const BVH_Vec3d& theCornerMax1,
+                                         const BVH_Vec3d& theCornerMin2,
+                                         const BVH_Vec3d& theCornerMax2,
+                                         Standard_Real& theMetric) const Standard_OVERRIDE
+    {
+      theMetric = BVH_Tools<Standard_Real, 3>::BoxBoxSquareDistance (theCornerMin1, theCornerMax1,
+                                                                      theCornerMin2, theCornerMax2);
+      return RejectMetric (theMetric);
+    }
+
+    virtual Standard_Boolean Accept (const Standard_Integer theIndex1,
+                                     const Standard_Integer theIndex2) Standard_OVERRIDE
+    {
+      const Standard_Real aSqDist = BVH_Tools<Standard_Real, 3>::BoxBoxSquareDistance (
+        myBVHSet1->Box (theIndex1), myBVHSet2->Box (theIndex2));
+      if (RejectMetric (aSqDist))
+      {
+        return Standard_False;
+      }
+
+      // the distance between the middle points of the intervals bounds the minimal distance
+      const Standard_Integer anInterval1 = myBVHSet1->Element (theIndex1);
+      const Standard_Integer anInterval2 = myBVHSet2->Element (theIndex2);
+      const BVH_Vec3d aDelta = myBVHSet1->MiddlePoint (anInterval1) - myBVHSet2->MiddlePoint (anInterval2);
+      myUpperSqDistance = Min (myUpperSqDistance, aDelta.Dot (aDelta));
+      myPairs.Append (Extrema_CurveBoxSet::IntervalPair (anInterval1, anInterval2, aSqDist));
+      return Standard_True;
+    }
+
+  private:
+
+    Standard_Real mySqTolerance;
+    Standard_Real myUpperSqDistance;
+    NCollection_Vector<Extrema_CurveBoxSet::IntervalPair>& myPairs;
+  };
+}
+
+//=======================================================================
+//function : IsHullBounded
+//purpose  :
+//=======================================================================
+Standard_Boolean Extrema_CurveBoxSet::IsHullBounded (const Adaptor3d_Curve& theCurve)
+{
+  return theCurve.GetType() == GeomAbs_BezierCurve
+      || theCurve.GetType() == GeomAbs_BSplineCurve;
+}
+
+//=======================================================================
+//function : IsHullBounded
+//purpose  :
+//=======================================================================
+Standard_Boolean Extrema_CurveBoxSet::IsHullBounded (const Adaptor2d_Curve2d& theCurve)
+{
+  return theCurve.GetType() == GeomAbs_BezierCurve
+      || theCurve.GetType() == GeomAbs_BSplineCurve;
+}
+
+//=======================================================================
+//function : SelectPairs
+//purpose  :
+//=======================================================================
+void Extrema_CurveBoxSet::SelectPairs (Extrema_CurveBoxSet& theSet1,
+                                       Extrema_CurveBoxSet& theSet2,
+                                       const Standard_Real theSqTolerance,
+                                       NCollection_Vector<IntervalPair>& thePairs)
+{
+  NCollection_Vector<IntervalPair> aPairs;
+  PairSelector aSelector (theSqTolerance, aPairs);
+  aSelector.SetBVHSets (&theSet1, &theSet2);
+  aSelector.Select();
+
+  // the pairs accepted before the upper bound has been reduced may be too far
+  const Standard_Real aThreshold = aSelector.Threshold();
+  for (NCollection_Vector<IntervalPair>::Iterator aPairIter (aPairs); aPairIter.More(); aPairIter.Next())
+  {
+    if (aPairIter.Value().SqDistance <= aThreshold)
+    {
+      thePairs.Append (aPairIter.Value());
+    }
+  }
+  std::sort (thePairs.begin(), thePairs.end());
+}
+
+//=======================================================================
+//function : Extrema_CurveBoxSet
+//purpose  :
+//=======================================================================
+Extrema_CurveBoxSet::Extrema_CurveBoxSet()
+: BVH_BoxSet<Standard_Real, 3, Standard_Integer> (new BVH_LinearBuilder<Standard_Real, 3>()),
+  myLower (1)
+{
+  //
+}
+
+//=======================================================================
+//function : Clear
+//purpose  :
+//=======================================================================
+void Extrema_CurveBoxSet::Clear()
+{
+  BVH_BoxSet<Standard_Real, 3, Standard_Integer>::Clear();
+  myMiddlePoints.Clear();
+}
+
+//=======================================================================
+//function : Init
+//purpose  :
+//=======================================================================
+void Extrema_CurveBoxSet::Init (const Adaptor3d_Curve& theCurve,
+                                const TColStd_Array1OfReal& theParams)
+{
+  Clear();
+  myLower = theParams.Lower();
+  SetSize (theParams.Length() - 1);
+
+  Handle(Geom_BSplineCurve) aBSpline;
+  Handle(Geom_BezierCurve) aBezier;
+  if (theCurve.GetType() == GeomAbs_BSplineCurve)
+  {
+    aBSpline = theCurve.BSpline();
+    if (aBSpline->IsPeriodic())
+    {
+      aBSpline.Nullify();
+    }
+  }
+  else if (theCurve.GetType() == GeomAbs_BezierCurve)
+  {
+    aBezier = theCurve.Bezier();
+  }
+
+  for (Standard_Integer anIntIter = theParams.Lower(); anIntIter < theParams.Upper(); ++anIntIter)
+  {
+    const Standard_Real aFirst = theParams (anIntIter);
+    const Standard_Real aLast  = theParams (anIntIter + 1);
+    const BVH_Vec3d aMiddle = toVec (theCurve.Value (0.5 * (aFirst + aLast)));
+
+    BVH_Box<Standard_Real, 3> aBox (aMiddle);
+    if (!aBSpline.IsNull())
+    {
+      addSpanPoles (aBSpline, aFirst, aLast, aBox);
+    }
+    else if (!aBezier.IsNull())
+    {
+      addPoles (aBezier, aBox);
+    }
+    else
+    {
+      Bnd_Box aBndBox;
+      BndLib_Add3dCurve::Add (theCurve, aFirst, aLast, Precision::Confusion(), aBndBox);
+      if (!aBndBox.IsVoid())
+      {
+        aBox.Add (toVec (aBndBox.CornerMin()));
+        aBox.Add (toVec (aBndBox.CornerMax()));
+      }
+    }
+
+    myMiddlePoints.Append (aMiddle);
+    Add (anIntIter, aBox);
+  }
+  Build();
+}
+
+//=======================================================================
+//function : Init
+//purpose  :
+//=======================================================================
+void Extrema_CurveBoxSet::Init (const Adaptor2d_Curve2d& theCurve,
+                                const TColStd_Array1OfReal& theParams)
+{
+  Clear();
+  myLower = theParams.Lower();
+  SetSize (theParams.Length() - 1);
+
+  Handle(Geom2d_BSplineCurve) aBSpline;
+  Handle(Geom2d_BezierCurve) aBezier;
+  if (theCurve.GetType() == GeomAbs_BSplineCurve)
+  {
+    aBSpline = theCurve.BSpline();
+    if (aBSpline->IsPeriodic())
+    {
+      aBSpline.Nullify();
+    }
+  }
+  else if (theCurve.GetType() == GeomAbs_BezierCurve)
+  {
+    aBezier = theCurve.Bezier();
+  }
+
+  for (Standard_Integer anIntIter = theParams.Lower(); anIntIter < theParams.Upper(); ++anIntIter)
+  {
+    const Standard_Real aFirst = theParams (anIntIter);
+    const Standard_Real aLast  = theParams (anIntIter + 1);
+    const BVH_Vec3d aMiddle = toVec (theCurve.Value (0.5 * (aFirst + aLast)));
+
+    BVH_Box<Standard_Real, 3> aBox (aMiddle);
+    if (!aBSpline.IsNull())
+    {
+      addSpanPoles (aBSpline, aFirst, aLast, aBox);
+    }
+    else if (!aBezier.IsNull())
+    {
+      addPoles (aBezier, aBox);
+    }
+    else
+    {
+      Bnd_Box2d aBndBox;
+      BndLib_Add2dCurve::Add (theCurve, aFirst, aLast, Precision::Confusion(), aBndBox);
+      if (!aBndBox.IsVoid())
+      {
+        Standard_Real aXMin = 0.0, aYMin = 0.0, aXMax = 0.0, aYMax = 0.0;
+        aBndBox.Get (aXMin, aYMin, aXMax, aYMax);
+        aBox.Add (BVH_Vec3d (aXMin, aYMin, 0.0));
+        aBox.Add (BVH_Vec3d (aXMax, aYMax, 0.0));
+      }
+    }
+
+    myMiddlePoints.Append (aMiddle);
+    Add (anIntIter, aBox);
+  }
+  Build();
+}
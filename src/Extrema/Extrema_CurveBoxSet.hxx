@@ -0,0 +1,115 @@
+// Copyright (c) 2024 OPEN CASCADE SAS
+//
+// This file is part of Open CASCADE Technology software library.
+//
+// This library is free software; you can redistribute it and/or modify it under
+// the terms of the GNU Lesser General Public License version 2.1 as published
+// by the Free Software Foundation, with special exception defined in the file
+// OCCT_LGPL_EXCEPTION.txt. Consult the file LICENSE_LGPL_21.txt included in OCCT
+// distribution for complete text of the license and disclaimer of any warranty.
+//
+// Alternatively, this file may be used under the terms of Open CASCADE
+// commercial license or contractual agreement.
+
+#ifndef _Extrema_CurveBoxSet_HeaderFile
+#define _Extrema_CurveBoxSet_HeaderFile
+
+#include <BVH_BoxSet.hxx>
+#include <NCollection_Vector.hxx>
+#include <TColStd_Array1OfReal.hxx>
+
+class Adaptor3d_Curve;
+class Adaptor2d_Curve2d;
+
+//! Set of the boxes bounding the parametric intervals of the curve with the BVH tree
+//! built on them, used for the search of the candidates of the extrema between curves.
+//!
+//! The element of the set is the index of the interval [theParams(i), theParams(i + 1)]
+//! given on initialization. The boxes of the intervals of B-spline and Bezier curves
+//! are the boxes of the poles of the knot spans covering the interval, which contain
+//! the curve by the convex hull property (the control hulls of the Bezier segments
+//! of the curve lie within these poles); the boxes of the other curves are computed
+//! by BndLib. 2d curves are placed into the plane Z = 0.
+//!
+//! SelectPairs() traverses the trees of two sets and selects the pairs of intervals
+//! whose boxes are close enough to contain the minimal distance between the curves,
+//! so that the global search is performed only on these pairs of intervals.
+class Extrema_CurveBoxSet : public BVH_BoxSet<Standard_Real, 3, Standard_Integer>
+{
+public:
+
+  //! Pair of intervals of two curves selected by SelectPairs().
+  struct IntervalPair
+  {
+    Standard_Integer Index1;     //!< index of the interval of the first curve
+    Standard_Integer Index2;     //!< index of the interval of the second curve
+    Standard_Real    SqDistance; //!< square distance between the boxes of the intervals
+
+    IntervalPair (const Standard_Integer theIndex1 = 0,
+                  const Standard_Integer theIndex2 = 0,
+                  const Standard_Real theSqDistance = 0.0)
+    : Index1 (theIndex1), Index2 (theIndex2), SqDistance (theSqDistance) {}
+
+    //! Compares the pairs by the distance between the boxes, then by the indices.
+    Standard_Boolean operator< (const IntervalPair& theOther) const
+    {
+      if (SqDistance != theOther.SqDistance)
+      {
+        return SqDistance < theOther.SqDistance;
+      }
+      return Index1 < theOther.Index1
+         || (Index1 == theOther.Index1 && Index2 < theOther.Index2);
+    }
+  };
+
+public:
+
+  //! Returns true if the boxes of the intervals of the curve are computed
+  //! from its control polygon (B-spline and Bezier curves).
+  Standard_EXPORT static Standard_Boolean IsHullBounded (const Adaptor3d_Curve& theCurve);
+
+  //! Returns true if the boxes of the intervals of the curve are computed
+  //! from its control polygon (B-spline and Bezier curves).
+  Standard_EXPORT static Standard_Boolean IsHullBounded (const Adaptor2d_Curve2d& theCurve);
+
+  //! Selects the pairs of intervals of two curves which may contain the points
+  //! with the square distance not exceeding the minimal square distance between
+  //! the curves by more than theSqTolerance.
+  //! The minimal distance is estimated from above by the distances between
+  //! the middle points of the intervals during the traverse of the trees.
+  //! The pairs are sorted by the distance between the boxes of the intervals.
+  Standard_EXPORT static void SelectPairs (Extrema_CurveBoxSet& theSet1,
+                                           Extrema_CurveBoxSet& theSet2,
+                                           const Standard_Real theSqTolerance,
+                                           NCollection_Vector<IntervalPair>& thePairs);
+
+public:
+
+  //! Creates an empty set using the linear BVH builder.
+  Standard_EXPORT Extrema_CurveBoxSet();
+
+  //! Builds the boxes of the intervals [theParams(i), theParams(i + 1)] of the curve.
+  Standard_EXPORT void Init (const Adaptor3d_Curve& theCurve,
+                             const TColStd_Array1OfReal& theParams);
+
+  //! Builds the boxes of the intervals [theParams(i), theParams(i + 1)] of the 2d curve.
+  Standard_EXPORT void Init (const Adaptor2d_Curve2d& theCurve,
+                             const TColStd_Array1OfReal& theParams);
+
+  //! Returns the middle point of the interval with the given index.
+  const BVH_Vec3d& MiddlePoint (const Standard_Integer theInterval) const
+  {
+    return myMiddlePoints.Value (theInterval - myLower);
+  }
+
+  //! Clears the set.
+  Standard_EXPORT virtual void Clear() Standard_OVERRIDE;
+
+private:
+
+  NCollection_Vector<BVH_Vec3d> myMiddlePoints; //!< middle points of the intervals
+  Standard_Integer              myLower;        //!< index of the first interval
+
+};
+
+#endif // _Extrema_CurveBoxSet_HeaderFile
@@ -66,6 +66,24 @@ public:
   //! Get flag for single extrema computation. Works on parametric solver only.
   Standard_EXPORT Standard_Boolean GetSingleSolutionFlag () const;
 
+  //! Sets the flag of the search of the minimal distance between spline curves
+  //! only on the pairs of intervals selected by the BVH trees of the boxes
+  //! of their control polygons (see Extrema_CurveBoxSet). True by default.
+  Standard_EXPORT void SetBVHSearch (const Standard_Boolean theToUse);
+
+  //! Returns the flag of the BVH search of the pairs of intervals.
+  Standard_EXPORT Standard_Boolean IsBVHSearch() const;
+
+  //! Sets the flag of the global search of the minimal distance in parallel threads
+  //! (see math_GlobOptMin::Perform()); the curves are copied for each thread by ShallowCopy().
+  //! False by default, and no algorithm turns it on implicitly: only the pairs of intervals
+  //! long compared to the tolerance are split between the threads, so the flag pays off
+  //! for the long curves with few intervals and is an overhead for the others.
+  Standard_EXPORT void SetMultiThread (const Standard_Boolean theIsMultiThread);
+
+  //! Returns the flag of the parallel global search.
+  Standard_EXPORT Standard_Boolean IsMultiThread() const;
+
   //! Performs calculations.
   Standard_EXPORT void Perform();
   
@@ -99,6 +117,8 @@ private:
 
   Standard_Boolean myIsFindSingleSolution; // Default value is false.
   Standard_Boolean myParallel;
+  Standard_Boolean myIsBVHSearch;
+  Standard_Boolean myIsMultiThread;
   Standard_Real myCurveMinTol;
   math_Vector myLowBorder;
   math_Vector myUppBorder;
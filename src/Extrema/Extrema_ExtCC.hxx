@@ -126,6 +126,14 @@ public:
   //! Get flag for single extrema computation. Works on parametric solver only.
   Standard_EXPORT Standard_Boolean GetSingleSolutionFlag () const;
 
+  //! Sets the flag of the global search of the minimal distance between
+  //! the curves in parallel threads, false by default (see Extrema_ECC::SetMultiThread()).
+  //! Works on parametric solver only.
+  void SetMultiThread (const Standard_Boolean theIsMultiThread) { myECC.SetMultiThread (theIsMultiThread); }
+
+  //! Returns the flag of the parallel global search.
+  Standard_Boolean IsMultiThread() const { return myECC.IsMultiThread(); }
+
 protected:
 
   //! Prepares the extrema result(s) for analytical cases (line, circle, ellipsis etc.)
@@ -16,6 +16,7 @@
 
 
 #include <Extrema_GenExtCS.hxx>
+#include <BVH_Tools.hxx>
 #include <Geom_OffsetCurve.hxx>
 #include <Extrema_GlobOptFuncCS.hxx>
 #include <Extrema_GlobOptFuncConicS.hxx>
@@ -27,10 +28,12 @@
 #include <math_PSO.hxx>
 #include <math_PSOParticlesPool.hxx>
 #include <math_Vector.hxx>
+#include <NCollection_Array1.hxx>
 #include <Precision.hxx>
 #include <Standard_OutOfRange.hxx>
 #include <StdFail_NotDone.hxx>
 #include <TColgp_Array1OfPnt.hxx>
+#include <TColStd_Array1OfReal.hxx>
 #include <Geom_TrimmedCurve.hxx>
 #include <ElCLib.hxx>
 #include <Extrema_GenLocateExtPS.hxx>
@@ -39,6 +42,13 @@
 const Standard_Real MaxParamVal = 1.0e+10;
 const Standard_Real aBorderDivisor = 1.0e+4;
 const Standard_Real HyperbolaLimit = 23.; //ln(MaxParamVal)
+const Standard_Integer aCurvGroupSize = 8; // Number of curve samples in the bounding box.
+
+//! Converts the point into the BVH vector.
+static BVH_Vec3d ToVec (const gp_Pnt& thePnt)
+{
+  return BVH_Vec3d (thePnt.X(), thePnt.Y(), thePnt.Z());
+}
 
 static Standard_Boolean IsQuadric(const GeomAbs_SurfaceType theSType)
 {
@@ -435,38 +445,81 @@ void Extrema_GenExtCS::GlobMinGenCS(const Adaptor3d_Curve& theC,
 
   // Pre-compute curve sample points.
   TColgp_Array1OfPnt aCurvPnts(0, aNewCsample);
+  TColStd_Array1OfReal aCurvParams(0, aNewCsample);
 
   Standard_Real aCU1 = aMinTUV(1);
   for (Standard_Integer aCUI = 0; aCUI <= aNewCsample; aCUI++, aCU1 += aStepCU)
+  {
     aCurvPnts.SetValue(aCUI, theC.Value(aCU1));
+    aCurvParams.SetValue(aCUI, aCU1);
+  }
+
+  // Two-level hierarchy of the bounding boxes of the samples: the boxes of the whole curve
+  // and of the groups of its consecutive samples, and the boxes of the rows of the surface samples.
+  // The pairs of samples farther than the worst particle cannot replace it, so the rows, points
+  // and groups whose boxes are farther are skipped, keeping the order of the exhaustive search
+  // and hence its result.
+  const Standard_Integer aNbCurvGroups = aNewCsample / aCurvGroupSize + 1;
+  NCollection_Array1<BVH_Box<Standard_Real, 3> > aCurvGroupBoxes(0, aNbCurvGroups - 1);
+  BVH_Box<Standard_Real, 3> aCurvBox;
+  for (Standard_Integer aCUI = 0; aCUI <= aNewCsample; aCUI++)
+  {
+    const BVH_Vec3d aCurvPnt = ToVec(aCurvPnts.Value(aCUI));
+    aCurvGroupBoxes.ChangeValue(aCUI / aCurvGroupSize).Add(aCurvPnt);
+    aCurvBox.Add(aCurvPnt);
+  }
+
+  NCollection_Array1<BVH_Box<Standard_Real, 3> > aSurfRowBoxes(0, myusample);
+  for (Standard_Integer aSUI = 0; aSUI <= myusample; aSUI++)
+  {
+    for (Standard_Integer aSVI = 0; aSVI <= myvsample; aSVI++)
+      aSurfRowBoxes.ChangeValue(aSUI).Add(ToVec(mySurfPnts->Value(aSUI, aSVI)));
+  }
 
   PSO_Particle* aParticle = aParticles.GetWorstParticle();
   // Select specified number of particles from pre-computed set of samples
   Standard_Real aSU = aMinTUV(2);
   for (Standard_Integer aSUI = 0; aSUI <= myusample; aSUI++, aSU += aStepSU)
   {
+    if (BVH_Tools<Standard_Real, 3>::BoxBoxSquareDistance(aSurfRowBoxes.Value(aSUI), aCurvBox)
+        >= aParticle->Distance)
+      continue;
+
     Standard_Real aSV = aMinTUV(3);
     for (Standard_Integer aSVI = 0; aSVI <= myvsample; aSVI++, aSV += aStepSV)
     {
-      Standard_Real aCU2 = aMinTUV(1);
-      for (Standard_Integer aCUI = 0; aCUI <= aNewCsample; aCUI++, aCU2 += aStepCU)
+      const gp_Pnt& aSurfPnt = mySurfPnts->Value(aSUI, aSVI);
+      const BVH_Vec3d aSurfVec = ToVec(aSurfPnt);
+      if (BVH_Tools<Standard_Real, 3>::PointBoxSquareDistance(aSurfVec, aCurvBox) >= aParticle->Distance)
+        continue;
+
+      for (Standard_Integer aGroup = 0; aGroup < aNbCurvGroups; aGroup++)
       {
-        Standard_Real aSqDist = mySurfPnts->Value(aSUI, aSVI).SquareDistance(aCurvPnts.Value(aCUI));
+        if (BVH_Tools<Standard_Real, 3>::PointBoxSquareDistance(aSurfVec, aCurvGroupBoxes.Value(aGroup))
+            >= aParticle->Distance)
+          continue;
 
-        if (aSqDist < aParticle->Distance)
+        const Standard_Integer aLastCUI = Min(aGroup * aCurvGroupSize + aCurvGroupSize - 1, aNewCsample);
+        for (Standard_Integer aCUI = aGroup * aCurvGroupSize; aCUI <= aLastCUI; aCUI++)
         {
-          aParticle->Position[0] = aCU2;
-          aParticle->Position[1] = aSU;
-          aParticle->Position[2] = aSV;
+          Standard_Real aSqDist = aSurfPnt.SquareDistance(aCurvPnts.Value(aCUI));
+
+          if (aSqDist < aParticle->Distance)
+          {
+            const Standard_Real aCU2 = aCurvParams.Value(aCUI);
+            aParticle->Position[0] = aCU2;
+            aParticle->Position[1] = aSU;
+            aParticle->Position[2] = aSV;
 
-          aParticle->BestPosition[0] = aCU2;
-          aParticle->BestPosition[1] = aSU;
-          aParticle->BestPosition[2] = aSV;
+            aParticle->BestPosition[0] = aCU2;
+            aParticle->BestPosition[1] = aSU;
+            aParticle->BestPosition[2] = aSV;
 
-          aParticle->Distance = aSqDist;
-          aParticle->BestDistance = aSqDist;
+            aParticle->Distance = aSqDist;
+            aParticle->BestDistance = aSqDist;
 
-          aParticle = aParticles.GetWorstParticle();
+            aParticle = aParticles.GetWorstParticle();
+          }
         }
       }
     }
@@ -22,7 +22,7 @@
 #include <Extrema_POnSurf.hxx>
 #include <gp_Pnt.hxx>
 #include <math_FunctionSetRoot.hxx>
-#include <math_NewtonFunctionSetRoot.hxx>
+#include <math_NewtonFunctionSetRootN.hxx>
 #include <math_BFGS.hxx>
 #include <math_FRPR.hxx>
 #include <StdFail_NotDone.hxx>
@@ -196,7 +196,7 @@ void Extrema_GenLocateExtPS::Perform(const gp_Pnt& theP,
         aTol(1) = myTolU;
         aTol(2) = myTolV;
       }
-      math_NewtonFunctionSetRoot aNSR(F, aTol, Precision::Confusion());
+      math_NewtonFunctionSetRootN<2> aNSR(F, aTol, Precision::Confusion());
       aNSR.Perform(F, aStart, aBoundInf, aBoundSup);
       if (!aSR.IsDone() && !aNSR.IsDone())
       {
@@ -1141,7 +1141,8 @@ Handle(Font_SystemFont) Font_FontMgr::Font_FontMap::Find (const TCollection_Asci
 
   TCollection_AsciiString aFontName (theFontName);
   aFontName.LowerCase();
-  for (IndexedMapNode* aNodeIter = (IndexedMapNode* )myData1[::HashCode (aFontName, NbBuckets())];
+  const Standard_Size aHash = NCollection_HasherTraits<TCollection_AsciiString, NCollection_DefaultHasher<TCollection_AsciiString> >::HashCode (aFontName);
+  for (IndexedMapNode* aNodeIter = (IndexedMapNode* )myData1[HasherTraits::Bucket (aHash, NbBuckets())];
        aNodeIter != NULL; aNodeIter = (IndexedMapNode* )aNodeIter->Next())
   {
     const Handle(Font_SystemFont)& aKey = aNodeIter->Key1();
@@ -0,0 +1,563 @@
+// Copyright (c) 2024 OPEN CASCADE SAS
+//
+// This file is part of Open CASCADE Technology software library.
+//
+// This library is free software; you can redistribute it and/or modify it under
+// the terms of the GNU Lesser General Public License version 2.1 as published
+// by the Free Software Foundation, with special exception defined in the file
+// OCCT_LGPL_EXCEPTION.txt. Consult the file LICENSE_LGPL_21.txt included in OCCT
+// distribution for complete text of the license and disclaimer of any warranty.
+//
+// Alternatively, this file may be used under the terms of Open CASCADE
+// commercial license or contractual agreement.
+
+#include <GeomAPI_ProjectPointsOnSurf.hxx>
+
+#include <BVH_Distance.hxx>
+#include <BVH_LinearBuilder.hxx>
+#include <BVH_Tools.hxx>
+#include <Extrema_ExtPS.hxx>
+#include <Extrema_FuncPSNorm.hxx>
+#include <Extrema_POnSurf.hxx>
+#include <Geom_Surface.hxx>
+#include <math_FunctionSetRoot.hxx>
+#include <math_Vector.hxx>
+#include <OSD_ThreadPool.hxx>
+#include <Precision.hxx>
+#include <StdFail_NotDone.hxx>
+
+namespace
+{
+  //! Minimal number of the samples in each direction of the surface.
+  static const Standard_Integer THE_MIN_NB_SAMPLES = 32;
+
+  //! Maximal number of the samples in each direction of the surface.
+  static const Standard_Integer THE_MAX_NB_SAMPLES = 512;
+
+  //! Data of the projection shared by the threads.
+  struct ProjectionData
+  {
+    const GeomAdaptor_Surface*                    Surface;
+    Standard_Real                                 UMin, UMax, VMin, VMax;
+    Standard_Real                                 Tolerance;
+    const TColStd_Array1OfReal*                   SampleU;
+    const TColStd_Array1OfReal*                   SampleV;
+    const TColgp_Array2OfPnt*                     Samples;
+    const GeomAPI_ProjectPointsOnSurf::SampleSet* SampleSet;
+  };
+
+  //! Selector of the cell of the sample grid containing the nearest projection.
+  //! The cells are visited in the order of the distance to their boxes, the
+  //! projection is refined by Newton iterations starting from the nearest sample
+  //! of the cell, and the cells with the boxes farther than the best projection
+  //! found are rejected. The distance is measured as the square distance.
+  class CellSelector : public BVH_Distance<Standard_Real, 3, BVH_Vec3d, GeomAPI_ProjectPointsOnSurf::SampleSet>
+  {
+  public:
+
+    //! Constructor.
+    CellSelector (const ProjectionData& theData,
+                  Extrema_FuncPSNorm& theFunc)
+    : myData (theData),
+      myFunc (theFunc),
+      myUV (1, 2),
+      myTol (1, 2),
+      myUVInf (1, 2),
+      myUVSup (1, 2),
+      myU (0.0),
+      myV (0.0)
+    {
+      myTol (1) = myTol (2) = theData.Tolerance;
+      myUVInf (1) = theData.UMin;
+      myUVInf (2) = theData.VMin;
+      myUVSup (1) = theData.UMax;
+      myUVSup (2) = theData.VMax;
+      SetBVHSet (const_cast<GeomAPI_ProjectPointsOnSurf::SampleSet*> (theData.SampleSet));
+    }
+
+    //! Finds the nearest projection of the point, returns false if no projection is found.
+    Standard_Boolean Project (const gp_Pnt& thePoint,
+                              Standard_Real& theU,
+                              Standard_Real& theV,
+                              Standard_Real& theDistance)
+    {
+      myPoint    = thePoint;
+      myDistance = RealLast();
+      SetObject (BVH_Vec3d (thePoint.X(), thePoint.Y(), thePoint.Z()));
+      ComputeDistance();
+      if (!IsDone())
+      {
+        return Standard_False;
+      }
+      theU = myU;
+      theV = myV;
+      theDistance = Sqrt (myDistance);
+      return Standard_True;
+    }
+
+    //! Computes the square distance from the point to the box of the node.
+    virtual Standard_Boolean RejectNode (const BVH_Vec3d& theCornerMin,
+                                         const BVH_Vec3d& theCornerMax,
+                                         Standard_Real& theMetric) const Standard_OVERRIDE
+    {
+      theMetric = BVH_Tools<Standard_Real, 3>::PointBoxSquareDistance (myObject, theCornerMin, theCornerMax);
+      return RejectMetric (theMetric);
+    }
+
+    //! Refines the projection within the cell.
+    virtual Standard_Boolean Accept (const Standard_Integer theIndex,
+                                     const Standard_Real& ) Standard_OVERRIDE
+    {
+      const BVH_Box<Standard_Real, 3> aBox = myBVHSet->Box (theIndex);
+      if (RejectMetric (BVH_Tools<Standard_Real, 3>::PointBoxSquareDistance (myObject, aBox.CornerMin(), aBox.CornerMax())))
+      {
+        return Standard_False;
+      }
+
+      // the cell covers 3x3 samples, the iterations start from the nearest one;
+      // the cell containing the best projection found is not refined once more
+      const Standard_Integer aNbCellsV = (myData.SampleV->Length() - 1) / 2;
+      const Standard_Integer aCell = myBVHSet->Element (theIndex);
+      const Standard_Integer anUFirst = myData.SampleU->Lower() + 2 * (aCell / aNbCellsV);
+      const Standard_Integer aVFirst  = myData.SampleV->Lower() + 2 * (aCell % aNbCellsV);
+      if (myDistance < RealLast()
+       && myU >= myData.SampleU->Value (anUFirst) && myU <= myData.SampleU->Value (anUFirst + 2)
+       && myV >= myData.SampleV->Value (aVFirst)  && myV <= myData.SampleV->Value (aVFirst + 2))
+      {
+        return Standard_False;
+      }
+      Standard_Integer anUNearest = anUFirst, aVNearest = aVFirst;
+      Standard_Real aMinSqDist = RealLast();
+      for (Standard_Integer anUIter = anUFirst; anUIter <= anUFirst + 2; ++anUIter)
+      {
+        for (Standard_Integer aVIter = aVFirst; aVIter <= aVFirst + 2; ++aVIter)
+        {
+          const Standard_Real aSqDist = myPoint.SquareDistance (myData.Samples->Value (anUIter, aVIter));
+          if (aSqDist < aMinSqDist)
+          {
+            aMinSqDist = aSqDist;
+            anUNearest = anUIter;
+            aVNearest  = aVIter;
+          }
+        }
+      }
+
+      myUV (1) = myData.SampleU->Value (anUNearest);
+      myUV (2) = myData.SampleV->Value (aVNearest);
+      myFunc.SetPoint (myPoint);
+      math_FunctionSetRoot aSolver (myFunc, myTol);
+      aSolver.Perform (myFunc, myUV, myUVInf, myUVSup);
+
+      Standard_Boolean isBetter = Standard_False;
+      for (Standard_Integer anExtIter = 1; anExtIter <= myFunc.NbExt(); ++anExtIter)
+      {
+        if (myFunc.SquareDistance (anExtIter) < myDistance)
+        {
+          myDistance = myFunc.SquareDistance (anExtIter);
+          myFunc.Point (anExtIter).Parameter (myU, myV);
+          isBetter = Standard_True;
+        }
+      }
+      return isBetter;
+    }
+
+  private:
+    const ProjectionData& myData;  //!< shared data of the projection
+    Extrema_FuncPSNorm&   myFunc;  //!< function of the Newton iterations
+    gp_Pnt                myPoint; //!< point to be projected
+    math_Vector           myUV;    //!< start point of the iterations
+    math_Vector           myTol;   //!< tolerance of the iterations
+    math_Vector           myUVInf; //!< lower bounds of the parameters
+    math_Vector           myUVSup; //!< upper bounds of the parameters
+    Standard_Real         myU;     //!< parameters of the best projection
+    Standard_Real         myV;
+  };
+
+  //! Tools of the projection used by one thread.
+  class ProjectionContext : public Standard_Transient
+  {
+  public:
+
+    //! Constructor.
+    ProjectionContext (const ProjectionData& theData)
+    : myData (theData),
+      mySurface (theData.Surface->ShallowCopy()),
+      mySelector (theData, myFunc),
+      myIsExtPSInit (Standard_False)
+    {
+      myFunc.Initialize (*mySurface);
+    }
+
+    //! Projects the point, returns false if the projection is not found.
+    Standard_Boolean Project (const gp_Pnt& thePoint,
+                              Standard_Real& theU,
+                              Standard_Real& theV,
+                              Standard_Real& theDistance)
+    {
+      if (myData.SampleSet == NULL
+      || !mySelector.Project (thePoint, theU, theV, theDistance))
+      {
+        return projectByExtrema (thePoint, theU, theV, theDistance);
+      }
+
+      // the iterations stopped on the boundary of the domain may miss the nearest
+      // point of the boundary found by the general algorithm
+      if (theU - myData.UMin > myData.Tolerance && myData.UMax - theU > myData.Tolerance
+       && theV - myData.VMin > myData.Tolerance && myData.VMax - theV > myData.Tolerance)
+      {
+        return Standard_True;
+      }
+      Standard_Real anU = 0.0, aV = 0.0, aDistance = 0.0;
+      if (projectByExtrema (thePoint, anU, aV, aDistance)
+       && aDistance < theDistance)
+      {
+        theU = anU;
+        theV = aV;
+        theDistance = aDistance;
+      }
+      return Standard_True;
+    }
+
+  private:
+
+    //! Computes the nearest projection by the general extrema algorithm.
+    Standard_Boolean projectByExtrema (const gp_Pnt& thePoint,
+                                       Standard_Real& theU,
+                                       Standard_Real& theV,
+                                       Standard_Real& theDistance)
+    {
+      if (!myIsExtPSInit)
+      {
+        myExtPS.Initialize (*mySurface, myData.UMin, myData.UMax, myData.VMin, myData.VMax,
+                            myData.Tolerance, myData.Tolerance);
+        myIsExtPSInit = Standard_True;
+      }
+      myExtPS.Perform (thePoint);
+      if (!myExtPS.IsDone() || myExtPS.NbExt() < 1)
+      {
+        return Standard_False;
+      }
+
+      Standard_Integer aBest = 1;
+      for (Standard_Integer anExtIter = 2; anExtIter <= myExtPS.NbExt(); ++anExtIter)
+      {
+        if (myExtPS.SquareDistance (anExtIter) < myExtPS.SquareDistance (aBest))
+        {
+          aBest = anExtIter;
+        }
+      }
+      myExtPS.Point (aBest).Parameter (theU, theV);
+      theDistance = Sqrt (myExtPS.SquareDistance (aBest));
+      return Standard_True;
+    }
+
+  private:
+    const ProjectionData&     myData;        //!< shared data of the projection
+    Handle(Adaptor3d_Surface) mySurface;     //!< copy of the adaptor for this thread
+    Extrema_FuncPSNorm        myFunc;        //!< function of the Newton iterations
+    CellSelector              mySelector;    //!< selector of the cells of the sample grid
+    Extrema_ExtPS             myExtPS;       //!< general extrema algorithm
+    Standard_Boolean          myIsExtPSInit; //!< flag of initialized myExtPS
+  };
+
+  //! Functor projecting the points with the context per thread.
+  class ProjectionFunctor
+  {
+  public:
+
+    //! Constructor.
+    ProjectionFunctor (const ProjectionData& theData,
+                       const OSD_ThreadPool::Launcher& theLauncher,
+                       const TColgp_Array1OfPnt& thePoints,
+                       NCollection_Array1<Standard_Boolean>& theIsDone,
+                       TColStd_Array1OfReal& theU,
+                       TColStd_Array1OfReal& theV,
+                       TColStd_Array1OfReal& theDistances)
+    : myData (theData),
+      myContexts (theLauncher.LowerThreadIndex(), theLauncher.UpperThreadIndex()),
+      myPoints (thePoints),
+      myIsDone (theIsDone),
+      myU (theU),
+      myV (theV),
+      myDistances (theDistances) {}
+
+    //! Projects the point with the given index.
+    void operator() (int theThreadIndex,
+                     int theIndex) const
+    {
+      Handle(ProjectionContext)& aContext = myContexts.ChangeValue (theThreadIndex);
+      if (aContext.IsNull())
+      {
+        aContext = new ProjectionContext (myData);
+      }
+      myIsDone (theIndex) = aContext->Project (myPoints (theIndex), myU (theIndex), myV (theIndex), myDistances (theIndex));
+    }
+
+  private:
+    ProjectionFunctor (const ProjectionFunctor& );
+    ProjectionFunctor& operator= (const ProjectionFunctor& );
+
+  private:
+    const ProjectionData&                                 myData;
+    mutable NCollection_Array1<Handle(ProjectionContext)> myContexts;
+    const TColgp_Array1OfPnt&                             myPoints;
+    NCollection_Array1<Standard_Boolean>&                 myIsDone;
+    TColStd_Array1OfReal&                                 myU;
+    TColStd_Array1OfReal&                                 myV;
+    TColStd_Array1OfReal&                                 myDistances;
+  };
+}
+
+//=======================================================================
+//function : GeomAPI_ProjectPointsOnSurf
+//purpose  :
+//=======================================================================
+GeomAPI_ProjectPointsOnSurf::GeomAPI_ProjectPointsOnSurf()
+: myUMin (0.0),
+  myUMax (0.0),
+  myVMin (0.0),
+  myVMax (0.0),
+  myTolerance (0.0)
+{
+  //
+}
+
+//=======================================================================
+//function : GeomAPI_ProjectPointsOnSurf
+//purpose  :
+//=======================================================================
+GeomAPI_ProjectPointsOnSurf::GeomAPI_ProjectPointsOnSurf (const Handle(Geom_Surface)& theSurface,
+                                                          const Standard_Real theTolerance)
+{
+  Init (theSurface, theTolerance);
+}
+
+//=======================================================================
+//function : GeomAPI_ProjectPointsOnSurf
+//purpose  :
+//=======================================================================
+GeomAPI_ProjectPointsOnSurf::GeomAPI_ProjectPointsOnSurf (const Handle(Geom_Surface)& theSurface,
+                                                          const Standard_Real theUMin,
+                                                          const Standard_Real theUMax,
+                                                          const Standard_Real theVMin,
+                                                          const Standard_Real theVMax,
+                                                          const Standard_Real theTolerance)
+{
+  Init (theSurface, theUMin, theUMax, theVMin, theVMax, theTolerance);
+}
+
+//=======================================================================
+//function : Init
+//purpose  :
+//=======================================================================
+void GeomAPI_ProjectPointsOnSurf::Init (const Handle(Geom_Surface)& theSurface,
+                                        const Standard_Real theTolerance)
+{
+  Standard_Real aUMin = 0.0, aUMax = 0.0, aVMin = 0.0, aVMax = 0.0;
+  theSurface->Bounds (aUMin, aUMax, aVMin, aVMax);
+  Init (theSurface, aUMin, aUMax, aVMin, aVMax, theTolerance);
+}
+
+//=======================================================================
+//function : Init
+//purpose  :
+//=======================================================================
+void GeomAPI_ProjectPointsOnSurf::Init (const Handle(Geom_Surface)& theSurface,
+                                        const Standard_Real theUMin,
+                                        const Standard_Real theUMax,
+                                        const Standard_Real theVMin,
+                                        const Standard_Real theVMax,
+                                        const Standard_Real theTolerance)
+{
+  mySurface.Load (theSurface, theUMin, theUMax, theVMin, theVMax);
+  myUMin = theUMin;
+  myUMax = theUMax;
+  myVMin = theVMin;
+  myVMax = theVMax;
+  myTolerance = theTolerance;
+  mySampleU   = TColStd_Array1OfReal();
+  mySampleV   = TColStd_Array1OfReal();
+  mySamples   = TColgp_Array2OfPnt();
+  mySampleSet.Nullify();
+
+  // Extrema_ExtPS computes the projection onto the elementary surfaces
+  // and the surfaces of extrusion and revolution without the sampling
+  switch (mySurface.GetType())
+  {
+    case GeomAbs_BezierSurface:
+    case GeomAbs_BSplineSurface:
+    case GeomAbs_OffsetSurface:
+    case GeomAbs_OtherSurface:
+      break;
+    default:
+      return;
+  }
+
+  // the unbounded domain cannot be sampled with the finite steps,
+  // the points are projected without the sampling as by GeomAPI_ProjectPointOnSurf
+  if (Precision::IsInfinite (theUMin) || Precision::IsInfinite (theUMax)
+   || Precision::IsInfinite (theVMin) || Precision::IsInfinite (theVMax))
+  {
+    return;
+  }
+
+  fillSamples (Standard_True,  mySampleU);
+  fillSamples (Standard_False, mySampleV);
+  mySamples.Resize (mySampleU.Lower(), mySampleU.Upper(), mySampleV.Lower(), mySampleV.Upper(), Standard_False);
+  mySurface.D0Grid (mySampleU, mySampleV, mySamples);
+
+  // the cells of 3x3 samples; the box of the cell is enlarged by the deviation
+  // of the middle samples from the bilinear interpolation of the corner ones
+  // to bound the patch of the surface covered by the cell
+  const Standard_Integer aNbCellsU = (mySampleU.Length() - 1) / 2;
+  const Standard_Integer aNbCellsV = (mySampleV.Length() - 1) / 2;
+  mySampleSet = new SampleSet (new BVH_LinearBuilder<Standard_Real, 3>());
+  mySampleSet->SetSize (aNbCellsU * aNbCellsV);
+  for (Standard_Integer aCellU = 0; aCellU < aNbCellsU; ++aCellU)
+  {
+    for (Standard_Integer aCellV = 0; aCellV < aNbCellsV; ++aCellV)
+    {
+      const Standard_Integer anU = mySampleU.Lower() + 2 * aCellU;
+      const Standard_Integer aV  = mySampleV.Lower() + 2 * aCellV;
+      const gp_XYZ& aP00 = mySamples (anU,     aV    ).XYZ();
+      const gp_XYZ& aP20 = mySamples (anU + 2, aV    ).XYZ();
+      const gp_XYZ& aP02 = mySamples (anU,     aV + 2).XYZ();
+      const gp_XYZ& aP22 = mySamples (anU + 2, aV + 2).XYZ();
+      Standard_Real aSqDev = 0.0;
+      aSqDev = Max (aSqDev, (mySamples (anU + 1, aV    ).XYZ() - (aP00 + aP20) * 0.5).SquareModulus());
+      aSqDev = Max (aSqDev, (mySamples (anU + 1, aV + 2).XYZ() - (aP02 + aP22) * 0.5).SquareModulus());
+      aSqDev = Max (aSqDev, (mySamples (anU,     aV + 1).XYZ() - (aP00 + aP02) * 0.5).SquareModulus());
+      aSqDev = Max (aSqDev, (mySamples (anU + 2, aV + 1).XYZ() - (aP20 + aP22) * 0.5).SquareModulus());
+      aSqDev = Max (aSqDev, (mySamples (anU + 1, aV + 1).XYZ() - (aP00 + aP20 + aP02 + aP22) * 0.25).SquareModulus());
+
+      BVH_Box<Standard_Real, 3> aBox;
+      for (Standard_Integer anUIter = anU; anUIter <= anU + 2; ++anUIter)
+      {
+        for (Standard_Integer aVIter = aV; aVIter <= aV + 2; ++aVIter)
+        {
+          const gp_Pnt& aPnt = mySamples (anUIter, aVIter);
+          aBox.Add (BVH_Vec3d (aPnt.X(), aPnt.Y(), aPnt.Z()));
+        }
+      }
+      const Standard_Real anEnlarge = 2.0 * Sqrt (aSqDev) + Precision::Confusion();
+      aBox.CornerMin() -= BVH_Vec3d (anEnlarge, anEnlarge, anEnlarge);
+      aBox.CornerMax() += BVH_Vec3d (anEnlarge, anEnlarge, anEnlarge);
+      mySampleSet->Add (aCellU * aNbCellsV + aCellV, aBox);
+    }
+  }
+  mySampleSet->Build();
+}
+
+//=======================================================================
+//function : fillSamples
+//purpose  :
+//=======================================================================
+void GeomAPI_ProjectPointsOnSurf::fillSamples (const Standard_Boolean theIsU,
+                                               TColStd_Array1OfReal& theParams) const
+{
+  // each interval of the surface is split into the equal steps, so that
+  // the knot spans of B-spline get at least the number of samples equal to the order
+  const Standard_Integer aNbIntervals = theIsU ? mySurface.NbUIntervals (GeomAbs_CN)
+                                               : mySurface.NbVIntervals (GeomAbs_CN);
+  TColStd_Array1OfReal anIntervals (1, aNbIntervals + 1);
+  if (theIsU)
+  {
+    mySurface.UIntervals (anIntervals, GeomAbs_CN);
+  }
+  else
+  {
+    mySurface.VIntervals (anIntervals, GeomAbs_CN);
+  }
+
+  Standard_Integer aNbPerInterval = (THE_MIN_NB_SAMPLES + aNbIntervals - 1) / aNbIntervals;
+  if (mySurface.GetType() == GeomAbs_BSplineSurface
+   || mySurface.GetType() == GeomAbs_BezierSurface)
+  {
+    aNbPerInterval = Max (aNbPerInterval, (theIsU ? mySurface.UDegree() : mySurface.VDegree()) + 1);
+  }
+  aNbPerInterval = Max (Min (aNbPerInterval, THE_MAX_NB_SAMPLES / aNbIntervals), 1);
+
+  // even number of the samples in each interval to compose the cells of 3x3 samples
+  aNbPerInterval += aNbPerInterval % 2;
+
+  theParams.Resize (1, aNbIntervals * aNbPerInterval + 1, Standard_False);
+  Standard_Integer aParamIter = 1;
+  for (Standard_Integer anIntIter = 1; anIntIter <= aNbIntervals; ++anIntIter)
+  {
+    const Standard_Real aFirst = anIntervals (anIntIter);
+    const Standard_Real aStep  = (anIntervals (anIntIter + 1) - aFirst) / aNbPerInterval;
+    for (Standard_Integer aStepIter = 0; aStepIter < aNbPerInterval; ++aStepIter)
+    {
+      theParams (aParamIter++) = aFirst + aStep * aStepIter;
+    }
+  }
+  theParams (aParamIter) = anIntervals (aNbIntervals + 1);
+}
+
+//=======================================================================
+//function : Perform
+//purpose  :
+//=======================================================================
+void GeomAPI_ProjectPointsOnSurf::Perform (const TColgp_Array1OfPnt& thePoints,
+                                           const Standard_Boolean theToRunParallel)
+{
+  myIsDone   .Resize (thePoints.Lower(), thePoints.Upper(), Standard_False);
+  myUParams  .Resize (thePoints.Lower(), thePoints.Upper(), Standard_False);
+  myVParams  .Resize (thePoints.Lower(), thePoints.Upper(), Standard_False);
+  myDistances.Resize (thePoints.Lower(), thePoints.Upper(), Standard_False);
+  myIsDone.Init (Standard_False);
+  if (thePoints.IsEmpty() || mySurface.Surface().IsNull())
+  {
+    return;
+  }
+
+  ProjectionData aData;
+  aData.Surface   = &mySurface;
+  aData.UMin      = myUMin;
+  aData.UMax      = myUMax;
+  aData.VMin      = myVMin;
+  aData.VMax      = myVMax;
+  aData.Tolerance = myTolerance;
+  aData.SampleU   = &mySampleU;
+  aData.SampleV   = &mySampleV;
+  aData.Samples   = &mySamples;
+  aData.SampleSet = mySampleSet.get();
+
+  const Handle(OSD_ThreadPool)& aThreadPool = OSD_ThreadPool::DefaultPool();
+  OSD_ThreadPool::Launcher aPoolLauncher (*aThreadPool, theToRunParallel ? thePoints.Length() : 0);
+  ProjectionFunctor aFunctor (aData, aPoolLauncher, thePoints, myIsDone, myUParams, myVParams, myDistances);
+  aPoolLauncher.Perform (thePoints.Lower(), thePoints.Upper() + 1, aFunctor);
+}
+
+//=======================================================================
+//function : Parameters
+//purpose  :
+//=======================================================================
+void GeomAPI_ProjectPointsOnSurf::Parameters (const Standard_Integer theIndex,
+                                              Standard_Real& theU,
+                                              Standard_Real& theV) const
+{
+  StdFail_NotDone_Raise_if (!myIsDone (theIndex), "GeomAPI_ProjectPointsOnSurf::Parameters");
+  theU = myUParams (theIndex);
+  theV = myVParams (theIndex);
+}
+
+//=======================================================================
+//function : Distance
+//purpose  :
+//=======================================================================
+Standard_Real GeomAPI_ProjectPointsOnSurf::Distance (const Standard_Integer theIndex) const
+{
+  StdFail_NotDone_Raise_if (!myIsDone (theIndex), "GeomAPI_ProjectPointsOnSurf::Distance");
+  return myDistances (theIndex);
+}
+
+//=======================================================================
+//function : Point
+//purpose  :
+//=======================================================================
+gp_Pnt GeomAPI_ProjectPointsOnSurf::Point (const Standard_Integer theIndex) const
+{
+  StdFail_NotDone_Raise_if (!myIsDone (theIndex), "GeomAPI_ProjectPointsOnSurf::Point");
+  return mySurface.Value (myUParams (theIndex), myVParams (theIndex));
+}
@@ -0,0 +1,163 @@
+// Copyright (c) 2024 OPEN CASCADE SAS
+//
+// This file is part of Open CASCADE Technology software library.
+//
+// This library is free software; you can redistribute it and/or modify it under
+// the terms of the GNU Lesser General Public License version 2.1 as published
+// by the Free Software Foundation, with special exception defined in the file
+// OCCT_LGPL_EXCEPTION.txt. Consult the file LICENSE_LGPL_21.txt included in OCCT
+// distribution for complete text of the license and disclaimer of any warranty.
+//
+// Alternatively, this file may be used under the terms of Open CASCADE
+// commercial license or contractual agreement.
+
+#ifndef _GeomAPI_ProjectPointsOnSurf_HeaderFile
+#define _GeomAPI_ProjectPointsOnSurf_HeaderFile
+
+#include <BVH_BoxSet.hxx>
+#include <GeomAdaptor_Surface.hxx>
+#include <NCollection_Array1.hxx>
+#include <TColgp_Array1OfPnt.hxx>
+#include <TColgp_Array2OfPnt.hxx>
+#include <TColStd_Array1OfReal.hxx>
+
+class Geom_Surface;
+
+//! This class computes the nearest orthogonal projections of the array of points
+//! onto the surface. It is intended for projection of the large number of points
+//! (e.g. the points of the scan) onto the same surface.
+//!
+//! The surface is sampled once on initialization: the cells of the grid of samples
+//! are put into the BVH tree, which is shared by all points to be projected.
+//! The box of each cell is enlarged by the estimated deflection of the surface
+//! from the samples, so that it bounds the patch of the surface covered by the cell.
+//! The projection of the point visits the cells in the order of the distance to their
+//! boxes and refines the projection by Newton iterations on the gradient of the distance
+//! function starting from the nearest sample of the cell; the cells with the boxes
+//! farther than the best projection found are skipped.
+//! When the iterations fail in all visited cells, the projection is computed
+//! by Extrema_ExtPS like GeomAPI_ProjectPointOnSurf.
+//! For elementary surfaces, surfaces of extrusion and revolution the sampling is not
+//! needed and Extrema_ExtPS is used directly.
+//!
+//! The points are projected in parallel threads, each thread keeping its own copy
+//! of the adaptor of the surface.
+//!
+//! The result for each point is the parameters of the projection and the distance,
+//! accessed by the index of the point in the input array.
+class GeomAPI_ProjectPointsOnSurf
+{
+public:
+
+  DEFINE_STANDARD_ALLOC
+
+  //! Creates an empty object. Use the Init function for further initialization.
+  Standard_EXPORT GeomAPI_ProjectPointsOnSurf();
+
+  //! Initializes the projection onto the whole surface.
+  Standard_EXPORT GeomAPI_ProjectPointsOnSurf (const Handle(Geom_Surface)& theSurface,
+                                               const Standard_Real theTolerance);
+
+  //! Initializes the projection onto the domain [theUMin, theUMax] x [theVMin, theVMax] of the surface.
+  Standard_EXPORT GeomAPI_ProjectPointsOnSurf (const Handle(Geom_Surface)& theSurface,
+                                               const Standard_Real theUMin,
+                                               const Standard_Real theUMax,
+                                               const Standard_Real theVMin,
+                                               const Standard_Real theVMax,
+                                               const Standard_Real theTolerance);
+
+  //! Initializes the projection onto the whole surface.
+  //! theTolerance is the parametric tolerance of the iterations.
+  Standard_EXPORT void Init (const Handle(Geom_Surface)& theSurface,
+                             const Standard_Real theTolerance);
+
+  //! Initializes the projection onto the domain [theUMin, theUMax] x [theVMin, theVMax] of the surface;
+  //! samples the surface and builds the tree of the sample points.
+  //! The infinite domain is not sampled, the points are projected onto it by Extrema_ExtPS.
+  Standard_EXPORT void Init (const Handle(Geom_Surface)& theSurface,
+                             const Standard_Real theUMin,
+                             const Standard_Real theUMax,
+                             const Standard_Real theVMin,
+                             const Standard_Real theVMax,
+                             const Standard_Real theTolerance);
+
+  //! Returns the number of the sample points of the surface
+  //! (0 if the projection does not need the sampling).
+  Standard_Integer NbSamples() const { return mySamples.Size(); }
+
+  //! Projects the points onto the surface.
+  //! The results are indexed by the indices of the points in the array.
+  //! @param thePoints the points to be projected
+  //! @param theToRunParallel flag to project the points in parallel threads
+  Standard_EXPORT void Perform (const TColgp_Array1OfPnt& thePoints,
+                                const Standard_Boolean theToRunParallel = Standard_True);
+
+  //! Returns the lower index of the projected points.
+  Standard_Integer Lower() const { return myIsDone.Lower(); }
+
+  //! Returns the upper index of the projected points.
+  Standard_Integer Upper() const { return myIsDone.Upper(); }
+
+  //! Returns the number of the projected points.
+  Standard_Integer NbPoints() const { return myIsDone.Size(); }
+
+  //! Returns true if the projection of the point with the given index is found.
+  Standard_Boolean IsDone (const Standard_Integer theIndex) const { return myIsDone (theIndex); }
+
+  //! Returns the parameters of the projection of the point with the given index.
+  //! Exceptions
+  //! StdFail_NotDone if the projection of the point is not found.
+  Standard_EXPORT void Parameters (const Standard_Integer theIndex,
+                                   Standard_Real& theU,
+                                   Standard_Real& theV) const;
+
+  //! Returns the distance between the point with the given index and its projection.
+  //! Exceptions
+  //! StdFail_NotDone if the projection of the point is not found.
+  Standard_EXPORT Standard_Real Distance (const Standard_Integer theIndex) const;
+
+  //! Returns the projection of the point with the given index.
+  //! Exceptions
+  //! StdFail_NotDone if the projection of the point is not found.
+  Standard_EXPORT gp_Pnt Point (const Standard_Integer theIndex) const;
+
+  //! Returns the U parameters of the projections; undefined for the points without projection.
+  const TColStd_Array1OfReal& UParameters() const { return myUParams; }
+
+  //! Returns the V parameters of the projections; undefined for the points without projection.
+  const TColStd_Array1OfReal& VParameters() const { return myVParams; }
+
+  //! Returns the distances to the projections; undefined for the points without projection.
+  const TColStd_Array1OfReal& Distances() const { return myDistances; }
+
+public:
+
+  //! Set of the cells of the grid of samples, the element is the index of the cell.
+  typedef BVH_BoxSet<Standard_Real, 3, Standard_Integer> SampleSet;
+
+private:
+
+  //! Fills the sample parameters in one direction of the surface.
+  void fillSamples (const Standard_Boolean theIsU,
+                    TColStd_Array1OfReal& theParams) const;
+
+private:
+
+  GeomAdaptor_Surface                  mySurface;   //!< adaptor of the surface
+  Standard_Real                        myUMin;      //!< domain of the projection
+  Standard_Real                        myUMax;
+  Standard_Real                        myVMin;
+  Standard_Real                        myVMax;
+  Standard_Real                        myTolerance; //!< parametric tolerance
+  TColStd_Array1OfReal                 mySampleU;   //!< U parameters of the samples
+  TColStd_Array1OfReal                 mySampleV;   //!< V parameters of the samples
+  TColgp_Array2OfPnt                   mySamples;   //!< sample points of the surface
+  Handle(SampleSet)                    mySampleSet; //!< tree of the sample points
+  NCollection_Array1<Standard_Boolean> myIsDone;    //!< flags of the found projections
+  TColStd_Array1OfReal                 myUParams;   //!< U parameters of the projections
+  TColStd_Array1OfReal                 myVParams;   //!< V parameters of the projections
+  TColStd_Array1OfReal                 myDistances; //!< distances to the projections
+
+};
+
+#endif // _GeomAPI_ProjectPointsOnSurf_HeaderFile
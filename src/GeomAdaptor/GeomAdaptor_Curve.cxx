@@ -45,17 +45,24 @@
 #include <gp_Parab.hxx>
 #include <gp_Pnt.hxx>
 #include <gp_Vec.hxx>
+#include <NCollection_LocalArray.hxx>
 #include <Precision.hxx>
 #include <Standard_DomainError.hxx>
 #include <Standard_NoSuchObject.hxx>
 #include <Standard_NotImplemented.hxx>
 #include <TColgp_Array1OfPnt.hxx>
+#include <TColgp_Array1OfVec.hxx>
 #include <TColStd_Array1OfInteger.hxx>
 #include <TColStd_Array1OfReal.hxx>
 
+#include <algorithm>
+
 //#include <GeomConvert_BSplineCurveKnotSplitting.hxx>
 static const Standard_Real PosTol = Precision::PConfusion() / 2;
 
+//! Number of the parameters ordered by the spans at once in the array evaluation
+static const Standard_Integer THE_ARRAY_BLOCK_SIZE = 4096;
+
 IMPLEMENT_STANDARD_RTTIEXT(GeomAdaptor_Curve, Adaptor3d_Curve)
 
 //=======================================================================
@@ -693,6 +700,106 @@ void GeomAdaptor_Curve::D3(const Standard_Real U,
 }
 }
 
+//=======================================================================
+//function : evalArrayBySpans
+//purpose  : 
+//=======================================================================
+
+void GeomAdaptor_Curve::evalArrayBySpans (const Standard_Integer      theDeriv,
+                                          const TColStd_Array1OfReal& theParams,
+                                          TColgp_Array1OfPnt&         thePoints,
+                                          TColgp_Array1OfVec*         theD1,
+                                          TColgp_Array1OfVec*         theD2) const
+{
+  // the parameters are ordered by the spans within the blocks small enough
+  // to keep the evaluated values in the processor cache, so that the cache
+  // of the span is rebuilt once per block instead of once per parameter
+  const TColStd_Array1OfReal& aKnots = myBSplineCurve->Knots();
+  NCollection_LocalArray<std::pair<Standard_Integer, Standard_Integer> > anOrder (Min (THE_ARRAY_BLOCK_SIZE, theParams.Length()));
+  Standard_Integer aSpan = aKnots.Lower();
+  for (Standard_Integer aBlockStart = theParams.Lower(); aBlockStart <= theParams.Upper();
+       aBlockStart += THE_ARRAY_BLOCK_SIZE)
+  {
+    const Standard_Integer aBlockEnd = Min (aBlockStart + THE_ARRAY_BLOCK_SIZE - 1, theParams.Upper());
+    Standard_Integer aNbParams = 0;
+    for (Standard_Integer anIter = aBlockStart; anIter <= aBlockEnd; ++anIter)
+    {
+      BSplCLib::Hunt (aKnots, theParams (anIter), aSpan);
+      anOrder[aNbParams++] = std::make_pair (aSpan, anIter);
+    }
+    std::sort (&anOrder[0], &anOrder[0] + aNbParams);
+
+    for (Standard_Integer anIter = 0; anIter < aNbParams; ++anIter)
+    {
+      const Standard_Integer anIndex = anOrder[anIter].second;
+      switch (theDeriv)
+      {
+        case 0:
+          D0 (theParams (anIndex), thePoints.ChangeValue (anIndex));
+          break;
+        case 1:
+          D1 (theParams (anIndex), thePoints.ChangeValue (anIndex), theD1->ChangeValue (anIndex));
+          break;
+        default:
+          D2 (theParams (anIndex), thePoints.ChangeValue (anIndex),
+              theD1->ChangeValue (anIndex), theD2->ChangeValue (anIndex));
+          break;
+      }
+    }
+  }
+}
+
+//=======================================================================
+//function : D0Array
+//purpose  : 
+//=======================================================================
+
+void GeomAdaptor_Curve::D0Array (const TColStd_Array1OfReal& theParams,
+                                 TColgp_Array1OfPnt& thePoints) const
+{
+  if (myTypeCurve == GeomAbs_BSplineCurve)
+  {
+    evalArrayBySpans (0, theParams, thePoints, NULL, NULL);
+    return;
+  }
+  Adaptor3d_Curve::D0Array (theParams, thePoints);
+}
+
+//=======================================================================
+//function : D1Array
+//purpose  : 
+//=======================================================================
+
+void GeomAdaptor_Curve::D1Array (const TColStd_Array1OfReal& theParams,
+                                 TColgp_Array1OfPnt& thePoints,
+                                 TColgp_Array1OfVec& theD1) const
+{
+  if (myTypeCurve == GeomAbs_BSplineCurve)
+  {
+    evalArrayBySpans (1, theParams, thePoints, &theD1, NULL);
+    return;
+  }
+  Adaptor3d_Curve::D1Array (theParams, thePoints, theD1);
+}
+
+//=======================================================================
+//function : D2Array
+//purpose  : 
+//=======================================================================
+
+void GeomAdaptor_Curve::D2Array (const TColStd_Array1OfReal& theParams,
+                                 TColgp_Array1OfPnt& thePoints,
+                                 TColgp_Array1OfVec& theD1,
+                                 TColgp_Array1OfVec& theD2) const
+{
+  if (myTypeCurve == GeomAbs_BSplineCurve)
+  {
+    evalArrayBySpans (2, theParams, thePoints, &theD1, &theD2);
+    return;
+  }
+  Adaptor3d_Curve::D2Array (theParams, thePoints, theD1, theD2);
+}
+
 //=======================================================================
 //function : DN
 //purpose  : 
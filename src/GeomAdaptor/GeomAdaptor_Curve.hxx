@@ -143,6 +143,26 @@ public:
   //! derivatives are computed on the current interval.
   //! else the derivatives are computed on the basis curve.
   Standard_EXPORT void D3 (const Standard_Real U, gp_Pnt& P, gp_Vec& V1, gp_Vec& V2, gp_Vec& V3) const Standard_OVERRIDE;
+
+  //! Computes the points of the array of parameters, see Adaptor3d_Curve::D0Array().
+  //! For B-spline curve the parameters are visited span by span,
+  //! so that the cache of each span is built once for any order of the parameters;
+  //! the result is the same as of D0().
+  Standard_EXPORT virtual void D0Array (const TColStd_Array1OfReal& theParams,
+                                        TColgp_Array1OfPnt& thePoints) const Standard_OVERRIDE;
+
+  //! Computes the points and the first derivatives of the array of parameters,
+  //! see D0Array() above; the result is the same as of D1().
+  Standard_EXPORT virtual void D1Array (const TColStd_Array1OfReal& theParams,
+                                        TColgp_Array1OfPnt& thePoints,
+                                        TColgp_Array1OfVec& theD1) const Standard_OVERRIDE;
+
+  //! Computes the points, the first and the second derivatives of the array of parameters,
+  //! see D0Array() above; the result is the same as of D2().
+  Standard_EXPORT virtual void D2Array (const TColStd_Array1OfReal& theParams,
+                                        TColgp_Array1OfPnt& thePoints,
+                                        TColgp_Array1OfVec& theD1,
+                                        TColgp_Array1OfVec& theD2) const Standard_OVERRIDE;
   
 
   //! The returned vector gives the value of the derivative for the
@@ -224,6 +244,14 @@ private:
   //! \param theParameter the value on the knot axis which identifies the caching span
   void RebuildCache (const Standard_Real theParameter) const;
 
+  //! Evaluates the array of parameters of B-spline curve with the derivatives
+  //! till theDeriv order visiting the parameters of the same span together.
+  void evalArrayBySpans (const Standard_Integer      theDeriv,
+                         const TColStd_Array1OfReal& theParams,
+                         TColgp_Array1OfPnt&         thePoints,
+                         TColgp_Array1OfVec*         theD1,
+                         TColgp_Array1OfVec*         theD2) const;
+
 private:
 
   Handle(Geom_Curve) myCurve;
@@ -27,6 +27,7 @@
 #include <Adaptor3d_Surface.hxx>
 #include <BSplCLib.hxx>
 #include <BSplSLib_Cache.hxx>
+#include <ElSLib.hxx>
 #include <Geom_BezierSurface.hxx>
 #include <Geom_Circle.hxx>
 #include <Geom_ConicalSurface.hxx>
@@ -50,9 +51,11 @@
 #include <gp_Dir.hxx>
 #include <gp_Pln.hxx>
 #include <gp_Pnt.hxx>
+#include <gp_Pnt2d.hxx>
 #include <gp_Sphere.hxx>
 #include <gp_Torus.hxx>
 #include <gp_Vec.hxx>
+#include <NCollection_LocalArray.hxx>
 #include <Precision.hxx>
 #include <Standard_DomainError.hxx>
 #include <Standard_NoSuchObject.hxx>
@@ -60,8 +63,13 @@
 #include <TColStd_Array1OfInteger.hxx>
 #include <TColStd_Array1OfReal.hxx>
 
+#include <algorithm>
+
 static const Standard_Real PosTol = Precision::PConfusion()*0.5;
 
+//! Number of the parameters ordered by the patches at once in the array evaluation
+static const Standard_Integer THE_ARRAY_BLOCK_SIZE = 4096;
+
 IMPLEMENT_STANDARD_RTTIEXT(GeomAdaptor_Surface, Adaptor3d_Surface)
 
 //=======================================================================
@@ -854,6 +862,499 @@ void GeomAdaptor_Surface::D2(const Standard_Real U,
 }
 
 
+//=======================================================================
+//function : snapGridParameters
+//purpose  : Moves the parameters of the grid lines close to the bounds
+//           onto the bounds in the same way as D1() and D2() do
+//=======================================================================
+
+static void snapGridParameters (const TColStd_Array1OfReal& theParams,
+                                const Standard_Real theFirst,
+                                const Standard_Real theLast,
+                                const Standard_Real theTol,
+                                TColStd_Array1OfReal& theSnapped)
+{
+  for (Standard_Integer i = theParams.Lower(); i <= theParams.Upper(); ++i)
+  {
+    const Standard_Real aParam = theParams (i);
+    if (Abs (aParam - theFirst) <= theTol)
+    {
+      theSnapped (i) = theFirst;
+    }
+    else if (Abs (aParam - theLast) <= theTol)
+    {
+      theSnapped (i) = theLast;
+    }
+    else
+    {
+      theSnapped (i) = aParam;
+    }
+  }
+}
+
+//=======================================================================
+//function : D0Grid
+//purpose  : 
+//=======================================================================
+
+void GeomAdaptor_Surface::D0Grid (const TColStd_Array1OfReal& theU,
+                                  const TColStd_Array1OfReal& theV,
+                                  TColgp_Array2OfPnt& thePoints) const
+{
+  if (mySurfaceType == GeomAbs_BezierSurface
+   || mySurfaceType == GeomAbs_BSplineSurface)
+  {
+    evalGridByCache (0, theU, theV, thePoints, NULL, NULL, NULL, NULL, NULL);
+    return;
+  }
+
+  if (mySurfaceType == GeomAbs_SurfaceOfExtrusion
+   || mySurfaceType == GeomAbs_SurfaceOfRevolution
+   || mySurfaceType == GeomAbs_OffsetSurface)
+  {
+    Standard_NoSuchObject_Raise_if (myNestedEvaluator.IsNull(),
+        "GeomAdaptor_Surface::D0Grid: evaluator is not initialized");
+    myNestedEvaluator->D0Grid (theU, theV, thePoints);
+    return;
+  }
+
+  switch (mySurfaceType)
+  {
+    case GeomAbs_Plane:
+    {
+      ElSLib::PlaneD0Grid (theU, theV, Plane().Position(), thePoints);
+      return;
+    }
+    case GeomAbs_Cylinder:
+    {
+      const gp_Cylinder aCylinder = Cylinder();
+      ElSLib::CylinderD0Grid (theU, theV, aCylinder.Position(), aCylinder.Radius(), thePoints);
+      return;
+    }
+    case GeomAbs_Cone:
+    {
+      const gp_Cone aCone = Cone();
+      ElSLib::ConeD0Grid (theU, theV, aCone.Position(), aCone.RefRadius(), aCone.SemiAngle(), thePoints);
+      return;
+    }
+    case GeomAbs_Sphere:
+    {
+      const gp_Sphere aSphere = Sphere();
+      ElSLib::SphereD0Grid (theU, theV, aSphere.Position(), aSphere.Radius(), thePoints);
+      return;
+    }
+    case GeomAbs_Torus:
+    {
+      const gp_Torus aTorus = Torus();
+      ElSLib::TorusD0Grid (theU, theV, aTorus.Position(), aTorus.MajorRadius(), aTorus.MinorRadius(), thePoints);
+      return;
+    }
+    default:
+      break;
+  }
+  Adaptor3d_Surface::D0Grid (theU, theV, thePoints);
+}
+
+//=======================================================================
+//function : D1Grid
+//purpose  : 
+//=======================================================================
+
+void GeomAdaptor_Surface::D1Grid (const TColStd_Array1OfReal& theU,
+                                  const TColStd_Array1OfReal& theV,
+                                  TColgp_Array2OfPnt& thePoints,
+                                  TColgp_Array2OfVec& theD1U,
+                                  TColgp_Array2OfVec& theD1V) const
+{
+  if (mySurfaceType == GeomAbs_BezierSurface
+   || mySurfaceType == GeomAbs_BSplineSurface)
+  {
+    evalGridByCache (1, theU, theV, thePoints, &theD1U, &theD1V, NULL, NULL, NULL);
+    return;
+  }
+
+  if (mySurfaceType == GeomAbs_SurfaceOfExtrusion
+   || mySurfaceType == GeomAbs_SurfaceOfRevolution
+   || mySurfaceType == GeomAbs_OffsetSurface)
+  {
+    Standard_NoSuchObject_Raise_if (myNestedEvaluator.IsNull(),
+        "GeomAdaptor_Surface::D1Grid: evaluator is not initialized");
+    TColStd_Array1OfReal anU (theU.Lower(), theU.Upper()), aV (theV.Lower(), theV.Upper());
+    snapGridParameters (theU, myUFirst, myULast, myTolU, anU);
+    snapGridParameters (theV, myVFirst, myVLast, myTolV, aV);
+    myNestedEvaluator->D1Grid (anU, aV, thePoints, theD1U, theD1V);
+    return;
+  }
+
+  if (mySurfaceType == GeomAbs_Plane
+   || mySurfaceType == GeomAbs_Cylinder
+   || mySurfaceType == GeomAbs_Cone
+   || mySurfaceType == GeomAbs_Sphere
+   || mySurfaceType == GeomAbs_Torus)
+  {
+    TColStd_Array1OfReal anU (theU.Lower(), theU.Upper()), aV (theV.Lower(), theV.Upper());
+    snapGridParameters (theU, myUFirst, myULast, myTolU, anU);
+    snapGridParameters (theV, myVFirst, myVLast, myTolV, aV);
+    switch (mySurfaceType)
+    {
+      case GeomAbs_Plane:
+      {
+        ElSLib::PlaneD1Grid (anU, aV, Plane().Position(), thePoints, theD1U, theD1V);
+        break;
+      }
+      case GeomAbs_Cylinder:
+      {
+        const gp_Cylinder aCylinder = Cylinder();
+        ElSLib::CylinderD1Grid (anU, aV, aCylinder.Position(), aCylinder.Radius(),
+                                thePoints, theD1U, theD1V);
+        break;
+      }
+      case GeomAbs_Cone:
+      {
+        const gp_Cone aCone = Cone();
+        ElSLib::ConeD1Grid (anU, aV, aCone.Position(), aCone.RefRadius(), aCone.SemiAngle(),
+                            thePoints, theD1U, theD1V);
+        break;
+      }
+      case GeomAbs_Sphere:
+      {
+        const gp_Sphere aSphere = Sphere();
+        ElSLib::SphereD1Grid (anU, aV, aSphere.Position(), aSphere.Radius(),
+                              thePoints, theD1U, theD1V);
+        break;
+      }
+      default:
+      {
+        const gp_Torus aTorus = Torus();
+        ElSLib::TorusD1Grid (anU, aV, aTorus.Position(), aTorus.MajorRadius(), aTorus.MinorRadius(),
+                             thePoints, theD1U, theD1V);
+        break;
+      }
+    }
+    return;
+  }
+  Adaptor3d_Surface::D1Grid (theU, theV, thePoints, theD1U, theD1V);
+}
+
+//=======================================================================
+//function : D2Grid
+//purpose  : 
+//=======================================================================
+
+void GeomAdaptor_Surface::D2Grid (const TColStd_Array1OfReal& theU,
+                                  const TColStd_Array1OfReal& theV,
+                                  TColgp_Array2OfPnt& thePoints,
+                                  TColgp_Array2OfVec& theD1U,
+                                  TColgp_Array2OfVec& theD1V,
+                                  TColgp_Array2OfVec& theD2U,
+                                  TColgp_Array2OfVec& theD2V,
+                                  TColgp_Array2OfVec& theD2UV) const
+{
+  if (mySurfaceType == GeomAbs_BezierSurface
+   || mySurfaceType == GeomAbs_BSplineSurface)
+  {
+    evalGridByCache (2, theU, theV, thePoints, &theD1U, &theD1V, &theD2U, &theD2V, &theD2UV);
+    return;
+  }
+
+  if (mySurfaceType == GeomAbs_SurfaceOfExtrusion
+   || mySurfaceType == GeomAbs_SurfaceOfRevolution
+   || mySurfaceType == GeomAbs_OffsetSurface)
+  {
+    Standard_NoSuchObject_Raise_if (myNestedEvaluator.IsNull(),
+        "GeomAdaptor_Surface::D2Grid: evaluator is not initialized");
+    TColStd_Array1OfReal anU (theU.Lower(), theU.Upper()), aV (theV.Lower(), theV.Upper());
+    snapGridParameters (theU, myUFirst, myULast, myTolU, anU);
+    snapGridParameters (theV, myVFirst, myVLast, myTolV, aV);
+    myNestedEvaluator->D2Grid (anU, aV, thePoints, theD1U, theD1V, theD2U, theD2V, theD2UV);
+    return;
+  }
+
+  if (mySurfaceType == GeomAbs_Plane
+   || mySurfaceType == GeomAbs_Cylinder
+   || mySurfaceType == GeomAbs_Cone
+   || mySurfaceType == GeomAbs_Sphere
+   || mySurfaceType == GeomAbs_Torus)
+  {
+    TColStd_Array1OfReal anU (theU.Lower(), theU.Upper()), aV (theV.Lower(), theV.Upper());
+    snapGridParameters (theU, myUFirst, myULast, myTolU, anU);
+    snapGridParameters (theV, myVFirst, myVLast, myTolV, aV);
+    switch (mySurfaceType)
+    {
+      case GeomAbs_Plane:
+      {
+        ElSLib::PlaneD1Grid (anU, aV, Plane().Position(), thePoints, theD1U, theD1V);
+        theD2U .Init (gp_Vec (0.0, 0.0, 0.0));
+        theD2V .Init (gp_Vec (0.0, 0.0, 0.0));
+        theD2UV.Init (gp_Vec (0.0, 0.0, 0.0));
+        break;
+      }
+      case GeomAbs_Cylinder:
+      {
+        const gp_Cylinder aCylinder = Cylinder();
+        ElSLib::CylinderD2Grid (anU, aV, aCylinder.Position(), aCylinder.Radius(),
+                                thePoints, theD1U, theD1V, theD2U, theD2V, theD2UV);
+        break;
+      }
+      case GeomAbs_Cone:
+      {
+        const gp_Cone aCone = Cone();
+        ElSLib::ConeD2Grid (anU, aV, aCone.Position(), aCone.RefRadius(), aCone.SemiAngle(),
+                            thePoints, theD1U, theD1V, theD2U, theD2V, theD2UV);
+        break;
+      }
+      case GeomAbs_Sphere:
+      {
+        const gp_Sphere aSphere = Sphere();
+        ElSLib::SphereD2Grid (anU, aV, aSphere.Position(), aSphere.Radius(),
+                              thePoints, theD1U, theD1V, theD2U, theD2V, theD2UV);
+        break;
+      }
+      default:
+      {
+        const gp_Torus aTorus = Torus();
+        ElSLib::TorusD2Grid (anU, aV, aTorus.Position(), aTorus.MajorRadius(), aTorus.MinorRadius(),
+                             thePoints, theD1U, theD1V, theD2U, theD2V, theD2UV);
+        break;
+      }
+    }
+    return;
+  }
+  Adaptor3d_Surface::D2Grid (theU, theV, thePoints, theD1U, theD1V, theD2U, theD2V, theD2UV);
+}
+
+//=======================================================================
+//function : evalGridByCache
+//purpose  : 
+//=======================================================================
+
+void GeomAdaptor_Surface::evalGridByCache (const Standard_Integer      theDeriv,
+                                           const TColStd_Array1OfReal& theU,
+                                           const TColStd_Array1OfReal& theV,
+                                           TColgp_Array2OfPnt&         thePoints,
+                                           TColgp_Array2OfVec*         theD1U,
+                                           TColgp_Array2OfVec*         theD1V,
+                                           TColgp_Array2OfVec*         theD2U,
+                                           TColgp_Array2OfVec*         theD2V,
+                                           TColgp_Array2OfVec*         theD2UV) const
+{
+  if (theU.IsEmpty() || theV.IsEmpty())
+  {
+    return;
+  }
+
+  // the derivatives of B-spline on the boundaries of the adaptor are computed within
+  // the boundary spans (see D1()), such parameters are evaluated one by one
+  const Standard_Boolean toCheckBounds = theDeriv > 0 && !myBSplineSurface.IsNull();
+  NCollection_Array1<Standard_Boolean> isBoundU (theU.Lower(), theU.Upper());
+  NCollection_Array1<Standard_Boolean> isBoundV (theV.Lower(), theV.Upper());
+  for (Standard_Integer anUIter = theU.Lower(); anUIter <= theU.Upper(); ++anUIter)
+  {
+    isBoundU (anUIter) = toCheckBounds
+                      && (Abs (theU (anUIter) - myUFirst) <= myTolU
+                       || Abs (theU (anUIter) - myULast)  <= myTolU);
+  }
+  for (Standard_Integer aVIter = theV.Lower(); aVIter <= theV.Upper(); ++aVIter)
+  {
+    isBoundV (aVIter) = toCheckBounds
+                     && (Abs (theV (aVIter) - myVFirst) <= myTolV
+                      || Abs (theV (aVIter) - myVLast)  <= myTolV);
+  }
+
+  const Standard_Real aV0 = theV.First();
+  for (Standard_Integer anUIter = theU.Lower(); anUIter <= theU.Upper();)
+  {
+    // the block of the parameters along U lying in the same span
+    Standard_Integer anULast = anUIter;
+    if (!isBoundU (anUIter))
+    {
+      if (mySurfaceCache.IsNull() || !mySurfaceCache->IsCacheValid (theU (anUIter), aV0))
+      {
+        RebuildCache (theU (anUIter), aV0);
+      }
+      while (anULast < theU.Upper()
+         && !isBoundU (anULast + 1)
+         &&  mySurfaceCache->IsCacheValid (theU (anULast + 1), aV0))
+      {
+        ++anULast;
+      }
+    }
+
+    for (Standard_Integer aVIter = theV.Lower(); aVIter <= theV.Upper();)
+    {
+      if (isBoundU (anUIter) || isBoundV (aVIter))
+      {
+        for (Standard_Integer anUPntIter = anUIter; anUPntIter <= anULast; ++anUPntIter)
+        {
+          const Standard_Real anU = theU (anUPntIter), aV = theV (aVIter);
+          switch (theDeriv)
+          {
+            case 0:
+              D0 (anU, aV, thePoints.ChangeValue (anUPntIter, aVIter));
+              break;
+            case 1:
+              D1 (anU, aV, thePoints.ChangeValue (anUPntIter, aVIter),
+                  theD1U->ChangeValue (anUPntIter, aVIter), theD1V->ChangeValue (anUPntIter, aVIter));
+              break;
+            default:
+              D2 (anU, aV, thePoints.ChangeValue (anUPntIter, aVIter),
+                  theD1U->ChangeValue (anUPntIter, aVIter), theD1V->ChangeValue (anUPntIter, aVIter),
+                  theD2U->ChangeValue (anUPntIter, aVIter), theD2V->ChangeValue (anUPntIter, aVIter),
+                  theD2UV->ChangeValue (anUPntIter, aVIter));
+              break;
+          }
+        }
+        ++aVIter;
+        continue;
+      }
+
+      // the block of the parameters along V lying in the same span;
+      // the span along U is kept as the cache is built for the first parameter of the block
+      if (!mySurfaceCache->IsCacheValid (theU (anUIter), theV (aVIter)))
+      {
+        RebuildCache (theU (anUIter), theV (aVIter));
+      }
+      Standard_Integer aVLast = aVIter;
+      while (aVLast < theV.Upper()
+         && !isBoundV (aVLast + 1)
+         &&  mySurfaceCache->IsCacheValid (theU (anUIter), theV (aVLast + 1)))
+      {
+        ++aVLast;
+      }
+
+      switch (theDeriv)
+      {
+        case 0:
+          mySurfaceCache->D0Grid (theU, anUIter, anULast, theV, aVIter, aVLast, thePoints);
+          break;
+        case 1:
+          mySurfaceCache->D1Grid (theU, anUIter, anULast, theV, aVIter, aVLast, thePoints, *theD1U, *theD1V);
+          break;
+        default:
+          mySurfaceCache->D2Grid (theU, anUIter, anULast, theV, aVIter, aVLast, thePoints,
+                                  *theD1U, *theD1V, *theD2U, *theD2V, *theD2UV);
+          break;
+      }
+      aVIter = aVLast + 1;
+    }
+    anUIter = anULast + 1;
+  }
+}
+
+//=======================================================================
+//function : evalArrayByPatches
+//purpose  : 
+//=======================================================================
+
+void GeomAdaptor_Surface::evalArrayByPatches (const Standard_Integer      theDeriv,
+                                              const TColgp_Array1OfPnt2d& theUV,
+                                              TColgp_Array1OfPnt&         thePoints,
+                                              TColgp_Array1OfVec*         theD1U,
+                                              TColgp_Array1OfVec*         theD1V,
+                                              TColgp_Array1OfVec*         theD2U,
+                                              TColgp_Array1OfVec*         theD2V,
+                                              TColgp_Array1OfVec*         theD2UV) const
+{
+  // the parameters are ordered by the patches within the blocks small enough
+  // to keep the evaluated values in the processor cache, so that the cache
+  // of the patch is rebuilt once per block instead of once per pair of parameters
+  const TColStd_Array1OfReal& anUKnots = myBSplineSurface->UKnots();
+  const TColStd_Array1OfReal& aVKnots  = myBSplineSurface->VKnots();
+  const Standard_Integer aNbVSpans = aVKnots.Upper() + 2; // including the parameters out of the knots
+  NCollection_LocalArray<std::pair<Standard_Integer, Standard_Integer> > anOrder (Min (THE_ARRAY_BLOCK_SIZE, theUV.Length()));
+  Standard_Integer anUSpan = anUKnots.Lower(), aVSpan = aVKnots.Lower();
+  for (Standard_Integer aBlockStart = theUV.Lower(); aBlockStart <= theUV.Upper();
+       aBlockStart += THE_ARRAY_BLOCK_SIZE)
+  {
+    const Standard_Integer aBlockEnd = Min (aBlockStart + THE_ARRAY_BLOCK_SIZE - 1, theUV.Upper());
+    Standard_Integer aNbParams = 0;
+    for (Standard_Integer anIter = aBlockStart; anIter <= aBlockEnd; ++anIter)
+    {
+      BSplCLib::Hunt (anUKnots, theUV (anIter).X(), anUSpan);
+      BSplCLib::Hunt (aVKnots,  theUV (anIter).Y(), aVSpan);
+      anOrder[aNbParams++] = std::make_pair (anUSpan * aNbVSpans + aVSpan, anIter);
+    }
+    std::sort (&anOrder[0], &anOrder[0] + aNbParams);
+
+    for (Standard_Integer anIter = 0; anIter < aNbParams; ++anIter)
+    {
+      const Standard_Integer anIndex = anOrder[anIter].second;
+      const gp_Pnt2d& aUV = theUV (anIndex);
+      switch (theDeriv)
+      {
+        case 0:
+          D0 (aUV.X(), aUV.Y(), thePoints.ChangeValue (anIndex));
+          break;
+        case 1:
+          D1 (aUV.X(), aUV.Y(), thePoints.ChangeValue (anIndex),
+              theD1U->ChangeValue (anIndex), theD1V->ChangeValue (anIndex));
+          break;
+        default:
+          D2 (aUV.X(), aUV.Y(), thePoints.ChangeValue (anIndex),
+              theD1U->ChangeValue (anIndex), theD1V->ChangeValue (anIndex),
+              theD2U->ChangeValue (anIndex), theD2V->ChangeValue (anIndex),
+              theD2UV->ChangeValue (anIndex));
+          break;
+      }
+    }
+  }
+}
+
+//=======================================================================
+//function : D0Array
+//purpose  : 
+//=======================================================================
+
+void GeomAdaptor_Surface::D0Array (const TColgp_Array1OfPnt2d& theUV,
+                                   TColgp_Array1OfPnt& thePoints) const
+{
+  if (mySurfaceType == GeomAbs_BSplineSurface)
+  {
+    evalArrayByPatches (0, theUV, thePoints, NULL, NULL, NULL, NULL, NULL);
+    return;
+  }
+  Adaptor3d_Surface::D0Array (theUV, thePoints);
+}
+
+//=======================================================================
+//function : D1Array
+//purpose  : 
+//=======================================================================
+
+void GeomAdaptor_Surface::D1Array (const TColgp_Array1OfPnt2d& theUV,
+                                   TColgp_Array1OfPnt& thePoints,
+                                   TColgp_Array1OfVec& theD1U,
+                                   TColgp_Array1OfVec& theD1V) const
+{
+  if (mySurfaceType == GeomAbs_BSplineSurface)
+  {
+    evalArrayByPatches (1, theUV, thePoints, &theD1U, &theD1V, NULL, NULL, NULL);
+    return;
+  }
+  Adaptor3d_Surface::D1Array (theUV, thePoints, theD1U, theD1V);
+}
+
+//=======================================================================
+//function : D2Array
+//purpose  : 
+//=======================================================================
+
+void GeomAdaptor_Surface::D2Array (const TColgp_Array1OfPnt2d& theUV,
+                                   TColgp_Array1OfPnt& thePoints,
+                                   TColgp_Array1OfVec& theD1U,
+                                   TColgp_Array1OfVec& theD1V,
+                                   TColgp_Array1OfVec& theD2U,
+                                   TColgp_Array1OfVec& theD2V,
+                                   TColgp_Array1OfVec& theD2UV) const
+{
+  if (mySurfaceType == GeomAbs_BSplineSurface)
+  {
+    evalArrayByPatches (2, theUV, thePoints, &theD1U, &theD1V, &theD2U, &theD2V, &theD2UV);
+    return;
+  }
+  Adaptor3d_Surface::D2Array (theUV, thePoints, theD1U, theD1V, theD2U, theD2V, theD2UV);
+}
+
 //=======================================================================
 //function : D3
 //purpose  : 
@@ -172,6 +172,59 @@ public:
   //! the derivatives are computed on the current interval.
   //! else the derivatives are computed on the basis surface.
   Standard_EXPORT void D3 (const Standard_Real U, const Standard_Real V, gp_Pnt& P, gp_Vec& D1U, gp_Vec& D1V, gp_Vec& D2U, gp_Vec& D2V, gp_Vec& D2UV, gp_Vec& D3U, gp_Vec& D3V, gp_Vec& D3UUV, gp_Vec& D3UVV) const Standard_OVERRIDE;
+
+  //! Computes the points on the grid of parameters, see Adaptor3d_Surface::D0Grid().
+  //! For B-spline and Bezier surfaces the blocks of the grid lying in the same span
+  //! are evaluated at once by the cache of the span, the elementary surfaces compute
+  //! the trigonometric functions once per grid line, and the surfaces of extrusion
+  //! and revolution evaluate their base curve once per grid line;
+  //! the result is the same as of D0().
+  Standard_EXPORT virtual void D0Grid (const TColStd_Array1OfReal& theU,
+                                       const TColStd_Array1OfReal& theV,
+                                       TColgp_Array2OfPnt& thePoints) const Standard_OVERRIDE;
+
+  //! Computes the points and the first derivatives on the grid of parameters,
+  //! see Adaptor3d_Surface::D0Grid() and D0Grid() above; the result is the same as of D1().
+  Standard_EXPORT virtual void D1Grid (const TColStd_Array1OfReal& theU,
+                                       const TColStd_Array1OfReal& theV,
+                                       TColgp_Array2OfPnt& thePoints,
+                                       TColgp_Array2OfVec& theD1U,
+                                       TColgp_Array2OfVec& theD1V) const Standard_OVERRIDE;
+
+  //! Computes the points, the first and the second derivatives on the grid of parameters,
+  //! see Adaptor3d_Surface::D0Grid() and D0Grid() above; the result is the same as of D2().
+  Standard_EXPORT virtual void D2Grid (const TColStd_Array1OfReal& theU,
+                                       const TColStd_Array1OfReal& theV,
+                                       TColgp_Array2OfPnt& thePoints,
+                                       TColgp_Array2OfVec& theD1U,
+                                       TColgp_Array2OfVec& theD1V,
+                                       TColgp_Array2OfVec& theD2U,
+                                       TColgp_Array2OfVec& theD2V,
+                                       TColgp_Array2OfVec& theD2UV) const Standard_OVERRIDE;
+
+  //! Computes the points of the array of scattered parameters, see Adaptor3d_Surface::D0Array().
+  //! For B-spline surface the parameters are visited patch by patch,
+  //! so that the cache of each patch is built once for any order of the parameters;
+  //! the result is the same as of D0().
+  Standard_EXPORT virtual void D0Array (const TColgp_Array1OfPnt2d& theUV,
+                                        TColgp_Array1OfPnt& thePoints) const Standard_OVERRIDE;
+
+  //! Computes the points and the first derivatives of the array of scattered parameters,
+  //! see D0Array() above; the result is the same as of D1().
+  Standard_EXPORT virtual void D1Array (const TColgp_Array1OfPnt2d& theUV,
+                                        TColgp_Array1OfPnt& thePoints,
+                                        TColgp_Array1OfVec& theD1U,
+                                        TColgp_Array1OfVec& theD1V) const Standard_OVERRIDE;
+
+  //! Computes the points, the first and the second derivatives of the array
+  //! of scattered parameters, see D0Array() above; the result is the same as of D2().
+  Standard_EXPORT virtual void D2Array (const TColgp_Array1OfPnt2d& theUV,
+                                        TColgp_Array1OfPnt& thePoints,
+                                        TColgp_Array1OfVec& theD1U,
+                                        TColgp_Array1OfVec& theD1V,
+                                        TColgp_Array1OfVec& theD2U,
+                                        TColgp_Array1OfVec& theD2V,
+                                        TColgp_Array1OfVec& theD2UV) const Standard_OVERRIDE;
   
   //! Computes the derivative of order Nu in the
   //! direction U and Nv in the direction V at the point P(U, V).
@@ -260,6 +313,29 @@ private:
   //! \param theV second parameter to identify the span for caching
   Standard_EXPORT void RebuildCache (const Standard_Real theU, const Standard_Real theV) const;
 
+  //! Evaluates the grid of parameters of B-spline or Bezier surface
+  //! with the derivatives till theDeriv order by the blocks lying in the same span.
+  void evalGridByCache (const Standard_Integer      theDeriv,
+                        const TColStd_Array1OfReal& theU,
+                        const TColStd_Array1OfReal& theV,
+                        TColgp_Array2OfPnt&         thePoints,
+                        TColgp_Array2OfVec*         theD1U,
+                        TColgp_Array2OfVec*         theD1V,
+                        TColgp_Array2OfVec*         theD2U,
+                        TColgp_Array2OfVec*         theD2V,
+                        TColgp_Array2OfVec*         theD2UV) const;
+
+  //! Evaluates the array of scattered parameters of B-spline surface with the derivatives
+  //! till theDeriv order visiting the parameters of the same patch together.
+  void evalArrayByPatches (const Standard_Integer      theDeriv,
+                           const TColgp_Array1OfPnt2d& theUV,
+                           TColgp_Array1OfPnt&         thePoints,
+                           TColgp_Array1OfVec*         theD1U,
+                           TColgp_Array1OfVec*         theD1V,
+                           TColgp_Array1OfVec*         theD2U,
+                           TColgp_Array1OfVec*         theD2V,
+                           TColgp_Array1OfVec*         theD2UV) const;
+
   protected:
 
   Handle(Geom_Surface) mySurface;
@@ -17,9 +17,9 @@
 
 #include <Standard_Transient.hxx>
 #include <Standard_Type.hxx>
-
-class gp_Pnt;
-class gp_Vec;
+#include <TColgp_Array2OfPnt.hxx>
+#include <TColgp_Array2OfVec.hxx>
+#include <TColStd_Array1OfReal.hxx>
 
 //! Interface for calculation of values and derivatives for different kinds of surfaces.
 //! Works both with adaptors and surfaces.
@@ -49,6 +49,63 @@ public:
   virtual gp_Vec DN(const Standard_Real theU, const Standard_Real theV,
                     const Standard_Integer theDerU, const Standard_Integer theDerV) const = 0;
 
+  //! Computes the points on the grid of parameters theU x theV,
+  //! see Adaptor3d_Surface::D0Grid() for the layout of the results.
+  //! The default implementation evaluates the points one by one by D0().
+  virtual void D0Grid (const TColStd_Array1OfReal& theU,
+                       const TColStd_Array1OfReal& theV,
+                       TColgp_Array2OfPnt& thePoints) const
+  {
+    for (Standard_Integer anUIter = theU.Lower(); anUIter <= theU.Upper(); ++anUIter)
+    {
+      for (Standard_Integer aVIter = theV.Lower(); aVIter <= theV.Upper(); ++aVIter)
+      {
+        D0 (theU (anUIter), theV (aVIter), thePoints.ChangeValue (anUIter, aVIter));
+      }
+    }
+  }
+
+  //! Computes the points and the first derivatives on the grid of parameters.
+  //! The default implementation evaluates the points one by one by D1().
+  virtual void D1Grid (const TColStd_Array1OfReal& theU,
+                       const TColStd_Array1OfReal& theV,
+                       TColgp_Array2OfPnt& thePoints,
+                       TColgp_Array2OfVec& theD1U,
+                       TColgp_Array2OfVec& theD1V) const
+  {
+    for (Standard_Integer anUIter = theU.Lower(); anUIter <= theU.Upper(); ++anUIter)
+    {
+      for (Standard_Integer aVIter = theV.Lower(); aVIter <= theV.Upper(); ++aVIter)
+      {
+        D1 (theU (anUIter), theV (aVIter), thePoints.ChangeValue (anUIter, aVIter),
+            theD1U.ChangeValue (anUIter, aVIter), theD1V.ChangeValue (anUIter, aVIter));
+      }
+    }
+  }
+
+  //! Computes the points, the first and the second derivatives on the grid of parameters.
+  //! The default implementation evaluates the points one by one by D2().
+  virtual void D2Grid (const TColStd_Array1OfReal& theU,
+                       const TColStd_Array1OfReal& theV,
+                       TColgp_Array2OfPnt& thePoints,
+                       TColgp_Array2OfVec& theD1U,
+                       TColgp_Array2OfVec& theD1V,
+                       TColgp_Array2OfVec& theD2U,
+                       TColgp_Array2OfVec& theD2V,
+                       TColgp_Array2OfVec& theD2UV) const
+  {
+    for (Standard_Integer anUIter = theU.Lower(); anUIter <= theU.Upper(); ++anUIter)
+    {
+      for (Standard_Integer aVIter = theV.Lower(); aVIter <= theV.Upper(); ++aVIter)
+      {
+        D2 (theU (anUIter), theV (aVIter), thePoints.ChangeValue (anUIter, aVIter),
+            theD1U.ChangeValue (anUIter, aVIter), theD1V.ChangeValue (anUIter, aVIter),
+            theD2U.ChangeValue (anUIter, aVIter), theD2V.ChangeValue (anUIter, aVIter),
+            theD2UV.ChangeValue (anUIter, aVIter));
+      }
+    }
+  }
+
   virtual Handle(GeomEvaluator_Surface) ShallowCopy() const  = 0;
 
   DEFINE_STANDARD_RTTI_INLINE(GeomEvaluator_Surface,Standard_Transient)
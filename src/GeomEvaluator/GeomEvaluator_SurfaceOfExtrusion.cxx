@@ -119,6 +119,79 @@ gp_Vec GeomEvaluator_SurfaceOfExtrusion::DN(
   return aResult;
 }
 
+void GeomEvaluator_SurfaceOfExtrusion::D0Grid(
+    const TColStd_Array1OfReal& theU, const TColStd_Array1OfReal& theV,
+    TColgp_Array2OfPnt& thePoints) const
+{
+  gp_Pnt aBaseValue;
+  for (Standard_Integer anUIter = theU.Lower(); anUIter <= theU.Upper(); ++anUIter)
+  {
+    if (!myBaseAdaptor.IsNull())
+      myBaseAdaptor->D0(theU(anUIter), aBaseValue);
+    else
+      myBaseCurve->D0(theU(anUIter), aBaseValue);
+
+    for (Standard_Integer aVIter = theV.Lower(); aVIter <= theV.Upper(); ++aVIter)
+    {
+      gp_Pnt& aValue = thePoints.ChangeValue(anUIter, aVIter);
+      aValue = aBaseValue;
+      Shift(theV(aVIter), aValue);
+    }
+  }
+}
+
+void GeomEvaluator_SurfaceOfExtrusion::D1Grid(
+    const TColStd_Array1OfReal& theU, const TColStd_Array1OfReal& theV,
+    TColgp_Array2OfPnt& thePoints, TColgp_Array2OfVec& theD1U, TColgp_Array2OfVec& theD1V) const
+{
+  gp_Pnt aBaseValue;
+  gp_Vec aBaseD1;
+  for (Standard_Integer anUIter = theU.Lower(); anUIter <= theU.Upper(); ++anUIter)
+  {
+    if (!myBaseAdaptor.IsNull())
+      myBaseAdaptor->D1(theU(anUIter), aBaseValue, aBaseD1);
+    else
+      myBaseCurve->D1(theU(anUIter), aBaseValue, aBaseD1);
+
+    for (Standard_Integer aVIter = theV.Lower(); aVIter <= theV.Upper(); ++aVIter)
+    {
+      gp_Pnt& aValue = thePoints.ChangeValue(anUIter, aVIter);
+      aValue = aBaseValue;
+      Shift(theV(aVIter), aValue);
+      theD1U.ChangeValue(anUIter, aVIter) = aBaseD1;
+      theD1V.ChangeValue(anUIter, aVIter) = myDirection;
+    }
+  }
+}
+
+void GeomEvaluator_SurfaceOfExtrusion::D2Grid(
+    const TColStd_Array1OfReal& theU, const TColStd_Array1OfReal& theV,
+    TColgp_Array2OfPnt& thePoints, TColgp_Array2OfVec& theD1U, TColgp_Array2OfVec& theD1V,
+    TColgp_Array2OfVec& theD2U, TColgp_Array2OfVec& theD2V, TColgp_Array2OfVec& theD2UV) const
+{
+  gp_Pnt aBaseValue;
+  gp_Vec aBaseD1, aBaseD2;
+  for (Standard_Integer anUIter = theU.Lower(); anUIter <= theU.Upper(); ++anUIter)
+  {
+    if (!myBaseAdaptor.IsNull())
+      myBaseAdaptor->D2(theU(anUIter), aBaseValue, aBaseD1, aBaseD2);
+    else
+      myBaseCurve->D2(theU(anUIter), aBaseValue, aBaseD1, aBaseD2);
+
+    for (Standard_Integer aVIter = theV.Lower(); aVIter <= theV.Upper(); ++aVIter)
+    {
+      gp_Pnt& aValue = thePoints.ChangeValue(anUIter, aVIter);
+      aValue = aBaseValue;
+      Shift(theV(aVIter), aValue);
+      theD1U.ChangeValue(anUIter, aVIter) = aBaseD1;
+      theD1V.ChangeValue(anUIter, aVIter) = myDirection;
+      theD2U.ChangeValue(anUIter, aVIter) = aBaseD2;
+      theD2V.ChangeValue(anUIter, aVIter).SetCoord(0.0, 0.0, 0.0);
+      theD2UV.ChangeValue(anUIter, aVIter).SetCoord(0.0, 0.0, 0.0);
+    }
+  }
+}
+
 Handle(GeomEvaluator_Surface) GeomEvaluator_SurfaceOfExtrusion::ShallowCopy() const
 {
   Handle(GeomEvaluator_SurfaceOfExtrusion) aCopy;
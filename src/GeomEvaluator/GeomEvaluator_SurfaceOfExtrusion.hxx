@@ -59,6 +59,29 @@ public:
                             const Standard_Integer theDerU,
                             const Standard_Integer theDerV) const Standard_OVERRIDE;
 
+  //! Computes the points on the grid of parameters;
+  //! the base curve is evaluated once per parameter of theU.
+  Standard_EXPORT void D0Grid (const TColStd_Array1OfReal& theU,
+                               const TColStd_Array1OfReal& theV,
+                               TColgp_Array2OfPnt& thePoints) const Standard_OVERRIDE;
+  //! Computes the points and the first derivatives on the grid of parameters;
+  //! the base curve is evaluated once per parameter of theU.
+  Standard_EXPORT void D1Grid (const TColStd_Array1OfReal& theU,
+                               const TColStd_Array1OfReal& theV,
+                               TColgp_Array2OfPnt& thePoints,
+                               TColgp_Array2OfVec& theD1U,
+                               TColgp_Array2OfVec& theD1V) const Standard_OVERRIDE;
+  //! Computes the points, the first and the second derivatives on the grid of parameters;
+  //! the base curve is evaluated once per parameter of theU.
+  Standard_EXPORT void D2Grid (const TColStd_Array1OfReal& theU,
+                               const TColStd_Array1OfReal& theV,
+                               TColgp_Array2OfPnt& thePoints,
+                               TColgp_Array2OfVec& theD1U,
+                               TColgp_Array2OfVec& theD1V,
+                               TColgp_Array2OfVec& theD2U,
+                               TColgp_Array2OfVec& theD2V,
+                               TColgp_Array2OfVec& theD2UV) const Standard_OVERRIDE;
+
   Standard_EXPORT Handle(GeomEvaluator_Surface) ShallowCopy() const Standard_OVERRIDE;
 
   DEFINE_STANDARD_RTTIEXT(GeomEvaluator_SurfaceOfExtrusion,GeomEvaluator_Surface)
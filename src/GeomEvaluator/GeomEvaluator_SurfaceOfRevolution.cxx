@@ -16,6 +16,7 @@
 
 #include <Adaptor3d_Curve.hxx>
 #include <gp_Trsf.hxx>
+#include <NCollection_Array1.hxx>
 #include <Precision.hxx>
 
 IMPLEMENT_STANDARD_RTTIEXT(GeomEvaluator_SurfaceOfRevolution,GeomEvaluator_Surface)
@@ -203,6 +204,100 @@ gp_Vec GeomEvaluator_SurfaceOfRevolution::DN(
   return aResult;
 }
 
+void GeomEvaluator_SurfaceOfRevolution::D0Grid(
+    const TColStd_Array1OfReal& theU, const TColStd_Array1OfReal& theV,
+    TColgp_Array2OfPnt& thePoints) const
+{
+  NCollection_Array1<gp_Trsf> aRotations(theU.Lower(), theU.Upper());
+  for (Standard_Integer anUIter = theU.Lower(); anUIter <= theU.Upper(); ++anUIter)
+    aRotations(anUIter).SetRotation(myRotAxis, theU(anUIter));
+
+  gp_Pnt aBaseValue;
+  for (Standard_Integer aVIter = theV.Lower(); aVIter <= theV.Upper(); ++aVIter)
+  {
+    if (!myBaseAdaptor.IsNull())
+      myBaseAdaptor->D0(theV(aVIter), aBaseValue);
+    else
+      myBaseCurve->D0(theV(aVIter), aBaseValue);
+
+    for (Standard_Integer anUIter = theU.Lower(); anUIter <= theU.Upper(); ++anUIter)
+      thePoints.ChangeValue(anUIter, aVIter) = aBaseValue.Transformed(aRotations(anUIter));
+  }
+}
+
+void GeomEvaluator_SurfaceOfRevolution::D1Grid(
+    const TColStd_Array1OfReal& theU, const TColStd_Array1OfReal& theV,
+    TColgp_Array2OfPnt& thePoints, TColgp_Array2OfVec& theD1U, TColgp_Array2OfVec& theD1V) const
+{
+  NCollection_Array1<gp_Trsf> aRotations(theU.Lower(), theU.Upper());
+  for (Standard_Integer anUIter = theU.Lower(); anUIter <= theU.Upper(); ++anUIter)
+    aRotations(anUIter).SetRotation(myRotAxis, theU(anUIter));
+
+  gp_Pnt aBaseValue;
+  gp_Vec aBaseD1U, aBaseD1V;
+  for (Standard_Integer aVIter = theV.Lower(); aVIter <= theV.Upper(); ++aVIter)
+  {
+    if (!myBaseAdaptor.IsNull())
+      myBaseAdaptor->D1(theV(aVIter), aBaseValue, aBaseD1V);
+    else
+      myBaseCurve->D1(theV(aVIter), aBaseValue, aBaseD1V);
+
+    // the derivatives are computed as in D1() before the rotation
+    gp_XYZ aCQ = aBaseValue.XYZ() - myRotAxis.Location().XYZ();
+    aBaseD1U = gp_Vec(myRotAxis.Direction().XYZ().Crossed(aCQ));
+    if (aBaseD1U.SquareMagnitude() < Precision::SquareConfusion())
+      aBaseD1U.SetCoord(0.0, 0.0, 0.0);
+
+    for (Standard_Integer anUIter = theU.Lower(); anUIter <= theU.Upper(); ++anUIter)
+    {
+      const gp_Trsf& aRotation = aRotations(anUIter);
+      thePoints.ChangeValue(anUIter, aVIter) = aBaseValue.Transformed(aRotation);
+      theD1U.ChangeValue(anUIter, aVIter) = aBaseD1U.Transformed(aRotation);
+      theD1V.ChangeValue(anUIter, aVIter) = aBaseD1V.Transformed(aRotation);
+    }
+  }
+}
+
+void GeomEvaluator_SurfaceOfRevolution::D2Grid(
+    const TColStd_Array1OfReal& theU, const TColStd_Array1OfReal& theV,
+    TColgp_Array2OfPnt& thePoints, TColgp_Array2OfVec& theD1U, TColgp_Array2OfVec& theD1V,
+    TColgp_Array2OfVec& theD2U, TColgp_Array2OfVec& theD2V, TColgp_Array2OfVec& theD2UV) const
+{
+  NCollection_Array1<gp_Trsf> aRotations(theU.Lower(), theU.Upper());
+  for (Standard_Integer anUIter = theU.Lower(); anUIter <= theU.Upper(); ++anUIter)
+    aRotations(anUIter).SetRotation(myRotAxis, theU(anUIter));
+
+  gp_Pnt aBaseValue;
+  gp_Vec aBaseD1U, aBaseD1V, aBaseD2U, aBaseD2V, aBaseD2UV;
+  const gp_XYZ& aDir = myRotAxis.Direction().XYZ();
+  for (Standard_Integer aVIter = theV.Lower(); aVIter <= theV.Upper(); ++aVIter)
+  {
+    if (!myBaseAdaptor.IsNull())
+      myBaseAdaptor->D2(theV(aVIter), aBaseValue, aBaseD1V, aBaseD2V);
+    else
+      myBaseCurve->D2(theV(aVIter), aBaseValue, aBaseD1V, aBaseD2V);
+
+    // the derivatives are computed as in D2() before the rotation
+    gp_XYZ aCQ = aBaseValue.XYZ() - myRotAxis.Location().XYZ();
+    aBaseD1U = gp_Vec(aDir.Crossed(aCQ));
+    if (aBaseD1U.SquareMagnitude() < Precision::SquareConfusion())
+      aBaseD1U.SetCoord(0.0, 0.0, 0.0);
+    aBaseD2U = gp_Vec(aDir.Dot(aCQ) * aDir - aCQ);
+    aBaseD2UV = gp_Vec(aDir.Crossed(aBaseD1V.XYZ()));
+
+    for (Standard_Integer anUIter = theU.Lower(); anUIter <= theU.Upper(); ++anUIter)
+    {
+      const gp_Trsf& aRotation = aRotations(anUIter);
+      thePoints.ChangeValue(anUIter, aVIter) = aBaseValue.Transformed(aRotation);
+      theD1U.ChangeValue(anUIter, aVIter) = aBaseD1U.Transformed(aRotation);
+      theD1V.ChangeValue(anUIter, aVIter) = aBaseD1V.Transformed(aRotation);
+      theD2U.ChangeValue(anUIter, aVIter) = aBaseD2U.Transformed(aRotation);
+      theD2V.ChangeValue(anUIter, aVIter) = aBaseD2V.Transformed(aRotation);
+      theD2UV.ChangeValue(anUIter, aVIter) = aBaseD2UV.Transformed(aRotation);
+    }
+  }
+}
+
 Handle(GeomEvaluator_Surface) GeomEvaluator_SurfaceOfRevolution::ShallowCopy() const
 {
   Handle(GeomEvaluator_SurfaceOfRevolution) aCopy;
@@ -53,7 +53,8 @@ IntPatch_Intersection::IntPatch_Intersection ()
    myU1Start(0.0),
    myV1Start(0.0),
    myU2Start(0.0),
-   myV2Start(0.0)
+   myV2Start(0.0),
+   myIsParallel(Standard_False)
 {
 }
 
@@ -76,7 +77,8 @@ IntPatch_Intersection::IntPatch_Intersection(const Handle(Adaptor3d_Surface)&  S
    myU1Start(0.0),
    myV1Start(0.0),
    myU2Start(0.0),
-   myV2Start(0.0)
+   myV2Start(0.0),
+   myIsParallel(Standard_False)
 {
   if(myTolArc<1e-8) myTolArc=1e-8;
   if(myTolTang<1e-8) myTolTang=1e-8;
@@ -102,7 +104,8 @@ IntPatch_Intersection::IntPatch_Intersection(const Handle(Adaptor3d_Surface)&  S
    myU1Start(0.0),
    myV1Start(0.0),
    myU2Start(0.0),
-   myV2Start(0.0)
+   myV2Start(0.0),
+   myIsParallel(Standard_False)
 {
   Perform(S1,D1,TolArc,TolTang);
 }
@@ -1244,9 +1247,12 @@ void IntPatch_Intersection::ParamParamPerfom(const Handle(Adaptor3d_Surface)&  t
                                              const GeomAbs_SurfaceType typs2)
 {
   IntPatch_PrmPrmIntersection interpp;
+  interpp.SetRunParallel(myIsParallel);
   //
   if(!theD1->DomainIsInfinite() && !theD2->DomainIsInfinite())
   {
+    // the samplings are given for the original surfaces, which are trimmed otherwise
+    interpp.SetSurfaceSamplings(mySampling1, mySampling2);
     Standard_Boolean ClearFlag = Standard_True;
     if(!ListOfPnts.IsEmpty())
     {
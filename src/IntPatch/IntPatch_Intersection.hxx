@@ -20,6 +20,7 @@
 #include <Adaptor3d_Surface.hxx>
 #include <IntPatch_SequenceOfPoint.hxx>
 #include <IntPatch_SequenceOfLine.hxx>
+#include <IntPatch_SurfaceSampling.hxx>
 #include <IntSurf_ListOfPntOn2S.hxx>
 #include <GeomAbs_SurfaceType.hxx>
 #include <NCollection_Vector.hxx>
@@ -61,6 +62,25 @@ public:
   //! algorithms  to    compute the  distance between to
   //! points in their respective parametric spaces.
   Standard_EXPORT void SetTolerances (const Standard_Real TolArc, const Standard_Real TolTang, const Standard_Real UVMaxStep, const Standard_Real Fleche);
+
+  //! Sets the samplings of the surfaces S1 and S2 used by the Param-Param
+  //! intersection for the search of the starting points of the walking lines.
+  //! The samplings are computed on demand and kept in the given objects,
+  //! so that the intersections of the same surface with the different ones
+  //! do not evaluate its grid of points again (see IntPatch_SurfaceSampling).
+  //! Null handles (default) mean the temporary samplings.
+  void SetSurfaceSamplings (const Handle(IntPatch_SurfaceSampling)& theSampling1,
+                            const Handle(IntPatch_SurfaceSampling)& theSampling2)
+  {
+    mySampling1 = theSampling1;
+    mySampling2 = theSampling2;
+  }
+
+  //! Sets the flag of the parallel computation of the samplings of the surfaces
+  //! and of the polyhedral pre-intersection by the Param-Param intersection;
+  //! the walking itself is sequential,
+  //! so that the result does not depend on this flag.
+  void SetRunParallel (const Standard_Boolean theToRunParallel) { myIsParallel = theToRunParallel; }
   
   //! Flag theIsReqToKeepRLine has been entered only for
   //! compatibility with TopOpeBRep package. It shall be deleted
@@ -197,6 +217,9 @@ private:
   Standard_Real myV1Start;
   Standard_Real myU2Start;
   Standard_Real myV2Start;
+  Handle(IntPatch_SurfaceSampling) mySampling1;
+  Handle(IntPatch_SurfaceSampling) mySampling2;
+  Standard_Boolean myIsParallel;
 
 
 };
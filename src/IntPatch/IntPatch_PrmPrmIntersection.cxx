@@ -32,6 +32,8 @@
 #include <IntSurf_ListIteratorOfListOfPntOn2S.hxx>
 #include <IntSurf_PntOn2S.hxx>
 #include <IntWalk_PWalking.hxx>
+#include <NCollection_DataMap.hxx>
+#include <OSD_Parallel.hxx>
 #include <Standard_OutOfRange.hxx>
 #include <StdFail_NotDone.hxx>
 #include <TColStd_Array1OfReal.hxx>
@@ -298,7 +300,8 @@ static void DublicateOfLinesProcessing( const IntWalk_PWalking& thePW,
 //==================================================================================
 IntPatch_PrmPrmIntersection::IntPatch_PrmPrmIntersection()
 : done(Standard_False),
-  empt(Standard_True)
+  empt(Standard_True),
+  myIsParallel(Standard_False)
 {
 }
 
@@ -2176,12 +2179,12 @@ void IntPatch_PrmPrmIntersection::Perform (const Handle(Adaptor3d_Surface)& Surf
 
     if ( D1->IsUniformSampling() || D2->IsUniformSampling() )
     {
-      pInterference = new IntPolyh_Intersection(Surf1,NbU1,NbV1,Surf2,NbU2,NbV2);
+      pInterference = new IntPolyh_Intersection(Surf1,NbU1,NbV1,Surf2,NbU2,NbV2,myIsParallel);
     }
     else
     {
       pInterference = new IntPolyh_Intersection(Surf1, anUpars1, aVpars1, 
-        Surf2, anUpars2, aVpars2 );
+        Surf2, anUpars2, aVpars2, myIsParallel);
     }
 
     if ( !pInterference )
@@ -2963,8 +2966,6 @@ public:
     myP2DS1=new char[aNBI2];
     myIP1=new Standard_Integer[aNBI2]; 
     myIP2=new Standard_Integer[aNBI2];
-    myP1=new gp_Pnt[aNBI2];
-    myP2=new gp_Pnt[aNBI2];
     //
     for (i=0; i<myNBI; ++i) {
       for (j=0; j<myNBI; ++j) {
@@ -2972,8 +2973,6 @@ public:
         xP2DS1(i, j)=0;
         xIP1(i, j)=0;
         xIP2(i, j)=0;
-        xP1(i, j).SetCoord(0., 0., 0.);
-        xP2(i, j).SetCoord(0., 0., 0.);
       }
     }
   };
@@ -2983,8 +2982,6 @@ public:
     delete [] (char*) myP2DS1;
     delete [] (Standard_Integer*) myIP1;
     delete [] (Standard_Integer*) myIP2; 
-    delete [] (gp_Pnt*)myP1;
-    delete [] (gp_Pnt*)myP2;
   };
   //---------------------------------------- Index
   Standard_Integer Index(const Standard_Integer i,
@@ -3015,16 +3012,6 @@ public:
     const Standard_Integer j) { 
       return myIP2[Index(i,j)];
   };
-  //----------------------------------------xP1
-  gp_Pnt& xP1(const Standard_Integer i,
-    const Standard_Integer j) { 
-      return myP1[Index(i,j)];
-  };
-  //----------------------------------------xP1
-  gp_Pnt& xP2(const Standard_Integer i,
-    const Standard_Integer j) { 
-      return myP2[Index(i,j)];
-  };
 
 private:
 
@@ -3038,10 +3025,119 @@ private:
   char *myP2DS1;
   Standard_Integer *myIP1;
   Standard_Integer *myIP2;
-  gp_Pnt *myP1;
-  gp_Pnt *myP2;
 }; 
 //modified by NIZNHY-PKV Tue May 24 11:38:55 2011t
+//=======================================================================
+//class : IntPatch_GridCells
+//purpose  : computes the cells of the 3d grid containing the points
+//           of the sampling of one surface and fills the cells crossed
+//           by the triangles of the sampling in the map
+//=======================================================================
+class IntPatch_GridCells {
+public:
+  IntPatch_GridCells(const IntPatch_PrmPrmIntersection& theAlgo,
+                     const TColgp_Array2OfPnt& thePoints,
+                     const Standard_Integer theSU,
+                     const Standard_Integer theSV,
+                     const Standard_Real* theOtherBox,
+                     const Standard_Real* theGrid,
+                     IntPatch_InfoPD& theIPD,
+                     const Standard_Boolean theIsFirst,
+                     NCollection_DataMap<Standard_Integer, Standard_Integer>& theFirstIP,
+                     IntPatch_PrmPrmIntersection_T3Bits& theMap)
+  : myAlgo(theAlgo), myPoints(thePoints), mySU(theSU), mySV(theSV),
+    myOtherBox(theOtherBox), myGrid(theGrid), myIPD(theIPD),
+    myIsFirst(theIsFirst), myFirstIP(theFirstIP), myMap(theMap) {}
+  //
+  void Perform() const {
+    Standard_Integer i, j;
+    const Standard_Real* B = myOtherBox;
+    const Standard_Real* G = myGrid;
+    for(i=0;i<mySU;i++) { 
+      for(j=0;j<mySV;j++) { 
+        IP(i, j)=-1;
+        const gp_Pnt& P=myPoints(i, j);
+        DS(i, j) = (char)myAlgo.CodeReject(B[0],B[1],B[2],B[3],B[4],B[5],P.X(),P.Y(),P.Z());
+        int ix = (int)((P.X()-G[0] + G[6])/G[3]);
+        if(myAlgo.DansGrille(ix)) { 
+          int iy = (int)((P.Y()-G[1] + G[7])/G[4]);
+          if(myAlgo.DansGrille(iy)) {
+            int iz = (int)((P.Z()-G[2] + G[8])/G[5]);
+            if(myAlgo.DansGrille(iz)) {
+              IP(i, j) = myAlgo.GrilleInteger(ix,iy,iz);
+              if(!myFirstIP.IsBound(IP(i, j))) {
+                myFirstIP.Bind(IP(i, j), myIPD.Index(i, j));
+              }
+            }
+          }
+        }
+      }
+    }
+    //
+    for(i=0;i<mySU-1;i+=1) {
+      for(j=0;j<mySV-1;j+=1) { 
+        if(!((DS(i, j) & DS(i+1, j)) || 
+          (DS(i, j) & DS(i+1, j+1)))){
+            myAlgo.Remplit(IP(i, j),
+              IP(i+1, j),
+              IP(i+1, j+1),
+              myMap);
+        }
+        if(!((DS(i, j) & DS(i, j+1)) || 
+          (DS(i, j) & DS(i+1, j+1)))) {
+            myAlgo.Remplit(IP(i, j),
+              IP(i, j+1),
+              IP(i+1, j+1),
+              myMap);	
+        }
+      }
+    }
+  }
+
+private:
+  //! Cell of the point of the sampling.
+  Standard_Integer& IP(const Standard_Integer i, const Standard_Integer j) const {
+    return myIsFirst ? myIPD.xIP1(i, j) : myIPD.xIP2(i, j);
+  }
+  //! Code of the position of the point relatively to the box of the other surface.
+  char& DS(const Standard_Integer i, const Standard_Integer j) const {
+    return myIsFirst ? myIPD.xP1DS2(i, j) : myIPD.xP2DS1(i, j);
+  }
+
+private:
+  IntPatch_GridCells (const IntPatch_GridCells&);
+  IntPatch_GridCells& operator=(const IntPatch_GridCells&);
+
+private:
+  const IntPatch_PrmPrmIntersection& myAlgo;
+  const TColgp_Array2OfPnt& myPoints;
+  Standard_Integer mySU;
+  Standard_Integer mySV;
+  const Standard_Real* myOtherBox;
+  const Standard_Real* myGrid;
+  IntPatch_InfoPD& myIPD;
+  Standard_Boolean myIsFirst;
+  NCollection_DataMap<Standard_Integer, Standard_Integer>& myFirstIP;
+  IntPatch_PrmPrmIntersection_T3Bits& myMap;
+};
+//=======================================================================
+//class : IntPatch_GridCellsFunctor
+//purpose  : fills the cells of the two surfaces by OSD_Parallel
+//=======================================================================
+class IntPatch_GridCellsFunctor {
+public:
+  IntPatch_GridCellsFunctor(const IntPatch_GridCells& theCells1,
+                            const IntPatch_GridCells& theCells2)
+  : myCells1(theCells1), myCells2(theCells2) {}
+  //
+  void operator()(const Standard_Integer theIndex) const {
+    (theIndex == 0 ? myCells1 : myCells2).Perform();
+  }
+
+private:
+  const IntPatch_GridCells& myCells1;
+  const IntPatch_GridCells& myCells2;
+};
 //==================================================================================
 // function : PointDepart
 // purpose  : 
@@ -3063,8 +3159,7 @@ void IntPatch_PrmPrmIntersection::PointDepart(Handle(IntSurf_LineOn2S)& LineOn2S
   Standard_Real U0, U1, V0, V1, U, V;
   Standard_Real resu0,resv0;
   Standard_Real  du1,du2,dv1,dv2, dmaxOn1, dmaxOn2;
-  Standard_Real x0,y0,z0, x1,y1,z1,d;
-  Bnd_Box Box1, Box2;
+  Standard_Real x0,y0,z0, x1,y1,z1;
   //
   iC15=15;
   SU1 =iC15*SU_1 ;
@@ -3093,27 +3188,19 @@ void IntPatch_PrmPrmIntersection::PointDepart(Handle(IntSurf_LineOn2S)& LineOn2S
   resu0=U0;
   resv0=V0;
   //
-  dmaxOn1 = 0.0;
-  dmaxOn2 = 0.0;
   //-----
   du1 = (U1-U0)/(SU1-1);
   dv1 = (V1-V0)/(SV1-1);
-  for(U=U0,i=0; i<SU1; i++,U+=du1) { 
-    for(V=V0,j=0; j<SV1; V+=dv1,j++) { 
-      aIPD.xP1(i, j)= S1->Value(U,V);
-      Box1.Add(aIPD.xP1(i, j));
-      if(i>0 && j>0) { 
-        aIPD.xP1(i, j)    .Coord(x0,y0,z0);
-        aIPD.xP1(i-1, j-1).Coord(x1,y1,z1);
-        //
-        d=Abs(x1-x0)+Abs(y1-y0)+Abs(z1-z0);
-        if(d>dmaxOn1) {
-          dmaxOn1 = d;
-        }
-      }
-    }
+  //
+  // the grids of points depend only on the surfaces, so that
+  // the samplings kept from the previous intersections are reused
+  Handle(IntPatch_SurfaceSampling) aSampling1 = mySampling1;
+  if (aSampling1.IsNull()) {
+    aSampling1 = new IntPatch_SurfaceSampling();
+  }
+  if (!aSampling1->IsComputed(*S1, SU1, SV1)) {
+    aSampling1->Perform(S1, SU1, SV1, myIsParallel);
   }
-  Box1.Enlarge(1.e-8);
   //
   U0 = S2->FirstUParameter();
   U1 = S2->LastUParameter();
@@ -3122,21 +3209,22 @@ void IntPatch_PrmPrmIntersection::PointDepart(Handle(IntSurf_LineOn2S)& LineOn2S
   //
   du2 = (U1-U0)/(SU2-1);  
   dv2 = (V1-V0)/(SV2-1);
-  for(U=U0,i=0; i<SU2; i++,U+=du2) { 
-    for(V=V0,j=0; j<SV2; V+=dv2,j++) { 
-      aIPD.xP2(i, j) = S2->Value(U,V);
-      Box2.Add(aIPD.xP2(i, j));
-      if(i>0 && j>0) { 
-        aIPD.xP2(i, j)    .Coord(x0,y0,z0);
-        aIPD.xP2(i-1, j-1).Coord(x1,y1,z1);
-        d =  Abs(x1-x0)+Abs(y1-y0)+Abs(z1-z0);
-        if(d>dmaxOn2) {
-          dmaxOn2 = d;
-        }
-      }
-    }
+  //
+  Handle(IntPatch_SurfaceSampling) aSampling2 = mySampling2;
+  if (aSampling2.IsNull()
+   || (aSampling2 == aSampling1 && !aSampling1->IsComputed(*S2, SU2, SV2))) {
+    aSampling2 = new IntPatch_SurfaceSampling();
+  }
+  if (!aSampling2->IsComputed(*S2, SU2, SV2)) {
+    aSampling2->Perform(S2, SU2, SV2, myIsParallel);
   }
-  Box2.Enlarge(1.e-8);
+  //
+  const TColgp_Array2OfPnt& aP1 = aSampling1->Points();
+  const TColgp_Array2OfPnt& aP2 = aSampling2->Points();
+  const Bnd_Box& Box1 = aSampling1->Box();
+  const Bnd_Box& Box2 = aSampling2->Box();
+  dmaxOn1 = aSampling1->MaxDiagonal();
+  dmaxOn2 = aSampling2->MaxDiagonal();
   //--------
   //
   if(Box1.IsOut(Box2)) {
@@ -3208,80 +3296,16 @@ void IntPatch_PrmPrmIntersection::PointDepart(Handle(IntSurf_LineOn2S)& LineOn2S
   //
   IntPatch_PrmPrmIntersection_T3Bits M1(_BASE);
   IntPatch_PrmPrmIntersection_T3Bits M2(_BASE);
+  // first points of the grids in the cells
+  NCollection_DataMap<Standard_Integer, Standard_Integer> aFirstIP1(SU1*SV1), aFirstIP2(SU2*SV2);
   //
-  for(i=0;i<SU1;i++) { 
-    for(j=0;j<SV1;j++) { 
-      aIPD.xIP1(i, j)=-1;
-      const gp_Pnt& P=aIPD.xP1(i, j);
-      aIPD.xP1DS2(i, j) = (char)CodeReject(x20,y20,z20,x21,y21,z21,P.X(),P.Y(),P.Z());
-      int ix = (int)((P.X()-x0  + dx2 )/dx);
-      if(DansGrille(ix)) { 
-        int iy = (int)((P.Y()-y0 + dy2)/dy);
-        if(DansGrille(iy)) {
-          int iz = (int)((P.Z()-z0 + dz2)/dz);
-          if(DansGrille(iz)) {
-            aIPD.xIP1(i, j) = GrilleInteger(ix,iy,iz);
-          }
-        }
-      }
-    }
-  }
-  //-- std::cout<<" Grille  du 1 fini "<<std::endl;
-  for(i=0;i<SU2;i++) { 
-    for(j=0;j<SV2;j++) { 
-      aIPD.xIP2(i, j)=-1;
-      const gp_Pnt& P=aIPD.xP2(i, j);
-      aIPD.xP2DS1(i, j) = (char)CodeReject(x10,y10,z10,x11,y11,z11,P.X(),P.Y(),P.Z());
-      int ix = (int)((P.X()-x0 + dx2)/dx);
-      if(DansGrille(ix)) { 
-        int iy = (int)((P.Y()-y0 + dy2)/dy);
-        if(DansGrille(iy)) {
-          int iz = (int)((P.Z()-z0 + dz2)/dz);
-          if(DansGrille(iz)) {
-            aIPD.xIP2(i, j) =  GrilleInteger(ix,iy,iz);
-          }
-        }
-      }
-    }
-  }
-  //
-  for(i=0;i<SU1-1;i+=1) {
-    for(j=0;j<SV1-1;j+=1) { 
-      if(!((aIPD.xP1DS2(i, j) & aIPD.xP1DS2(i+1, j)) || 
-        (aIPD.xP1DS2(i, j) & aIPD.xP1DS2(i+1, j+1)))){
-          Remplit(aIPD.xIP1(i, j),
-            aIPD.xIP1(i+1, j),
-            aIPD.xIP1(i+1, j+1),
-            M1);
-      }
-      if(!((aIPD.xP1DS2(i, j) & aIPD.xP1DS2(i, j+1)) || 
-        (aIPD.xP1DS2(i, j) & aIPD.xP1DS2(i+1, j+1)))) {
-          Remplit(aIPD.xIP1(i, j),
-            aIPD.xIP1(i, j+1),
-            aIPD.xIP1(i+1, j+1),
-            M1);	
-      }
-    }
-  }	
-  //
-  for(i=0;i<SU2-1;i+=1) {
-    for(j=0;j<SV2-1;j+=1) { 
-      if(!((aIPD.xP2DS1(i, j) & aIPD.xP2DS1(i+1, j)) ||
-        (aIPD.xP2DS1(i, j) & aIPD.xP2DS1(i+1, j+1)))){
-          Remplit(aIPD.xIP2(i, j),
-            aIPD.xIP2(i+1, j),
-            aIPD.xIP2(i+1, j+1),
-            M2);
-      }
-      if(!((aIPD.xP2DS1(i, j) & aIPD.xP2DS1(i, j+1)) || 
-        (aIPD.xP2DS1(i, j) & aIPD.xP2DS1(i+1, j+1)))){
-          Remplit(aIPD.xIP2(i, j),
-            aIPD.xIP2(i, j+1),
-            aIPD.xIP2(i+1, j+1),
-            M2);	
-      }
-    }
-  }	
+  //-- the cells of the surfaces are filled independently, in parallel threads if requested
+  const Standard_Real aGrid[9] = { x0, y0, z0, dx, dy, dz, dx2, dy2, dz2 };
+  const Standard_Real aBox1[6] = { x10, y10, z10, x11, y11, z11 };
+  const Standard_Real aBox2[6] = { x20, y20, z20, x21, y21, z21 };
+  const IntPatch_GridCells aCells1(*this, aP1, SU1, SV1, aBox2, aGrid, aIPD, Standard_True,  aFirstIP1, M1);
+  const IntPatch_GridCells aCells2(*this, aP2, SU2, SV2, aBox1, aGrid, aIPD, Standard_False, aFirstIP2, M2);
+  OSD_Parallel::For(0, 2, IntPatch_GridCellsFunctor(aCells1, aCells2), !myIsParallel);
   //
   M1.ResetAnd();
   M2.ResetAnd();
@@ -3289,7 +3313,7 @@ void IntPatch_PrmPrmIntersection::PointDepart(Handle(IntSurf_LineOn2S)& LineOn2S
   int newind=0;
   int ok=0;
   int indicepointtraite = 0;
-  Standard_Integer k,nu,nv;
+  Standard_Integer k;
   //
   do { 
     indicepointtraite--;
@@ -3327,24 +3351,18 @@ void IntPatch_PrmPrmIntersection::PointDepart(Handle(IntSurf_LineOn2S)& LineOn2S
       //
       gp_Pnt P(dx*i + x0, dy*j + y0, dz*k+z0);
       //
+      //-- the cells are given by And() only once, so that the first points
+      //-- of the grids in the cell are found by the maps
       Standard_Integer nu1=-1,nu2=-1;
       Standard_Integer nv1=0, nv2=0;
-      for(nu=0;nu1<0 && nu<SU1;nu++) { 
-        for(nv=0;nu1<0 && nv<SV1;nv++) { 
-          if( aIPD.xIP1(nu, nv) ==(Standard_Integer) newind )  { 
-            aIPD.xIP1(nu, nv)=indicepointtraite;
-            nu1=nu; nv1=nv;
-          }
-        }
-      }
-      if(nu1>=0) { 
-        for(nu=0;nu2<0 && nu<SU2;nu++) { 
-          for(nv=0;nu2<0 && nv<SV2;nv++) { 
-            if( aIPD.xIP2(nu, nv)==(Standard_Integer) newind )  { 
-              aIPD.xIP2(nu, nv)=indicepointtraite;
-              nu2=nu; nv2=nv;
-            }
-          }
+      const Standard_Integer* pIndex1 = aFirstIP1.Seek(newind);
+      if(pIndex1) { 
+        nu1=*pIndex1/xNBI; nv1=*pIndex1%xNBI;
+        aIPD.xIP1(nu1, nv1)=indicepointtraite;
+        const Standard_Integer* pIndex2 = aFirstIP2.Seek(newind);
+        if(pIndex2) { 
+          nu2=*pIndex2/xNBI; nv2=*pIndex2%xNBI;
+          aIPD.xIP2(nu2, nv2)=indicepointtraite;
         }
       }
       if(nu1>=0 && nu2>=0) { 
@@ -3365,7 +3383,7 @@ void IntPatch_PrmPrmIntersection::PointDepart(Handle(IntSurf_LineOn2S)& LineOn2S
         for(U=resu0,i=0; i<SU1; i++,U+=du1) { 
           for(V=resv0,j=0; j<SV1; V+=dv1,j++) {       
             //-- On place les 3 meilleures valeurs dans Dist1,Dist2,Dist3
-            Standard_Real t = aIPD.xP1(i, j).SquareDistance(P);
+            Standard_Real t = aP1(i, j).SquareDistance(P);
             //-- On remplace la plus grande valeur ds Dist[.] par la val courante
             if(Dist3[0]<Dist3[1]) { 
               Standard_Real z;
@@ -3399,7 +3417,7 @@ void IntPatch_PrmPrmIntersection::PointDepart(Handle(IntSurf_LineOn2S)& LineOn2S
         for(U=U0,i=0; i<SU2; i++,U+=du2) { 
           for(V=V0,j=0; j<SV2; V+=dv2,j++) {       
             //-- On place les 3 meilleures valeurs dans Dist1,Dist2,Dist3
-            Standard_Real t = aIPD.xP2(i, j).SquareDistance(P);
+            Standard_Real t = aP2(i, j).SquareDistance(P);
             //-- On remplace la plus grande valeur ds Dist3[.] par la val courante
             if(Dist3[0]<Dist3[1]) { 
               Standard_Real z;
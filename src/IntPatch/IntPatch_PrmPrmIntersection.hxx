@@ -19,6 +19,7 @@
 
 #include <Adaptor3d_Surface.hxx>
 #include <IntPatch_SequenceOfLine.hxx>
+#include <IntPatch_SurfaceSampling.hxx>
 #include <IntSurf_ListOfPntOn2S.hxx>
 
 class Adaptor3d_TopolTool;
@@ -40,6 +41,21 @@ public:
   
   //! Empty Constructor
   Standard_EXPORT IntPatch_PrmPrmIntersection();
+
+  //! Sets the samplings of the surfaces <Caro1> and <Caro2> used for the search
+  //! of the starting points of the walking lines.
+  //! The samplings are computed on demand and kept for the next intersections
+  //! of the same surfaces; null handles mean the temporary samplings.
+  void SetSurfaceSamplings (const Handle(IntPatch_SurfaceSampling)& theSampling1,
+                            const Handle(IntPatch_SurfaceSampling)& theSampling2)
+  {
+    mySampling1 = theSampling1;
+    mySampling2 = theSampling2;
+  }
+
+  //! Sets the flag of the parallel computation of the samplings of the surfaces
+  //! and of the polyhedral pre-intersection (see IntPolyh_Intersection).
+  void SetRunParallel (const Standard_Boolean theToRunParallel) { myIsParallel = theToRunParallel; }
   
   //! Performs the intersection between <Caro1>  and
   //! <Caro2>.  Associated Polyhedrons <Polyhedron1>
@@ -145,6 +161,9 @@ private:
   Standard_Boolean done;
   Standard_Boolean empt;
   IntPatch_SequenceOfLine SLin;
+  Handle(IntPatch_SurfaceSampling) mySampling1;
+  Handle(IntPatch_SurfaceSampling) mySampling2;
+  Standard_Boolean myIsParallel;
 
 
 };
@@ -0,0 +1,178 @@
+// Copyright (c) 2024 OPEN CASCADE SAS
+//
+// This file is part of Open CASCADE Technology software library.
+//
+// This library is free software; you can redistribute it and/or modify it under
+// the terms of the GNU Lesser General Public License version 2.1 as published
+// by the Free Software Foundation, with special exception defined in the file
+// OCCT_LGPL_EXCEPTION.txt. Consult the file LICENSE_LGPL_21.txt included in OCCT
+// distribution for complete text of the license and disclaimer of any warranty.
+//
+// Alternatively, this file may be used under the terms of Open CASCADE
+// commercial license or contractual agreement.
+
+#include <IntPatch_SurfaceSampling.hxx>
+
+#include <OSD_Parallel.hxx>
+#include <TColStd_Array1OfReal.hxx>
+
+IMPLEMENT_STANDARD_RTTIEXT(IntPatch_SurfaceSampling, Standard_Transient)
+
+namespace
+{
+  //! Evaluates the chunks of the rows of the grid on the shallow copies of the surface.
+  class GridFunctor
+  {
+  public:
+
+    GridFunctor (const Handle(Adaptor3d_Surface)& theSurface,
+                 const TColStd_Array1OfReal& theU,
+                 const TColStd_Array1OfReal& theV,
+                 const Standard_Integer theNbChunks,
+                 TColgp_Array2OfPnt& thePoints)
+    : mySurface (theSurface),
+      myU (theU),
+      myV (theV),
+      myNbChunks (theNbChunks),
+      myPoints (thePoints) {}
+
+    void operator() (const Standard_Integer theChunk) const
+    {
+      const Standard_Integer aNbRows = myU.Length();
+      const Standard_Integer aFirst  = myU.Lower() + (aNbRows * theChunk) / myNbChunks;
+      const Standard_Integer aLast   = myU.Lower() + (aNbRows * (theChunk + 1)) / myNbChunks - 1;
+      if (aFirst > aLast)
+      {
+        return;
+      }
+
+      // the rows of the grid are contiguous, so the chunk is evaluated in place
+      const TColStd_Array1OfReal aU (myU (aFirst), aFirst, aLast);
+      TColgp_Array2OfPnt aPoints (myPoints (aFirst, myPoints.LowerCol()),
+                                  aFirst, aLast, myPoints.LowerCol(), myPoints.UpperCol());
+      const Handle(Adaptor3d_Surface) aSurface = myNbChunks > 1 ? mySurface->ShallowCopy() : mySurface;
+      aSurface->D0Grid (aU, myV, aPoints);
+    }
+
+  private:
+    GridFunctor (const GridFunctor&);
+    GridFunctor& operator= (const GridFunctor&);
+
+  private:
+    const Handle(Adaptor3d_Surface)& mySurface;
+    const TColStd_Array1OfReal&      myU;
+    const TColStd_Array1OfReal&      myV;
+    const Standard_Integer           myNbChunks;
+    TColgp_Array2OfPnt&              myPoints;
+  };
+}
+
+//=======================================================================
+//function : IntPatch_SurfaceSampling
+//purpose  :
+//=======================================================================
+IntPatch_SurfaceSampling::IntPatch_SurfaceSampling()
+: myMaxDiagonal (0.0),
+  myUMin (0.0),
+  myUMax (0.0),
+  myVMin (0.0),
+  myVMax (0.0),
+  myNbU (0),
+  myNbV (0)
+{
+}
+
+//=======================================================================
+//function : IsComputed
+//purpose  :
+//=======================================================================
+Standard_Boolean IntPatch_SurfaceSampling::IsComputed (const Adaptor3d_Surface& theSurface,
+                                                       const Standard_Integer theNbU,
+                                                       const Standard_Integer theNbV) const
+{
+  return myNbU == theNbU
+      && myNbV == theNbV
+      && myUMin == theSurface.FirstUParameter()
+      && myUMax == theSurface.LastUParameter()
+      && myVMin == theSurface.FirstVParameter()
+      && myVMax == theSurface.LastVParameter();
+}
+
+//=======================================================================
+//function : Perform
+//purpose  :
+//=======================================================================
+void IntPatch_SurfaceSampling::Perform (const Handle(Adaptor3d_Surface)& theSurface,
+                                        const Standard_Integer theNbU,
+                                        const Standard_Integer theNbV,
+                                        const Standard_Boolean theToRunParallel)
+{
+  Clear();
+  if (theNbU < 2 || theNbV < 2)
+  {
+    return;
+  }
+
+  myUMin = theSurface->FirstUParameter();
+  myUMax = theSurface->LastUParameter();
+  myVMin = theSurface->FirstVParameter();
+  myVMax = theSurface->LastVParameter();
+
+  // the parameters are accumulated by the steps in the same way
+  // as by IntPatch_PrmPrmIntersection::PointDepart()
+  TColStd_Array1OfReal aU (0, theNbU - 1), aV (0, theNbV - 1);
+  const Standard_Real aDU = (myUMax - myUMin) / (theNbU - 1);
+  const Standard_Real aDV = (myVMax - myVMin) / (theNbV - 1);
+  Standard_Real aParam = myUMin;
+  for (Standard_Integer i = 0; i < theNbU; ++i, aParam += aDU)
+  {
+    aU (i) = aParam;
+  }
+  aParam = myVMin;
+  for (Standard_Integer j = 0; j < theNbV; ++j, aParam += aDV)
+  {
+    aV (j) = aParam;
+  }
+
+  myPoints.Resize (0, theNbU - 1, 0, theNbV - 1, Standard_False);
+  const Standard_Integer aNbChunks = theToRunParallel
+                                   ? Min (OSD_Parallel::NbLogicalProcessors(), theNbU)
+                                   : 1;
+  GridFunctor aFunctor (theSurface, aU, aV, aNbChunks, myPoints);
+  OSD_Parallel::For (0, aNbChunks, aFunctor, aNbChunks < 2);
+
+  Standard_Real x0, y0, z0, x1, y1, z1;
+  for (Standard_Integer i = 0; i < theNbU; ++i)
+  {
+    for (Standard_Integer j = 0; j < theNbV; ++j)
+    {
+      const gp_Pnt& aP = myPoints (i, j);
+      myBox.Add (aP);
+      if (i > 0 && j > 0)
+      {
+        aP.Coord (x0, y0, z0);
+        myPoints (i - 1, j - 1).Coord (x1, y1, z1);
+        const Standard_Real d = Abs (x1 - x0) + Abs (y1 - y0) + Abs (z1 - z0);
+        if (d > myMaxDiagonal)
+        {
+          myMaxDiagonal = d;
+        }
+      }
+    }
+  }
+  myBox.Enlarge (1.e-8);
+  myNbU = theNbU;
+  myNbV = theNbV;
+}
+
+//=======================================================================
+//function : Clear
+//purpose  :
+//=======================================================================
+void IntPatch_SurfaceSampling::Clear()
+{
+  myBox.SetVoid();
+  myMaxDiagonal = 0.0;
+  myUMin = myUMax = myVMin = myVMax = 0.0;
+  myNbU = myNbV = 0;
+}
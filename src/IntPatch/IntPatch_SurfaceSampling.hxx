@@ -0,0 +1,91 @@
+// Copyright (c) 2024 OPEN CASCADE SAS
+//
+// This file is part of Open CASCADE Technology software library.
+//
+// This library is free software; you can redistribute it and/or modify it under
+// the terms of the GNU Lesser General Public License version 2.1 as published
+// by the Free Software Foundation, with special exception defined in the file
+// OCCT_LGPL_EXCEPTION.txt. Consult the file LICENSE_LGPL_21.txt included in OCCT
+// distribution for complete text of the license and disclaimer of any warranty.
+//
+// Alternatively, this file may be used under the terms of Open CASCADE
+// commercial license or contractual agreement.
+
+#ifndef _IntPatch_SurfaceSampling_HeaderFile
+#define _IntPatch_SurfaceSampling_HeaderFile
+
+#include <Adaptor3d_Surface.hxx>
+#include <Bnd_Box.hxx>
+#include <TColgp_Array2OfPnt.hxx>
+
+//! Sampling of the surface used by IntPatch_PrmPrmIntersection for the search
+//! of the starting points of the walking lines: the points of the uniform grid
+//! of parameters on the surface, their bounding box and the maximal distance
+//! between the diagonal neighbors of the grid.
+//!
+//! The sampling depends only on the surface, its parametric bounds and the size
+//! of the grid, so that it can be computed once and reused for the intersections
+//! of the same surface with the different surfaces (see IntPatch_Intersection::SetSurfaceSamplings()).
+//! The sampling is recomputed if it is requested for the other bounds or size of the grid,
+//! but it is not checked that the surface itself is the same: the caller should keep
+//! the separate samplings for the different surfaces.
+class IntPatch_SurfaceSampling : public Standard_Transient
+{
+  DEFINE_STANDARD_RTTIEXT(IntPatch_SurfaceSampling, Standard_Transient)
+public:
+
+  //! Creates an empty sampling.
+  Standard_EXPORT IntPatch_SurfaceSampling();
+
+  //! Returns true if the sampling is computed for the bounds of the surface
+  //! and the grid of theNbU x theNbV points.
+  Standard_EXPORT Standard_Boolean IsComputed (const Adaptor3d_Surface& theSurface,
+                                               const Standard_Integer theNbU,
+                                               const Standard_Integer theNbV) const;
+
+  //! Computes the points of the grid of theNbU x theNbV parameters uniformly
+  //! distributed within the bounds of the surface.
+  //! The rows of the grid may be evaluated in parallel threads
+  //! on the shallow copies of the surface.
+  Standard_EXPORT void Perform (const Handle(Adaptor3d_Surface)& theSurface,
+                                const Standard_Integer theNbU,
+                                const Standard_Integer theNbV,
+                                const Standard_Boolean theToRunParallel = Standard_False);
+
+  //! Returns the number of the points along U.
+  Standard_Integer NbU() const { return myNbU; }
+
+  //! Returns the number of the points along V.
+  Standard_Integer NbV() const { return myNbV; }
+
+  //! Returns the points of the grid indexed from 0:
+  //! Points()(i, j) is the point of the parameters (U0 + i * dU, V0 + j * dV).
+  const TColgp_Array2OfPnt& Points() const { return myPoints; }
+
+  //! Returns the box of the points enlarged by 1.e-8.
+  const Bnd_Box& Box() const { return myBox; }
+
+  //! Returns the maximal distance (in the sum of the absolute differences of the coordinates)
+  //! between the points (i, j) and (i - 1, j - 1) of the grid.
+  Standard_Real MaxDiagonal() const { return myMaxDiagonal; }
+
+  //! Clears the sampling.
+  Standard_EXPORT void Clear();
+
+private:
+
+  TColgp_Array2OfPnt myPoints;
+  Bnd_Box            myBox;
+  Standard_Real      myMaxDiagonal;
+  Standard_Real      myUMin;
+  Standard_Real      myUMax;
+  Standard_Real      myVMin;
+  Standard_Real      myVMax;
+  Standard_Integer   myNbU;
+  Standard_Integer   myNbV;
+
+};
+
+DEFINE_STANDARD_HANDLE(IntPatch_SurfaceSampling, Standard_Transient)
+
+#endif // _IntPatch_SurfaceSampling_HeaderFile
@@ -36,7 +36,8 @@ static Standard_Integer ComputeIntersection(IntPolyh_PMaillageAffinage& theMaill
 //purpose  : 
 //=======================================================================
 IntPolyh_Intersection::IntPolyh_Intersection(const Handle(Adaptor3d_Surface)& theS1,
-                                             const Handle(Adaptor3d_Surface)& theS2)
+                                             const Handle(Adaptor3d_Surface)& theS2,
+                                             const Standard_Boolean            theToRunParallel)
 {
   mySurf1 = theS1;
   mySurf2 = theS2;
@@ -46,6 +47,7 @@ IntPolyh_Intersection::IntPolyh_Intersection(const Handle(Adaptor3d_Surface)& th
   myNbSV2 = 10;
   myIsDone = Standard_False;
   myIsParallel = Standard_False;
+  myToRunParallel = theToRunParallel;
   mySectionLines.Init(1000);
   myTangentZones.Init(10000);
   Perform();
@@ -60,7 +62,8 @@ IntPolyh_Intersection::IntPolyh_Intersection(const Handle(Adaptor3d_Surface)& th
                                              const Standard_Integer            theNbSV1,
                                              const Handle(Adaptor3d_Surface)& theS2,
                                              const Standard_Integer            theNbSU2,
-                                             const Standard_Integer            theNbSV2)
+                                             const Standard_Integer            theNbSV2,
+                                             const Standard_Boolean            theToRunParallel)
 {
   mySurf1 = theS1;
   mySurf2 = theS2;
@@ -70,6 +73,7 @@ IntPolyh_Intersection::IntPolyh_Intersection(const Handle(Adaptor3d_Surface)& th
   myNbSV2 = theNbSV2;
   myIsDone = Standard_False;
   myIsParallel = Standard_False;
+  myToRunParallel = theToRunParallel;
   mySectionLines.Init(1000);
   myTangentZones.Init(10000);
   Perform();
@@ -84,7 +88,8 @@ IntPolyh_Intersection::IntPolyh_Intersection(const Handle(Adaptor3d_Surface)& th
                                              const TColStd_Array1OfReal&       theVPars1,
                                              const Handle(Adaptor3d_Surface)& theS2,
                                              const TColStd_Array1OfReal&       theUPars2,
-                                             const TColStd_Array1OfReal&       theVPars2)
+                                             const TColStd_Array1OfReal&       theVPars2,
+                                             const Standard_Boolean            theToRunParallel)
 {
   mySurf1 = theS1;
   mySurf2 = theS2;
@@ -94,6 +99,7 @@ IntPolyh_Intersection::IntPolyh_Intersection(const Handle(Adaptor3d_Surface)& th
   myNbSV2 = theVPars2.Length();
   myIsDone = Standard_False;
   myIsParallel = Standard_False;
+  myToRunParallel = theToRunParallel;
   mySectionLines.Init(1000);
   myTangentZones.Init(10000);
   Perform(theUPars1, theVPars1, theUPars2, theVPars2);
@@ -348,6 +354,7 @@ Standard_Boolean IntPolyh_Intersection::PerformMaillage(const TColStd_Array1OfRe
     new IntPolyh_MaillageAffinage(mySurf1, theUPars1.Length(), theVPars1.Length(),
                                   mySurf2, theUPars2.Length(), theVPars2.Length(),
                                   0);
+  theMaillage->SetRunParallel(myToRunParallel);
 
   theMaillage->FillArrayOfPnt(1, theUPars1, theVPars1, &theDeflTol1);
   theMaillage->FillArrayOfPnt(2, theUPars2, theVPars2, &theDeflTol2);
@@ -398,6 +405,7 @@ Standard_Boolean IntPolyh_Intersection::PerformMaillage(const TColStd_Array1OfRe
     new IntPolyh_MaillageAffinage(mySurf1, theUPars1.Length(), theVPars1.Length(),
                                   mySurf2, theUPars2.Length(), theVPars2.Length(),
                                   0);
+  theMaillage->SetRunParallel(myToRunParallel);
 
   theMaillage->FillArrayOfPnt(1, theIsFirstFwd , thePoints1, theUPars1, theVPars1, theDeflTol1);
   theMaillage->FillArrayOfPnt(2, theIsSecondFwd, thePoints2, theUPars2, theVPars2, theDeflTol2);
@@ -50,29 +50,36 @@ public: //! @name Constructors
 
   //! Constructor for intersection of two surfaces with default parameters.
   //! Performs intersection.
+  //! If <theToRunParallel> is true, the triangulations are processed in parallel threads
+  //! (see IntPolyh_MaillageAffinage::SetRunParallel()).
   Standard_EXPORT IntPolyh_Intersection(const Handle(Adaptor3d_Surface)& theS1,
-                                        const Handle(Adaptor3d_Surface)& theS2);
+                                        const Handle(Adaptor3d_Surface)& theS2,
+                                        const Standard_Boolean            theToRunParallel = Standard_False);
 
   //! Constructor for intersection of two surfaces with the given
   //! size of the sampling nets:
   //! - <theNbSU1> x <theNbSV1> - for the first surface <theS1>;
   //! - <theNbSU2> x <theNbSV2> - for the second surface <theS2>.
   //! Performs intersection.
+  //! If <theToRunParallel> is true, the triangulations are processed in parallel threads.
   Standard_EXPORT IntPolyh_Intersection(const Handle(Adaptor3d_Surface)& theS1,
                                         const Standard_Integer            theNbSU1,
                                         const Standard_Integer            theNbSV1,
                                         const Handle(Adaptor3d_Surface)& theS2,
                                         const Standard_Integer            theNbSU2,
-                                        const Standard_Integer            theNbSV2);
+                                        const Standard_Integer            theNbSV2,
+                                        const Standard_Boolean            theToRunParallel = Standard_False);
 
   //! Constructor for intersection of two surfaces with the precomputed sampling.
   //! Performs intersection.
+  //! If <theToRunParallel> is true, the triangulations are processed in parallel threads.
   Standard_EXPORT IntPolyh_Intersection(const Handle(Adaptor3d_Surface)& theS1,
                                         const TColStd_Array1OfReal&       theUPars1,
                                         const TColStd_Array1OfReal&       theVPars1,
                                         const Handle(Adaptor3d_Surface)& theS2,
                                         const TColStd_Array1OfReal&       theUPars2,
-                                        const TColStd_Array1OfReal&       theVPars2);
+                                        const TColStd_Array1OfReal&       theVPars2,
+                                        const Standard_Boolean            theToRunParallel = Standard_False);
 
 
 public: //! @name Getting the results
@@ -205,6 +212,7 @@ private: //! @name Fields
   Standard_Integer myNbSV1;                    //!< Number of samples in V direction for first surface
   Standard_Integer myNbSU2;                    //!< Number of samples in U direction for second surface
   Standard_Integer myNbSV2;                    //!< Number of samples in V direction for second surface
+  Standard_Boolean myToRunParallel;            //!< Flag to process the triangulations in parallel threads
   // Results
   Standard_Boolean myIsDone;                   //!< State of the operation
   IntPolyh_ArrayOfSectionLines mySectionLines; //!< Section lines
@@ -38,7 +38,9 @@
 #include <IntPolyh_StartPoint.hxx>
 #include <IntPolyh_Tools.hxx>
 #include <IntPolyh_Triangle.hxx>
+#include <OSD_Parallel.hxx>
 #include <TColStd_Array1OfInteger.hxx>
+#include <TColStd_Array1OfReal.hxx>
 #include <TColStd_MapOfInteger.hxx>
 #include <TColStd_ListIteratorOfListOfInteger.hxx>
 #include <algorithm>
@@ -271,6 +273,226 @@ static
   }
 }
 
+//=======================================================================
+//function : NbParallelChunks
+//purpose  : Returns the number of the chunks to split <theNbItems>
+//           items for the processing in parallel threads
+//=======================================================================
+static
+  Standard_Integer NbParallelChunks(const Standard_Integer theNbItems,
+                                    const Standard_Boolean theToRunParallel)
+{
+  if (!theToRunParallel || theNbItems < 2)
+    return 1;
+  return Min(OSD_Parallel::NbLogicalProcessors(), theNbItems);
+}
+
+//=======================================================================
+//class : IntPolyh_PointsFunctor
+//purpose  : Computes the points of the sampling of the surface
+//           for the chunks of the rows of the sampling
+//=======================================================================
+class IntPolyh_PointsFunctor
+{
+public:
+
+  //! Constructor
+  IntPolyh_PointsFunctor(const Handle(Adaptor3d_Surface)& theSurface,
+                         const TColStd_Array1OfReal& theUPars,
+                         const TColStd_Array1OfReal& theVPars,
+                         const Standard_Integer theNbU,
+                         const Standard_Integer theNbV,
+                         const Standard_Integer theNbChunks,
+                         IntPolyh_ArrayOfPoints& thePoints)
+  : mySurface(theSurface),
+    myUPars(theUPars),
+    myVPars(theVPars),
+    myNbU(theNbU),
+    myNbV(theNbV),
+    myNbChunks(theNbChunks),
+    myPoints(thePoints)
+  {}
+
+  //! Computes the points of the chunk
+  void operator()(const Standard_Integer theChunk) const
+  {
+    const Standard_Integer iFirst = (myNbU * theChunk) / myNbChunks;
+    const Standard_Integer iLast = (myNbU * (theChunk + 1)) / myNbChunks;
+    if (iFirst >= iLast)
+      return;
+    // The surfaces are not thread-safe, thus the chunks use own copies
+    const Handle(Adaptor3d_Surface) aS = (myNbChunks > 1) ? mySurface->ShallowCopy() : mySurface;
+    for (Standard_Integer i = iFirst; i < iLast; ++i) {
+      const Standard_Real aU = myUPars(i + 1);
+      for (Standard_Integer j = 0; j < myNbV; ++j) {
+        const Standard_Real aV = myVPars(j + 1);
+        const gp_Pnt aP = aS->Value(aU, aV);
+        myPoints[i * myNbV + j].Set(aP.X(), aP.Y(), aP.Z(), aU, aV);
+      }
+    }
+  }
+
+private:
+  IntPolyh_PointsFunctor(const IntPolyh_PointsFunctor&);
+  IntPolyh_PointsFunctor& operator=(const IntPolyh_PointsFunctor&);
+
+private:
+  const Handle(Adaptor3d_Surface)& mySurface;
+  const TColStd_Array1OfReal& myUPars;
+  const TColStd_Array1OfReal& myVPars;
+  const Standard_Integer myNbU;
+  const Standard_Integer myNbV;
+  const Standard_Integer myNbChunks;
+  IntPolyh_ArrayOfPoints& myPoints;
+};
+
+//=======================================================================
+//class : IntPolyh_DeflectionsFunctor
+//purpose  : Computes the deflections of the chunks of the triangles
+//           and the min and max deflections of each chunk
+//=======================================================================
+class IntPolyh_DeflectionsFunctor
+{
+public:
+
+  //! Constructor
+  IntPolyh_DeflectionsFunctor(const Handle(Adaptor3d_Surface)& theSurface,
+                              const IntPolyh_ArrayOfPoints& thePoints,
+                              IntPolyh_ArrayOfTriangles& theTriangles,
+                              const Standard_Integer theNbChunks)
+  : mySurface(theSurface),
+    myPoints(thePoints),
+    myTriangles(theTriangles),
+    myNbChunks(theNbChunks),
+    myMin(0, theNbChunks - 1),
+    myMax(0, theNbChunks - 1)
+  {
+    myMin.Init(RealLast());
+    myMax.Init(-RealLast());
+  }
+
+  //! Computes the deflections of the chunk
+  void operator()(const Standard_Integer theChunk) const
+  {
+    const Standard_Integer aNbT = myTriangles.NbItems();
+    const Standard_Integer iFirst = (aNbT * theChunk) / myNbChunks;
+    const Standard_Integer iLast = (aNbT * (theChunk + 1)) / myNbChunks;
+    if (iFirst >= iLast)
+      return;
+    const Handle(Adaptor3d_Surface) aS = (myNbChunks > 1) ? mySurface->ShallowCopy() : mySurface;
+    Standard_Real& aMin = myMin.ChangeValue(theChunk);
+    Standard_Real& aMax = myMax.ChangeValue(theChunk);
+    for (Standard_Integer i = iFirst; i < iLast; ++i) {
+      const Standard_Real aFleche = myTriangles[i].ComputeDeflection(aS, myPoints);
+      if (aFleche > aMax)
+        aMax = aFleche;
+      if (aFleche < aMin)
+        aMin = aFleche;
+    }
+  }
+
+  //! Returns the min and max deflections of all chunks
+  void MinMax(Standard_Real& theMin, Standard_Real& theMax) const
+  {
+    for (Standard_Integer i = 0; i < myNbChunks; ++i) {
+      if (myMax(i) > theMax)
+        theMax = myMax(i);
+      if (myMin(i) < theMin)
+        theMin = myMin(i);
+    }
+  }
+
+private:
+  IntPolyh_DeflectionsFunctor(const IntPolyh_DeflectionsFunctor&);
+  IntPolyh_DeflectionsFunctor& operator=(const IntPolyh_DeflectionsFunctor&);
+
+private:
+  const Handle(Adaptor3d_Surface)& mySurface;
+  const IntPolyh_ArrayOfPoints& myPoints;
+  IntPolyh_ArrayOfTriangles& myTriangles;
+  const Standard_Integer myNbChunks;
+  // The arrays are modified by the chunks in the const operator()
+  mutable TColStd_Array1OfReal myMin;
+  mutable TColStd_Array1OfReal myMax;
+};
+
+//=======================================================================
+//class : IntPolyh_TrianglesContact
+//purpose  : Couple of triangles with interfering bounding boxes
+//           and the result of their contact check
+//=======================================================================
+struct IntPolyh_TrianglesContact
+{
+  IntPolyh_TrianglesContact()
+    : T1(-1), T2(-1), Angle(RealLast()), IsContact(Standard_False)
+  {}
+
+  Standard_Integer T1;
+  Standard_Integer T2;
+  Standard_Real Angle;
+  Standard_Boolean IsContact;
+};
+
+//=======================================================================
+//class : IntPolyh_ContactsFunctor
+//purpose  : Checks the contacts of the chunks of the couples of triangles
+//=======================================================================
+class IntPolyh_ContactsFunctor
+{
+public:
+
+  //! Constructor
+  IntPolyh_ContactsFunctor(const IntPolyh_MaillageAffinage& theMaillage,
+                           const IntPolyh_ArrayOfTriangles& theTriangles1,
+                           const IntPolyh_ArrayOfPoints& thePoints1,
+                           const IntPolyh_ArrayOfTriangles& theTriangles2,
+                           const IntPolyh_ArrayOfPoints& thePoints2,
+                           const Standard_Integer theNbChunks,
+                           std::vector<IntPolyh_TrianglesContact>& theContacts)
+  : myMaillage(theMaillage),
+    myTriangles1(theTriangles1),
+    myPoints1(thePoints1),
+    myTriangles2(theTriangles2),
+    myPoints2(thePoints2),
+    myNbChunks(theNbChunks),
+    myContacts(theContacts)
+  {}
+
+  //! Checks the contacts of the couples of the chunk
+  void operator()(const Standard_Integer theChunk) const
+  {
+    const Standard_Integer aNbC = static_cast<Standard_Integer>(myContacts.size());
+    const Standard_Integer iFirst = (aNbC * theChunk) / myNbChunks;
+    const Standard_Integer iLast = (aNbC * (theChunk + 1)) / myNbChunks;
+    for (Standard_Integer i = iFirst; i < iLast; ++i) {
+      IntPolyh_TrianglesContact& aContact = myContacts[i];
+      const IntPolyh_Triangle& aT1 = myTriangles1[aContact.T1];
+      const IntPolyh_Triangle& aT2 = myTriangles2[aContact.T2];
+      aContact.IsContact =
+        myMaillage.TriContact(myPoints1[aT1.FirstPoint()],
+                              myPoints1[aT1.SecondPoint()],
+                              myPoints1[aT1.ThirdPoint()],
+                              myPoints2[aT2.FirstPoint()],
+                              myPoints2[aT2.SecondPoint()],
+                              myPoints2[aT2.ThirdPoint()],
+                              aContact.Angle) != 0;
+    }
+  }
+
+private:
+  IntPolyh_ContactsFunctor(const IntPolyh_ContactsFunctor&);
+  IntPolyh_ContactsFunctor& operator=(const IntPolyh_ContactsFunctor&);
+
+private:
+  const IntPolyh_MaillageAffinage& myMaillage;
+  const IntPolyh_ArrayOfTriangles& myTriangles1;
+  const IntPolyh_ArrayOfPoints& myPoints1;
+  const IntPolyh_ArrayOfTriangles& myTriangles2;
+  const IntPolyh_ArrayOfPoints& myPoints2;
+  const Standard_Integer myNbChunks;
+  std::vector<IntPolyh_TrianglesContact>& myContacts;
+};
+
 //=======================================================================
 //function : IntPolyh_MaillageAffinage
 //purpose  : 
@@ -290,7 +512,8 @@ IntPolyh_MaillageAffinage::IntPolyh_MaillageAffinage
   FlecheMax2(0.0), 
   FlecheMin1(0.0), 
   FlecheMin2(0.0),
-  myEnlargeZone(Standard_False) 
+  myEnlargeZone(Standard_False),
+  myToRunParallel(Standard_False)
 { 
 }
 //=======================================================================
@@ -316,7 +539,8 @@ IntPolyh_MaillageAffinage::IntPolyh_MaillageAffinage
   FlecheMax2(0.0), 
   FlecheMin1(0.0), 
   FlecheMin2(0.0),
-  myEnlargeZone(Standard_False)
+  myEnlargeZone(Standard_False),
+  myToRunParallel(Standard_False)
 { 
 }
 //=======================================================================
@@ -374,8 +598,7 @@ void IntPolyh_MaillageAffinage::FillArrayOfPnt
   Standard_Boolean bDegI, bDeg;
   Standard_Integer aNbU, aNbV, iCnt, i, j;
   Standard_Integer aID1, aID2, aJD1, aJD2;
-  Standard_Real aTol, aU, aV, aX, aY, aZ;
-  gp_Pnt aP;
+  Standard_Real aTol;
   //
   aNbU=(SurfID==1)? NbSamplesU1 : NbSamplesU2;
   aNbV=(SurfID==1)? NbSamplesV1 : NbSamplesV2;
@@ -393,23 +616,25 @@ void IntPolyh_MaillageAffinage::FillArrayOfPnt
   }
   //
   TPoints.Init(aNbU*aNbV);
+  // Compute the points of the surface
+  {
+    const Standard_Integer aNbChunks = NbParallelChunks(aNbU, myToRunParallel);
+    IntPolyh_PointsFunctor aFunctor(aS, Upars, Vpars, aNbU, aNbV, aNbChunks, TPoints);
+    OSD_Parallel::For(0, aNbChunks, aFunctor, aNbChunks < 2);
+  }
+  //
   iCnt=0;
   for(i=1; i<=aNbU; ++i){
     bDegI=(aID1==i || aID2==i);
-    aU=Upars(i);
     for(j=1; j<=aNbV; ++j){
-      aV=Vpars(j);
-      aP=aS->Value(aU, aV);
-      aP.Coord(aX, aY, aZ);
       IntPolyh_Point& aIP=TPoints[iCnt];
-      aIP.Set(aX, aY, aZ, aU, aV);
       //
       bDeg=bDegI || (aJD1==j || aJD2==j);
       if (bDeg) {
         aIP.SetDegenerated(bDeg);
       }
       ++iCnt;
-      aBox.Add(aP);
+      aBox.Add(gp_Pnt(aIP.X(), aIP.Y(), aIP.Z()));
     }
   }
   //
@@ -938,15 +1163,11 @@ void IntPolyh_MaillageAffinage::ComputeDeflections
   FlecheMax=-RealLast();
   FlecheMin=RealLast();
   const Standard_Integer FinTT = TTriangles.NbItems();
-  
-  for(Standard_Integer i = 0; i < FinTT; i++) {
-    IntPolyh_Triangle& aTriangle = TTriangles[i];
-    Standard_Real Fleche = aTriangle.ComputeDeflection(aSurface, TPoints);
-    if (Fleche > FlecheMax)
-      FlecheMax = Fleche;
-    if (Fleche < FlecheMin)
-      FlecheMin = Fleche;
-  }
+  const Standard_Integer aNbChunks = NbParallelChunks(FinTT, myToRunParallel);
+
+  IntPolyh_DeflectionsFunctor aFunctor(aSurface, TPoints, TTriangles, aNbChunks);
+  OSD_Parallel::For(0, aNbChunks, aFunctor, aNbChunks < 2);
+  aFunctor.MinMax(FlecheMin, FlecheMax);
 }
 
 //=======================================================================
@@ -2348,34 +2569,45 @@ Standard_Integer IntPolyh_MaillageAffinage::TriangleCompare ()
     return 0;
   }
   //
-  Standard_Real CoupleAngle = -2.0;
-  //
-  // Intersection of the triangles
-  Standard_Integer i, aNb = aDMILI.Extent();
+  // Collect the couples of triangles to check their contacts in parallel threads
+  Standard_Integer i, aNb = aDMILI.Extent(), aNbContacts = 0;
+  for (i = 1; i <= aNb; ++i) {
+    aNbContacts += aDMILI(i).Extent();
+  }
+  std::vector<IntPolyh_TrianglesContact> aContacts(aNbContacts);
+  aNbContacts = 0;
   for (i = 1; i <= aNb; ++i) {
     const Standard_Integer i_S1 = aDMILI.FindKey(i);
-    IntPolyh_Triangle &Triangle1 =  TTriangles1[i_S1];
-    const IntPolyh_Point& P1 = TPoints1[Triangle1.FirstPoint()];
-    const IntPolyh_Point& P2 = TPoints1[Triangle1.SecondPoint()];
-    const IntPolyh_Point& P3 = TPoints1[Triangle1.ThirdPoint()];
-    //
-    const TColStd_ListOfInteger& aLI2 = aDMILI(i);
-    TColStd_ListOfInteger::Iterator aItLI(aLI2);
-    for (; aItLI.More(); aItLI.Next()) {
-      const Standard_Integer i_S2 = aItLI.Value();
-      IntPolyh_Triangle &Triangle2 =  TTriangles2[i_S2];
-      const IntPolyh_Point& Q1 = TPoints2[Triangle2.FirstPoint()];
-      const IntPolyh_Point& Q2 = TPoints2[Triangle2.SecondPoint()];
-      const IntPolyh_Point& Q3 = TPoints2[Triangle2.ThirdPoint()];
-      //
-      if (TriContact(P1, P2, P3, Q1, Q2, Q3, CoupleAngle)) {
-        IntPolyh_Couple aCouple(i_S1, i_S2, CoupleAngle);
-        TTrianglesContacts.Append(aCouple);
-        //
-        Triangle1.SetIntersection(Standard_True);
-        Triangle2.SetIntersection(Standard_True);
-      }
+    TColStd_ListOfInteger::Iterator aItLI(aDMILI(i));
+    for (; aItLI.More(); aItLI.Next(), ++aNbContacts) {
+      aContacts[aNbContacts].T1 = i_S1;
+      aContacts[aNbContacts].T2 = aItLI.Value();
+    }
+  }
+  //
+  // Intersection of the triangles
+  const Standard_Integer aNbChunks = NbParallelChunks(aNbContacts, myToRunParallel);
+  IntPolyh_ContactsFunctor aFunctor(*this, TTriangles1, TPoints1, TTriangles2, TPoints2,
+                                    aNbChunks, aContacts);
+  OSD_Parallel::For(0, aNbChunks, aFunctor, aNbChunks < 2);
+  //
+  // Save the couples in contact in the order of the couples
+  Standard_Real CoupleAngle = -2.0;
+  for (i = 0; i < aNbContacts; ++i) {
+    const IntPolyh_TrianglesContact& aContact = aContacts[i];
+    if (!aContact.IsContact) {
+      continue;
+    }
+    // The angle is not computed for the degenerated triangles,
+    // in this case the angle of the previous couple is kept
+    if (aContact.Angle != RealLast()) {
+      CoupleAngle = aContact.Angle;
     }
+    IntPolyh_Couple aCouple(aContact.T1, aContact.T2, CoupleAngle);
+    TTrianglesContacts.Append(aCouple);
+    //
+    TTriangles1[aContact.T1].SetIntersection(Standard_True);
+    TTriangles2[aContact.T2].SetIntersection(Standard_True);
   }
   return TTrianglesContacts.Extent();
 }
@@ -184,6 +184,15 @@ public:
   //! returns FlecheMax
   Standard_EXPORT Standard_Real GetMaxDeflection (const Standard_Integer SurfID) const;
 
+  //! Sets the flag to compute the points of the surfaces, the deflections
+  //! of the triangles and the contacts of the couples of triangles in parallel threads.
+  //! The refinement of the triangles is always sequential.
+  //! The results do not depend on the flag.
+  void SetRunParallel (const Standard_Boolean theToRunParallel) { myToRunParallel = theToRunParallel; }
+
+  //! Returns the flag of parallel computations.
+  Standard_Boolean IsRunParallel() const { return myToRunParallel; }
+
 private:
 
   Handle(Adaptor3d_Surface) MaSurface1;
@@ -212,6 +221,7 @@ private:
   IntPolyh_ListOfCouples TTrianglesContacts;
 
   Standard_Boolean myEnlargeZone;
+  Standard_Boolean myToRunParallel;
 
 };
 
@@ -65,6 +65,9 @@ IntTools_Context::IntTools_Context()
   myBndBoxDataMap(100, myAllocator),
   mySurfAdaptorMap(100, myAllocator),
   myOBBMap(100, myAllocator),
+  mySamplingMap(100, myAllocator),
+  myLastSamplingStamp(0),
+  myProjectionCache(ProjLib_ProjectionCache::Current()),
   myCreateFlag(0),
   myPOnSTolerance(1.e-12)
 {
@@ -87,6 +90,9 @@ IntTools_Context::IntTools_Context
   myBndBoxDataMap(100, myAllocator),
   mySurfAdaptorMap(100, myAllocator),
   myOBBMap(100, myAllocator),
+  mySamplingMap(100, myAllocator),
+  myLastSamplingStamp(0),
+  myProjectionCache(ProjLib_ProjectionCache::Current()),
   myCreateFlag(1),
   myPOnSTolerance(1.e-12)
 {
@@ -345,6 +351,38 @@ BRepAdaptor_Surface& IntTools_Context::SurfaceAdaptor
   return *pBAS;
 }
 
+//=======================================================================
+//function : SurfaceSampling
+//purpose  : 
+//=======================================================================
+Handle(IntPatch_SurfaceSampling) IntTools_Context::SurfaceSampling
+  (const TopoDS_Face& theFace)
+{
+  std::pair<Handle(IntPatch_SurfaceSampling), Standard_Size>* pSampling = mySamplingMap.ChangeSeek (theFace);
+  if (pSampling == NULL)
+  {
+    if (mySamplingMap.Extent() >= MaxNbSurfaceSamplings())
+    {
+      // release the sampling of the least recently requested face
+      NCollection_DataMap<TopoDS_Shape, std::pair<Handle(IntPatch_SurfaceSampling), Standard_Size>, TopTools_ShapeMapHasher>::Iterator anIt (mySamplingMap);
+      TopoDS_Shape anOldestFace = anIt.Key();
+      Standard_Size anOldestStamp = anIt.Value().second;
+      for (anIt.Next(); anIt.More(); anIt.Next())
+      {
+        if (anIt.Value().second < anOldestStamp)
+        {
+          anOldestFace  = anIt.Key();
+          anOldestStamp = anIt.Value().second;
+        }
+      }
+      mySamplingMap.UnBind (anOldestFace);
+    }
+    pSampling = mySamplingMap.Bound (theFace, std::make_pair (Handle(IntPatch_SurfaceSampling) (new IntPatch_SurfaceSampling()), Standard_Size (0)));
+  }
+  pSampling->second = ++myLastSamplingStamp;
+  return pSampling->first;
+}
+
 //=======================================================================
 //function : Hatcher
 //purpose  : 
@@ -26,7 +26,11 @@
 #include <Standard_Transient.hxx>
 #include <TopAbs_State.hxx>
 #include <BRepAdaptor_Surface.hxx>
+#include <IntPatch_SurfaceSampling.hxx>
+#include <ProjLib_ProjectionCache.hxx>
 #include <TColStd_MapTransientHasher.hxx>
+
+#include <utility>
 class IntTools_FClass2d;
 class TopoDS_Face;
 class GeomAPI_ProjectPointOnSurf;
@@ -96,6 +100,17 @@ Standard_EXPORT virtual  ~IntTools_Context();
   //! Returns a reference to surface adaptor for given face
   Standard_EXPORT BRepAdaptor_Surface& SurfaceAdaptor (const TopoDS_Face& theFace);
 
+  //! Returns the sampling of the surface of the face used by the intersection
+  //! of the surfaces for the search of the starting points of the walking lines.
+  //! The sampling is computed by the intersection on demand and kept here
+  //! for the intersections of the same face with the other faces.
+  //! Only the samplings of the last MaxNbSurfaceSamplings() requested faces are kept,
+  //! the sampling of the least recently requested face is released first.
+  Standard_EXPORT Handle(IntPatch_SurfaceSampling) SurfaceSampling (const TopoDS_Face& theFace);
+
+  //! Returns the maximal number of the surface samplings kept in the context.
+  static Standard_Integer MaxNbSurfaceSamplings() { return 32; }
+
   //! Builds and stores an Oriented Bounding Box for the shape.
   //! Returns a reference to OBB.
   Standard_EXPORT Bnd_OBB& OBB(const TopoDS_Shape& theShape,
@@ -236,6 +251,15 @@ Standard_EXPORT virtual  ~IntTools_Context();
   //! correct value for all projectors
   Standard_EXPORT void SetPOnSProjectionTolerance (const Standard_Real theValue);
 
+  //! Returns the cache of the pcurves used by the algorithms computing
+  //! the pcurves with this context, or NULL if the cache is not used.
+  //! The context takes the current cache of the thread creating it
+  //! (ProjLib_ProjectionCache::Current()).
+  const Handle(ProjLib_ProjectionCache)& ProjectionCache() const { return myProjectionCache; }
+
+  //! Sets the cache of the pcurves, NULL to stop using the cache.
+  void SetProjectionCache (const Handle(ProjLib_ProjectionCache)& theCache) { myProjectionCache = theCache; }
+
 
 
   DEFINE_STANDARD_RTTIEXT(IntTools_Context,Standard_Transient)
@@ -253,6 +277,9 @@ protected:
   NCollection_DataMap<TopoDS_Shape, Bnd_Box*, TopTools_ShapeMapHasher> myBndBoxDataMap;
   NCollection_DataMap<TopoDS_Shape, BRepAdaptor_Surface*, TopTools_ShapeMapHasher> mySurfAdaptorMap;
   NCollection_DataMap<TopoDS_Shape, Bnd_OBB*, TopTools_ShapeMapHasher> myOBBMap; // Map of oriented bounding boxes
+  NCollection_DataMap<TopoDS_Shape, std::pair<Handle(IntPatch_SurfaceSampling), Standard_Size>, TopTools_ShapeMapHasher> mySamplingMap; // Map of samplings with the stamps of the last requests
+  Standard_Size myLastSamplingStamp;
+  Handle(ProjLib_ProjectionCache) myProjectionCache;
   Standard_Integer myCreateFlag;
   Standard_Real myPOnSTolerance;
 
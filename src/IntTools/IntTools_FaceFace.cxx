@@ -544,6 +544,11 @@ void IntTools_FaceFace::Perform (const TopoDS_Face& aF1,
 #endif
 
   const Standard_Boolean isGeomInt = isTreatAnalityc(aBAS1, aBAS2, myTol);
+  // the samplings of the surfaces are kept in the context
+  // for the intersections of the faces with the other faces
+  myIntersector.SetSurfaceSamplings(myContext->SurfaceSampling(myFace1),
+                                    myContext->SurfaceSampling(myFace2));
+  myIntersector.SetRunParallel(theToRunParallel);
   if (aF1.IsSame(aF2))
     myIntersector.Perform(myHS1, dom1, TolArc, TolTang);
   else
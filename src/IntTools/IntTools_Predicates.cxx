@@ -0,0 +1,179 @@
+// Copyright (c) 2024 OPEN CASCADE SAS
+//
+// This file is part of Open CASCADE Technology software library.
+//
+// This library is free software; you can redistribute it and/or modify it under
+// the terms of the GNU Lesser General Public License version 2.1 as published
+// by the Free Software Foundation, with special exception defined in the file
+// OCCT_LGPL_EXCEPTION.txt. Consult the file LICENSE_LGPL_21.txt included in OCCT
+// distribution for complete text of the license and disclaimer of any warranty.
+//
+// Alternatively, this file may be used under the terms of Open CASCADE
+// commercial license or contractual agreement.
+
+#include <IntTools_Predicates.hxx>
+
+#include <gp_XYZ.hxx>
+
+namespace
+{
+  //! Half of the machine epsilon (unit roundoff), 2^-53
+  static const Standard_Real THE_EPSILON = 1.1102230246251565e-16;
+
+  //! Splitter for the exact multiplication, 2^27 + 1
+  static const Standard_Real THE_SPLITTER = 134217729.0;
+
+  //! Bound of the relative error of the triple product
+  static const Standard_Real THE_TRIPLE_ERR_BOUND = (7.0 + 56.0 * THE_EPSILON) * THE_EPSILON;
+
+  //! Maximal length of the expansion
+  static const Standard_Integer THE_MAX_EXPANSION = 32;
+
+  //! Computes the sum of two numbers exactly: theA + theB = theX + theY
+  inline void TwoSum (const Standard_Real theA,
+                      const Standard_Real theB,
+                      Standard_Real& theX,
+                      Standard_Real& theY)
+  {
+    theX = theA + theB;
+    const Standard_Real aBVirt = theX - theA;
+    const Standard_Real aAVirt = theX - aBVirt;
+    theY = (theA - aAVirt) + (theB - aBVirt);
+  }
+
+  //! Splits the number on two halves with 26 significant bits each
+  inline void Split (const Standard_Real theA,
+                     Standard_Real& theHi,
+                     Standard_Real& theLo)
+  {
+    const Standard_Real aC = THE_SPLITTER * theA;
+    const Standard_Real aBig = aC - theA;
+    theHi = aC - aBig;
+    theLo = theA - theHi;
+  }
+
+  //! Computes the product of two numbers exactly: theA * theB = theX + theY
+  inline void TwoProduct (const Standard_Real theA,
+                          const Standard_Real theB,
+                          Standard_Real& theX,
+                          Standard_Real& theY)
+  {
+    theX = theA * theB;
+    Standard_Real aAHi, aALo, aBHi, aBLo;
+    Split (theA, aAHi, aALo);
+    Split (theB, aBHi, aBLo);
+    const Standard_Real anErr1 = theX - (aAHi * aBHi);
+    const Standard_Real anErr2 = anErr1 - (aALo * aBHi);
+    const Standard_Real anErr3 = anErr2 - (aAHi * aBLo);
+    theY = (aALo * aBLo) - anErr3;
+  }
+
+  //! Floating point expansion - exact sum of non-overlapping
+  //! components sorted by increasing magnitude
+  class Expansion
+  {
+  public:
+
+    Expansion() : myLength (0) {}
+
+    //! Adds the number to the expansion exactly (with elimination of zero components)
+    void Add (const Standard_Real theB)
+    {
+      Standard_Real aQ = theB;
+      Standard_Integer aNewLength = 0;
+      for (Standard_Integer i = 0; i < myLength; ++i)
+      {
+        Standard_Real aSum, anErr;
+        TwoSum (aQ, myComponents[i], aSum, anErr);
+        if (anErr != 0.0)
+        {
+          myComponents[aNewLength++] = anErr;
+        }
+        aQ = aSum;
+      }
+      if (aQ != 0.0 || aNewLength == 0)
+      {
+        myComponents[aNewLength++] = aQ;
+      }
+      myLength = aNewLength;
+    }
+
+    //! Adds the product of the numbers to the expansion exactly
+    void AddProduct (const Standard_Real theA,
+                     const Standard_Real theB)
+    {
+      Standard_Real aX, aY;
+      TwoProduct (theA, theB, aX, aY);
+      Add (aY);
+      Add (aX);
+    }
+
+    //! Adds the product of three numbers to the expansion exactly
+    void AddProduct (const Standard_Real theA,
+                     const Standard_Real theB,
+                     const Standard_Real theC)
+    {
+      Standard_Real aX, aY;
+      TwoProduct (theA, theB, aX, aY);
+      AddProduct (aY, theC);
+      AddProduct (aX, theC);
+    }
+
+    //! Returns the approximation of the expansion value.
+    //! As the largest component dominates the others,
+    //! the sign of the approximation is exact.
+    Standard_Real Value() const
+    {
+      Standard_Real aValue = 0.0;
+      for (Standard_Integer i = 0; i < myLength; ++i)
+      {
+        aValue += myComponents[i];
+      }
+      return aValue;
+    }
+
+  private:
+
+    Standard_Real myComponents[THE_MAX_EXPANSION];
+    Standard_Integer myLength;
+  };
+}
+
+//=======================================================================
+//function : TripleProduct
+//purpose  :
+//=======================================================================
+Standard_Real IntTools_Predicates::TripleProduct (const gp_XYZ& theV1,
+                                                  const gp_XYZ& theV2,
+                                                  const gp_XYZ& theV3)
+{
+  const Standard_Real aP1 = theV1.Y() * theV2.Z();
+  const Standard_Real aP2 = theV1.Z() * theV2.Y();
+  const Standard_Real aP3 = theV1.Z() * theV2.X();
+  const Standard_Real aP4 = theV1.X() * theV2.Z();
+  const Standard_Real aP5 = theV1.X() * theV2.Y();
+  const Standard_Real aP6 = theV1.Y() * theV2.X();
+
+  const Standard_Real aDet = (aP1 - aP2) * theV3.X() +
+                             (aP3 - aP4) * theV3.Y() +
+                             (aP5 - aP6) * theV3.Z();
+
+  const Standard_Real aPermanent = (Abs (aP1) + Abs (aP2)) * Abs (theV3.X()) +
+                                   (Abs (aP3) + Abs (aP4)) * Abs (theV3.Y()) +
+                                   (Abs (aP5) + Abs (aP6)) * Abs (theV3.Z());
+
+  if (Abs (aDet) > THE_TRIPLE_ERR_BOUND * aPermanent)
+  {
+    return aDet;
+  }
+
+  // The sign of the computed value is not reliable - compute it exactly
+  Expansion anExp;
+  anExp.AddProduct ( theV1.Y(), theV2.Z(), theV3.X());
+  anExp.AddProduct (-theV1.Z(), theV2.Y(), theV3.X());
+  anExp.AddProduct ( theV1.Z(), theV2.X(), theV3.Y());
+  anExp.AddProduct (-theV1.X(), theV2.Z(), theV3.Y());
+  anExp.AddProduct ( theV1.X(), theV2.Y(), theV3.Z());
+  anExp.AddProduct (-theV1.Y(), theV2.X(), theV3.Z());
+  return anExp.Value();
+}
@@ -0,0 +1,51 @@
+// Copyright (c) 2024 OPEN CASCADE SAS
+//
+// This file is part of Open CASCADE Technology software library.
+//
+// This library is free software; you can redistribute it and/or modify it under
+// the terms of the GNU Lesser General Public License version 2.1 as published
+// by the Free Software Foundation, with special exception defined in the file
+// OCCT_LGPL_EXCEPTION.txt. Consult the file LICENSE_LGPL_21.txt included in OCCT
+// distribution for complete text of the license and disclaimer of any warranty.
+//
+// Alternatively, this file may be used under the terms of Open CASCADE
+// commercial license or contractual agreement.
+
+#ifndef _IntTools_Predicates_HeaderFile
+#define _IntTools_Predicates_HeaderFile
+
+#include <Standard.hxx>
+#include <Standard_DefineAlloc.hxx>
+#include <Standard_Real.hxx>
+
+class gp_XYZ;
+
+//! The class contains the geometric predicates evaluated with adaptive precision.
+//!
+//! Each predicate is first evaluated in the floating point arithmetic
+//! together with the bound of the rounding error. Only if the computed value
+//! is not larger than this bound, i.e. its sign may be wrong, the predicate
+//! is evaluated again exactly, using the floating point expansions
+//! (the sums of non-overlapping floating point numbers).
+//! Thus, the exact evaluation is performed for nearly degenerated cases only
+//! and the predicates are almost as fast as the usual floating point ones.
+//!
+//! The returned values are the approximations of the exact values with
+//! the correct sign (zero is returned only if the exact value is zero).
+//! The coordinates are assumed to be finite and not causing overflow or underflow.
+class IntTools_Predicates
+{
+public:
+
+  DEFINE_STANDARD_ALLOC
+
+  //! Computes the triple product (theV1 ^ theV2) * theV3,
+  //! i.e. the determinant of the matrix composed of the given vectors.
+  //! The sign of the product defines the orientation of the vectors.
+  Standard_EXPORT static Standard_Real TripleProduct (const gp_XYZ& theV1,
+                                                      const gp_XYZ& theV2,
+                                                      const gp_XYZ& theV3);
+
+};
+
+#endif // _IntTools_Predicates_HeaderFile
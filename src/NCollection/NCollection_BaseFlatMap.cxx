@@ -0,0 +1,319 @@
+// Copyright (c) 2024 OPEN CASCADE SAS
+//
+// This file is part of Open CASCADE Technology software library.
+//
+// This library is free software; you can redistribute it and/or modify it under
+// the terms of the GNU Lesser General Public License version 2.1 as published
+// by the Free Software Foundation, with special exception defined in the file
+// OCCT_LGPL_EXCEPTION.txt. Consult the file LICENSE_LGPL_21.txt included in OCCT
+// distribution for complete text of the license and disclaimer of any warranty.
+//
+// Alternatively, this file may be used under the terms of Open CASCADE
+// commercial license or contractual agreement.
+
+#include <NCollection_BaseFlatMap.hxx>
+
+#include <Standard_OutOfRange.hxx>
+
+#include <cstring>
+#include <iomanip>
+
+namespace
+{
+  //! Minimal number of slots of the table
+  static const Standard_Integer THE_MIN_NB_SLOTS = 8;
+}
+
+//=======================================================================
+//function : nbSlotsFor
+//purpose  :
+//=======================================================================
+Standard_Integer NCollection_BaseFlatMap::nbSlotsFor (const Standard_Integer theExtent)
+{
+  Standard_Integer aNbSlots = THE_MIN_NB_SLOTS;
+  while (capacityFor (aNbSlots) < theExtent)
+  {
+    if (aNbSlots > (IntegerLast() >> 1))
+    {
+      throw Standard_OutOfRange ("NCollection_BaseFlatMap, the map is too large");
+    }
+    aNbSlots <<= 1;
+  }
+  return aNbSlots;
+}
+
+//=======================================================================
+//function : resizeTable
+//purpose  :
+//=======================================================================
+void NCollection_BaseFlatMap::resizeTable (const Standard_Integer theNbSlots)
+{
+  const Standard_Integer aCapacity = capacityFor (theNbSlots);
+
+  Standard_Size* aNewHashes = (Standard_Size* )myAllocator->Allocate (sizeof(Standard_Size) * aCapacity);
+  if (mySize > 0)
+  {
+    memcpy (aNewHashes, myHashes, sizeof(Standard_Size) * mySize);
+  }
+  if (myHashes != NULL)
+  {
+    myAllocator->Free (myHashes);
+  }
+  myHashes = aNewHashes;
+
+  Slot* anOldSlots = mySlots;
+  const Standard_Integer anOldNbSlots = myNbSlots;
+
+  mySlots = (Slot* )myAllocator->Allocate (sizeof(Slot) * theNbSlots);
+  memset (mySlots, 0, sizeof(Slot) * theNbSlots);
+
+  myNbSlots  = theNbSlots;
+  myCapacity = aCapacity;
+  myShift = 32;
+  for (Standard_Integer aNb = theNbSlots; aNb > 1; aNb >>= 1)
+  {
+    --myShift;
+  }
+
+  if (anOldSlots == NULL)
+  {
+    return;
+  }
+
+  // The home slot is defined by the upper bits of the hash code, thus the order
+  // of the keys in the old table is preserved in the new one. Reinserting the keys
+  // in this order, starting after the empty slot (i.e. from the beginning of the cluster),
+  // fills the new table sequentially without displacement of the already inserted keys.
+  const Standard_Integer anOldMask = anOldNbSlots - 1;
+  Standard_Integer aStart = 0;
+  while (anOldSlots[aStart].Index != 0)
+  {
+    ++aStart;
+  }
+  for (Standard_Integer aSlotIter = 1; aSlotIter <= anOldNbSlots; ++aSlotIter)
+  {
+    const Slot& anOldSlot = anOldSlots[(aStart + aSlotIter) & anOldMask];
+    if (anOldSlot.Index != 0)
+    {
+      insertSlot (anOldSlot.Hash, anOldSlot.Index);
+    }
+  }
+  myAllocator->Free (anOldSlots);
+}
+
+//=======================================================================
+//function : appendEntry
+//purpose  :
+//=======================================================================
+Standard_Integer NCollection_BaseFlatMap::appendEntry (const Standard_Size theHash)
+{
+  const Standard_Integer anIndex = ++mySize;
+  myHashes[anIndex - 1] = theHash;
+  insertSlot (mixHash (theHash), anIndex);
+  return anIndex;
+}
+
+//=======================================================================
+//function : insertSlot
+//purpose  :
+//=======================================================================
+void NCollection_BaseFlatMap::insertSlot (const unsigned int theHash,
+                                          const Standard_Integer theIndex)
+{
+  const unsigned int aMask = myNbSlots - 1;
+  Slot aSlot = { theHash, theIndex };
+  unsigned int aPos  = theHash >> myShift;
+  unsigned int aDist = 0;
+  for (;; aPos = (aPos + 1) & aMask, ++aDist)
+  {
+    Slot& aCurSlot = mySlots[aPos];
+    if (aCurSlot.Index == 0)
+    {
+      aCurSlot = aSlot;
+      return;
+    }
+
+    // take the slot from the key which is closer to its home
+    const unsigned int aCurDist = (aPos - (aCurSlot.Hash >> myShift)) & aMask;
+    if (aCurDist < aDist)
+    {
+      std::swap (aCurSlot, aSlot);
+      aDist = aCurDist;
+    }
+  }
+}
+
+//=======================================================================
+//function : findSlot
+//purpose  :
+//=======================================================================
+unsigned int NCollection_BaseFlatMap::findSlot (const Standard_Integer theIndex) const
+{
+  const unsigned int aMask = myNbSlots - 1;
+  unsigned int aPos = mixHash (myHashes[theIndex - 1]) >> myShift;
+  while (mySlots[aPos].Index != theIndex)
+  {
+    aPos = (aPos + 1) & aMask;
+  }
+  return aPos;
+}
+
+//=======================================================================
+//function : removeLastEntry
+//purpose  :
+//=======================================================================
+void NCollection_BaseFlatMap::removeLastEntry()
+{
+  Standard_OutOfRange_Raise_if (mySize == 0, "NCollection_BaseFlatMap::removeLastEntry");
+
+  // shift the following slots backward until the empty one
+  // or the one being in its home position
+  const unsigned int aMask = myNbSlots - 1;
+  unsigned int aPos  = findSlot (mySize);
+  unsigned int aNext = (aPos + 1) & aMask;
+  for (; mySlots[aNext].Index != 0
+      && ((aNext - (mySlots[aNext].Hash >> myShift)) & aMask) != 0;
+       aPos = aNext, aNext = (aNext + 1) & aMask)
+  {
+    mySlots[aPos] = mySlots[aNext];
+  }
+  mySlots[aPos].Index = 0;
+  --mySize;
+}
+
+//=======================================================================
+//function : removeEntry
+//purpose  :
+//=======================================================================
+Standard_Integer NCollection_BaseFlatMap::removeEntry (const Standard_Integer theIndex)
+{
+  Standard_OutOfRange_Raise_if (theIndex < 1 || theIndex > mySize, "NCollection_BaseFlatMap::removeEntry");
+  if (theIndex == mySize)
+  {
+    removeLastEntry();
+    return 0;
+  }
+
+  const Standard_Integer aLastIndex = mySize;
+  swapEntries (theIndex, aLastIndex);
+  removeLastEntry();
+  return aLastIndex;
+}
+
+//=======================================================================
+//function : swapEntries
+//purpose  :
+//=======================================================================
+void NCollection_BaseFlatMap::swapEntries (const Standard_Integer theIndex1,
+                                           const Standard_Integer theIndex2)
+{
+  if (theIndex1 == theIndex2)
+  {
+    return;
+  }
+  const unsigned int aPos1 = findSlot (theIndex1);
+  const unsigned int aPos2 = findSlot (theIndex2);
+  mySlots[aPos1].Index = theIndex2;
+  mySlots[aPos2].Index = theIndex1;
+  std::swap (myHashes[theIndex1 - 1], myHashes[theIndex2 - 1]);
+}
+
+//=======================================================================
+//function : rehashEntry
+//purpose  :
+//=======================================================================
+void NCollection_BaseFlatMap::rehashEntry (const Standard_Integer theIndex,
+                                           const Standard_Size theHash)
+{
+  // move the entry to the end, so that it could be unregistered
+  // and registered again with the new hash code
+  const Standard_Integer aLastIndex = mySize;
+  swapEntries (theIndex, aLastIndex);
+  removeLastEntry();
+  appendEntry (theHash);
+  swapEntries (theIndex, aLastIndex);
+}
+
+//=======================================================================
+//function : clearTable
+//purpose  :
+//=======================================================================
+void NCollection_BaseFlatMap::clearTable (const Standard_Boolean theToReleaseMemory)
+{
+  mySize = 0;
+  if (theToReleaseMemory)
+  {
+    releaseTable();
+  }
+  else if (mySlots != NULL)
+  {
+    memset (mySlots, 0, sizeof(Slot) * myNbSlots);
+  }
+}
+
+//=======================================================================
+//function : releaseTable
+//purpose  :
+//=======================================================================
+void NCollection_BaseFlatMap::releaseTable()
+{
+  if (mySlots != NULL)
+  {
+    myAllocator->Free (mySlots);
+    mySlots = NULL;
+  }
+  if (myHashes != NULL)
+  {
+    myAllocator->Free (myHashes);
+    myHashes = NULL;
+  }
+  myNbSlots  = 0;
+  myShift    = 32;
+  myCapacity = 0;
+}
+
+//=======================================================================
+//function : Statistics
+//purpose  :
+//=======================================================================
+void NCollection_BaseFlatMap::Statistics (Standard_OStream& theStream) const
+{
+  theStream << "\nMap Statistics\n---------------\n\n";
+  theStream << "This Map has " << myNbSlots << " Slots and " << mySize << " Keys\n\n";
+
+  if (mySize == 0)
+  {
+    return;
+  }
+
+  // distribution of the distances from the home slots
+  const unsigned int aMask = myNbSlots - 1;
+  Standard_Integer* aNbDists = new Standard_Integer[myNbSlots];
+  memset (aNbDists, 0, sizeof(Standard_Integer) * myNbSlots);
+  unsigned int aMaxDist = 0;
+  for (Standard_Integer aPos = 0; aPos < myNbSlots; ++aPos)
+  {
+    if (mySlots[aPos].Index != 0)
+    {
+      const unsigned int aDist = (aPos - (mySlots[aPos].Hash >> myShift)) & aMask;
+      ++aNbDists[aDist];
+      if (aDist > aMaxDist)
+      {
+        aMaxDist = aDist;
+      }
+    }
+  }
+
+  Standard_Real aMean = 0.0;
+  for (unsigned int aDist = 0; aDist <= aMaxDist; ++aDist)
+  {
+    if (aNbDists[aDist] > 0)
+    {
+      aMean += Standard_Real (aNbDists[aDist]) * aDist;
+      theStream << std::setw (5) << aNbDists[aDist] << " keys at distance " << aDist << "\n";
+    }
+  }
+  theStream << "\n\nMean of distance : " << aMean / mySize << "\n";
+
+  delete[] aNbDists;
+}
@@ -0,0 +1,323 @@
+// Copyright (c) 2024 OPEN CASCADE SAS
+//
+// This file is part of Open CASCADE Technology software library.
+//
+// This library is free software; you can redistribute it and/or modify it under
+// the terms of the GNU Lesser General Public License version 2.1 as published
+// by the Free Software Foundation, with special exception defined in the file
+// OCCT_LGPL_EXCEPTION.txt. Consult the file LICENSE_LGPL_21.txt included in OCCT
+// distribution for complete text of the license and disclaimer of any warranty.
+//
+// Alternatively, this file may be used under the terms of Open CASCADE
+// commercial license or contractual agreement.
+
+#ifndef NCollection_BaseFlatMap_HeaderFile
+#define NCollection_BaseFlatMap_HeaderFile
+
+#include <Standard.hxx>
+#include <Standard_OStream.hxx>
+#include <NCollection_BaseAllocator.hxx>
+#include <NCollection_DefineAlloc.hxx>
+
+#include <new>
+#include <utility>
+
+/**
+ * Purpose:     This is a base class for the maps with open addressing:
+ *                FlatMap
+ *                FlatDataMap
+ *                FlatIndexedMap
+ *
+ *              The entries (keys and items) of such maps are stored
+ *              contiguously in the order of their addition, with the
+ *              indices in the range [1, Extent()].
+ *              The hash table is an array of slots keeping the hash
+ *              code of the key and the index of its entry. Its size is
+ *              a power of two and the collisions are resolved by linear
+ *              probing with Robin Hood ordering of the slots (the slot
+ *              is given to the key which is farther from its home slot),
+ *              thus the probe sequences are short and the search of
+ *              absent key stops early. The removal of the slot shifts
+ *              the following slots backward, so no tombstones are used.
+ *
+ *              The full-width hash code of the key is computed once, on its
+ *              addition, and is kept in the map, so rehashing of the table on
+ *              growth does not call the Hasher. The slot keeps only the 32-bit
+ *              mix of the hash code (its upper bits define the home slot) to
+ *              keep the table compact; the full hash code of the entry is
+ *              checked when the mixes coincide, and the keys themselves are
+ *              compared only if their full hash codes coincide.
+ *
+ *              This class provides the management of the slots and
+ *              hash codes, while the storage of entries is implemented
+ *              by the descendants.
+ */
+class NCollection_BaseFlatMap
+{
+public:
+  //! Memory allocation
+  DEFINE_STANDARD_ALLOC
+  DEFINE_NCOLLECTION_ALLOC
+
+protected:
+
+  //! Slot of the hash table
+  struct Slot
+  {
+    unsigned int     Hash;  //!< mix of the hash code of the key, see mixHash()
+    Standard_Integer Index; //!< index of the entry, 0 for empty slot
+  };
+
+public:
+
+  //! Iterator over the indices of the entries, which hash codes
+  //! are equal to the given one. Used for the search of the key.
+  class ProbeIterator
+  {
+  public:
+    //! Constructor
+    ProbeIterator (const NCollection_BaseFlatMap& theMap,
+                   const Standard_Size theHash)
+    : mySlots   (theMap.mySlots),
+      myHashes  (theMap.myHashes),
+      myFullHash(theHash),
+      myMask    (theMap.myNbSlots - 1),
+      myShift   (theMap.myShift),
+      myHash    (mixHash (theHash)),
+      myPos     (0),
+      myDist    (0),
+      myIndex   (0)
+    {
+      if (mySlots != NULL)
+      {
+        myPos = myHash >> myShift;
+        find();
+      }
+    }
+
+    //! Returns true if there is the current entry
+    Standard_Boolean More() const
+    { return myIndex != 0; }
+
+    //! Moves to the next entry with the same hash code
+    void Next()
+    {
+      myPos = (myPos + 1) & myMask;
+      ++myDist;
+      find();
+    }
+
+    //! Returns the index of the current entry
+    Standard_Integer Index() const
+    { return myIndex; }
+
+  private:
+
+    //! Looks for the slot with the given hash code starting from the current position
+    void find()
+    {
+      for (;; myPos = (myPos + 1) & myMask, ++myDist)
+      {
+        const Slot& aSlot = mySlots[myPos];
+        if (aSlot.Index == 0)
+        {
+          break;
+        }
+        if (aSlot.Hash == myHash
+         && myHashes[aSlot.Index - 1] == myFullHash)
+        {
+          myIndex = aSlot.Index;
+          return;
+        }
+        if (((myPos - (aSlot.Hash >> myShift)) & myMask) < myDist)
+        {
+          // the key would have been placed here
+          break;
+        }
+      }
+      myIndex = 0;
+    }
+
+  private:
+    const Slot*          mySlots;
+    const Standard_Size* myHashes;
+    Standard_Size        myFullHash;
+    unsigned int         myMask;
+    unsigned int         myShift;
+    unsigned int         myHash;
+    unsigned int         myPos;
+    unsigned int         myDist;
+    Standard_Integer     myIndex;
+  };
+
+public:
+  // ---------- PUBLIC METHODS ------------
+
+  //! Returns the number of slots of the hash table
+  Standard_Integer NbBuckets() const
+  { return myNbSlots; }
+
+  //! Extent
+  Standard_Integer Extent() const
+  { return mySize; }
+
+  //! IsEmpty
+  Standard_Boolean IsEmpty() const
+  { return mySize == 0; }
+
+  //! Prints the distribution of distances of the keys from their home slots
+  Standard_EXPORT void Statistics (Standard_OStream& theStream) const;
+
+  //! Returns attached allocator
+  const Handle(NCollection_BaseAllocator)& Allocator() const
+  { return myAllocator; }
+
+protected:
+  // -------- PROTECTED METHODS -----------
+
+  //! Constructor
+  NCollection_BaseFlatMap (const Handle(NCollection_BaseAllocator)& theAllocator)
+  : mySlots   (NULL),
+    myHashes  (NULL),
+    myNbSlots (0),
+    myShift   (32),
+    myCapacity(0),
+    mySize    (0)
+  {
+    myAllocator = (theAllocator.IsNull() ? NCollection_BaseAllocator::CommonBaseAllocator() : theAllocator);
+  }
+
+  //! Destructor
+  virtual ~NCollection_BaseFlatMap()
+  { releaseTable(); }
+
+  //! Returns true if there is no room for the new entry
+  Standard_Boolean isFull() const
+  { return mySize >= myCapacity; }
+
+  //! Returns the number of entries the table of given number of slots can hold
+  static Standard_Integer capacityFor (const Standard_Integer theNbSlots)
+  { return theNbSlots - theNbSlots / 4; }
+
+  //! Returns the number of slots required for the given number of entries
+  Standard_EXPORT static Standard_Integer nbSlotsFor (const Standard_Integer theExtent);
+
+  //! Rebuilds the hash table with the given number of slots (power of two)
+  //! for the current entries. Reallocation of the entries themselves
+  //! should be performed by descendant before the call.
+  Standard_EXPORT void resizeTable (const Standard_Integer theNbSlots);
+
+  //! Registers the new entry with the given full-width hash code
+  //! (see NCollection_HasherTraits) at index Extent() + 1.
+  //! The table should not be full. Returns the index of the new entry.
+  Standard_EXPORT Standard_Integer appendEntry (const Standard_Size theHash);
+
+  //! Unregisters the last entry.
+  Standard_EXPORT void removeLastEntry();
+
+  //! Unregisters the entry with the given index moving the last entry
+  //! in its place. Returns the index of the moved entry (Extent() before
+  //! the call) or 0 if the removed entry was the last one.
+  //! The descendant should relocate the entry data accordingly.
+  Standard_EXPORT Standard_Integer removeEntry (const Standard_Integer theIndex);
+
+  //! Exchanges indices of two registered entries.
+  Standard_EXPORT void swapEntries (const Standard_Integer theIndex1,
+                                    const Standard_Integer theIndex2);
+
+  //! Changes the hash code of the entry with the given index.
+  Standard_EXPORT void rehashEntry (const Standard_Integer theIndex,
+                                    const Standard_Size theHash);
+
+  //! Returns the full-width hash code of the entry with the given index
+  Standard_Size entryHash (const Standard_Integer theIndex) const
+  { return myHashes[theIndex - 1]; }
+
+  //! Unregisters all entries.
+  //! @param theToReleaseMemory if true, the table is deallocated
+  Standard_EXPORT void clearTable (const Standard_Boolean theToReleaseMemory);
+
+  //! Exchanges the content of two maps.
+  void exchangeMapsData (NCollection_BaseFlatMap& theOther)
+  {
+    std::swap (myAllocator, theOther.myAllocator);
+    std::swap (mySlots,     theOther.mySlots);
+    std::swap (myHashes,    theOther.myHashes);
+    std::swap (myNbSlots,   theOther.myNbSlots);
+    std::swap (myShift,     theOther.myShift);
+    std::swap (myCapacity,  theOther.myCapacity);
+    std::swap (mySize,      theOther.mySize);
+  }
+
+  //! Reallocates the array of entries for the given capacity
+  //! moving the current entries (Extent() first ones) into the new array.
+  template<class TheEntryType>
+  void reallocEntries (TheEntryType*& theEntries,
+                       const Standard_Integer theCapacity)
+  {
+    TheEntryType* aNewEntries = (TheEntryType* )myAllocator->Allocate (sizeof(TheEntryType) * theCapacity);
+    for (Standard_Integer anEntryIter = 0; anEntryIter < mySize; ++anEntryIter)
+    {
+      new (&aNewEntries[anEntryIter]) TheEntryType (std::move (theEntries[anEntryIter]));
+      theEntries[anEntryIter].~TheEntryType();
+    }
+    if (theEntries != NULL)
+    {
+      myAllocator->Free (theEntries);
+    }
+    theEntries = aNewEntries;
+  }
+
+  //! Destroys the current entries (Extent() first ones),
+  //! releasing the array if requested.
+  template<class TheEntryType>
+  void destroyEntries (TheEntryType*& theEntries,
+                       const Standard_Boolean theToReleaseMemory)
+  {
+    for (Standard_Integer anEntryIter = 0; anEntryIter < mySize; ++anEntryIter)
+    {
+      theEntries[anEntryIter].~TheEntryType();
+    }
+    if (theToReleaseMemory && theEntries != NULL)
+    {
+      myAllocator->Free (theEntries);
+      theEntries = NULL;
+    }
+  }
+
+private:
+
+  //! Folds the full-width hash code of the key and mixes its bits
+  //! so that the upper bits can be used as the home slot.
+  static unsigned int mixHash (const Standard_Size theHashCode)
+  {
+    unsigned long long aHash = static_cast<unsigned long long> (theHashCode);
+    aHash = (aHash ^ (aHash >> 32)) & 0xFFFFFFFFull;
+    return static_cast<unsigned int> ((aHash * 0x9E3779B97F4A7C15ull) >> 32);
+  }
+
+  //! Returns the position of the slot referring to the entry with given index
+  Standard_EXPORT unsigned int findSlot (const Standard_Integer theIndex) const;
+
+  //! Inserts the slot into the table (Robin Hood insertion)
+  Standard_EXPORT void insertSlot (const unsigned int theHash,
+                                   const Standard_Integer theIndex);
+
+  //! Deallocates the table
+  Standard_EXPORT void releaseTable();
+
+protected:
+  // --------- PROTECTED FIELDS -----------
+  Handle(NCollection_BaseAllocator) myAllocator;
+
+private:
+  // ---------- PRIVATE FIELDS ------------
+  Slot*            mySlots;    //!< hash table
+  Standard_Size*   myHashes;   //!< full-width hash codes of the entries
+  Standard_Integer myNbSlots;  //!< number of slots (power of two)
+  unsigned int     myShift;    //!< shift of the hash code giving the home slot
+  Standard_Integer myCapacity; //!< number of entries the table can hold
+  Standard_Integer mySize;     //!< number of entries
+};
+
+#endif
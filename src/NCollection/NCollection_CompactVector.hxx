@@ -0,0 +1,249 @@
+// Copyright (c) 2024 OPEN CASCADE SAS
+//
+// This file is part of Open CASCADE Technology software library.
+//
+// This library is free software; you can redistribute it and/or modify it under
+// the terms of the GNU Lesser General Public License version 2.1 as published
+// by the Free Software Foundation, with special exception defined in the file
+// OCCT_LGPL_EXCEPTION.txt. Consult the file LICENSE_LGPL_21.txt included in OCCT
+// distribution for complete text of the license and disclaimer of any warranty.
+//
+// Alternatively, this file may be used under the terms of Open CASCADE
+// commercial license or contractual agreement.
+
+#ifndef NCollection_CompactVector_HeaderFile
+#define NCollection_CompactVector_HeaderFile
+
+#include <Standard.hxx>
+#include <Standard_NoSuchObject.hxx>
+#include <Standard_OutOfRange.hxx>
+
+#include <new>
+#include <utility>
+
+/**
+ * Purpose:     The CompactVector is the growing array keeping the items
+ *              in the single contiguous memory block.
+ *
+ *              It is designed as a small member of the numerous objects
+ *              having few items each: the empty vector takes no memory
+ *              block, the vector itself is the pointer and two integers,
+ *              and the items are reallocated with the geometric growth of
+ *              the block. The memory is managed by Standard::Allocate().
+ *
+ *              The item type is not required to be complete at the place
+ *              of declaration of the vector member, only where the methods
+ *              of the vector are used.
+ *
+ *              The items are indexed from 0. The references to the items
+ *              are invalidated by the addition and removal of the items,
+ *              the Iterator remains valid on addition of the items.
+ */
+template <class TheItemType>
+class NCollection_CompactVector
+{
+public:
+  //! STL-compliant typedef for value type
+  typedef TheItemType value_type;
+
+public:
+  //! Iterator over the items of the vector.
+  //! It refers to the vector and the index of the item, thus it
+  //! remains valid when the memory block of the vector is reallocated.
+  class Iterator
+  {
+  public:
+    //! Empty constructor.
+    Iterator() : myVector (NULL), myIndex (0) {}
+
+    //! Constructor.
+    Iterator (const NCollection_CompactVector& theVector) : myVector (&theVector), myIndex (0) {}
+
+    //! Initializes the iterator on the vector.
+    void Init (const NCollection_CompactVector& theVector)
+    {
+      myVector = &theVector;
+      myIndex  = 0;
+    }
+
+    //! Query if the end of collection is reached by iterator
+    Standard_Boolean More() const { return myVector != NULL && myIndex < myVector->mySize; }
+
+    //! Make a step along the collection
+    void Next() { ++myIndex; }
+
+    //! Value access
+    const TheItemType& Value() const
+    {
+      Standard_NoSuchObject_Raise_if (!More(), "NCollection_CompactVector::Iterator::Value");
+      return myVector->myData[myIndex];
+    }
+
+    //! Returns the index of the current item.
+    Standard_Integer Index() const { return myIndex; }
+
+  private:
+    const NCollection_CompactVector* myVector; //!< iterated vector
+    Standard_Integer                 myIndex;  //!< index of the current item
+  };
+
+public:
+
+  //! Empty constructor.
+  NCollection_CompactVector() : myData (NULL), mySize (0), myCapacity (0) {}
+
+  //! Copy constructor.
+  NCollection_CompactVector (const NCollection_CompactVector& theOther)
+  : myData (NULL), mySize (0), myCapacity (0)
+  {
+    Assign (theOther);
+  }
+
+  //! Destructor.
+  ~NCollection_CompactVector() { Clear(); }
+
+  //! Assignment.
+  NCollection_CompactVector& Assign (const NCollection_CompactVector& theOther)
+  {
+    if (this == &theOther)
+    {
+      return *this;
+    }
+    Clear();
+    Reserve (theOther.mySize);
+    for (; mySize < theOther.mySize; ++mySize)
+    {
+      new (&myData[mySize]) TheItemType (theOther.myData[mySize]);
+    }
+    return *this;
+  }
+
+  //! Assignment operator.
+  NCollection_CompactVector& operator= (const NCollection_CompactVector& theOther) { return Assign (theOther); }
+
+  //! Exchanges the content of two vectors without reallocation.
+  void Exchange (NCollection_CompactVector& theOther)
+  {
+    std::swap (myData,     theOther.myData);
+    std::swap (mySize,     theOther.mySize);
+    std::swap (myCapacity, theOther.myCapacity);
+  }
+
+  //! Returns the number of items.
+  Standard_Integer Size() const { return mySize; }
+
+  //! Returns the number of items.
+  Standard_Integer Length() const { return mySize; }
+
+  //! Returns true if the vector has no items.
+  Standard_Boolean IsEmpty() const { return mySize == 0; }
+
+  //! Returns the number of items which can be stored without reallocation.
+  Standard_Integer Capacity() const { return myCapacity; }
+
+  //! Returns the item with the given index in the range [0, Size() - 1].
+  const TheItemType& Value (const Standard_Integer theIndex) const
+  {
+    Standard_OutOfRange_Raise_if (theIndex < 0 || theIndex >= mySize, "NCollection_CompactVector::Value");
+    return myData[theIndex];
+  }
+
+  //! Returns the item with the given index in the range [0, Size() - 1].
+  const TheItemType& operator() (const Standard_Integer theIndex) const { return Value (theIndex); }
+
+  //! Returns the modifiable item with the given index in the range [0, Size() - 1].
+  TheItemType& ChangeValue (const Standard_Integer theIndex)
+  {
+    Standard_OutOfRange_Raise_if (theIndex < 0 || theIndex >= mySize, "NCollection_CompactVector::ChangeValue");
+    return myData[theIndex];
+  }
+
+  //! Returns the modifiable item with the given index in the range [0, Size() - 1].
+  TheItemType& operator() (const Standard_Integer theIndex) { return ChangeValue (theIndex); }
+
+  //! Returns the last item.
+  const TheItemType& Last() const { return Value (mySize - 1); }
+
+  //! Returns the modifiable last item.
+  TheItemType& ChangeLast() { return ChangeValue (mySize - 1); }
+
+  //! Appends the item to the end of the vector and returns the reference to it.
+  //! The item may be the item of this vector.
+  TheItemType& Append (const TheItemType& theItem)
+  {
+    if (mySize < myCapacity)
+    {
+      new (&myData[mySize]) TheItemType (theItem);
+    }
+    else
+    {
+      // the item is copied before releasing the memory block it could belong to
+      TheItemType* aNewData = allocate (myCapacity < 2 ? 2 : 2 * myCapacity);
+      new (&aNewData[mySize]) TheItemType (theItem);
+      relocate (aNewData);
+    }
+    return myData[mySize++];
+  }
+
+  //! Removes the item with the given index keeping the order of the following items.
+  void Remove (const Standard_Integer theIndex)
+  {
+    Standard_OutOfRange_Raise_if (theIndex < 0 || theIndex >= mySize, "NCollection_CompactVector::Remove");
+    for (Standard_Integer anIndex = theIndex + 1; anIndex < mySize; ++anIndex)
+    {
+      myData[anIndex - 1] = std::move (myData[anIndex]);
+    }
+    myData[--mySize].~TheItemType();
+  }
+
+  //! Reserves the memory for the given number of items.
+  void Reserve (const Standard_Integer theCapacity)
+  {
+    if (theCapacity > myCapacity)
+    {
+      relocate (allocate (theCapacity));
+    }
+  }
+
+  //! Removes all items and releases the memory.
+  void Clear()
+  {
+    for (Standard_Integer anIndex = 0; anIndex < mySize; ++anIndex)
+    {
+      myData[anIndex].~TheItemType();
+    }
+    Standard::Free (myData);
+    mySize     = 0;
+    myCapacity = 0;
+  }
+
+private:
+
+  //! Allocates the memory block for the given number of items
+  TheItemType* allocate (const Standard_Integer theCapacity)
+  {
+    myCapacity = theCapacity;
+    return (TheItemType* )Standard::Allocate (sizeof(TheItemType) * theCapacity);
+  }
+
+  //! Moves the items to the new memory block and releases the old one
+  void relocate (TheItemType* theNewData)
+  {
+    for (Standard_Integer anIndex = 0; anIndex < mySize; ++anIndex)
+    {
+      new (&theNewData[anIndex]) TheItemType (std::move (myData[anIndex]));
+      myData[anIndex].~TheItemType();
+    }
+    Standard::Free (myData);
+    myData = theNewData;
+  }
+
+private:
+
+  TheItemType*     myData;     //!< memory block of the items
+  Standard_Integer mySize;     //!< number of items
+  Standard_Integer myCapacity; //!< number of items in the memory block
+
+};
+
+#endif
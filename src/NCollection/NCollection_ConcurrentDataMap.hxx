@@ -0,0 +1,386 @@
+// Copyright (c) 2024 OPEN CASCADE SAS
+//
+// This file is part of Open CASCADE Technology software library.
+//
+// This library is free software; you can redistribute it and/or modify it under
+// the terms of the GNU Lesser General Public License version 2.1 as published
+// by the Free Software Foundation, with special exception defined in the file
+// OCCT_LGPL_EXCEPTION.txt. Consult the file LICENSE_LGPL_21.txt included in OCCT
+// distribution for complete text of the license and disclaimer of any warranty.
+//
+// Alternatively, this file may be used under the terms of Open CASCADE
+// commercial license or contractual agreement.
+
+#ifndef NCollection_ConcurrentDataMap_HeaderFile
+#define NCollection_ConcurrentDataMap_HeaderFile
+
+#include <NCollection_DefaultHasher.hxx>
+#include <Standard.hxx>
+#include <Standard_Mutex.hxx>
+#include <Standard_NoSuchObject.hxx>
+
+#include <atomic>
+#include <new>
+
+/**
+ * Purpose:     The DataMap which can be filled and searched by several
+ *              threads concurrently, intended for the caches shared by
+ *              the threads of parallel algorithms.
+ *
+ *              The search (Seek(), Find(), IsBound()) takes no lock.
+ *              The binding locks only one of the segments of the map,
+ *              selected by the hash code of the key, so that the threads
+ *              binding different keys rarely wait for each other.
+ *
+ *              The bound item is never replaced nor removed while the map
+ *              is used concurrently: TryBind() does nothing if the key is
+ *              already bound, so the references to the items returned by
+ *              the map remain valid until Clear() or destruction of the map,
+ *              which must not be called concurrently with other methods.
+ *
+ *              Each segment has its own hash table of power-of-two size,
+ *              which is doubled when the number of keys exceeds the number
+ *              of buckets. The keys and items are never moved: on resizing
+ *              the new table of links to them is published, and the old one
+ *              is kept until Clear() for the threads still reading it.
+ *
+ *              The Hasher is the same as for NCollection_DataMap.
+ */
+template < class TheKeyType,
+           class TheItemType,
+           class Hasher = NCollection_DefaultHasher<TheKeyType> >
+class NCollection_ConcurrentDataMap
+{
+public:
+  //! STL-compliant typedef for key type
+  typedef TheKeyType key_type;
+  //! STL-compliant typedef for value type
+  typedef TheItemType value_type;
+
+private:
+  typedef NCollection_HasherTraits<TheKeyType, Hasher> HasherTraits;
+
+  //! Number of bits of the hash code defining the segment
+  static const int THE_SEGMENT_BITS = 6;
+
+  //! Number of segments
+  static const int THE_NB_SEGMENTS = 1 << THE_SEGMENT_BITS;
+
+  //! Minimal number of bits of the hash code defining the bucket in the segment
+  static const int THE_MIN_BUCKET_BITS = 3;
+
+  //! Maximal number of bits of the hash code defining the bucket in the segment
+  static const int THE_MAX_BUCKET_BITS = 26;
+
+  //! Bound key and item, allocated once and never moved
+  struct Entry
+  {
+    TheKeyType    Key;
+    TheItemType   Item;
+    Standard_Size HashCode;
+
+    Entry (const TheKeyType& theKey, const TheItemType& theItem, const Standard_Size theHashCode)
+    : Key (theKey), Item (theItem), HashCode (theHashCode) {}
+  };
+
+  //! Link to the entry in the bucket; immutable after publication
+  struct Link
+  {
+    const Link* Next;
+    Entry*      Value;
+  };
+
+  //! Hash table of the segment
+  struct Table
+  {
+    std::atomic<const Link*>* Buckets;    //!< heads of the lists of links
+    int                       NbBits;     //!< number of bits defining the bucket
+    Table*                    Retired;    //!< next table in the list of retired tables
+  };
+
+  //! Segment of the map
+  struct Segment
+  {
+    Standard_Mutex      Mutex;            //!< mutex protecting the binding
+    std::atomic<Table*> Current;          //!< current table
+    Table*              Retired;          //!< list of replaced tables kept for concurrent readers
+    std::atomic<int>    NbKeys;           //!< number of bound keys
+
+    Segment() : Current (NULL), Retired (NULL), NbKeys (0) {}
+  };
+
+public:
+
+  //! Constructor.
+  //! @param theNbBuckets expected number of keys used to define the initial size of the tables
+  explicit NCollection_ConcurrentDataMap (const Standard_Integer theNbBuckets = 1)
+  : myInitialBits (THE_MIN_BUCKET_BITS)
+  {
+    while (myInitialBits < THE_MAX_BUCKET_BITS
+        && (Standard_Integer (1) << (myInitialBits + THE_SEGMENT_BITS)) < theNbBuckets)
+    {
+      ++myInitialBits;
+    }
+  }
+
+  //! Destructor
+  ~NCollection_ConcurrentDataMap() { Clear(); }
+
+  //! Binds the item to the key if the key is not bound yet.
+  //! @return TRUE if the key has been bound by this call,
+  //!         FALSE if it has been already bound (the bound item is not changed)
+  Standard_Boolean TryBind (const TheKeyType& theKey, const TheItemType& theItem)
+  {
+    Standard_Boolean isBound = Standard_False;
+    bind (theKey, theItem, isBound);
+    return isBound;
+  }
+
+  //! Binds the item to the key if the key is not bound yet.
+  //! @return the item bound to the key, either by this call or earlier
+  const TheItemType& TryBound (const TheKeyType& theKey, const TheItemType& theItem)
+  {
+    Standard_Boolean isBound = Standard_False;
+    return bind (theKey, theItem, isBound)->Item;
+  }
+
+  //! Returns TRUE if the key is bound.
+  Standard_Boolean IsBound (const TheKeyType& theKey) const
+  {
+    return Seek (theKey) != NULL;
+  }
+
+  //! Returns the pointer to the item bound to the key or NULL if the key is not bound.
+  const TheItemType* Seek (const TheKeyType& theKey) const
+  {
+    const Standard_Size aHashCode = HasherTraits::HashCode (theKey);
+    const unsigned long long aMixed = mixHash (aHashCode);
+    const Table* aTable = mySegments[segmentIndex (aMixed)].Current.load (std::memory_order_acquire);
+    if (aTable == NULL)
+    {
+      return NULL;
+    }
+    for (const Link* aLink = aTable->Buckets[bucketIndex (aMixed, aTable->NbBits)].load (std::memory_order_acquire);
+         aLink != NULL; aLink = aLink->Next)
+    {
+      if (HasherTraits::IsEqual (aLink->Value->HashCode, aLink->Value->Key, aHashCode, theKey))
+      {
+        return &aLink->Value->Item;
+      }
+    }
+    return NULL;
+  }
+
+  //! Returns the item bound to the key; raises Standard_NoSuchObject if the key is not bound.
+  const TheItemType& Find (const TheKeyType& theKey) const
+  {
+    const TheItemType* anItem = Seek (theKey);
+    if (anItem == NULL)
+    {
+      throw Standard_NoSuchObject ("NCollection_ConcurrentDataMap::Find");
+    }
+    return *anItem;
+  }
+
+  //! Finds the item bound to the key and copies it into theValue.
+  //! @return FALSE if the key is not bound
+  Standard_Boolean Find (const TheKeyType& theKey, TheItemType& theValue) const
+  {
+    const TheItemType* anItem = Seek (theKey);
+    if (anItem == NULL)
+    {
+      return Standard_False;
+    }
+    theValue = *anItem;
+    return Standard_True;
+  }
+
+  //! Returns the item bound to the key.
+  const TheItemType& operator() (const TheKeyType& theKey) const { return Find (theKey); }
+
+  //! Returns the number of bound keys.
+  //! While the map is being filled concurrently, the value may not include the keys being bound.
+  Standard_Integer Extent() const
+  {
+    Standard_Integer aNbKeys = 0;
+    for (int aSegIter = 0; aSegIter < THE_NB_SEGMENTS; ++aSegIter)
+    {
+      aNbKeys += mySegments[aSegIter].NbKeys.load (std::memory_order_relaxed);
+    }
+    return aNbKeys;
+  }
+
+  //! Returns the number of bound keys.
+  Standard_Integer Size() const { return Extent(); }
+
+  //! Returns TRUE if there are no bound keys.
+  Standard_Boolean IsEmpty() const { return Extent() == 0; }
+
+  //! Removes all keys and releases the memory.
+  //! Must not be called concurrently with other methods.
+  void Clear()
+  {
+    for (int aSegIter = 0; aSegIter < THE_NB_SEGMENTS; ++aSegIter)
+    {
+      Segment& aSegment = mySegments[aSegIter];
+      Table* aTable = aSegment.Current.load (std::memory_order_relaxed);
+      if (aTable == NULL)
+      {
+        continue;
+      }
+
+      // the entries are referred by the current table only once
+      const Standard_Size aNbBuckets = Standard_Size (1) << aTable->NbBits;
+      for (Standard_Size aBucketIter = 0; aBucketIter < aNbBuckets; ++aBucketIter)
+      {
+        for (const Link* aLink = aTable->Buckets[aBucketIter].load (std::memory_order_relaxed);
+             aLink != NULL; aLink = aLink->Next)
+        {
+          aLink->Value->~Entry();
+          Standard::Free (aLink->Value);
+        }
+      }
+
+      aTable->Retired = aSegment.Retired;
+      while (aTable != NULL)
+      {
+        Table* aNext = aTable->Retired;
+        releaseTable (aTable);
+        aTable = aNext;
+      }
+      aSegment.Current.store (NULL, std::memory_order_relaxed);
+      aSegment.Retired = NULL;
+      aSegment.NbKeys.store (0, std::memory_order_relaxed);
+    }
+  }
+
+private:
+
+  //! Mixes the bits of the full-width hash code so that the upper bits can be used
+  static unsigned long long mixHash (const Standard_Size theHashCode)
+  {
+    return static_cast<unsigned long long> (theHashCode) * 0x9E3779B97F4A7C15ull;
+  }
+
+  //! Returns the index of the segment for the mixed hash code
+  static int segmentIndex (const unsigned long long theMixed)
+  {
+    return static_cast<int> (theMixed >> (64 - THE_SEGMENT_BITS));
+  }
+
+  //! Returns the index of the bucket for the mixed hash code
+  static Standard_Size bucketIndex (const unsigned long long theMixed, const int theNbBits)
+  {
+    return static_cast<Standard_Size> ((theMixed << THE_SEGMENT_BITS) >> (64 - theNbBits));
+  }
+
+  //! Binds the item to the key if it is not bound, returns the entry bound to the key
+  Entry* bind (const TheKeyType& theKey, const TheItemType& theItem, Standard_Boolean& theIsBound)
+  {
+    const Standard_Size aHashCode = HasherTraits::HashCode (theKey);
+    const unsigned long long aMixed = mixHash (aHashCode);
+    Segment& aSegment = mySegments[segmentIndex (aMixed)];
+
+    Standard_Mutex::Sentry aSentry (aSegment.Mutex);
+    Table* aTable = aSegment.Current.load (std::memory_order_relaxed);
+    if (aTable == NULL)
+    {
+      aTable = newTable (myInitialBits);
+      aSegment.Current.store (aTable, std::memory_order_release);
+    }
+
+    std::atomic<const Link*>* aBucket = &aTable->Buckets[bucketIndex (aMixed, aTable->NbBits)];
+    for (const Link* aLink = aBucket->load (std::memory_order_relaxed); aLink != NULL; aLink = aLink->Next)
+    {
+      if (HasherTraits::IsEqual (aLink->Value->HashCode, aLink->Value->Key, aHashCode, theKey))
+      {
+        return aLink->Value;
+      }
+    }
+
+    Entry* anEntry = new (Standard::Allocate (sizeof(Entry))) Entry (theKey, theItem, aHashCode);
+    const int aNbKeys = aSegment.NbKeys.load (std::memory_order_relaxed) + 1;
+    if (aNbKeys > (1 << aTable->NbBits) && aTable->NbBits < THE_MAX_BUCKET_BITS)
+    {
+      // publish the table of the doubled size with the new entry,
+      // the old table is kept for the threads reading it
+      Table* aNewTable = newTable (aTable->NbBits + 1);
+      const Standard_Size aNbBuckets = Standard_Size (1) << aTable->NbBits;
+      for (Standard_Size aBucketIter = 0; aBucketIter < aNbBuckets; ++aBucketIter)
+      {
+        for (const Link* aLink = aTable->Buckets[aBucketIter].load (std::memory_order_relaxed);
+             aLink != NULL; aLink = aLink->Next)
+        {
+          prependLink (*aNewTable, aLink->Value, std::memory_order_relaxed);
+        }
+      }
+      prependLink (*aNewTable, anEntry, std::memory_order_relaxed);
+      aTable->Retired = aSegment.Retired;
+      aSegment.Retired = aTable;
+      aSegment.Current.store (aNewTable, std::memory_order_release);
+    }
+    else
+    {
+      prependLink (*aTable, anEntry, std::memory_order_release);
+    }
+    aSegment.NbKeys.store (aNbKeys, std::memory_order_relaxed);
+    theIsBound = Standard_True;
+    return anEntry;
+  }
+
+  //! Creates the link to the entry and publishes it as the head of the bucket
+  static void prependLink (Table& theTable, Entry* theEntry, const std::memory_order theOrder)
+  {
+    std::atomic<const Link*>& aBucket = theTable.Buckets[bucketIndex (mixHash (theEntry->HashCode), theTable.NbBits)];
+    Link* aLink = (Link* )Standard::Allocate (sizeof(Link));
+    aLink->Next  = aBucket.load (std::memory_order_relaxed);
+    aLink->Value = theEntry;
+    aBucket.store (aLink, theOrder);
+  }
+
+  //! Allocates the empty table with 2^theNbBits buckets
+  static Table* newTable (const int theNbBits)
+  {
+    const Standard_Size aNbBuckets = Standard_Size (1) << theNbBits;
+    Table* aTable = (Table* )Standard::Allocate (sizeof(Table));
+    aTable->Buckets = (std::atomic<const Link*>* )Standard::Allocate (sizeof(std::atomic<const Link*>) * aNbBuckets);
+    for (Standard_Size aBucketIter = 0; aBucketIter < aNbBuckets; ++aBucketIter)
+    {
+      new (&aTable->Buckets[aBucketIter]) std::atomic<const Link*> (NULL);
+    }
+    aTable->NbBits  = theNbBits;
+    aTable->Retired = NULL;
+    return aTable;
+  }
+
+  //! Releases the table and its links (but not the entries)
+  static void releaseTable (Table* theTable)
+  {
+    const Standard_Size aNbBuckets = Standard_Size (1) << theTable->NbBits;
+    for (Standard_Size aBucketIter = 0; aBucketIter < aNbBuckets; ++aBucketIter)
+    {
+      for (const Link* aLink = theTable->Buckets[aBucketIter].load (std::memory_order_relaxed); aLink != NULL;)
+      {
+        const Link* aNext = aLink->Next;
+        Standard::Free ((void* )aLink);
+        aLink = aNext;
+      }
+    }
+    Standard::Free (theTable->Buckets);
+    Standard::Free (theTable);
+  }
+
+private:
+
+  //! Copying is not allowed
+  NCollection_ConcurrentDataMap (const NCollection_ConcurrentDataMap& );
+  NCollection_ConcurrentDataMap& operator= (const NCollection_ConcurrentDataMap& );
+
+private:
+
+  Segment mySegments[THE_NB_SEGMENTS]; //!< segments of the map
+  int     myInitialBits;               //!< number of bits of the bucket index of the new table
+
+};
+
+#endif
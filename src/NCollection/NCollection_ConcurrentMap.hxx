@@ -0,0 +1,76 @@
+// Copyright (c) 2024 OPEN CASCADE SAS
+//
+// This file is part of Open CASCADE Technology software library.
+//
+// This library is free software; you can redistribute it and/or modify it under
+// the terms of the GNU Lesser General Public License version 2.1 as published
+// by the Free Software Foundation, with special exception defined in the file
+// OCCT_LGPL_EXCEPTION.txt. Consult the file LICENSE_LGPL_21.txt included in OCCT
+// distribution for complete text of the license and disclaimer of any warranty.
+//
+// Alternatively, this file may be used under the terms of Open CASCADE
+// commercial license or contractual agreement.
+
+#ifndef NCollection_ConcurrentMap_HeaderFile
+#define NCollection_ConcurrentMap_HeaderFile
+
+#include <NCollection_ConcurrentDataMap.hxx>
+
+/**
+ * Purpose:     The Map (set of keys) which can be filled and searched
+ *              by several threads concurrently.
+ *              The search takes no lock, the addition of the key locks
+ *              only one segment of the map; the keys cannot be removed
+ *              while the map is used concurrently.
+ *              See NCollection_ConcurrentDataMap for details.
+ *
+ *              The Hasher is the same as for NCollection_Map.
+ */
+template < class TheKeyType,
+           class Hasher = NCollection_DefaultHasher<TheKeyType> >
+class NCollection_ConcurrentMap
+{
+public:
+  //! STL-compliant typedef for key type
+  typedef TheKeyType key_type;
+
+public:
+
+  //! Constructor.
+  //! @param theNbBuckets expected number of keys used to define the initial size of the tables
+  explicit NCollection_ConcurrentMap (const Standard_Integer theNbBuckets = 1)
+  : myMap (theNbBuckets) {}
+
+  //! Adds the key to the map.
+  //! @return TRUE if the key has been added by this call, FALSE if it was already in the map
+  Standard_Boolean Add (const TheKeyType& theKey) { return myMap.TryBind (theKey, Standard_True); }
+
+  //! Returns TRUE if the key is in the map.
+  Standard_Boolean Contains (const TheKeyType& theKey) const { return myMap.IsBound (theKey); }
+
+  //! Returns the number of keys.
+  Standard_Integer Extent() const { return myMap.Extent(); }
+
+  //! Returns the number of keys.
+  Standard_Integer Size() const { return myMap.Extent(); }
+
+  //! Returns TRUE if the map is empty.
+  Standard_Boolean IsEmpty() const { return myMap.IsEmpty(); }
+
+  //! Removes all keys and releases the memory.
+  //! Must not be called concurrently with other methods.
+  void Clear() { myMap.Clear(); }
+
+private:
+
+  //! Copying is not allowed
+  NCollection_ConcurrentMap (const NCollection_ConcurrentMap& );
+  NCollection_ConcurrentMap& operator= (const NCollection_ConcurrentMap& );
+
+private:
+
+  NCollection_ConcurrentDataMap<TheKeyType, Standard_Boolean, Hasher> myMap; //!< map of keys to dummy items
+
+};
+
+#endif
@@ -53,6 +53,9 @@ public:
   //! STL-compliant typedef for value type
   typedef TheItemType value_type;
 
+  //! Hash protocol of the map
+  typedef NCollection_HasherTraits<TheKeyType, Hasher> HasherTraits;
+
 public:
   // **************** Adaptation of the TListNode to the DATAmap
   class DataMapNode : public NCollection_TListNode<TheItemType>
@@ -60,15 +63,21 @@ public:
   public:
     //! Constructor with 'Next'
     DataMapNode (const TheKeyType&     theKey, 
+                 const Standard_Size   theHashCode,
                  const TheItemType&    theItem, 
                  NCollection_ListNode* theNext) :
       NCollection_TListNode<TheItemType> (theItem, theNext),
-      myKey(theKey)
+      myKey(theKey),
+      myHashCode(theHashCode)
     {}
 
     //! Key
     const TheKeyType& Key (void) const
     { return myKey; }
+
+    //! Full-width hash code of the key
+    Standard_Size HashCode() const
+    { return myHashCode; }
     
     //! Static deleter to be passed to BaseMap
     static void delNode (NCollection_ListNode * theNode, 
@@ -80,6 +89,7 @@ public:
 
   private:
     TheKeyType    myKey;
+    Standard_Size myHashCode;
   };
 
  public:
@@ -153,6 +163,11 @@ public:
     : NCollection_BaseMap (theOther.NbBuckets(), Standard_True, theOther.myAllocator) 
   { *this = theOther; }
 
+  //! Move constructor
+  NCollection_DataMap (NCollection_DataMap&& theOther)
+  : NCollection_BaseMap (1, Standard_True, theOther.myAllocator)
+  { Exchange (theOther); }
+
   //! Exchange the content of two maps without re-allocations.
   //! Notice that allocators will be swapped as well!
   void Exchange (NCollection_DataMap& theOther)
@@ -185,6 +200,19 @@ public:
     return Assign (theOther);
   }
 
+  //! Move operator; the content is taken from the other map when it
+  //! shares the allocator with this map, otherwise it is copied
+  NCollection_DataMap& operator= (NCollection_DataMap&& theOther)
+  {
+    if (this != &theOther && this->myAllocator == theOther.myAllocator)
+    {
+      Clear();
+      Exchange (theOther);
+      return *this;
+    }
+    return Assign (theOther);
+  }
+
   //! ReSize
   void ReSize (const Standard_Integer N)
   {
@@ -205,7 +233,7 @@ public:
             p = olddata[i];
             while (p) 
             {
-              k = Hasher::HashCode(p->Key(),newBuck);
+              k = HasherTraits::Bucket(p->HashCode(),newBuck);
               q = (DataMapNode*) p->Next();
               p->Next() = newdata[k];
               newdata[k] = p;
@@ -227,18 +255,19 @@ public:
     if (Resizable()) 
       ReSize(Extent());
     DataMapNode** data = (DataMapNode**)myData1;
-    Standard_Integer k = Hasher::HashCode (theKey, NbBuckets());
+    const Standard_Size aHash = HasherTraits::HashCode (theKey);
+    Standard_Integer k = HasherTraits::Bucket (aHash, NbBuckets());
     DataMapNode* p = data[k];
     while (p) 
     {
-      if (Hasher::IsEqual(p->Key(), theKey))
+      if (HasherTraits::IsEqual(p->HashCode(), p->Key(), aHash, theKey))
       {
         p->ChangeValue() = theItem;
         return Standard_False;
       }
       p = (DataMapNode *) p->Next();
     }
-    data[k] = new (this->myAllocator) DataMapNode (theKey, theItem, data[k]);
+    data[k] = new (this->myAllocator) DataMapNode (theKey, aHash, theItem, data[k]);
     Increment();
     return Standard_True;
   }
@@ -249,18 +278,19 @@ public:
     if (Resizable()) 
       ReSize(Extent());
     DataMapNode** data = (DataMapNode**)myData1;
-    Standard_Integer k = Hasher::HashCode (theKey, NbBuckets());
+    const Standard_Size aHash = HasherTraits::HashCode (theKey);
+    Standard_Integer k = HasherTraits::Bucket (aHash, NbBuckets());
     DataMapNode* p = data[k];
     while (p)
     {
-      if (Hasher::IsEqual(p->Key(), theKey))
+      if (HasherTraits::IsEqual(p->HashCode(), p->Key(), aHash, theKey))
       {
         p->ChangeValue() = theItem;
         return &p->ChangeValue();
       }
       p = (DataMapNode*)p->Next();
     }
-    data[k] = new (this->myAllocator) DataMapNode (theKey, theItem, data[k]);
+    data[k] = new (this->myAllocator) DataMapNode (theKey, aHash, theItem, data[k]);
     Increment();
     return &data[k]->ChangeValue();
   }
@@ -278,12 +308,13 @@ public:
     if (IsEmpty()) 
       return Standard_False;
     DataMapNode** data = (DataMapNode**) myData1;
-    Standard_Integer k = Hasher::HashCode(theKey,NbBuckets());
+    const Standard_Size aHash = HasherTraits::HashCode (theKey);
+    Standard_Integer k = HasherTraits::Bucket (aHash, NbBuckets());
     DataMapNode* p = data[k];
     DataMapNode* q = NULL;
     while (p) 
     {
-      if (Hasher::IsEqual(p->Key(), theKey))
+      if (HasherTraits::IsEqual(p->HashCode(), p->Key(), aHash, theKey))
       {
         Decrement();
         if (q) 
@@ -390,10 +421,11 @@ public:
   {
     if (IsEmpty())
       return Standard_False; // Not found
-    for (thepNode = (DataMapNode*)myData1[Hasher::HashCode(theKey, NbBuckets())];
+    const Standard_Size aHash = HasherTraits::HashCode (theKey);
+    for (thepNode = (DataMapNode*)myData1[HasherTraits::Bucket(aHash, NbBuckets())];
          thepNode; thepNode = (DataMapNode*)thepNode->Next())
     {
-      if (Hasher::IsEqual(thepNode->Key(), theKey)) 
+      if (HasherTraits::IsEqual(thepNode->HashCode(), thepNode->Key(), aHash, theKey)) 
         return Standard_True;
     }
     return Standard_False; // Not found
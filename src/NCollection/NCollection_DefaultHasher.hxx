@@ -84,4 +84,73 @@ public:
   }
 };
 
+/**
+ * Purpose:     The HasherTraits define the hash protocol used by the
+ *              NCollection maps on top of the given Hasher.
+ *
+ *              The maps work with the full-width hash codes of type
+ *              Standard_Size, which are stored in the nodes and reused
+ *              on resizing and for fast rejection of unequal keys.
+ *              Such hash code is provided by the Hasher defining
+ *
+ *                static Standard_Size HashCode (const TheKeyType& theKey);
+ *
+ *              For the legacy Hasher, providing only the hash code
+ *              reduced to the range [1, theUpperBound]:
+ *
+ *                static Standard_Integer HashCode (const TheKeyType& theKey,
+ *                                                  const Standard_Integer theUpperBound);
+ *
+ *              the full-width hash code is computed with the largest upper
+ *              bound and shifted to start from zero, so that the keys are
+ *              distributed in the buckets in the same way as before.
+ *              The Hasher may define both functions to be usable with
+ *              the code calling the legacy one directly.
+*/
+template <class TheKeyType, class Hasher> class NCollection_HasherTraits
+{
+private:
+
+  //! Detects the Hasher providing the full-width hash code
+  template <class THasher>
+  static auto hashCode (const TheKeyType& theKey, int)
+    -> decltype (static_cast<Standard_Size> (THasher::HashCode (theKey)))
+  {
+    return static_cast<Standard_Size> (THasher::HashCode (theKey));
+  }
+
+  //! Adapts the legacy Hasher
+  template <class THasher>
+  static Standard_Size hashCode (const TheKeyType& theKey, long)
+  {
+    return static_cast<Standard_Size> (THasher::HashCode (theKey, IntegerLast()) - 1);
+  }
+
+public:
+
+  //! Returns the full-width hash code of the key
+  static Standard_Size HashCode (const TheKeyType& theKey)
+  {
+    return hashCode<Hasher> (theKey, 0);
+  }
+
+  //! Returns the index of the bucket in the range [1, theNbBuckets]
+  //! for the given full-width hash code
+  static Standard_Integer Bucket (const Standard_Size theHashCode,
+                                  const Standard_Integer theNbBuckets)
+  {
+    return static_cast<Standard_Integer> (theHashCode % static_cast<Standard_Size> (theNbBuckets)) + 1;
+  }
+
+  //! Returns true if the keys with the given hash codes are equal
+  static Standard_Boolean IsEqual (const Standard_Size theHashCode1,
+                                   const TheKeyType&   theKey1,
+                                   const Standard_Size theHashCode2,
+                                   const TheKeyType&   theKey2)
+  {
+    return theHashCode1 == theHashCode2
+        && Hasher::IsEqual (theKey1, theKey2);
+  }
+};
+
 #endif
@@ -42,6 +42,9 @@ public:
   typedef TheKey1Type key1_type;
   //! STL-compliant typedef for key2 type
   typedef TheKey2Type key2_type;
+  //! Adaptors of the hashers of the keys
+  typedef NCollection_HasherTraits<TheKey1Type, Hasher1> HasherTraits1;
+  typedef NCollection_HasherTraits<TheKey2Type, Hasher2> HasherTraits2;
 
 public:
   // **************** Adaptation of the TListNode to the DOUBLEmap
@@ -51,10 +54,14 @@ public:
     //! Constructor with 'Next'
     DoubleMapNode (const TheKey1Type&    theKey1, 
                    const TheKey2Type&    theKey2, 
+                   const Standard_Size   theHashCode1,
+                   const Standard_Size   theHashCode2,
                    NCollection_ListNode* theNext1, 
                    NCollection_ListNode* theNext2) :
       NCollection_TListNode<TheKey2Type> (theKey2, theNext1),
       myKey1(theKey1),
+      myHashCode1(theHashCode1),
+      myHashCode2(theHashCode2),
       myNext2((DoubleMapNode*)theNext2)
     { 
     }
@@ -64,6 +71,12 @@ public:
     //! Key2
     const TheKey2Type& Key2 (void)
     { return this->myValue; }
+    //! Full-width hash code of Key1
+    Standard_Size HashCode1() const
+    { return myHashCode1; }
+    //! Full-width hash code of Key2
+    Standard_Size HashCode2() const
+    { return myHashCode2; }
     //! Next2
     DoubleMapNode*& Next2 (void)
     { return myNext2; }
@@ -78,6 +91,8 @@ public:
 
   private:
     TheKey1Type    myKey1;
+    Standard_Size  myHashCode1;
+    Standard_Size  myHashCode2;
     DoubleMapNode *myNext2;
   };
 
@@ -157,9 +172,11 @@ public:
       {
         TheKey1Type aKey1 = anIter.Key1();
         TheKey2Type aKey2 = anIter.Key2();
-        Standard_Integer iK1 = Hasher1::HashCode (aKey1, NbBuckets());
-        Standard_Integer iK2 = Hasher2::HashCode (aKey2, NbBuckets());
-        DoubleMapNode * pNode = new (this->myAllocator) DoubleMapNode (aKey1, aKey2, 
+        const Standard_Size aHash1 = HasherTraits1::HashCode (aKey1);
+        const Standard_Size aHash2 = HasherTraits2::HashCode (aKey2);
+        Standard_Integer iK1 = HasherTraits1::Bucket (aHash1, NbBuckets());
+        Standard_Integer iK2 = HasherTraits2::Bucket (aHash2, NbBuckets());
+        DoubleMapNode * pNode = new (this->myAllocator) DoubleMapNode (aKey1, aKey2, aHash1, aHash2,
           myData1[iK1], 
           myData2[iK2]);
         myData1[iK1] = pNode;
@@ -195,8 +212,8 @@ public:
             p = (DoubleMapNode *) myData1[i];
             while (p) 
             {
-              iK1 = Hasher1::HashCode (p->Key1(), newBuck);
-              iK2 = Hasher2::HashCode (p->Key2(), newBuck);
+              iK1 = HasherTraits1::Bucket (p->HashCode1(), newBuck);
+              iK2 = HasherTraits2::Bucket (p->HashCode2(), newBuck);
               q = (DoubleMapNode*) p->Next();
               p->Next()  = ppNewData1[iK1];
               p->Next2() = (DoubleMapNode*)ppNewData2[iK2];
@@ -216,24 +233,26 @@ public:
   {
     if (Resizable()) 
       ReSize(Extent());
-    Standard_Integer iK1 = Hasher1::HashCode (theKey1, NbBuckets());
-    Standard_Integer iK2 = Hasher2::HashCode (theKey2, NbBuckets());
+    const Standard_Size aHash1 = HasherTraits1::HashCode (theKey1);
+    const Standard_Size aHash2 = HasherTraits2::HashCode (theKey2);
+    Standard_Integer iK1 = HasherTraits1::Bucket (aHash1, NbBuckets());
+    Standard_Integer iK2 = HasherTraits2::Bucket (aHash2, NbBuckets());
     DoubleMapNode * pNode;
     pNode = (DoubleMapNode *) myData1[iK1];
     while (pNode) 
     {
-      if (Hasher1::IsEqual (pNode->Key1(), theKey1))
+      if (HasherTraits1::IsEqual (pNode->HashCode1(), pNode->Key1(), aHash1, theKey1))
         throw Standard_MultiplyDefined("NCollection_DoubleMap:Bind");
       pNode = (DoubleMapNode *) pNode->Next();
     }
     pNode = (DoubleMapNode *) myData2[iK2];
     while (pNode) 
     {
-      if (Hasher2::IsEqual (pNode->Key2(), theKey2))
+      if (HasherTraits2::IsEqual (pNode->HashCode2(), pNode->Key2(), aHash2, theKey2))
         throw Standard_MultiplyDefined("NCollection_DoubleMap:Bind");
-      pNode = (DoubleMapNode *) pNode->Next();
+      pNode = (DoubleMapNode *) pNode->Next2();
     }
-    pNode = new (this->myAllocator) DoubleMapNode (theKey1, theKey2, 
+    pNode = new (this->myAllocator) DoubleMapNode (theKey1, theKey2, aHash1, aHash2,
                                                    myData1[iK1], myData2[iK2]);
     myData1[iK1] = pNode;
     myData2[iK2] = pNode;
@@ -246,13 +265,15 @@ public:
   {
     if (IsEmpty()) 
       return Standard_False;
-    Standard_Integer iK1 = Hasher1::HashCode (theKey1, NbBuckets());
-    Standard_Integer iK2 = Hasher2::HashCode (theKey2, NbBuckets());
+    const Standard_Size aHash1 = HasherTraits1::HashCode (theKey1);
+    const Standard_Size aHash2 = HasherTraits2::HashCode (theKey2);
+    Standard_Integer iK1 = HasherTraits1::Bucket (aHash1, NbBuckets());
+    Standard_Integer iK2 = HasherTraits2::Bucket (aHash2, NbBuckets());
     DoubleMapNode * pNode1, * pNode2;
     pNode1 = (DoubleMapNode *) myData1[iK1];
     while (pNode1) 
     {
-      if (Hasher1::IsEqual(pNode1->Key1(), theKey1)) 
+      if (HasherTraits1::IsEqual (pNode1->HashCode1(), pNode1->Key1(), aHash1, theKey1))
         break;
       pNode1 = (DoubleMapNode *) pNode1->Next();
     }
@@ -261,9 +282,9 @@ public:
     pNode2 = (DoubleMapNode *) myData2[iK2];
     while (pNode2) 
     {
-      if (Hasher2::IsEqual(pNode2->Key2(), theKey2)) 
+      if (HasherTraits2::IsEqual (pNode2->HashCode2(), pNode2->Key2(), aHash2, theKey2))
         break;
-      pNode2 = (DoubleMapNode *) pNode2->Next();
+      pNode2 = (DoubleMapNode *) pNode2->Next2();
     }
     if (pNode2 == NULL)
       return Standard_False;
@@ -276,12 +297,13 @@ public:
   {
     if (IsEmpty()) 
       return Standard_False;
-    Standard_Integer iK1 = Hasher1::HashCode (theKey1, NbBuckets());
+    const Standard_Size aHash1 = HasherTraits1::HashCode (theKey1);
+    Standard_Integer iK1 = HasherTraits1::Bucket (aHash1, NbBuckets());
     DoubleMapNode * pNode1;
     pNode1 = (DoubleMapNode *) myData1[iK1];
     while (pNode1) 
     {
-      if (Hasher1::IsEqual(pNode1->Key1(), theKey1)) 
+      if (HasherTraits1::IsEqual (pNode1->HashCode1(), pNode1->Key1(), aHash1, theKey1))
         return Standard_True;
       pNode1 = (DoubleMapNode *) pNode1->Next();
     }
@@ -293,12 +315,13 @@ public:
   {
     if (IsEmpty()) 
       return Standard_False;
-    Standard_Integer iK2 = Hasher2::HashCode (theKey2, NbBuckets());
+    const Standard_Size aHash2 = HasherTraits2::HashCode (theKey2);
+    Standard_Integer iK2 = HasherTraits2::Bucket (aHash2, NbBuckets());
     DoubleMapNode * pNode2;
     pNode2 = (DoubleMapNode *) myData2[iK2];
     while (pNode2) 
     {
-      if (Hasher2::IsEqual(pNode2->Key2(), theKey2)) 
+      if (HasherTraits2::IsEqual (pNode2->HashCode2(), pNode2->Key2(), aHash2, theKey2))
         return Standard_True;
       pNode2 = (DoubleMapNode *) pNode2->Next2();
     }
@@ -310,20 +333,21 @@ public:
   {
     if (IsEmpty()) 
       return Standard_False;
-    Standard_Integer iK1 = Hasher1::HashCode (theKey1, NbBuckets());
+    const Standard_Size aHash1 = HasherTraits1::HashCode (theKey1);
+    Standard_Integer iK1 = HasherTraits1::Bucket (aHash1, NbBuckets());
     DoubleMapNode * p1, * p2, * q1, *q2;
     q1 = q2 = NULL;
     p1 = (DoubleMapNode *) myData1[iK1];
     while (p1) 
     {
-      if (Hasher1::IsEqual (p1->Key1(), theKey1)) 
+      if (HasherTraits1::IsEqual (p1->HashCode1(), p1->Key1(), aHash1, theKey1))
       {
         // remove from the data1
         if (q1) 
           q1->Next() = p1->Next();
         else
           myData1[iK1] = (DoubleMapNode*) p1->Next();
-        Standard_Integer iK2 = Hasher2::HashCode (p1->Key2(), NbBuckets());
+        Standard_Integer iK2 = HasherTraits2::Bucket (p1->HashCode2(), NbBuckets());
         p2 = (DoubleMapNode *) myData2[iK2];
         while (p2)
         {
@@ -355,20 +379,21 @@ public:
   {
     if (IsEmpty()) 
       return Standard_False;
-    Standard_Integer iK2 = Hasher2::HashCode (theKey2, NbBuckets());
+    const Standard_Size aHash2 = HasherTraits2::HashCode (theKey2);
+    Standard_Integer iK2 = HasherTraits2::Bucket (aHash2, NbBuckets());
     DoubleMapNode * p1, * p2, * q1, *q2;
     q1 = q2 = NULL;
     p2 = (DoubleMapNode *) myData2[iK2];
     while (p2) 
     {
-      if (Hasher2::IsEqual (p2->Key2(), theKey2)) 
+      if (HasherTraits2::IsEqual (p2->HashCode2(), p2->Key2(), aHash2, theKey2))
       {
         // remove from the data2
         if (q2)
-          q2->Next() = p2->Next();
+          q2->Next2() = p2->Next2();
         else
           myData2[iK2] = (DoubleMapNode*) p2->Next2();
-        Standard_Integer iK1 = Hasher1::HashCode (p2->Key1(), NbBuckets());
+        Standard_Integer iK1 = HasherTraits1::Bucket (p2->HashCode1(), NbBuckets());
         p1 = (DoubleMapNode *) myData1[iK1];
         while (p1)
         {
@@ -426,10 +451,15 @@ public:
   //! @return pointer to Key2 or NULL if Key1 is not found
   const TheKey2Type* Seek1 (const TheKey1Type& theKey1) const
   {
-    for (DoubleMapNode* aNode1 = !IsEmpty() ? (DoubleMapNode* )myData1[Hasher1::HashCode (theKey1, NbBuckets())] : NULL;
+    if (IsEmpty())
+    {
+      return NULL;
+    }
+    const Standard_Size aHash1 = HasherTraits1::HashCode (theKey1);
+    for (DoubleMapNode* aNode1 = (DoubleMapNode* )myData1[HasherTraits1::Bucket (aHash1, NbBuckets())];
          aNode1 != NULL; aNode1 = (DoubleMapNode* )aNode1->Next())
     {
-      if (Hasher1::IsEqual (aNode1->Key1(), theKey1))
+      if (HasherTraits1::IsEqual (aNode1->HashCode1(), aNode1->Key1(), aHash1, theKey1))
       {
         return &aNode1->Key2();
       }
@@ -468,10 +498,15 @@ public:
   //! @return pointer to Key1 if Key2 has been found
   const TheKey1Type* Seek2 (const TheKey2Type& theKey2) const
   {
-    for (DoubleMapNode* aNode2 = !IsEmpty() ? (DoubleMapNode* )myData2[Hasher2::HashCode (theKey2, NbBuckets())] : NULL;
+    if (IsEmpty())
+    {
+      return NULL;
+    }
+    const Standard_Size aHash2 = HasherTraits2::HashCode (theKey2);
+    for (DoubleMapNode* aNode2 = (DoubleMapNode* )myData2[HasherTraits2::Bucket (aHash2, NbBuckets())];
          aNode2 != NULL; aNode2 = (DoubleMapNode* )aNode2->Next2())
     {
-      if (Hasher2::IsEqual (aNode2->Key2(), theKey2))
+      if (HasherTraits2::IsEqual (aNode2->HashCode2(), aNode2->Key2(), aHash2, theKey2))
       {
         return &aNode2->Key1();
       }
@@ -0,0 +1,361 @@
+// Copyright (c) 2024 OPEN CASCADE SAS
+//
+// This file is part of Open CASCADE Technology software library.
+//
+// This library is free software; you can redistribute it and/or modify it under
+// the terms of the GNU Lesser General Public License version 2.1 as published
+// by the Free Software Foundation, with special exception defined in the file
+// OCCT_LGPL_EXCEPTION.txt. Consult the file LICENSE_LGPL_21.txt included in OCCT
+// distribution for complete text of the license and disclaimer of any warranty.
+//
+// Alternatively, this file may be used under the terms of Open CASCADE
+// commercial license or contractual agreement.
+
+#ifndef NCollection_FlatDataMap_HeaderFile
+#define NCollection_FlatDataMap_HeaderFile
+
+#include <NCollection_BaseFlatMap.hxx>
+#include <NCollection_StlIterator.hxx>
+#include <NCollection_DefaultHasher.hxx>
+
+#include <Standard_NoSuchObject.hxx>
+
+/**
+ * Purpose:     The DataMap with open addressing.
+ *              It has the same interface as NCollection_DataMap and
+ *              can be used instead of it, but keeps the pairs of keys
+ *              and items in the contiguous array instead of the
+ *              separately allocated nodes, which makes it faster and
+ *              more compact (see NCollection_BaseFlatMap for details).
+ *
+ *              The removal of the key moves the last bound pair
+ *              in its place, thus the order of iteration changes.
+ *              The references to the keys and items are invalidated
+ *              by the binding and unbinding of the keys.
+ *
+ *              The Hasher is the same as for NCollection_DataMap.
+ */
+template < class TheKeyType,
+           class TheItemType,
+           class Hasher = NCollection_DefaultHasher<TheKeyType> >
+class NCollection_FlatDataMap : public NCollection_BaseFlatMap
+{
+public:
+  //! STL-compliant typedef for key type
+  typedef TheKeyType key_type;
+  //! STL-compliant typedef for value type
+  typedef TheItemType value_type;
+
+protected:
+  //! Pair of key and item stored in the map
+  struct Entry
+  {
+    TheKeyType  Key;
+    TheItemType Item;
+
+    Entry (const TheKeyType& theKey, const TheItemType& theItem)
+    : Key (theKey), Item (theItem) {}
+  };
+
+public:
+  //!   Implementation of the Iterator interface.
+  class Iterator
+  {
+  public:
+    //! Empty constructor
+    Iterator (void) :
+      myEntries (NULL),
+      myIndex (0),
+      myExtent (0) {}
+
+    //! Constructor
+    Iterator (const NCollection_FlatDataMap& theMap) :
+      myEntries (theMap.myEntries),
+      myIndex (0),
+      myExtent (theMap.Extent()) {}
+
+    //! Query if the end of collection is reached by iterator
+    Standard_Boolean More(void) const
+    { return myIndex < myExtent; }
+
+    //! Make a step along the collection
+    void Next(void)
+    { ++myIndex; }
+
+    //! Value inquiry
+    const TheItemType& Value(void) const
+    {
+      Standard_NoSuchObject_Raise_if (!More(), "NCollection_FlatDataMap::Iterator::Value");
+      return myEntries[myIndex].Item;
+    }
+
+    //! Value change access
+    TheItemType& ChangeValue(void) const
+    {
+      Standard_NoSuchObject_Raise_if (!More(), "NCollection_FlatDataMap::Iterator::ChangeValue");
+      return myEntries[myIndex].Item;
+    }
+
+    //! Key
+    const TheKeyType& Key (void) const
+    {
+      Standard_NoSuchObject_Raise_if (!More(), "NCollection_FlatDataMap::Iterator::Key");
+      return myEntries[myIndex].Key;
+    }
+
+    //! Performs comparison of two iterators.
+    Standard_Boolean IsEqual (const Iterator& theOther) const
+    { return myEntries == theOther.myEntries && myIndex == theOther.myIndex; }
+
+  private:
+    Entry*           myEntries; //!< entries of the map
+    Standard_Integer myIndex;   //!< current position
+    Standard_Integer myExtent;  //!< number of entries
+  };
+
+  //! Shorthand for a regular iterator type.
+  typedef NCollection_StlIterator<std::forward_iterator_tag, Iterator, TheItemType, false> iterator;
+
+  //! Shorthand for a constant iterator type.
+  typedef NCollection_StlIterator<std::forward_iterator_tag, Iterator, TheItemType, true> const_iterator;
+
+  //! Returns an iterator pointing to the first element in the map.
+  iterator begin() const { return Iterator (*this); }
+
+  //! Returns an iterator referring to the past-the-end element in the map.
+  iterator end() const { return Iterator(); }
+
+  //! Returns a const iterator pointing to the first element in the map.
+  const_iterator cbegin() const { return Iterator (*this); }
+
+  //! Returns a const iterator referring to the past-the-end element in the map.
+  const_iterator cend() const { return Iterator(); }
+
+public:
+  // ---------- PUBLIC METHODS ------------
+
+  //! Empty constructor.
+  NCollection_FlatDataMap()
+  : NCollection_BaseFlatMap (Handle(NCollection_BaseAllocator)()),
+    myEntries (NULL) {}
+
+  //! Constructor
+  explicit NCollection_FlatDataMap (const Standard_Integer theNbBuckets,
+                                    const Handle(NCollection_BaseAllocator)& theAllocator = 0L)
+  : NCollection_BaseFlatMap (theAllocator),
+    myEntries (NULL)
+  {
+    ReSize (theNbBuckets);
+  }
+
+  //! Copy constructor
+  NCollection_FlatDataMap (const NCollection_FlatDataMap& theOther)
+  : NCollection_BaseFlatMap (theOther.myAllocator),
+    myEntries (NULL)
+  { *this = theOther; }
+
+  //! Exchange the content of two maps without re-allocations.
+  //! Notice that allocators will be swapped as well!
+  void Exchange (NCollection_FlatDataMap& theOther)
+  {
+    this->exchangeMapsData (theOther);
+    std::swap (myEntries, theOther.myEntries);
+  }
+
+  //! Assignment.
+  //! This method does not change the internal allocator.
+  NCollection_FlatDataMap& Assign (const NCollection_FlatDataMap& theOther)
+  {
+    if (this == &theOther)
+      return *this;
+
+    Clear (Standard_False);
+    ReSize (theOther.Extent());
+    for (Standard_Integer anIndex = 1; anIndex <= theOther.Extent(); ++anIndex)
+    {
+      new (&myEntries[anIndex - 1]) Entry (theOther.myEntries[anIndex - 1]);
+      appendEntry (theOther.entryHash (anIndex));
+    }
+    return *this;
+  }
+
+  //! Assignment operator
+  NCollection_FlatDataMap& operator= (const NCollection_FlatDataMap& theOther)
+  {
+    return Assign (theOther);
+  }
+
+  //! ReSize: reserves the room for the given number of keys
+  void ReSize (const Standard_Integer theExtent)
+  {
+    const Standard_Integer aNbSlots = nbSlotsFor (theExtent);
+    if (aNbSlots <= NbBuckets())
+      return;
+    reallocEntries (myEntries, capacityFor (aNbSlots));
+    resizeTable (aNbSlots);
+  }
+
+  //! Bind binds Item to Key in map.
+  //! @param theKey  key to add/update
+  //! @param theItem new item; overrides value previously bound to the key, if any
+  //! @return Standard_True if Key was not bound already
+  Standard_Boolean Bind (const TheKeyType& theKey, const TheItemType& theItem)
+  {
+    const Standard_Size aHash = hashCode (theKey);
+    const Standard_Integer anIndex = lookup (theKey, aHash);
+    if (anIndex != 0)
+    {
+      myEntries[anIndex - 1].Item = theItem;
+      return Standard_False;
+    }
+    append (theKey, theItem, aHash);
+    return Standard_True;
+  }
+
+  //! Bound binds Item to Key in map. Returns modifiable Item
+  TheItemType* Bound (const TheKeyType& theKey, const TheItemType& theItem)
+  {
+    const Standard_Size aHash = hashCode (theKey);
+    Standard_Integer anIndex = lookup (theKey, aHash);
+    if (anIndex != 0)
+      myEntries[anIndex - 1].Item = theItem;
+    else
+      anIndex = append (theKey, theItem, aHash);
+    return &myEntries[anIndex - 1].Item;
+  }
+
+  //! IsBound
+  Standard_Boolean IsBound (const TheKeyType& theKey) const
+  {
+    return lookup (theKey, hashCode (theKey)) != 0;
+  }
+
+  //! UnBind removes Item Key pair from map
+  Standard_Boolean UnBind (const TheKeyType& theKey)
+  {
+    const Standard_Integer anIndex = lookup (theKey, hashCode (theKey));
+    if (anIndex == 0)
+      return Standard_False;
+    const Standard_Integer aMoved = removeEntry (anIndex);
+    if (aMoved != 0)
+    {
+      myEntries[anIndex - 1].Key  = std::move (myEntries[aMoved - 1].Key);
+      myEntries[anIndex - 1].Item = std::move (myEntries[aMoved - 1].Item);
+    }
+    myEntries[Extent()].~Entry();
+    return Standard_True;
+  }
+
+  //! Seek returns pointer to Item by Key. Returns
+  //! NULL is Key was not bound.
+  const TheItemType* Seek (const TheKeyType& theKey) const
+  {
+    const Standard_Integer anIndex = lookup (theKey, hashCode (theKey));
+    return anIndex != 0 ? &myEntries[anIndex - 1].Item : 0L;
+  }
+
+  //! Find returns the Item for Key. Raises if Key was not bound
+  const TheItemType& Find (const TheKeyType& theKey) const
+  {
+    const Standard_Integer anIndex = lookup (theKey, hashCode (theKey));
+    if (anIndex == 0)
+      throw Standard_NoSuchObject ("NCollection_FlatDataMap::Find");
+    return myEntries[anIndex - 1].Item;
+  }
+
+  //! Find Item for key with copying.
+  //! @return true if key was found
+  Standard_Boolean Find (const TheKeyType& theKey,
+                         TheItemType&      theValue) const
+  {
+    const Standard_Integer anIndex = lookup (theKey, hashCode (theKey));
+    if (anIndex == 0)
+      return Standard_False;
+    theValue = myEntries[anIndex - 1].Item;
+    return Standard_True;
+  }
+
+  //! operator ()
+  const TheItemType& operator() (const TheKeyType& theKey) const
+  { return Find (theKey); }
+
+  //! ChangeSeek returns modifiable pointer to Item by Key. Returns
+  //! NULL is Key was not bound.
+  TheItemType* ChangeSeek (const TheKeyType& theKey)
+  {
+    const Standard_Integer anIndex = lookup (theKey, hashCode (theKey));
+    return anIndex != 0 ? &myEntries[anIndex - 1].Item : 0L;
+  }
+
+  //! ChangeFind returns modifiable Item by Key. Raises if Key was not bound
+  TheItemType& ChangeFind (const TheKeyType& theKey)
+  {
+    const Standard_Integer anIndex = lookup (theKey, hashCode (theKey));
+    if (anIndex == 0)
+      throw Standard_NoSuchObject ("NCollection_FlatDataMap::Find");
+    return myEntries[anIndex - 1].Item;
+  }
+
+  //! operator ()
+  TheItemType& operator() (const TheKeyType& theKey)
+  { return ChangeFind (theKey); }
+
+  //! Clear data. If doReleaseMemory is false then the table of
+  //! slots is not released and will be reused.
+  void Clear (const Standard_Boolean doReleaseMemory = Standard_True)
+  {
+    destroyEntries (myEntries, doReleaseMemory);
+    clearTable (doReleaseMemory);
+  }
+
+  //! Clear data and reset allocator
+  void Clear (const Handle(NCollection_BaseAllocator)& theAllocator)
+  {
+    Clear();
+    this->myAllocator = ( ! theAllocator.IsNull() ? theAllocator :
+                    NCollection_BaseAllocator::CommonBaseAllocator() );
+  }
+
+  //! Destructor
+  virtual ~NCollection_FlatDataMap (void)
+  { Clear(); }
+
+  //! Size
+  Standard_Integer Size (void) const
+  { return Extent(); }
+
+protected:
+  // ---------- PROTECTED METHODS ----------
+
+  //! Computes the hash code of the key
+  static Standard_Size hashCode (const TheKeyType& theKey)
+  { return NCollection_HasherTraits<TheKeyType, Hasher>::HashCode (theKey); }
+
+  //! Returns the index of the key or 0 if it is not bound
+  Standard_Integer lookup (const TheKeyType& theKey,
+                           const Standard_Size theHash) const
+  {
+    for (ProbeIterator anIter (*this, theHash); anIter.More(); anIter.Next())
+    {
+      if (Hasher::IsEqual (myEntries[anIter.Index() - 1].Key, theKey))
+        return anIter.Index();
+    }
+    return 0;
+  }
+
+  //! Appends the new pair, returns its index
+  Standard_Integer append (const TheKeyType&  theKey,
+                           const TheItemType& theItem,
+                           const Standard_Size theHash)
+  {
+    if (isFull())
+      ReSize (Extent() + 1);
+    new (&myEntries[Extent()]) Entry (theKey, theItem);
+    return appendEntry (theHash);
+  }
+
+private:
+  Entry* myEntries; //!< array of pairs of keys and items
+};
+
+#endif
@@ -0,0 +1,318 @@
+// Copyright (c) 2024 OPEN CASCADE SAS
+//
+// This file is part of Open CASCADE Technology software library.
+//
+// This library is free software; you can redistribute it and/or modify it under
+// the terms of the GNU Lesser General Public License version 2.1 as published
+// by the Free Software Foundation, with special exception defined in the file
+// OCCT_LGPL_EXCEPTION.txt. Consult the file LICENSE_LGPL_21.txt included in OCCT
+// distribution for complete text of the license and disclaimer of any warranty.
+//
+// Alternatively, this file may be used under the terms of Open CASCADE
+// commercial license or contractual agreement.
+
+#ifndef NCollection_FlatIndexedMap_HeaderFile
+#define NCollection_FlatIndexedMap_HeaderFile
+
+#include <NCollection_BaseFlatMap.hxx>
+#include <NCollection_StlIterator.hxx>
+#include <NCollection_DefaultHasher.hxx>
+
+#include <Standard_DomainError.hxx>
+#include <Standard_NoSuchObject.hxx>
+#include <Standard_OutOfRange.hxx>
+
+/**
+ * Purpose:     The IndexedMap with open addressing.
+ *              It has the same interface as NCollection_IndexedMap and
+ *              can be used instead of it. The keys are kept in the
+ *              contiguous array in the order of their indices, thus
+ *              the access to the key by index is the access to the array
+ *              item, and the hash table refers to the indices of the keys
+ *              (see NCollection_BaseFlatMap for details).
+ *
+ *              The references to the keys are invalidated by the
+ *              addition and removal of the keys.
+ *
+ *              The Hasher is the same as for NCollection_IndexedMap.
+ */
+template < class TheKeyType,
+           class Hasher = NCollection_DefaultHasher<TheKeyType> >
+class NCollection_FlatIndexedMap : public NCollection_BaseFlatMap
+{
+public:
+  //! STL-compliant typedef for key type
+  typedef TheKeyType key_type;
+
+public:
+  //! Implementation of the Iterator interface.
+  class Iterator
+  {
+  public:
+    //! Empty constructor.
+    Iterator (void) :
+      myMap (NULL),
+      myIndex (0) {}
+
+    //! Constructor.
+    Iterator (const NCollection_FlatIndexedMap& theMap) :
+      myMap ((NCollection_FlatIndexedMap* )&theMap),
+      myIndex (1) {}
+
+    //! Query if the end of collection is reached by iterator
+    Standard_Boolean More(void) const
+    { return myMap != NULL && myIndex <= myMap->Extent(); }
+
+    //! Make a step along the collection
+    void Next(void)
+    { ++myIndex; }
+
+    //! Value access
+    const TheKeyType& Value(void) const
+    {
+      Standard_NoSuchObject_Raise_if (!More(), "NCollection_FlatIndexedMap::Iterator::Value");
+      return myMap->FindKey (myIndex);
+    }
+
+    //! Performs comparison of two iterators.
+    Standard_Boolean IsEqual (const Iterator& theOther) const
+    { return myMap == theOther.myMap && myIndex == theOther.myIndex; }
+
+  private:
+    NCollection_FlatIndexedMap* myMap;   //!< pointer to the map being iterated
+    Standard_Integer            myIndex; //!< current index
+  };
+
+  //! Shorthand for a constant iterator type.
+  typedef NCollection_StlIterator<std::forward_iterator_tag, Iterator, TheKeyType, true> const_iterator;
+
+  //! Returns a const iterator pointing to the first element in the map.
+  const_iterator cbegin() const { return Iterator (*this); }
+
+  //! Returns a const iterator referring to the past-the-end element in the map.
+  const_iterator cend() const { return Iterator(); }
+
+public:
+  // ---------- PUBLIC METHODS ------------
+
+  //! Empty constructor.
+  NCollection_FlatIndexedMap()
+  : NCollection_BaseFlatMap (Handle(NCollection_BaseAllocator)()),
+    myKeys (NULL) {}
+
+  //! Constructor
+  explicit NCollection_FlatIndexedMap (const Standard_Integer theNbBuckets,
+                                       const Handle(NCollection_BaseAllocator)& theAllocator = 0L)
+  : NCollection_BaseFlatMap (theAllocator),
+    myKeys (NULL)
+  {
+    ReSize (theNbBuckets);
+  }
+
+  //! Copy constructor
+  NCollection_FlatIndexedMap (const NCollection_FlatIndexedMap& theOther)
+  : NCollection_BaseFlatMap (theOther.myAllocator),
+    myKeys (NULL)
+  { *this = theOther; }
+
+  //! Exchange the content of two maps without re-allocations.
+  //! Notice that allocators will be swapped as well!
+  void Exchange (NCollection_FlatIndexedMap& theOther)
+  {
+    this->exchangeMapsData (theOther);
+    std::swap (myKeys, theOther.myKeys);
+  }
+
+  //! Assign.
+  //! This method does not change the internal allocator.
+  NCollection_FlatIndexedMap& Assign (const NCollection_FlatIndexedMap& theOther)
+  {
+    if (this == &theOther)
+      return *this;
+
+    Clear (Standard_False);
+    ReSize (theOther.Extent());
+    for (Standard_Integer anIndex = 1; anIndex <= theOther.Extent(); ++anIndex)
+    {
+      new (&myKeys[anIndex - 1]) TheKeyType (theOther.myKeys[anIndex - 1]);
+      appendEntry (theOther.entryHash (anIndex));
+    }
+    return *this;
+  }
+
+  //! Assignment operator
+  NCollection_FlatIndexedMap& operator= (const NCollection_FlatIndexedMap& theOther)
+  {
+    return Assign (theOther);
+  }
+
+  //! ReSize: reserves the room for the given number of keys
+  void ReSize (const Standard_Integer theExtent)
+  {
+    const Standard_Integer aNbSlots = nbSlotsFor (theExtent);
+    if (aNbSlots <= NbBuckets())
+      return;
+    reallocEntries (myKeys, capacityFor (aNbSlots));
+    resizeTable (aNbSlots);
+  }
+
+  //! Add
+  Standard_Integer Add (const TheKeyType& theKey1)
+  {
+    const Standard_Size aHash = hashCode (theKey1);
+    const Standard_Integer anIndex = lookup (theKey1, aHash);
+    if (anIndex != 0)
+      return anIndex;
+
+    if (isFull())
+      ReSize (Extent() + 1);
+    new (&myKeys[Extent()]) TheKeyType (theKey1);
+    return appendEntry (aHash);
+  }
+
+  //! Contains
+  Standard_Boolean Contains (const TheKeyType& theKey1) const
+  {
+    return lookup (theKey1, hashCode (theKey1)) != 0;
+  }
+
+  //! Substitute
+  void Substitute (const Standard_Integer theIndex,
+                   const TheKeyType& theKey1)
+  {
+    Standard_OutOfRange_Raise_if (theIndex < 1 || theIndex > Extent(),
+                                  "NCollection_FlatIndexedMap::Substitute : "
+                                  "Index is out of range");
+
+    // check if theKey1 is not already in the map
+    const Standard_Size aHash = hashCode (theKey1);
+    const Standard_Integer anIndex = lookup (theKey1, aHash);
+    if (anIndex != 0)
+    {
+      if (anIndex != theIndex)
+      {
+        throw Standard_DomainError ("NCollection_FlatIndexedMap::Substitute : "
+                                    "Attempt to substitute existing key");
+      }
+      myKeys[theIndex - 1] = theKey1;
+      return;
+    }
+
+    myKeys[theIndex - 1] = theKey1;
+    rehashEntry (theIndex, aHash);
+  }
+
+  //! Swaps two elements with the given indices.
+  void Swap (const Standard_Integer theIndex1,
+             const Standard_Integer theIndex2)
+  {
+    Standard_OutOfRange_Raise_if (theIndex1 < 1 || theIndex1 > Extent()
+                               || theIndex2 < 1 || theIndex2 > Extent(), "NCollection_FlatIndexedMap::Swap");
+
+    if (theIndex1 == theIndex2)
+    {
+      return;
+    }
+
+    swapEntries (theIndex1, theIndex2);
+    std::swap (myKeys[theIndex1 - 1], myKeys[theIndex2 - 1]);
+  }
+
+  //! RemoveLast
+  void RemoveLast (void)
+  {
+    Standard_OutOfRange_Raise_if (Extent() == 0, "NCollection_FlatIndexedMap::RemoveLast");
+    removeLastEntry();
+    myKeys[Extent()].~TheKeyType();
+  }
+
+  //! Remove the key of the given index.
+  //! Caution! The index of the last key can be changed.
+  void RemoveFromIndex (const Standard_Integer theIndex)
+  {
+    Standard_OutOfRange_Raise_if (theIndex < 1 || theIndex > Extent(), "NCollection_FlatIndexedMap::RemoveFromIndex");
+    const Standard_Integer aMoved = removeEntry (theIndex);
+    if (aMoved != 0)
+      myKeys[theIndex - 1] = std::move (myKeys[aMoved - 1]);
+    myKeys[Extent()].~TheKeyType();
+  }
+
+  //! Remove the given key.
+  //! Caution! The index of the last key can be changed.
+  Standard_Boolean RemoveKey (const TheKeyType& theKey1)
+  {
+    const Standard_Integer anIndToRemove = FindIndex (theKey1);
+    if (anIndToRemove < 1)
+    {
+      return Standard_False;
+    }
+
+    RemoveFromIndex (anIndToRemove);
+    return Standard_True;
+  }
+
+  //! FindKey
+  const TheKeyType& FindKey (const Standard_Integer theIndex) const
+  {
+    Standard_OutOfRange_Raise_if (theIndex < 1 || theIndex > Extent(), "NCollection_FlatIndexedMap::FindKey");
+    return myKeys[theIndex - 1];
+  }
+
+  //! operator ()
+  const TheKeyType& operator() (const Standard_Integer theIndex) const
+  { return FindKey (theIndex); }
+
+  //! FindIndex
+  Standard_Integer FindIndex (const TheKeyType& theKey1) const
+  {
+    return lookup (theKey1, hashCode (theKey1));
+  }
+
+  //! Clear data. If doReleaseMemory is false then the table of
+  //! slots is not released and will be reused.
+  void Clear (const Standard_Boolean doReleaseMemory = Standard_True)
+  {
+    destroyEntries (myKeys, doReleaseMemory);
+    clearTable (doReleaseMemory);
+  }
+
+  //! Clear data and reset allocator
+  void Clear (const Handle(NCollection_BaseAllocator)& theAllocator)
+  {
+    Clear();
+    this->myAllocator = ( ! theAllocator.IsNull() ? theAllocator :
+                    NCollection_BaseAllocator::CommonBaseAllocator() );
+  }
+
+  //! Destructor
+  virtual ~NCollection_FlatIndexedMap (void)
+  { Clear(); }
+
+  //! Size
+  Standard_Integer Size (void) const
+  { return Extent(); }
+
+protected:
+  // ---------- PROTECTED METHODS ----------
+
+  //! Computes the hash code of the key
+  static Standard_Size hashCode (const TheKeyType& theKey)
+  { return NCollection_HasherTraits<TheKeyType, Hasher>::HashCode (theKey); }
+
+  //! Returns the index of the key or 0 if it is not in the map
+  Standard_Integer lookup (const TheKeyType& theKey,
+                           const Standard_Size theHash) const
+  {
+    for (ProbeIterator anIter (*this, theHash); anIter.More(); anIter.Next())
+    {
+      if (Hasher::IsEqual (myKeys[anIter.Index() - 1], theKey))
+        return anIter.Index();
+    }
+    return 0;
+  }
+
+private:
+  TheKeyType* myKeys; //!< array of keys in the order of indices
+};
+
+#endif
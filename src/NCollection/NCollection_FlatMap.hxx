@@ -0,0 +1,265 @@
+// Copyright (c) 2024 OPEN CASCADE SAS
+//
+// This file is part of Open CASCADE Technology software library.
+//
+// This library is free software; you can redistribute it and/or modify it under
+// the terms of the GNU Lesser General Public License version 2.1 as published
+// by the Free Software Foundation, with special exception defined in the file
+// OCCT_LGPL_EXCEPTION.txt. Consult the file LICENSE_LGPL_21.txt included in OCCT
+// distribution for complete text of the license and disclaimer of any warranty.
+//
+// Alternatively, this file may be used under the terms of Open CASCADE
+// commercial license or contractual agreement.
+
+#ifndef NCollection_FlatMap_HeaderFile
+#define NCollection_FlatMap_HeaderFile
+
+#include <NCollection_BaseFlatMap.hxx>
+#include <NCollection_StlIterator.hxx>
+#include <NCollection_DefaultHasher.hxx>
+
+#include <Standard_NoSuchObject.hxx>
+
+/**
+ * Purpose:     Single hashed Map with open addressing.
+ *              It has the same interface as NCollection_Map and
+ *              can be used instead of it, but keeps the keys in the
+ *              contiguous array instead of the separately allocated
+ *              nodes, which makes it faster and more compact
+ *              (see NCollection_BaseFlatMap for details).
+ *
+ *              The removal of the key moves the last added key
+ *              in its place, thus the order of iteration changes.
+ *              The references to the keys are invalidated by the
+ *              addition and removal of the keys.
+ *
+ *              The Hasher is the same as for NCollection_Map.
+ */
+template < class TheKeyType,
+           class Hasher = NCollection_DefaultHasher<TheKeyType> >
+class NCollection_FlatMap : public NCollection_BaseFlatMap
+{
+public:
+  //! STL-compliant typedef for key type
+  typedef TheKeyType key_type;
+
+public:
+  //!   Implementation of the Iterator interface.
+  class Iterator
+  {
+  public:
+    //! Empty constructor
+    Iterator (void) :
+      myKeys (NULL),
+      myIndex (0),
+      myExtent (0) {}
+
+    //! Constructor
+    Iterator (const NCollection_FlatMap& theMap) :
+      myKeys (theMap.myKeys),
+      myIndex (0),
+      myExtent (theMap.Extent()) {}
+
+    //! Query if the end of collection is reached by iterator
+    Standard_Boolean More(void) const
+    { return myIndex < myExtent; }
+
+    //! Make a step along the collection
+    void Next(void)
+    { ++myIndex; }
+
+    //! Value inquiry
+    const TheKeyType& Value(void) const
+    {
+      Standard_NoSuchObject_Raise_if (!More(), "NCollection_FlatMap::Iterator::Value");
+      return myKeys[myIndex];
+    }
+
+    //! Key
+    const TheKeyType& Key (void) const
+    {
+      Standard_NoSuchObject_Raise_if (!More(), "NCollection_FlatMap::Iterator::Key");
+      return myKeys[myIndex];
+    }
+
+    //! Performs comparison of two iterators.
+    Standard_Boolean IsEqual (const Iterator& theOther) const
+    { return myKeys == theOther.myKeys && myIndex == theOther.myIndex; }
+
+  private:
+    const TheKeyType* myKeys;   //!< keys of the map
+    Standard_Integer  myIndex;  //!< current position
+    Standard_Integer  myExtent; //!< number of keys
+  };
+
+  //! Shorthand for a constant iterator type.
+  typedef NCollection_StlIterator<std::forward_iterator_tag, Iterator, TheKeyType, true> const_iterator;
+
+  //! Returns a const iterator pointing to the first element in the map.
+  const_iterator cbegin() const { return Iterator (*this); }
+
+  //! Returns a const iterator referring to the past-the-end element in the map.
+  const_iterator cend() const { return Iterator(); }
+
+public:
+  // ---------- PUBLIC METHODS ------------
+
+  //! Empty constructor.
+  NCollection_FlatMap()
+  : NCollection_BaseFlatMap (Handle(NCollection_BaseAllocator)()),
+    myKeys (NULL) {}
+
+  //! Constructor
+  explicit NCollection_FlatMap (const Standard_Integer theNbBuckets,
+                                const Handle(NCollection_BaseAllocator)& theAllocator = 0L)
+  : NCollection_BaseFlatMap (theAllocator),
+    myKeys (NULL)
+  {
+    ReSize (theNbBuckets);
+  }
+
+  //! Copy constructor
+  NCollection_FlatMap (const NCollection_FlatMap& theOther)
+  : NCollection_BaseFlatMap (theOther.myAllocator),
+    myKeys (NULL)
+  { *this = theOther; }
+
+  //! Exchange the content of two maps without re-allocations.
+  //! Notice that allocators will be swapped as well!
+  void Exchange (NCollection_FlatMap& theOther)
+  {
+    this->exchangeMapsData (theOther);
+    std::swap (myKeys, theOther.myKeys);
+  }
+
+  //! Assign.
+  //! This method does not change the internal allocator.
+  NCollection_FlatMap& Assign (const NCollection_FlatMap& theOther)
+  {
+    if (this == &theOther)
+      return *this;
+
+    Clear (Standard_False);
+    ReSize (theOther.Extent());
+    for (Standard_Integer anIndex = 1; anIndex <= theOther.Extent(); ++anIndex)
+    {
+      new (&myKeys[anIndex - 1]) TheKeyType (theOther.myKeys[anIndex - 1]);
+      appendEntry (theOther.entryHash (anIndex));
+    }
+    return *this;
+  }
+
+  //! Assign operator
+  NCollection_FlatMap& operator= (const NCollection_FlatMap& theOther)
+  {
+    return Assign (theOther);
+  }
+
+  //! ReSize: reserves the room for the given number of keys
+  void ReSize (const Standard_Integer theExtent)
+  {
+    const Standard_Integer aNbSlots = nbSlotsFor (theExtent);
+    if (aNbSlots <= NbBuckets())
+      return;
+    reallocEntries (myKeys, capacityFor (aNbSlots));
+    resizeTable (aNbSlots);
+  }
+
+  //! Add
+  Standard_Boolean Add (const TheKeyType& theKey)
+  {
+    const Standard_Size aHash = hashCode (theKey);
+    if (lookup (theKey, aHash) != 0)
+      return Standard_False;
+    append (theKey, aHash);
+    return Standard_True;
+  }
+
+  //! Added: add a new key if not yet in the map, and return
+  //! reference to either newly added or previously existing object
+  const TheKeyType& Added (const TheKeyType& theKey)
+  {
+    const Standard_Size aHash = hashCode (theKey);
+    Standard_Integer anIndex = lookup (theKey, aHash);
+    if (anIndex == 0)
+      anIndex = append (theKey, aHash);
+    return myKeys[anIndex - 1];
+  }
+
+  //! Contains
+  Standard_Boolean Contains (const TheKeyType& theKey) const
+  {
+    return lookup (theKey, hashCode (theKey)) != 0;
+  }
+
+  //! Remove
+  Standard_Boolean Remove (const TheKeyType& theKey)
+  {
+    const Standard_Integer anIndex = lookup (theKey, hashCode (theKey));
+    if (anIndex == 0)
+      return Standard_False;
+    const Standard_Integer aMoved = removeEntry (anIndex);
+    if (aMoved != 0)
+      myKeys[anIndex - 1] = std::move (myKeys[aMoved - 1]);
+    myKeys[Extent()].~TheKeyType();
+    return Standard_True;
+  }
+
+  //! Clear data. If doReleaseMemory is false then the table of
+  //! slots is not released and will be reused.
+  void Clear (const Standard_Boolean doReleaseMemory = Standard_True)
+  {
+    destroyEntries (myKeys, doReleaseMemory);
+    clearTable (doReleaseMemory);
+  }
+
+  //! Clear data and reset allocator
+  void Clear (const Handle(NCollection_BaseAllocator)& theAllocator)
+  {
+    Clear();
+    this->myAllocator = ( ! theAllocator.IsNull() ? theAllocator :
+                    NCollection_BaseAllocator::CommonBaseAllocator() );
+  }
+
+  //! Destructor
+  virtual ~NCollection_FlatMap (void)
+  { Clear(); }
+
+  //! Size
+  Standard_Integer Size (void) const
+  { return Extent(); }
+
+protected:
+  // ---------- PROTECTED METHODS ----------
+
+  //! Computes the hash code of the key
+  static Standard_Size hashCode (const TheKeyType& theKey)
+  { return NCollection_HasherTraits<TheKeyType, Hasher>::HashCode (theKey); }
+
+  //! Returns the index of the key or 0 if it is not in the map
+  Standard_Integer lookup (const TheKeyType& theKey,
+                           const Standard_Size theHash) const
+  {
+    for (ProbeIterator anIter (*this, theHash); anIter.More(); anIter.Next())
+    {
+      if (Hasher::IsEqual (myKeys[anIter.Index() - 1], theKey))
+        return anIter.Index();
+    }
+    return 0;
+  }
+
+  //! Appends the new key, returns its index
+  Standard_Integer append (const TheKeyType& theKey,
+                           const Standard_Size theHash)
+  {
+    if (isFull())
+      ReSize (Extent() + 1);
+    new (&myKeys[Extent()]) TheKeyType (theKey);
+    return appendEntry (theHash);
+  }
+
+private:
+  TheKeyType* myKeys; //!< array of keys
+};
+
+#endif
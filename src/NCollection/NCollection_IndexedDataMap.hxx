@@ -56,22 +56,29 @@ public:
   typedef TheItemType value_type;
 
 private:
+  //! Hash protocol of the map
+  typedef NCollection_HasherTraits<TheKeyType, Hasher> HasherTraits;
+
   //!    Adaptation of the TListNode to the INDEXEDDatamap
   class IndexedDataMapNode : public NCollection_TListNode<TheItemType>
   {
   public:
     //! Constructor with 'Next'
     IndexedDataMapNode (const TheKeyType&      theKey1, 
+                        const Standard_Size    theHashCode,
                         const Standard_Integer theIndex,
                         const TheItemType&     theItem,
                         NCollection_ListNode*  theNext1)
     : NCollection_TListNode<TheItemType>(theItem,theNext1),
       myKey1  (theKey1),
+      myHashCode (theHashCode),
       myIndex (theIndex)
     { 
     }
     //! Key1
     TheKeyType& Key1() { return myKey1; }
+    //! Full-width hash code of Key1
+    Standard_Size& HashCode() { return myHashCode; }
     //! Index
     Standard_Integer& Index() { return myIndex; }
 
@@ -84,6 +91,7 @@ private:
     }
   private:
     TheKeyType       myKey1;
+    Standard_Size    myHashCode;
     Standard_Integer myIndex;
   };
 
@@ -177,6 +185,11 @@ private:
     : NCollection_BaseMap (theOther.NbBuckets(), Standard_False, theOther.myAllocator) 
   { *this = theOther; }
 
+  //! Move constructor
+  NCollection_IndexedDataMap (NCollection_IndexedDataMap&& theOther)
+  : NCollection_BaseMap (1, Standard_False, theOther.myAllocator)
+  { Exchange (theOther); }
+
   //! Exchange the content of two maps without re-allocations.
   //! Notice that allocators will be swapped as well!
   void Exchange (NCollection_IndexedDataMap& theOther)
@@ -200,8 +213,9 @@ private:
       {
         const TheKeyType&  aKey1  = theOther.FindKey      (anIndexIter);
         const TheItemType& anItem = theOther.FindFromIndex(anIndexIter);
-        const Standard_Integer iK1 = Hasher::HashCode (aKey1, NbBuckets());
-        IndexedDataMapNode* pNode = new (this->myAllocator) IndexedDataMapNode (aKey1, anIndexIter, anItem, myData1[iK1]);
+        const Standard_Size aHash = ((IndexedDataMapNode* )theOther.myData2[anIndexIter - 1])->HashCode();
+        const Standard_Integer iK1 = HasherTraits::Bucket (aHash, NbBuckets());
+        IndexedDataMapNode* pNode = new (this->myAllocator) IndexedDataMapNode (aKey1, aHash, anIndexIter, anItem, myData1[iK1]);
         myData1[iK1]             = pNode;
         myData2[anIndexIter - 1] = pNode;
         Increment();
@@ -216,6 +230,19 @@ private:
     return Assign (theOther);
   }
 
+  //! Move operator; the content is taken from the other map when it
+  //! shares the allocator with this map, otherwise it is copied
+  NCollection_IndexedDataMap& operator= (NCollection_IndexedDataMap&& theOther)
+  {
+    if (this != &theOther && this->myAllocator == theOther.myAllocator)
+    {
+      Clear();
+      Exchange (theOther);
+      return *this;
+    }
+    return Assign (theOther);
+  }
+
   //! ReSize
   void ReSize (const Standard_Integer N)
   {
@@ -234,7 +261,7 @@ private:
             IndexedDataMapNode* p = (IndexedDataMapNode *) myData1[aBucketIter];
             while (p) 
             {
-              const Standard_Integer iK1 = Hasher::HashCode (p->Key1(), newBuck);
+              const Standard_Integer iK1 = HasherTraits::Bucket (p->HashCode(), newBuck);
               IndexedDataMapNode* q = (IndexedDataMapNode* )p->Next();
               p->Next() = ppNewData1[iK1];
               ppNewData1[iK1] = p;
@@ -258,11 +285,12 @@ private:
       ReSize(Extent());
     }
 
-    const Standard_Integer iK1 = Hasher::HashCode (theKey1, NbBuckets());
+    const Standard_Size aHash = HasherTraits::HashCode (theKey1);
+    const Standard_Integer iK1 = HasherTraits::Bucket (aHash, NbBuckets());
     IndexedDataMapNode* pNode = (IndexedDataMapNode* )myData1[iK1];
     while (pNode)
     {
-      if (Hasher::IsEqual (pNode->Key1(), theKey1))
+      if (HasherTraits::IsEqual (pNode->HashCode(), pNode->Key1(), aHash, theKey1))
       {
         return pNode->Index();
       }
@@ -270,7 +298,7 @@ private:
     }
 
     const Standard_Integer aNewIndex = Increment();
-    pNode = new (this->myAllocator) IndexedDataMapNode (theKey1, aNewIndex, theItem, myData1[iK1]);
+    pNode = new (this->myAllocator) IndexedDataMapNode (theKey1, aHash, aNewIndex, theItem, myData1[iK1]);
     myData1[iK1]           = pNode;
     myData2[aNewIndex - 1] = pNode;
     return aNewIndex;
@@ -281,12 +309,13 @@ private:
   {
     if (IsEmpty()) 
       return Standard_False;
-    Standard_Integer iK1 = Hasher::HashCode (theKey1, NbBuckets());
+    const Standard_Size aHash = HasherTraits::HashCode (theKey1);
+    Standard_Integer iK1 = HasherTraits::Bucket (aHash, NbBuckets());
     IndexedDataMapNode * pNode1;
     pNode1 = (IndexedDataMapNode *) myData1[iK1];
     while (pNode1) 
     {
-      if (Hasher::IsEqual(pNode1->Key1(), theKey1)) 
+      if (HasherTraits::IsEqual(pNode1->HashCode(), pNode1->Key1(), aHash, theKey1)) 
         return Standard_True;
       pNode1 = (IndexedDataMapNode *) pNode1->Next();
     }
@@ -303,11 +332,12 @@ private:
                                   "Index is out of range");
 
     // check if theKey1 is not already in the map
-    const Standard_Integer iK1 = Hasher::HashCode (theKey1, NbBuckets());
+    const Standard_Size aHash = HasherTraits::HashCode (theKey1);
+    const Standard_Integer iK1 = HasherTraits::Bucket (aHash, NbBuckets());
     IndexedDataMapNode* p = (IndexedDataMapNode *) myData1[iK1];
     while (p)
     {
-      if (Hasher::IsEqual (p->Key1(), theKey1))
+      if (HasherTraits::IsEqual (p->HashCode(), p->Key1(), aHash, theKey1))
       {
         if (p->Index() != theIndex)
         {
@@ -325,7 +355,7 @@ private:
     p = (IndexedDataMapNode* )myData2[theIndex - 1];
     
     // remove the old key
-    const Standard_Integer iK = Hasher::HashCode (p->Key1(), NbBuckets());
+    const Standard_Integer iK = HasherTraits::Bucket (p->HashCode(), NbBuckets());
     IndexedDataMapNode * q = (IndexedDataMapNode *) myData1[iK];
     if (q == p)
       myData1[iK] = (IndexedDataMapNode *) p->Next();
@@ -338,6 +368,7 @@ private:
 
     // update the node
     p->Key1()  = theKey1;
+    p->HashCode() = aHash;
     p->ChangeValue() = theItem;
     p->Next()  = myData1[iK1];
     myData1[iK1] = p;
@@ -373,7 +404,7 @@ private:
     myData2[aLastIndex - 1] = NULL;
     
     // remove the key
-    const Standard_Integer iK1 = Hasher::HashCode (p->Key1(), NbBuckets());
+    const Standard_Integer iK1 = HasherTraits::Bucket (p->HashCode(), NbBuckets());
     IndexedDataMapNode* q = (IndexedDataMapNode *) myData1[iK1];
     if (q == p)
       myData1[iK1] = (IndexedDataMapNode *) p->Next();
@@ -445,10 +476,11 @@ private:
   Standard_Integer FindIndex(const TheKeyType& theKey1) const
   {
     if (IsEmpty()) return 0;
-    IndexedDataMapNode* pNode1 = (IndexedDataMapNode* )myData1[Hasher::HashCode(theKey1,NbBuckets())];
+    const Standard_Size aHash = HasherTraits::HashCode (theKey1);
+    IndexedDataMapNode* pNode1 = (IndexedDataMapNode* )myData1[HasherTraits::Bucket(aHash,NbBuckets())];
     while (pNode1)
     {
-      if (Hasher::IsEqual (pNode1->Key1(), theKey1))
+      if (HasherTraits::IsEqual (pNode1->HashCode(), pNode1->Key1(), aHash, theKey1))
       {
         return pNode1->Index();
       }
@@ -462,10 +494,11 @@ private:
   {
     Standard_NoSuchObject_Raise_if (IsEmpty(), "NCollection_IndexedDataMap::FindFromKey");
 
-    IndexedDataMapNode* pNode1 = (IndexedDataMapNode* )myData1[Hasher::HashCode(theKey1,NbBuckets())];
+    const Standard_Size aHash = HasherTraits::HashCode (theKey1);
+    IndexedDataMapNode* pNode1 = (IndexedDataMapNode* )myData1[HasherTraits::Bucket(aHash,NbBuckets())];
     while (pNode1)
     {
-      if (Hasher::IsEqual (pNode1->Key1(), theKey1))
+      if (HasherTraits::IsEqual (pNode1->HashCode(), pNode1->Key1(), aHash, theKey1))
       {
         return pNode1->Value();
       }
@@ -479,10 +512,11 @@ private:
   {
     Standard_NoSuchObject_Raise_if (IsEmpty(), "NCollection_IndexedDataMap::ChangeFromKey");
 
-    IndexedDataMapNode* pNode1 = (IndexedDataMapNode* )myData1[Hasher::HashCode(theKey1,NbBuckets())];
+    const Standard_Size aHash = HasherTraits::HashCode (theKey1);
+    IndexedDataMapNode* pNode1 = (IndexedDataMapNode* )myData1[HasherTraits::Bucket(aHash,NbBuckets())];
     while (pNode1)
     {
-      if (Hasher::IsEqual (pNode1->Key1(), theKey1))
+      if (HasherTraits::IsEqual (pNode1->HashCode(), pNode1->Key1(), aHash, theKey1))
       {
         return pNode1->ChangeValue();
       }
@@ -506,10 +540,11 @@ private:
   {
     if (!IsEmpty()) 
     {
-      IndexedDataMapNode* pNode1 = (IndexedDataMapNode* )myData1[Hasher::HashCode(theKey1,NbBuckets())];
+      const Standard_Size aHash = HasherTraits::HashCode (theKey1);
+      IndexedDataMapNode* pNode1 = (IndexedDataMapNode* )myData1[HasherTraits::Bucket(aHash,NbBuckets())];
       while (pNode1)
       {
-        if (Hasher::IsEqual (pNode1->Key1(), theKey1))
+        if (HasherTraits::IsEqual (pNode1->HashCode(), pNode1->Key1(), aHash, theKey1))
         {
           return &pNode1->ChangeValue();
         }
@@ -528,10 +563,11 @@ private:
     {
       return Standard_False;
     }
-    for (IndexedDataMapNode* aNode = (IndexedDataMapNode* )myData1[Hasher::HashCode (theKey1, NbBuckets())];
+    const Standard_Size aHash = HasherTraits::HashCode (theKey1);
+    for (IndexedDataMapNode* aNode = (IndexedDataMapNode* )myData1[HasherTraits::Bucket (aHash, NbBuckets())];
          aNode != NULL; aNode = (IndexedDataMapNode* )aNode->Next())
     {
-      if (Hasher::IsEqual (aNode->Key1(), theKey1))
+      if (HasherTraits::IsEqual (aNode->HashCode(), aNode->Key1(), aHash, theKey1))
       {
         theValue = aNode->Value();
         return Standard_True;
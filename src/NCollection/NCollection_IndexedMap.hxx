@@ -45,21 +45,29 @@ public:
   typedef TheKeyType key_type;
 
 protected:
+  //! Hash protocol of the map
+  typedef NCollection_HasherTraits<TheKeyType, Hasher> HasherTraits;
+
   //! Adaptation of the TListNode to the INDEXEDmap
   class IndexedMapNode : public NCollection_TListNode<TheKeyType>
   {
   public:
     //! Constructor with 'Next'
     IndexedMapNode (const TheKeyType&      theKey1, 
+                    const Standard_Size    theHashCode,
                     const Standard_Integer theIndex,
                     NCollection_ListNode*  theNext1)
     : NCollection_TListNode<TheKeyType> (theKey1, theNext1),
+      myHashCode (theHashCode),
       myIndex (theIndex)
     {
     }
     //! Key1
     TheKeyType& Key1() { return this->ChangeValue(); }
 
+    //! Full-width hash code of Key1
+    Standard_Size& HashCode() { return myHashCode; }
+
     //! Index
     Standard_Integer& Index() { return myIndex; }
     
@@ -72,6 +80,7 @@ protected:
     }
 
   private:
+    Standard_Size    myHashCode;
     Standard_Integer myIndex;
   };
 
@@ -137,6 +146,11 @@ protected:
   : NCollection_BaseMap (theOther.NbBuckets(), Standard_False, theOther.myAllocator)
   { *this = theOther; }
 
+  //! Move constructor
+  NCollection_IndexedMap (NCollection_IndexedMap&& theOther)
+  : NCollection_BaseMap (1, Standard_False, theOther.myAllocator)
+  { Exchange (theOther); }
+
   //! Exchange the content of two maps without re-allocations.
   //! Notice that allocators will be swapped as well!
   void Exchange (NCollection_IndexedMap& theOther)
@@ -159,8 +173,9 @@ protected:
       for (Standard_Integer anIndexIter = 1; anIndexIter <= anExt; ++anIndexIter)
       {
         const TheKeyType& aKey1 = theOther.FindKey (anIndexIter);
-        const Standard_Integer iK1 = Hasher::HashCode (aKey1, NbBuckets());
-        IndexedMapNode* pNode = new (this->myAllocator) IndexedMapNode (aKey1, anIndexIter, myData1[iK1]);
+        const Standard_Size aHash = ((IndexedMapNode* )theOther.myData2[anIndexIter - 1])->HashCode();
+        const Standard_Integer iK1 = HasherTraits::Bucket (aHash, NbBuckets());
+        IndexedMapNode* pNode = new (this->myAllocator) IndexedMapNode (aKey1, aHash, anIndexIter, myData1[iK1]);
         myData1[iK1]             = pNode;
         myData2[anIndexIter - 1] = pNode;
         Increment();
@@ -175,6 +190,19 @@ protected:
     return Assign (theOther);
   }
 
+  //! Move operator; the content is taken from the other map when it
+  //! shares the allocator with this map, otherwise it is copied
+  NCollection_IndexedMap& operator= (NCollection_IndexedMap&& theOther)
+  {
+    if (this != &theOther && this->myAllocator == theOther.myAllocator)
+    {
+      Clear();
+      Exchange (theOther);
+      return *this;
+    }
+    return Assign (theOther);
+  }
+
   //! ReSize
   void ReSize (const Standard_Integer theExtent)
   {
@@ -193,7 +221,7 @@ protected:
             IndexedMapNode* p = (IndexedMapNode* )myData1[aBucketIter];
             while (p) 
             {
-              const Standard_Integer iK1 = Hasher::HashCode (p->Key1(), newBuck);
+              const Standard_Integer iK1 = HasherTraits::Bucket (p->HashCode(), newBuck);
               IndexedMapNode* q = (IndexedMapNode* )p->Next();
               p->Next() = ppNewData1[iK1];
               ppNewData1[iK1] = p;
@@ -214,11 +242,12 @@ protected:
       ReSize (Extent());
     }
 
-    Standard_Integer iK1 = Hasher::HashCode (theKey1, NbBuckets());
+    const Standard_Size aHash = HasherTraits::HashCode (theKey1);
+    Standard_Integer iK1 = HasherTraits::Bucket (aHash, NbBuckets());
     IndexedMapNode* pNode = (IndexedMapNode* )myData1[iK1];
     while (pNode)
     {
-      if (Hasher::IsEqual (pNode->Key1(), theKey1))
+      if (HasherTraits::IsEqual (pNode->HashCode(), pNode->Key1(), aHash, theKey1))
       {
         return pNode->Index();
       }
@@ -226,7 +255,7 @@ protected:
     }
 
     const Standard_Integer aNewIndex = Increment();
-    pNode = new (this->myAllocator) IndexedMapNode (theKey1, aNewIndex, myData1[iK1]);
+    pNode = new (this->myAllocator) IndexedMapNode (theKey1, aHash, aNewIndex, myData1[iK1]);
     myData1[iK1]           = pNode;
     myData2[aNewIndex - 1] = pNode;
     return aNewIndex;
@@ -237,12 +266,13 @@ protected:
   {
     if (IsEmpty()) 
       return Standard_False;
-    Standard_Integer iK1 = Hasher::HashCode (theKey1, NbBuckets());
+    const Standard_Size aHash = HasherTraits::HashCode (theKey1);
+    Standard_Integer iK1 = HasherTraits::Bucket (aHash, NbBuckets());
     IndexedMapNode * pNode1;
     pNode1 = (IndexedMapNode *) myData1[iK1];
     while (pNode1) 
     {
-      if (Hasher::IsEqual(pNode1->Key1(), theKey1)) 
+      if (HasherTraits::IsEqual(pNode1->HashCode(), pNode1->Key1(), aHash, theKey1)) 
         return Standard_True;
       pNode1 = (IndexedMapNode *) pNode1->Next();
     }
@@ -258,11 +288,12 @@ protected:
                                   "Index is out of range");
 
     // check if theKey1 is not already in the map
-    Standard_Integer iK1 = Hasher::HashCode (theKey1, NbBuckets());
+    const Standard_Size aHash = HasherTraits::HashCode (theKey1);
+    Standard_Integer iK1 = HasherTraits::Bucket (aHash, NbBuckets());
     IndexedMapNode* p = (IndexedMapNode *) myData1[iK1];
     while (p)
     {
-      if (Hasher::IsEqual (p->Key1(), theKey1))
+      if (HasherTraits::IsEqual (p->HashCode(), p->Key1(), aHash, theKey1))
       {
         if (p->Index() != theIndex)
         {
@@ -279,7 +310,7 @@ protected:
     p = (IndexedMapNode* )myData2[theIndex - 1];
     
     // remove the old key
-    Standard_Integer iK = Hasher::HashCode (p->Key1(), NbBuckets());
+    Standard_Integer iK = HasherTraits::Bucket (p->HashCode(), NbBuckets());
     IndexedMapNode * q = (IndexedMapNode *) myData1[iK];
     if (q == p)
       myData1[iK] = (IndexedMapNode *) p->Next();
@@ -292,6 +323,7 @@ protected:
 
     // update the node
     p->Key1() = theKey1;
+    p->HashCode() = aHash;
     p->Next() = myData1[iK1];
     myData1[iK1] = p;
   }
@@ -326,7 +358,7 @@ protected:
     myData2[aLastIndex - 1] = NULL;
 
     // remove the key
-    Standard_Integer iK1 = Hasher::HashCode (p->Key1(), NbBuckets());
+    Standard_Integer iK1 = HasherTraits::Bucket (p->HashCode(), NbBuckets());
     IndexedMapNode* q = (IndexedMapNode *) myData1[iK1];
     if (q == p)
       myData1[iK1] = (IndexedMapNode *) p->Next();
@@ -384,10 +416,11 @@ protected:
   Standard_Integer FindIndex(const TheKeyType& theKey1) const
   {
     if (IsEmpty()) return 0;
-    IndexedMapNode* pNode1 = (IndexedMapNode* )myData1[Hasher::HashCode(theKey1,NbBuckets())];
+    const Standard_Size aHash = HasherTraits::HashCode (theKey1);
+    IndexedMapNode* pNode1 = (IndexedMapNode* )myData1[HasherTraits::Bucket(aHash,NbBuckets())];
     while (pNode1)
     {
-      if (Hasher::IsEqual (pNode1->Key1(), theKey1))
+      if (HasherTraits::IsEqual (pNode1->HashCode(), pNode1->Key1(), aHash, theKey1))
       {
         return pNode1->Index();
       }
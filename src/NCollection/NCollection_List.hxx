@@ -71,6 +71,13 @@ public:
     Assign (theOther);
   }
 
+  //! Move constructor
+  NCollection_List (NCollection_List&& theOther) :
+    NCollection_BaseList(theOther.myAllocator)
+  {
+    PAppend (theOther);
+  }
+
   //! Size - Number of items
   Standard_Integer Size (void) const
   { return Extent(); }
@@ -92,6 +99,18 @@ public:
     return Assign (theOther);
   }
 
+  //! Move operator; the nodes are taken from the other list when it
+  //! shares the allocator with this list, otherwise the items are copied
+  NCollection_List& operator= (NCollection_List&& theOther)
+  {
+    if (this != &theOther)
+    {
+      Clear();
+      Append (theOther);
+    }
+    return *this;
+  }
+
   //! Clear this list
   void Clear (const Handle(NCollection_BaseAllocator)& theAllocator=0L)
   {
@@ -136,6 +155,14 @@ public:
     return ((ListNode *) PLast())->ChangeValue();
   }
 
+  //! Append one item at the end moving it
+  TheItemType& Append (TheItemType&& theItem)
+  {
+    ListNode * pNew = new (this->myAllocator) ListNode(std::move (theItem));
+    PAppend(pNew);
+    return ((ListNode *) PLast())->ChangeValue();
+  }
+
   //! Append one item at the end and output iterator
   //!   pointing at the appended item
   void Append (const TheItemType& theItem, Iterator& theIter)
@@ -172,6 +199,14 @@ public:
     return ((ListNode *) PFirst())->ChangeValue();
   }
 
+  //! Prepend one item at the beginning moving it
+  TheItemType& Prepend (TheItemType&& theItem)
+  {
+    ListNode * pNew = new (this->myAllocator) ListNode(std::move (theItem));
+    PPrepend(pNew);
+    return ((ListNode *) PFirst())->ChangeValue();
+  }
+
   //! Prepend another list at the beginning
   void Prepend (NCollection_List& theOther)
   { 
@@ -59,6 +59,9 @@ public:
   //! STL-compliant typedef for key type
   typedef TheKeyType key_type;
 
+  //! Hash protocol of the map
+  typedef NCollection_HasherTraits<TheKeyType, Hasher> HasherTraits;
+
 public:
   //!   Adaptation of the TListNode to the map notations
   class MapNode : public NCollection_TListNode<TheKeyType>
@@ -66,12 +69,19 @@ public:
   public:
     //! Constructor with 'Next'
     MapNode (const TheKeyType& theKey, 
+             const Standard_Size theHashCode,
              NCollection_ListNode* theNext) :
-      NCollection_TListNode<TheKeyType> (theKey, theNext) {}
+      NCollection_TListNode<TheKeyType> (theKey, theNext),
+      myHashCode (theHashCode) {}
     //! Key
     const TheKeyType& Key (void)
     { return this->Value(); }
+    //! Full-width hash code of the key
+    Standard_Size HashCode() const
+    { return myHashCode; }
 
+  private:
+    Standard_Size myHashCode;
   };
 
  public:
@@ -131,6 +141,11 @@ public:
     NCollection_BaseMap (theOther.NbBuckets(), Standard_True, theOther.myAllocator)
   { *this = theOther; }
 
+  //! Move constructor
+  NCollection_Map (NCollection_Map&& theOther)
+  : NCollection_BaseMap (1, Standard_True, theOther.myAllocator)
+  { Exchange (theOther); }
+
   //! Exchange the content of two maps without re-allocations.
   //! Notice that allocators will be swapped as well!
   void Exchange (NCollection_Map& theOther)
@@ -163,6 +178,19 @@ public:
     return Assign(theOther);
   }
 
+  //! Move operator; the content is taken from the other map when it
+  //! shares the allocator with this map, otherwise it is copied
+  NCollection_Map& operator= (NCollection_Map&& theOther)
+  {
+    if (this != &theOther && this->myAllocator == theOther.myAllocator)
+    {
+      Clear();
+      Exchange (theOther);
+      return *this;
+    }
+    return Assign (theOther);
+  }
+
   //! ReSize
   void ReSize (const Standard_Integer N)
   {
@@ -183,7 +211,7 @@ public:
             p = olddata[i];
             while (p) 
             {
-              k = Hasher::HashCode(p->Key(),newBuck);
+              k = HasherTraits::Bucket(p->HashCode(),newBuck);
               q = (MapNode*) p->Next();
               p->Next() = newdata[k];
               newdata[k] = p;
@@ -202,15 +230,16 @@ public:
     if (Resizable()) 
       ReSize(Extent());
     MapNode** data = (MapNode**)myData1;
-    Standard_Integer k = Hasher::HashCode(K,NbBuckets());
+    const Standard_Size aHash = HasherTraits::HashCode(K);
+    Standard_Integer k = HasherTraits::Bucket(aHash,NbBuckets());
     MapNode* p = data[k];
     while (p) 
     {
-      if (Hasher::IsEqual(p->Key(),K))
+      if (HasherTraits::IsEqual(p->HashCode(),p->Key(),aHash,K))
         return Standard_False;
       p = (MapNode *) p->Next();
     }
-    data[k] = new (this->myAllocator) MapNode(K,data[k]);
+    data[k] = new (this->myAllocator) MapNode(K,aHash,data[k]);
     Increment();
     return Standard_True;
   }
@@ -222,15 +251,16 @@ public:
     if (Resizable()) 
       ReSize(Extent());
     MapNode** data = (MapNode**)myData1;
-    Standard_Integer k = Hasher::HashCode(K,NbBuckets());
+    const Standard_Size aHash = HasherTraits::HashCode(K);
+    Standard_Integer k = HasherTraits::Bucket(aHash,NbBuckets());
     MapNode* p = data[k];
     while (p) 
     {
-      if (Hasher::IsEqual(p->Key(),K))
+      if (HasherTraits::IsEqual(p->HashCode(),p->Key(),aHash,K))
         return p->Key();
       p = (MapNode *) p->Next();
     }
-    data[k] = new (this->myAllocator) MapNode(K,data[k]);
+    data[k] = new (this->myAllocator) MapNode(K,aHash,data[k]);
     Increment();
     return data[k]->Key();
   }
@@ -241,10 +271,11 @@ public:
     if (IsEmpty()) 
       return Standard_False;
     MapNode** data = (MapNode**) myData1;
-    MapNode*  p = data[Hasher::HashCode(K,NbBuckets())];
+    const Standard_Size aHash = HasherTraits::HashCode(K);
+    MapNode*  p = data[HasherTraits::Bucket(aHash,NbBuckets())];
     while (p) 
     {
-      if (Hasher::IsEqual(p->Key(),K)) 
+      if (HasherTraits::IsEqual(p->HashCode(),p->Key(),aHash,K)) 
         return Standard_True;
       p = (MapNode *) p->Next();
     }
@@ -257,12 +288,13 @@ public:
     if (IsEmpty()) 
       return Standard_False;
     MapNode** data = (MapNode**) myData1;
-    Standard_Integer k = Hasher::HashCode(K,NbBuckets());
+    const Standard_Size aHash = HasherTraits::HashCode(K);
+    Standard_Integer k = HasherTraits::Bucket(aHash,NbBuckets());
     MapNode* p = data[k];
     MapNode* q = NULL;
     while (p) 
     {
-      if (Hasher::IsEqual(p->Key(),K)) 
+      if (HasherTraits::IsEqual(p->HashCode(),p->Key(),aHash,K)) 
       {
         Decrement();
         if (q) 
@@ -22,6 +22,8 @@
 #include <Standard_OutOfRange.hxx>
 #include <Standard_NoSuchObject.hxx>
 
+#include <utility>
+
 /**
  * Purpose:     Definition of a sequence of elements indexed by
  *              an Integer in range of 1..n
@@ -42,6 +44,10 @@ public:
     Node (const TheItemType& theItem) :
       NCollection_SeqNode ()
       { myValue = theItem; }
+    //! Constructor moving the item
+    Node (TheItemType&& theItem) :
+      NCollection_SeqNode ()
+      { myValue = std::move (theItem); }
     //! Constant value access
     const TheItemType& Value () const { return myValue; }
     //! Variable value access
@@ -121,6 +127,13 @@ public:
     Assign (theOther);
   }
 
+  //! Move constructor
+  NCollection_Sequence (NCollection_Sequence&& theOther) :
+    NCollection_BaseSequence(theOther.myAllocator)
+  {
+    Append (theOther);
+  }
+
   //! Number of items
   Standard_Integer Size (void) const
   { return mySize; }
@@ -190,6 +203,18 @@ public:
     return Assign (theOther);
   }
 
+  //! Move operator; the nodes are taken from the other sequence when it
+  //! shares the allocator with this sequence, otherwise the items are copied
+  NCollection_Sequence& operator= (NCollection_Sequence&& theOther)
+  {
+    if (this != &theOther)
+    {
+      Clear();
+      Append (theOther);
+    }
+    return *this;
+  }
+
   //! Remove one item
   void Remove (Iterator& thePosition)
   { RemoveSeq (thePosition, delNode); }
@@ -207,6 +232,10 @@ public:
   void Append (const TheItemType& theItem)
   { PAppend (new (this->myAllocator) Node (theItem)); }
 
+  //! Append one item moving it
+  void Append (TheItemType&& theItem)
+  { PAppend (new (this->myAllocator) Node (std::move (theItem))); }
+
   //! Append another sequence (making it empty)
   void Append (NCollection_Sequence& theSeq)
   {
@@ -230,6 +259,10 @@ public:
   void Prepend (const TheItemType& theItem)
   { PPrepend (new (this->myAllocator) Node (theItem)); }
 
+  //! Prepend one item moving it
+  void Prepend (TheItemType&& theItem)
+  { PPrepend (new (this->myAllocator) Node (std::move (theItem))); }
+
   //! Prepend another sequence (making it empty)
   void Prepend (NCollection_Sequence& theSeq)
   {
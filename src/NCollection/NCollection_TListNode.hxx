@@ -18,6 +18,8 @@
 
 #include <NCollection_ListNode.hxx>
 
+#include <utility>
+
 /**
  * Purpose:     Abstract list node class. Used by BaseList
  * Remark:      Internal class
@@ -30,6 +32,10 @@ template <class TheItemType> class NCollection_TListNode
   NCollection_TListNode (const TheItemType& theItem,
                          NCollection_ListNode* theNext=NULL) :
     NCollection_ListNode  (theNext), myValue(theItem) { }
+  //! Constructor moving the item
+  NCollection_TListNode (TheItemType&& theItem,
+                         NCollection_ListNode* theNext=NULL) :
+    NCollection_ListNode  (theNext), myValue(std::move (theItem)) { }
   //! Constant value access
   const TheItemType& Value () const { return myValue; }
   //! Variable value access
@@ -0,0 +1,58 @@
+// Copyright (c) 2024 OPEN CASCADE SAS
+//
+// This file is part of Open CASCADE Technology software library.
+//
+// This library is free software; you can redistribute it and/or modify it under
+// the terms of the GNU Lesser General Public License version 2.1 as published
+// by the Free Software Foundation, with special exception defined in the file
+// OCCT_LGPL_EXCEPTION.txt. Consult the file LICENSE_LGPL_21.txt included in OCCT
+// distribution for complete text of the license and disclaimer of any warranty.
+//
+// Alternatively, this file may be used under the terms of Open CASCADE
+// commercial license or contractual agreement.
+#ifndef _OSD_Future_HeaderFile
+#define _OSD_Future_HeaderFile
+
+#include <OSD_Task.hxx>
+#include <Standard_ProgramError.hxx>
+
+//! Task of OSD_TaskGraph producing the result of type TheResult,
+//! which can be retrieved by the dependent tasks or by the caller of the graph.
+//! The result is defined by the sub-class, or by the functor passed to OSD_TaskGraph::AddFuture().
+template<class TheResult>
+class OSD_Future : public OSD_Task
+{
+public:
+
+  //! Waits for the completion of the task and returns its result.
+  //! Rethrows the exception of the failed task;
+  //! throws Standard_ProgramError if the task has been cancelled.
+  const TheResult& Value() const
+  {
+    if (!IsFinished())
+    {
+      Wait();
+    }
+    if (!Failure().IsNull())
+    {
+      Failure()->Reraise();
+    }
+    if (Status() != OSD_TaskStatus_Done)
+    {
+      throw Standard_ProgramError ("OSD_Future::Value(), the task has been cancelled");
+    }
+    return myResult;
+  }
+
+protected:
+
+  //! Empty constructor.
+  OSD_Future() : myResult() {}
+
+protected:
+
+  TheResult myResult; //!< result of the task
+
+};
+
+#endif // _OSD_Future_HeaderFile
@@ -33,6 +33,8 @@
 
 #include <OSD_MemInfo.hxx>
 
+#include <Standard.hxx>
+
 #if defined(__EMSCRIPTEN__)
   #include <emscripten.h>
 
@@ -273,6 +275,17 @@ void OSD_MemInfo::Update()
   }
 #endif
 #endif
+
+  if (IsActive (MemAllocatorReserved)
+   || IsActive (MemAllocatorInUse))
+  {
+    Standard_Size aReserved = 0, anInUse = 0;
+    if (Standard::AllocatorStatistics (aReserved, anInUse))
+    {
+      myCounters[MemAllocatorReserved] = aReserved;
+      myCounters[MemAllocatorInUse]    = anInUse;
+    }
+  }
 }
 
 // =======================================================================
@@ -312,6 +325,15 @@ TCollection_AsciiString OSD_MemInfo::ToString() const
   {
     anInfo += TCollection_AsciiString("  Heap memory:     ") +  Standard_Integer (ValueMiB (MemHeapUsage)) + " MiB\n";
   }
+  if (hasValue (MemAllocatorReserved))
+  {
+    anInfo += TCollection_AsciiString("  Allocator memory:   ") +  Standard_Integer (ValueMiB (MemAllocatorReserved)) + " MiB";
+    if (hasValue (MemAllocatorInUse))
+    {
+      anInfo += TCollection_AsciiString(" (in use: ") +  Standard_Integer (ValueMiB (MemAllocatorInUse)) + " MiB)";
+    }
+    anInfo += "\n";
+  }
   return anInfo;
 }
 
@@ -37,6 +37,9 @@
 //!                     Those pages may or may not be in memory (RAM)
 //!                     thus this counter couldn't be used to estimate
 //!                     how many active pages doesn't present in RAM.
+//!  - Allocator      - memory reserved from the system by the OCCT memory manager
+//!                     (Standard::Allocate()) and the memory of the blocks in use,
+//!                     available only for the memory manager collecting statistics (MMGT_OPT=3).
 //!
 //! Notice that none of these counters can be used as absolute measure of
 //! application memory consumption!
@@ -61,6 +64,8 @@ public:
     MemSwapUsage,      //!< Space allocated for the pagefile
     MemSwapUsagePeak,  //!< Peak space allocated for the pagefile
     MemHeapUsage,      //!< Total space allocated from the heap
+    MemAllocatorReserved, //!< Memory reserved by the OCCT memory manager from the system
+    MemAllocatorInUse,    //!< Memory of the blocks in use allocated by the OCCT memory manager
     MemCounter_NB      //!< Indicates total counters number
   };
 
@@ -376,6 +376,46 @@ public: //! @name public methods
     }
   }
 
+  //! Same as For() above, but with explicit size of the chunks of indices processed by one thread at once.
+  //! Large grain size reduces the scheduling overhead of the loops over many fast tasks.
+  //! The grain size is considered only by OCCT threads (see ToUseOcctThreads()).
+  //! @param theBegin     the first index (inclusive)
+  //! @param theEnd       the last  index (exclusive)
+  //! @param theGrainSize number of indices in the chunk;
+  //!                     0 means decreasing size of the chunks defined by the number of remaining indices
+  //! @param theFunctor   functor providing an interface "void operator(int theIndex){}"
+  //!                     performing task for specified index
+  //! @param isForceSingleThreadExecution if true, then no threads will be created
+  template <typename Functor>
+  static void For(const Standard_Integer theBegin,
+                  const Standard_Integer theEnd,
+                  const Standard_Integer theGrainSize,
+                  const Functor&         theFunctor,
+                  const Standard_Boolean isForceSingleThreadExecution = Standard_False)
+  {
+    const Standard_Integer aRange = theEnd - theBegin;
+    if (isForceSingleThreadExecution || aRange <= Max (theGrainSize, 1))
+    {
+      for (Standard_Integer it (theBegin); it != theEnd; ++it)
+        theFunctor(it);
+    }
+    else if (ToUseOcctThreads())
+    {
+      const Handle(OSD_ThreadPool)& aThreadPool = OSD_ThreadPool::DefaultPool();
+      const Standard_Integer aNbChunks = theGrainSize > 0 ? (aRange + theGrainSize - 1) / theGrainSize : aRange;
+      OSD_ThreadPool::Launcher aPoolLauncher (*aThreadPool, aNbChunks);
+      FunctorWrapperForThreadPool<Functor> aFunctor (theFunctor);
+      aPoolLauncher.Perform (theBegin, theEnd, aFunctor, theGrainSize);
+    }
+    else
+    {
+      UniversalIterator aBegin(new IteratorWrapper<Standard_Integer>(theBegin));
+      UniversalIterator aEnd  (new IteratorWrapper<Standard_Integer>(theEnd));
+      FunctorWrapperInt<Functor> aFunctor (theFunctor);
+      forEachExternal (aBegin, aEnd, aFunctor, aRange);
+    }
+  }
+
 };
 
 #endif
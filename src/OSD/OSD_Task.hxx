@@ -0,0 +1,82 @@
+// Copyright (c) 2024 OPEN CASCADE SAS
+//
+// This file is part of Open CASCADE Technology software library.
+//
+// This library is free software; you can redistribute it and/or modify it under
+// the terms of the GNU Lesser General Public License version 2.1 as published
+// by the Free Software Foundation, with special exception defined in the file
+// OCCT_LGPL_EXCEPTION.txt. Consult the file LICENSE_LGPL_21.txt included in OCCT
+// distribution for complete text of the license and disclaimer of any warranty.
+//
+// Alternatively, this file may be used under the terms of Open CASCADE
+// commercial license or contractual agreement.
+
+#ifndef _OSD_Task_HeaderFile
+#define _OSD_Task_HeaderFile
+
+#include <Message_ProgressRange.hxx>
+#include <NCollection_Vector.hxx>
+#include <OSD_TaskStatus.hxx>
+#include <Standard_Condition.hxx>
+#include <Standard_Failure.hxx>
+#include <Standard_Transient.hxx>
+
+#include <atomic>
+
+class OSD_TaskGraph;
+
+//! Task performed by OSD_TaskGraph after completion of its prerequisites.
+//! The task is defined by the sub-class implementing method Perform(),
+//! or by the functor passed to OSD_TaskGraph::Add().
+//!
+//! The status of the task can be checked and its completion can be awaited
+//! from any thread while the graph is being performed, see OSD_TaskGraph::Launch().
+class OSD_Task : public Standard_Transient
+{
+  friend class OSD_TaskGraph;
+  DEFINE_STANDARD_RTTIEXT(OSD_Task, Standard_Transient)
+public:
+
+  //! Performs the task; called by OSD_TaskGraph in one of the threads of the pool.
+  //! Exceptions thrown by this method are caught and stored in the task.
+  //! @param theRange progress range of the task, which also signals the cancellation
+  virtual void Perform (const Message_ProgressRange& theRange) = 0;
+
+  //! Returns the execution status of the task.
+  OSD_TaskStatus Status() const { return (OSD_TaskStatus )myStatus.load(); }
+
+  //! Returns TRUE if the task has been performed successfully.
+  bool IsDone() const { return Status() == OSD_TaskStatus_Done; }
+
+  //! Returns TRUE if the task has been performed (successfully or not) or cancelled.
+  bool IsFinished() const { return Status() >= OSD_TaskStatus_Done; }
+
+  //! Returns the exception thrown by the task, or NULL.
+  const Handle(Standard_Failure)& Failure() const { return myFailure; }
+
+  //! Waits until the task is finished.
+  //! Should be called only when the graph containing the task is being performed by another thread.
+  Standard_EXPORT void Wait() const;
+
+protected:
+
+  //! Empty constructor.
+  Standard_EXPORT OSD_Task();
+
+private:
+
+  NCollection_Vector<OSD_Task*> mySuccessors;      //!< tasks depending on this one
+  OSD_TaskGraph*                myGraph;           //!< graph containing the task
+  Handle(Standard_Failure)      myFailure;         //!< exception thrown by the task
+  mutable Standard_Condition    myFinishEvent;     //!< event signaling the completion of the task
+  Standard_Integer              myIndex;           //!< index of the task in the graph defining its priority
+  Standard_Integer              myNbPrerequisites; //!< number of prerequisites
+  Standard_Integer              myNbPending;       //!< number of not finished prerequisites
+  Standard_Boolean              myToCancel;        //!< flag indicating failed or cancelled prerequisite
+  std::atomic<int>              myStatus;          //!< execution status
+
+};
+
+DEFINE_STANDARD_HANDLE(OSD_Task, Standard_Transient)
+
+#endif // _OSD_Task_HeaderFile
@@ -0,0 +1,446 @@
+// Copyright (c) 2024 OPEN CASCADE SAS
+//
+// This file is part of Open CASCADE Technology software library.
+//
+// This library is free software; you can redistribute it and/or modify it under
+// the terms of the GNU Lesser General Public License version 2.1 as published
+// by the Free Software Foundation, with special exception defined in the file
+// OCCT_LGPL_EXCEPTION.txt. Consult the file LICENSE_LGPL_21.txt included in OCCT
+// distribution for complete text of the license and disclaimer of any warranty.
+//
+// Alternatively, this file may be used under the terms of Open CASCADE
+// commercial license or contractual agreement.
+#include <OSD_TaskGraph.hxx>
+
+#include <Message_ProgressScope.hxx>
+#include <Standard_ErrorHandler.hxx>
+#include <Standard_ProgramError.hxx>
+#include <TCollection_AsciiString.hxx>
+
+//! Functor of the launcher performing the ready tasks in each thread.
+struct OSD_TaskGraph::Worker
+{
+  Worker (OSD_TaskGraph& theGraph, NCollection_Array1<Message_ProgressRange>& theRanges)
+  : Graph (theGraph), Ranges (theRanges) {}
+
+  void operator() (int , int ) const { Graph.performTasks (Ranges); }
+
+  OSD_TaskGraph& Graph;
+  NCollection_Array1<Message_ProgressRange>& Ranges;
+};
+
+//=======================================================================
+//function : OSD_TaskGraph
+//purpose  :
+//=======================================================================
+OSD_TaskGraph::OSD_TaskGraph (const Handle(OSD_ThreadPool)& thePool,
+                              const Standard_Integer theMaxThreads)
+: myPool (!thePool.IsNull() ? thePool : OSD_ThreadPool::DefaultPool()),
+  myMaxThreads (theMaxThreads),
+  myNbReady (0),
+  myNbLeft (0),
+  myLauncher (NULL),
+  myToCancel (0),
+  myScope (NULL),
+  myIsLaunched (Standard_False),
+  myIsDone (Standard_False)
+{
+  //
+}
+
+//=======================================================================
+//function : ~OSD_TaskGraph
+//purpose  :
+//=======================================================================
+OSD_TaskGraph::~OSD_TaskGraph()
+{
+  if (myIsLaunched)
+  {
+    myThread.Wait();
+  }
+  for (NCollection_Vector<Handle(OSD_Task)>::Iterator aTaskIter (myTasks); aTaskIter.More(); aTaskIter.Next())
+  {
+    aTaskIter.Value()->myGraph = NULL;
+  }
+}
+
+//=======================================================================
+//function : AddTask
+//purpose  :
+//=======================================================================
+void OSD_TaskGraph::AddTask (const Handle(OSD_Task)& theTask)
+{
+  if (theTask.IsNull()
+   || theTask->myGraph == this)
+  {
+    return;
+  }
+  else if (theTask->myGraph != NULL)
+  {
+    throw Standard_ProgramError ("OSD_TaskGraph::AddTask(), the task belongs to another graph");
+  }
+
+  theTask->myGraph = this;
+  theTask->myIndex = myTasks.Length();
+  myTasks.Append (theTask);
+}
+
+//=======================================================================
+//function : AddDependency
+//purpose  :
+//=======================================================================
+void OSD_TaskGraph::AddDependency (const Handle(OSD_Task)& theTask,
+                                   const Handle(OSD_Task)& thePrerequisite)
+{
+  if (thePrerequisite.IsNull())
+  {
+    return;
+  }
+  else if (theTask.IsNull()
+        || theTask->myGraph != this
+        || thePrerequisite->myGraph != this)
+  {
+    throw Standard_ProgramError ("OSD_TaskGraph::AddDependency(), the task does not belong to the graph");
+  }
+
+  thePrerequisite->mySuccessors.Append (theTask.get());
+  ++theTask->myNbPrerequisites;
+}
+
+//=======================================================================
+//function : Perform
+//purpose  :
+//=======================================================================
+Standard_Boolean OSD_TaskGraph::Perform (const Message_ProgressRange& theRange)
+{
+  if (myIsLaunched)
+  {
+    throw Standard_ProgramError ("OSD_TaskGraph::Perform(), the graph is already launched");
+  }
+
+  prepare();
+  return performGraph (theRange);
+}
+
+//=======================================================================
+//function : Launch
+//purpose  :
+//=======================================================================
+void OSD_TaskGraph::Launch (const Message_ProgressRange& theRange)
+{
+  if (myIsLaunched)
+  {
+    throw Standard_ProgramError ("OSD_TaskGraph::Launch(), the graph is already launched");
+  }
+
+  // the tasks are reset before return, so that their events can be awaited
+  prepare();
+  myLaunchRange = theRange;
+  myLaunchFailure.Nullify();
+  myIsDone = Standard_False;
+  myIsLaunched = Standard_True;
+  myThread.SetFunction (&OSD_TaskGraph::runGraph);
+  if (!myThread.Run (this))
+  {
+    myIsLaunched = Standard_False;
+    throw Standard_ProgramError ("OSD_TaskGraph::Launch(), unable to start the thread");
+  }
+}
+
+//=======================================================================
+//function : Wait
+//purpose  :
+//=======================================================================
+Standard_Boolean OSD_TaskGraph::Wait()
+{
+  if (!myIsLaunched)
+  {
+    return myIsDone;
+  }
+
+  myThread.Wait();
+  myIsLaunched = Standard_False;
+  if (!myLaunchFailure.IsNull())
+  {
+    Handle(Standard_Failure) aFailure = myLaunchFailure;
+    myLaunchFailure.Nullify();
+    aFailure->Reraise();
+  }
+  return myIsDone;
+}
+
+//=======================================================================
+//function : runGraph
+//purpose  :
+//=======================================================================
+Standard_Address OSD_TaskGraph::runGraph (Standard_Address theGraph)
+{
+  OSD_TaskGraph* aGraph = static_cast<OSD_TaskGraph*> (theGraph);
+  try
+  {
+    OCC_CATCH_SIGNALS
+    aGraph->myIsDone = aGraph->performGraph (aGraph->myLaunchRange);
+  }
+  catch (Standard_Failure const& aFailure)
+  {
+    TCollection_AsciiString aMsg = TCollection_AsciiString (aFailure.DynamicType()->Name())
+                                 + ": " + aFailure.GetMessageString();
+    aGraph->myLaunchFailure = new Standard_ProgramError (aMsg.ToCString(), aFailure.GetStackString());
+  }
+  return NULL;
+}
+
+//=======================================================================
+//function : prepare
+//purpose  :
+//=======================================================================
+void OSD_TaskGraph::prepare()
+{
+  myToCancel = 0;
+  const Standard_Integer aNbTasks = myTasks.Length();
+  if (aNbTasks == 0)
+  {
+    return;
+  }
+
+  // check that all tasks can be reached from the tasks without prerequisites
+  NCollection_Array1<Standard_Integer> aNbPending (0, aNbTasks - 1);
+  NCollection_Array1<Standard_Integer> aQueue (0, aNbTasks - 1);
+  Standard_Integer aQueueEnd = 0;
+  for (Standard_Integer aTaskIter = 0; aTaskIter < aNbTasks; ++aTaskIter)
+  {
+    aNbPending (aTaskIter) = myTasks (aTaskIter)->myNbPrerequisites;
+    if (aNbPending (aTaskIter) == 0)
+    {
+      aQueue (aQueueEnd++) = aTaskIter;
+    }
+  }
+  for (Standard_Integer aQueueIter = 0; aQueueIter < aQueueEnd; ++aQueueIter)
+  {
+    const OSD_Task& aTask = *myTasks (aQueue (aQueueIter));
+    for (NCollection_Vector<OSD_Task*>::Iterator aSuccIter (aTask.mySuccessors); aSuccIter.More(); aSuccIter.Next())
+    {
+      if (--aNbPending (aSuccIter.Value()->myIndex) == 0)
+      {
+        aQueue (aQueueEnd++) = aSuccIter.Value()->myIndex;
+      }
+    }
+  }
+  if (aQueueEnd != aNbTasks)
+  {
+    throw Standard_ProgramError ("OSD_TaskGraph, the dependencies of the tasks are cyclic");
+  }
+
+  for (NCollection_Vector<Handle(OSD_Task)>::Iterator aTaskIter (myTasks); aTaskIter.More(); aTaskIter.Next())
+  {
+    OSD_Task& aTask = *aTaskIter.Value();
+    aTask.myNbPending = aTask.myNbPrerequisites;
+    aTask.myToCancel  = Standard_False;
+    aTask.myStatus    = OSD_TaskStatus_Pending;
+    aTask.myFailure.Nullify();
+    aTask.myFinishEvent.Reset();
+  }
+}
+
+//=======================================================================
+//function : performGraph
+//purpose  :
+//=======================================================================
+Standard_Boolean OSD_TaskGraph::performGraph (const Message_ProgressRange& theRange)
+{
+  const Standard_Integer aNbTasks = myTasks.Length();
+  Message_ProgressScope aPS (theRange, "Performing tasks", Max (aNbTasks, 1));
+  if (aNbTasks == 0)
+  {
+    return Standard_True;
+  }
+
+  // the ranges are allocated in advance as the tasks are finished in arbitrary order
+  NCollection_Array1<Message_ProgressRange> aRanges (0, aNbTasks - 1);
+  for (Standard_Integer aTaskIter = 0; aTaskIter < aNbTasks; ++aTaskIter)
+  {
+    aRanges (aTaskIter) = aPS.Next();
+  }
+
+  myReady.Resize (0, aNbTasks - 1, false);
+  myNbReady = 0;
+  myNbLeft  = aNbTasks;
+  myScope   = &aPS;
+  for (NCollection_Vector<Handle(OSD_Task)>::Iterator aTaskIter (myTasks); aTaskIter.More(); aTaskIter.Next())
+  {
+    if (aTaskIter.Value()->myNbPending == 0)
+    {
+      pushReady (aTaskIter.Value().get());
+    }
+  }
+
+  {
+    OSD_ThreadPool::Launcher aLauncher (*myPool, myMaxThreads);
+    Worker aWorker (*this, aRanges);
+    myLauncher = &aLauncher;
+    aLauncher.Perform (0, aLauncher.NbThreads(), aWorker, 1);
+  }
+  myLauncher = NULL;
+  myScope = NULL;
+
+  for (NCollection_Vector<Handle(OSD_Task)>::Iterator aTaskIter (myTasks); aTaskIter.More(); aTaskIter.Next())
+  {
+    if (!aTaskIter.Value()->IsDone())
+    {
+      return Standard_False;
+    }
+  }
+  return Standard_True;
+}
+
+//=======================================================================
+//function : performTasks
+//purpose  :
+//=======================================================================
+void OSD_TaskGraph::performTasks (NCollection_Array1<Message_ProgressRange>& theRanges)
+{
+  myMutex.Lock();
+  while (myNbLeft > 0)
+  {
+    OSD_Task* aTask = popReady();
+    if (aTask == NULL)
+    {
+      // the stamp is taken under the lock, so that it cannot miss the signal of the finished task;
+      // the nested parallel jobs of the running tasks are helped while waiting
+      const int aStamp = myLauncher->HelpersStamp();
+      myMutex.Unlock();
+      myLauncher->HelpNestedJobs (aStamp);
+      myMutex.Lock();
+      continue;
+    }
+
+    if (aTask->myToCancel
+     || myToCancel != 0
+     || myScope->UserBreak())
+    {
+      finishTask (*aTask, OSD_TaskStatus_Cancelled);
+      continue;
+    }
+
+    aTask->myStatus = OSD_TaskStatus_Running;
+    myMutex.Unlock();
+
+    OSD_TaskStatus aStatus = OSD_TaskStatus_Failed;
+    try
+    {
+      OCC_CATCH_SIGNALS
+      aTask->Perform (theRanges.ChangeValue (aTask->myIndex));
+      aStatus = OSD_TaskStatus_Done;
+    }
+    catch (Standard_Failure const& aFailure)
+    {
+      TCollection_AsciiString aMsg = TCollection_AsciiString (aFailure.DynamicType()->Name())
+                                   + ": " + aFailure.GetMessageString();
+      aTask->myFailure = new Standard_ProgramError (aMsg.ToCString(), aFailure.GetStackString());
+    }
+    catch (std::exception& anStdException)
+    {
+      TCollection_AsciiString aMsg = TCollection_AsciiString (typeid(anStdException).name())
+                                   + ": " + anStdException.what();
+      aTask->myFailure = new Standard_ProgramError (aMsg.ToCString(), NULL);
+    }
+    catch (...)
+    {
+      aTask->myFailure = new Standard_ProgramError ("Error: Unknown exception", NULL);
+    }
+
+    myMutex.Lock();
+    finishTask (*aTask, aStatus);
+  }
+  myMutex.Unlock();
+}
+
+//=======================================================================
+//function : finishTask
+//purpose  :
+//=======================================================================
+void OSD_TaskGraph::finishTask (OSD_Task& theTask, const OSD_TaskStatus theStatus)
+{
+  theTask.myStatus = theStatus;
+  bool hasNewReady = false;
+  for (NCollection_Vector<OSD_Task*>::Iterator aSuccIter (theTask.mySuccessors); aSuccIter.More(); aSuccIter.Next())
+  {
+    OSD_Task* aSuccessor = aSuccIter.Value();
+    if (theStatus != OSD_TaskStatus_Done)
+    {
+      aSuccessor->myToCancel = Standard_True;
+    }
+    if (--aSuccessor->myNbPending == 0)
+    {
+      pushReady (aSuccessor);
+      hasNewReady = true;
+    }
+  }
+  theTask.myFinishEvent.Set();
+  if (--myNbLeft == 0 || hasNewReady)
+  {
+    myLauncher->WakeUpHelpers();
+  }
+}
+
+//=======================================================================
+//function : pushReady
+//purpose  :
+//=======================================================================
+void OSD_TaskGraph::pushReady (OSD_Task* theTask)
+{
+  // sift up within the binary heap
+  Standard_Integer aPos = myNbReady++;
+  while (aPos > 0)
+  {
+    const Standard_Integer aParent = (aPos - 1) / 2;
+    if (myReady (aParent)->myIndex <= theTask->myIndex)
+    {
+      break;
+    }
+    myReady (aPos) = myReady (aParent);
+    aPos = aParent;
+  }
+  myReady (aPos) = theTask;
+}
+
+//=======================================================================
+//function : popReady
+//purpose  :
+//=======================================================================
+OSD_Task* OSD_TaskGraph::popReady()
+{
+  if (myNbReady == 0)
+  {
+    return NULL;
+  }
+
+  // sift down the last task from the root of the binary heap
+  OSD_Task* aTop  = myReady (0);
+  OSD_Task* aLast = myReady (--myNbReady);
+  Standard_Integer aPos = 0;
+  for (;;)
+  {
+    Standard_Integer aChild = 2 * aPos + 1;
+    if (aChild >= myNbReady)
+    {
+      break;
+    }
+    if (aChild + 1 < myNbReady
+     && myReady (aChild + 1)->myIndex < myReady (aChild)->myIndex)
+    {
+      ++aChild;
+    }
+    if (aLast->myIndex <= myReady (aChild)->myIndex)
+    {
+      break;
+    }
+    myReady (aPos) = myReady (aChild);
+    aPos = aChild;
+  }
+  if (myNbReady > 0)
+  {
+    myReady (aPos) = aLast;
+  }
+  return aTop;
+}
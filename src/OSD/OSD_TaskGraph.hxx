@@ -0,0 +1,207 @@
+// Copyright (c) 2024 OPEN CASCADE SAS
+//
+// This file is part of Open CASCADE Technology software library.
+//
+// This library is free software; you can redistribute it and/or modify it under
+// the terms of the GNU Lesser General Public License version 2.1 as published
+// by the Free Software Foundation, with special exception defined in the file
+// OCCT_LGPL_EXCEPTION.txt. Consult the file LICENSE_LGPL_21.txt included in OCCT
+// distribution for complete text of the license and disclaimer of any warranty.
+//
+// Alternatively, this file may be used under the terms of Open CASCADE
+// commercial license or contractual agreement.
+#ifndef _OSD_TaskGraph_HeaderFile
+#define _OSD_TaskGraph_HeaderFile
+
+#include <OSD_Future.hxx>
+#include <OSD_Thread.hxx>
+#include <OSD_ThreadPool.hxx>
+#include <Standard_Mutex.hxx>
+
+class Message_ProgressScope;
+
+//! Graph of the tasks with dependencies performed by the threads of OSD_ThreadPool.
+//!
+//! Each task starts as soon as all its prerequisites are done and a thread is free,
+//! so that independent chains of tasks overlap. When several tasks are ready,
+//! the task added to the graph earlier is performed first: adding the stages
+//! of each part one after another makes the parts stream through the stages,
+//! e.g. the mesh of the first part can be exported while the next parts are still being healed:
+//! @code
+//!   OSD_TaskGraph aGraph;
+//!   Handle(OSD_Task) aPrevExport;
+//!   for (int aPartIter = 0; aPartIter < aNbParts; ++aPartIter)
+//!   {
+//!     Handle(OSD_Future<TopoDS_Shape>) aHealed = aGraph.AddFuture<TopoDS_Shape> (
+//!       [=](const Message_ProgressRange& theRange) { return healPart (aPartIter, theRange); });
+//!     Handle(OSD_Task) aMeshed = aGraph.Add (
+//!       [=](const Message_ProgressRange& theRange) { meshPart (aHealed->Value(), theRange); });
+//!     aGraph.AddDependency (aMeshed, aHealed);
+//!     // the parts are written in their order
+//!     Handle(OSD_Task) anExport = aGraph.Add (
+//!       [=](const Message_ProgressRange& ) { writePart (aHealed->Value()); });
+//!     aGraph.AddDependency (anExport, aMeshed);
+//!     aGraph.AddDependency (anExport, aPrevExport);
+//!     aPrevExport = anExport;
+//!   }
+//!   aGraph.Perform (theProgress);
+//! @endcode
+//!
+//! The exception thrown by the task is stored in the task (OSD_Task::Failure())
+//! and the tasks depending on it are cancelled; the other tasks are still performed.
+//! The remaining tasks are cancelled when the progress indicator signals the user break
+//! or on call of method Cancel().
+//!
+//! Method Perform() blocks the caller until all tasks are finished,
+//! while Launch() performs the graph in the background thread, so that the caller
+//! can wait for the results of the particular tasks using OSD_Task::Wait() or OSD_Future::Value().
+//!
+//! The graph is performed by the launcher of the thread pool, so that the tasks
+//! can use nested parallel algorithms (OSD_Parallel) sharing the threads of the graph:
+//! the threads waiting for the ready tasks perform the parts of the nested jobs meanwhile.
+class OSD_TaskGraph
+{
+public:
+
+  //! Constructor.
+  //! @param thePool       thread pool performing the tasks; default pool is used if NULL
+  //! @param theMaxThreads maximal number of threads to be used, -1 for the default number of the pool
+  Standard_EXPORT OSD_TaskGraph (const Handle(OSD_ThreadPool)& thePool = Handle(OSD_ThreadPool)(),
+                                 const Standard_Integer theMaxThreads = -1);
+
+  //! Destructor; waits for the completion of the launched graph.
+  Standard_EXPORT ~OSD_TaskGraph();
+
+  //! Returns the number of tasks.
+  Standard_Integer NbTasks() const { return myTasks.Length(); }
+
+  //! Returns the task with the given index within [0, NbTasks() - 1] in the order of addition.
+  const Handle(OSD_Task)& Task (const Standard_Integer theIndex) const { return myTasks.Value (theIndex); }
+
+  //! Adds the task to the graph.
+  //! The task can belong to one graph only.
+  Standard_EXPORT void AddTask (const Handle(OSD_Task)& theTask);
+
+  //! Adds the task performed by the functor with interface
+  //! "void operator() (const Message_ProgressRange& theRange) const".
+  //! The functor is copied into the task.
+  template<class TheFunctor>
+  Handle(OSD_Task) Add (const TheFunctor& theFunctor)
+  {
+    Handle(OSD_Task) aTask = new FunctorTask<TheFunctor> (theFunctor);
+    AddTask (aTask);
+    return aTask;
+  }
+
+  //! Adds the task computing the result by the functor with interface
+  //! "TheResult operator() (const Message_ProgressRange& theRange) const".
+  //! The functor is copied into the task.
+  template<class TheResult, class TheFunctor>
+  Handle(OSD_Future<TheResult>) AddFuture (const TheFunctor& theFunctor)
+  {
+    Handle(OSD_Future<TheResult>) aTask = new FunctorFuture<TheResult, TheFunctor> (theFunctor);
+    AddTask (aTask);
+    return aTask;
+  }
+
+  //! Makes the task to be started only after successful completion of the prerequisite.
+  //! Both tasks should belong to this graph; NULL prerequisite is ignored.
+  //! Should not be called while the graph is being performed.
+  Standard_EXPORT void AddDependency (const Handle(OSD_Task)& theTask,
+                                      const Handle(OSD_Task)& thePrerequisite);
+
+  //! Performs all tasks and waits for their completion.
+  //! Throws Standard_ProgramError if the dependencies are cyclic.
+  //! @param theRange progress range divided equally between the tasks
+  //! @return TRUE if all tasks have been done successfully
+  Standard_EXPORT Standard_Boolean Perform (const Message_ProgressRange& theRange = Message_ProgressRange());
+
+  //! Starts performing the tasks in the background thread and returns immediately.
+  //! The progress scope of the range should be kept alive until the call of Wait().
+  //! The graph should not be modified until the call of Wait().
+  Standard_EXPORT void Launch (const Message_ProgressRange& theRange = Message_ProgressRange());
+
+  //! Waits for the completion of the graph started by Launch().
+  //! Rethrows the exception thrown by the background thread outside of the tasks (e.g. on cyclic dependencies).
+  //! @return TRUE if all tasks have been done successfully
+  Standard_EXPORT Standard_Boolean Wait();
+
+  //! Cancels the tasks not started yet; can be called from any thread.
+  void Cancel() { myToCancel = 1; }
+
+private:
+
+  //! Task calling the functor.
+  template<class TheFunctor>
+  class FunctorTask : public OSD_Task
+  {
+  public:
+    FunctorTask (const TheFunctor& theFunctor) : myFunctor (theFunctor) {}
+    virtual void Perform (const Message_ProgressRange& theRange) Standard_OVERRIDE { myFunctor (theRange); }
+  private:
+    TheFunctor myFunctor;
+  };
+
+  //! Task storing the result of the functor.
+  template<class TheResult, class TheFunctor>
+  class FunctorFuture : public OSD_Future<TheResult>
+  {
+  public:
+    FunctorFuture (const TheFunctor& theFunctor) : myFunctor (theFunctor) {}
+    virtual void Perform (const Message_ProgressRange& theRange) Standard_OVERRIDE { this->myResult = myFunctor (theRange); }
+  private:
+    TheFunctor myFunctor;
+  };
+
+  //! Functor of the launcher performing the ready tasks in each thread.
+  struct Worker;
+
+private:
+
+  //! Resets the status of the tasks and checks that the dependencies are not cyclic.
+  void prepare();
+
+  //! Performs the prepared tasks.
+  Standard_Boolean performGraph (const Message_ProgressRange& theRange);
+
+  //! Takes the ready tasks and performs them until all tasks are finished.
+  void performTasks (NCollection_Array1<Message_ProgressRange>& theRanges);
+
+  //! Finishes the task and updates its successors; should be called under lock.
+  void finishTask (OSD_Task& theTask, const OSD_TaskStatus theStatus);
+
+  //! Adds the task to the heap of ready tasks; should be called under lock.
+  void pushReady (OSD_Task* theTask);
+
+  //! Removes the task of the least index from the heap of ready tasks; should be called under lock.
+  OSD_Task* popReady();
+
+  //! Function of the background thread.
+  static Standard_Address runGraph (Standard_Address theGraph);
+
+private:
+
+  OSD_TaskGraph (const OSD_TaskGraph& );
+  OSD_TaskGraph& operator= (const OSD_TaskGraph& );
+
+private:
+
+  Handle(OSD_ThreadPool)           myPool;        //!< thread pool
+  Standard_Integer                 myMaxThreads;  //!< maximal number of threads
+  NCollection_Vector<Handle(OSD_Task)> myTasks;   //!< tasks in the order of addition
+  NCollection_Array1<OSD_Task*>    myReady;       //!< binary heap of the ready tasks ordered by index
+  Standard_Integer                 myNbReady;     //!< number of the ready tasks
+  Standard_Integer                 myNbLeft;      //!< number of not finished tasks
+  Standard_Mutex                   myMutex;       //!< mutex protecting the heap and the counters
+  OSD_ThreadPool::Launcher*        myLauncher;    //!< launcher performing the graph, woken up on a new ready task or the completion of all tasks
+  std::atomic<int>                 myToCancel;    //!< cancellation flag
+  const Message_ProgressScope*     myScope;       //!< progress scope checked for the user break
+  OSD_Thread                       myThread;      //!< background thread
+  Message_ProgressRange            myLaunchRange; //!< progress range of the launched graph
+  Handle(Standard_Failure)         myLaunchFailure; //!< exception of the background thread
+  Standard_Boolean                 myIsLaunched;  //!< flag indicating the graph running in the background thread
+  Standard_Boolean                 myIsDone;      //!< result of the launched graph
+
+};
+
+#endif // _OSD_TaskGraph_HeaderFile
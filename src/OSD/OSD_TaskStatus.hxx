@@ -0,0 +1,27 @@
+// Copyright (c) 2024 OPEN CASCADE SAS
+//
+// This file is part of Open CASCADE Technology software library.
+//
+// This library is free software; you can redistribute it and/or modify it under
+// the terms of the GNU Lesser General Public License version 2.1 as published
+// by the Free Software Foundation, with special exception defined in the file
+// OCCT_LGPL_EXCEPTION.txt. Consult the file LICENSE_LGPL_21.txt included in OCCT
+// distribution for complete text of the license and disclaimer of any warranty.
+//
+// Alternatively, this file may be used under the terms of Open CASCADE
+// commercial license or contractual agreement.
+
+#ifndef _OSD_TaskStatus_HeaderFile
+#define _OSD_TaskStatus_HeaderFile
+
+//! Execution status of the task of OSD_TaskGraph.
+enum OSD_TaskStatus
+{
+  OSD_TaskStatus_Pending,   //!< the task waits for its prerequisites or for the free thread
+  OSD_TaskStatus_Running,   //!< the task is being performed
+  OSD_TaskStatus_Done,      //!< the task has been performed successfully
+  OSD_TaskStatus_Failed,    //!< the task has thrown an exception
+  OSD_TaskStatus_Cancelled  //!< the task has been skipped due to cancellation or failure of its prerequisite
+};
+
+#endif // _OSD_TaskStatus_HeaderFile
@@ -21,6 +21,53 @@
 
 IMPLEMENT_STANDARD_RTTIEXT(OSD_ThreadPool, Standard_Transient)
 
+namespace
+{
+  //! Root launcher of the job performed by the current thread.
+  static Standard_THREADLOCAL OSD_ThreadPool::Launcher* THE_ROOT_LAUNCHER = NULL;
+
+  //! Throws the exception caught by the threads, if any.
+  static void raiseFailures (const NCollection_Array1<Handle(Standard_Failure)>& theFailures)
+  {
+    int aNbFailures = 0;
+    for (NCollection_Array1<Handle(Standard_Failure)>::Iterator aFailureIter (theFailures);
+         aFailureIter.More(); aFailureIter.Next())
+    {
+      if (!aFailureIter.Value().IsNull())
+      {
+        ++aNbFailures;
+      }
+    }
+    if (aNbFailures == 0)
+    {
+      return;
+    }
+
+    TCollection_AsciiString aFailures;
+    for (NCollection_Array1<Handle(Standard_Failure)>::Iterator aFailureIter (theFailures);
+         aFailureIter.More(); aFailureIter.Next())
+    {
+      const Handle(Standard_Failure)& aFailure = aFailureIter.Value();
+      if (!aFailure.IsNull())
+      {
+        if (aNbFailures == 1)
+        {
+          aFailure->Reraise();
+        }
+
+        if (!aFailures.IsEmpty())
+        {
+          aFailures += "\n";
+        }
+        aFailures += aFailure->GetMessageString();
+      }
+    }
+
+    aFailures = TCollection_AsciiString("Multiple exceptions:\n") + aFailures;
+    throw Standard_ProgramError (aFailures.ToCString(), NULL);
+  }
+}
+
 // =======================================================================
 // function : Lock
 // purpose  :
@@ -43,15 +90,18 @@ void OSD_ThreadPool::EnumeratedThread::Free()
 // function : WakeUp
 // purpose  :
 // =======================================================================
-void OSD_ThreadPool::EnumeratedThread::WakeUp (JobInterface* theJob, bool theToCatchFpe)
+void OSD_ThreadPool::EnumeratedThread::WakeUp (JobInterface* theJob, bool theToCatchFpe, Launcher* theLauncher)
 {
   myJob = theJob;
+  myLauncher = theLauncher;
   myToCatchFpe = theToCatchFpe;
   if (myIsSelfThread)
   {
     if (theJob != NULL)
     {
-      OSD_ThreadPool::performJob (myFailure, myJob, myThreadIndex);
+      myFailure.Nullify();
+      OSD_ThreadPool::performJob (myFailure, myJob, myThreadIndex, myLauncher);
+      myLauncher->helpNestedJobs();
     }
     return;
   }
@@ -210,6 +260,12 @@ void OSD_ThreadPool::release()
 // =======================================================================
 void OSD_ThreadPool::Launcher::perform (JobInterface& theJob)
 {
+  if (myRoot != NULL)
+  {
+    performNested (theJob);
+    return;
+  }
+
   run (theJob);
   wait();
 }
@@ -221,10 +277,13 @@ void OSD_ThreadPool::Launcher::perform (JobInterface& theJob)
 void OSD_ThreadPool::Launcher::run (JobInterface& theJob)
 {
   bool toCatchFpe = OSD::ToCatchFloatingSignals();
+  myNestedJobs = NULL;
+  myNbBusy = myNbThreads;
+  myNestedEvent.Reset();
   for (NCollection_Array1<EnumeratedThread*>::Iterator aThreadIter (myThreads);
        aThreadIter.More() && aThreadIter.Value() != NULL; aThreadIter.Next())
   {
-    aThreadIter.ChangeValue()->WakeUp (&theJob, toCatchFpe);
+    aThreadIter.ChangeValue()->WakeUp (&theJob, toCatchFpe, this);
   }
 }
 
@@ -234,42 +293,182 @@ void OSD_ThreadPool::Launcher::run (JobInterface& theJob)
 // =======================================================================
 void OSD_ThreadPool::Launcher::wait()
 {
-  int aNbFailures = 0;
+  NCollection_Array1<Handle(Standard_Failure)> aFailures (0, myNbThreads - 1);
+  int aThreadIndex = 0;
   for (NCollection_Array1<EnumeratedThread*>::Iterator aThreadIter (myThreads);
        aThreadIter.More() && aThreadIter.Value() != NULL; aThreadIter.Next())
   {
     aThreadIter.ChangeValue()->WaitIdle();
-    if (!aThreadIter.Value()->myFailure.IsNull())
+    aFailures.SetValue (aThreadIndex++, aThreadIter.Value()->myFailure);
+  }
+  raiseFailures (aFailures);
+}
+
+// =======================================================================
+// function : performNested
+// purpose  :
+// =======================================================================
+void OSD_ThreadPool::Launcher::performNested (JobInterface& theJob)
+{
+  myNestedJob = &theJob;
+  myNbSlots   = 0;
+  myNbHelpers = 0;
+  myFailures.Resize (0, myNbThreads - 1, false);
+  myFailures.Init (Handle(Standard_Failure)());
+
+  // the last thread index is reserved for the self-thread, the others are given to the helpers
+  {
+    Standard_Mutex::Sentry aLock (myRoot->myNestedMutex);
+    myIsRegistered = true;
+    myNextNested = myRoot->myNestedJobs;
+    myRoot->myNestedJobs = this;
+    myRoot->myNestedEvent.Set();
+  }
+
+  OSD_ThreadPool::performJob (myFailures.ChangeLast(), &theJob, myNbThreads - 1, myRoot);
+
+  // all elements have been taken, so that the new helpers are useless
+  bool toWait = false;
+  {
+    Standard_Mutex::Sentry aLock (myRoot->myNestedMutex);
+    for (Launcher** aNestedIter = &myRoot->myNestedJobs; *aNestedIter != NULL; aNestedIter = &(*aNestedIter)->myNextNested)
     {
-      ++aNbFailures;
+      if (*aNestedIter == this)
+      {
+        *aNestedIter = myNextNested;
+        break;
+      }
     }
+    myIsRegistered = false;
+    myNextNested = NULL;
+    toWait = myNbHelpers > 0;
+    if (toWait)
+    {
+      myHelpersEvent.Reset();
+    }
+  }
+  if (toWait)
+  {
+    myHelpersEvent.Wait();
   }
-  if (aNbFailures == 0)
+  myNestedJob = NULL;
+  raiseFailures (myFailures);
+}
+
+// =======================================================================
+// function : helpNestedJobs
+// purpose  :
+// =======================================================================
+void OSD_ThreadPool::Launcher::helpNestedJobs()
+{
+  if (myNbThreads < 2)
   {
     return;
   }
 
-  TCollection_AsciiString aFailures;
-  for (NCollection_Array1<EnumeratedThread*>::Iterator aThreadIter (myThreads);
-       aThreadIter.More() && aThreadIter.Value() != NULL; aThreadIter.Next())
+  myNestedMutex.Lock();
+  --myNbBusy;
+  for (;;)
   {
-    if (!aThreadIter.Value()->myFailure.IsNull())
+    if (helpNestedJob())
     {
-      if (aNbFailures == 1)
-      {
-        aThreadIter.Value()->myFailure->Reraise();
-      }
+      continue;
+    }
 
-      if (!aFailures.IsEmpty())
-      {
-        aFailures += "\n";
-      }
-      aFailures += aThreadIter.Value()->myFailure->GetMessageString();
+    if (myNbBusy == 0)
+    {
+      // the job is completed, wake up the other threads to exit
+      myNestedEvent.Set();
+      break;
+    }
+
+    // the event is reset under the lock, so that it cannot miss the signal of the last busy thread
+    myNestedEvent.Reset();
+    myNestedMutex.Unlock();
+    myNestedEvent.Wait();
+    myNestedMutex.Lock();
+  }
+  myNestedMutex.Unlock();
+}
+
+// =======================================================================
+// function : helpNestedJob
+// purpose  :
+// =======================================================================
+bool OSD_ThreadPool::Launcher::helpNestedJob()
+{
+  Launcher* aNested = myNestedJobs;
+  for (; aNested != NULL; aNested = aNested->myNextNested)
+  {
+    if (aNested->myNbSlots < aNested->myNbThreads - 1)
+    {
+      break;
+    }
+  }
+  if (aNested == NULL)
+  {
+    return false;
+  }
+
+  const int aThreadIndex = aNested->myNbSlots++;
+  ++aNested->myNbHelpers;
+  ++myNbBusy;
+  myNestedMutex.Unlock();
+
+  OSD_ThreadPool::performJob (aNested->myFailures.ChangeValue (aThreadIndex), aNested->myNestedJob, aThreadIndex, this);
+
+  myNestedMutex.Lock();
+  --myNbBusy;
+  if (--aNested->myNbHelpers == 0
+   && !aNested->myIsRegistered)
+  {
+    aNested->myHelpersEvent.Set();
+  }
+  return true;
+}
+
+// =======================================================================
+// function : HelpersStamp
+// purpose  :
+// =======================================================================
+int OSD_ThreadPool::Launcher::HelpersStamp()
+{
+  Standard_Mutex::Sentry aLock (myNestedMutex);
+  return myHelpersStamp;
+}
+
+// =======================================================================
+// function : HelpNestedJobs
+// purpose  :
+// =======================================================================
+void OSD_ThreadPool::Launcher::HelpNestedJobs (const int theStamp)
+{
+  myNestedMutex.Lock();
+  while (myHelpersStamp == theStamp)
+  {
+    if (helpNestedJob())
+    {
+      continue;
     }
+
+    // the event is reset under the lock, so that it cannot miss the signal of WakeUpHelpers()
+    myNestedEvent.Reset();
+    myNestedMutex.Unlock();
+    myNestedEvent.Wait();
+    myNestedMutex.Lock();
   }
+  myNestedMutex.Unlock();
+}
 
-  aFailures = TCollection_AsciiString("Multiple exceptions:\n") + aFailures;
-  throw Standard_ProgramError (aFailures.ToCString(), NULL);
+// =======================================================================
+// function : WakeUpHelpers
+// purpose  :
+// =======================================================================
+void OSD_ThreadPool::Launcher::WakeUpHelpers()
+{
+  Standard_Mutex::Sentry aLock (myNestedMutex);
+  ++myHelpersStamp;
+  myNestedEvent.Set();
 }
 
 // =======================================================================
@@ -278,8 +477,11 @@ void OSD_ThreadPool::Launcher::wait()
 // =======================================================================
 void OSD_ThreadPool::performJob (Handle(Standard_Failure)& theFailure,
                                  OSD_ThreadPool::JobInterface* theJob,
-                                 int theThreadIndex)
+                                 int theThreadIndex,
+                                 Launcher* theLauncher)
 {
+  Launcher* aPrevLauncher = THE_ROOT_LAUNCHER;
+  THE_ROOT_LAUNCHER = theLauncher;
   try
   {
     OCC_CATCH_SIGNALS
@@ -301,6 +503,7 @@ void OSD_ThreadPool::performJob (Handle(Standard_Failure)& theFailure,
   {
     theFailure = new Standard_ProgramError ("Error: Unknown exception", NULL);
   }
+  THE_ROOT_LAUNCHER = aPrevLauncher;
 }
 
 // =======================================================================
@@ -323,8 +526,10 @@ void OSD_ThreadPool::EnumeratedThread::performThread()
     if (myJob != NULL)
     {
       OSD::SetThreadLocalSignal (OSD::SignalMode(), myToCatchFpe);
-      OSD_ThreadPool::performJob (myFailure, myJob, myThreadIndex);
+      OSD_ThreadPool::performJob (myFailure, myJob, myThreadIndex, myLauncher);
+      myLauncher->helpNestedJobs();
       myJob = NULL;
+      myLauncher = NULL;
     }
     myIdleEvent.Set();
   }
@@ -347,7 +552,19 @@ Standard_Address OSD_ThreadPool::EnumeratedThread::runThread (Standard_Address t
 // =======================================================================
 OSD_ThreadPool::Launcher::Launcher (OSD_ThreadPool& thePool, Standard_Integer theMaxThreads)
 : mySelfThread (true),
-  myNbThreads (0)
+  myNbThreads (0),
+  myPool (&thePool),
+  myNestedEvent (false),
+  myNestedJobs (NULL),
+  myNbBusy (0),
+  myHelpersStamp (0),
+  myRoot (NULL),
+  myNextNested (NULL),
+  myNestedJob (NULL),
+  myNbSlots (0),
+  myNbHelpers (0),
+  myIsRegistered (false),
+  myHelpersEvent (false)
 {
   const int aNbThreads = theMaxThreads > 0
                        ? Min (theMaxThreads, thePool.NbThreads())
@@ -378,6 +595,18 @@ OSD_ThreadPool::Launcher::Launcher (OSD_ThreadPool& thePool, Standard_Integer th
   myThreads.SetValue (myNbThreads, &mySelfThread);
   mySelfThread.myThreadIndex = myNbThreads;
   ++myNbThreads;
+
+  // share the threads of the launcher performing the outer job, if none are free
+  Launcher* aRoot = THE_ROOT_LAUNCHER;
+  if (myNbThreads == 1
+   && aNbThreads > 1
+   && aRoot != NULL
+   && aRoot->myPool == myPool
+   && aRoot->myNbThreads > 1)
+  {
+    myRoot = aRoot;
+    myNbThreads = Min (aNbThreads, aRoot->myNbThreads);
+  }
 }
 
 // =======================================================================
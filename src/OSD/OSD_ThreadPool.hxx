@@ -44,6 +44,13 @@
 //!   This behavior is affected by OSD_ThreadPool::NbDefaultThreadsToLaunch() parameter
 //!   and Launcher constructor, so that single Launcher instance will occupy not all threads
 //!   in the pool allowing other threads to be used concurrently.
+//! - Launcher created within the job of another Launcher of the same thread pool, which finds no free threads,
+//!   shares the threads of the outer (root) Launcher instead of executing the nested job sequentially:
+//!   the threads of the root Launcher, which have finished their part of the outer job,
+//!   join the nested jobs until the outer job is completed.
+//! - The range of the job is distributed among the threads by chunks of consecutive indices;
+//!   the size of the chunk decreases with the number of remaining indices (guided scheduling),
+//!   unless the grain size is specified explicitly.
 //! - OSD_ThreadPool::Launcher locks thread one-by-one from thread pool in a thread-safe way.
 //! - Each working thread catches exceptions occurred during job execution, and Launcher will
 //!   throw Standard_Failure in a caller thread on completed execution.
@@ -96,6 +103,10 @@ public:
   //! Should be called only with no active jobs, or exception Standard_ProgramError will be thrown!
   Standard_EXPORT void Init (int theNbThreads);
 
+public:
+
+  class Launcher;
+
 protected:
 
   //! Thread function interface.
@@ -112,7 +123,7 @@ protected:
   public:
     //! Main constructor.
     EnumeratedThread (bool theIsSelfThread = false)
-    : myPool (NULL), myJob (NULL), myWakeEvent (false),
+    : myPool (NULL), myJob (NULL), myLauncher (NULL), myWakeEvent (false),
       myIdleEvent (false), myThreadIndex (0), myUsageCounter(0),
       myIsStarted (false), myToCatchFpe (false),
       myIsSelfThread (theIsSelfThread) {}
@@ -125,7 +136,10 @@ protected:
     Standard_EXPORT void Free();
 
     //! Wake up the thread.
-    Standard_EXPORT void WakeUp (JobInterface* theJob, bool theToCatchFpe);
+    //! @param theJob        the job to perform, or NULL to shut down the thread
+    //! @param theToCatchFpe flag to catch floating point exceptions
+    //! @param theLauncher   the launcher running the job, which nested jobs the thread should help to perform
+    Standard_EXPORT void WakeUp (JobInterface* theJob, bool theToCatchFpe, Launcher* theLauncher = NULL);
 
     //! Wait the thread going into Idle state (finished jobs).
     Standard_EXPORT void WaitIdle();
@@ -135,7 +149,7 @@ protected:
     //! Copy constructor.
     EnumeratedThread (const EnumeratedThread& theCopy)
     : OSD_Thread(),
-      myPool (NULL), myJob (NULL), myWakeEvent (false),
+      myPool (NULL), myJob (NULL), myLauncher (NULL), myWakeEvent (false),
       myIdleEvent (false), myThreadIndex (0), myUsageCounter(0),
       myIsStarted (false), myToCatchFpe (false),
       myIsSelfThread (false) { Assign (theCopy); }
@@ -153,6 +167,7 @@ protected:
       OSD_Thread::Assign (theCopy);
       myPool         = theCopy.myPool;
       myJob          = theCopy.myJob;
+      myLauncher     = theCopy.myLauncher;
       myThreadIndex  = theCopy.myThreadIndex;
       myToCatchFpe   = theCopy.myToCatchFpe;
       myIsSelfThread = theCopy.myIsSelfThread;
@@ -169,6 +184,7 @@ protected:
   private:
     OSD_ThreadPool* myPool;
     JobInterface* myJob;
+    Launcher* myLauncher;
     Handle(Standard_Failure) myFailure;
     Standard_Condition myWakeEvent;
     Standard_Condition myIdleEvent;
@@ -185,11 +201,15 @@ public:
   //! in a thread pool to perform parallel execution of the job.
   class Launcher
   {
+    friend class EnumeratedThread;
   public:
     //! Lock specified number of threads from the thread pool.
     //! If thread pool is already locked by another user,
     //! Launcher will lock as many threads as possible
     //! (if none will be locked, then single threaded execution will be done).
+    //! The exception is Launcher created within the job of another Launcher of the same pool:
+    //! when no threads are free, it shares the threads of the outer Launcher
+    //! and the number of threads is limited by the number of threads of the outer Launcher.
     //! @param thePool       thread pool to lock the threads
     //! @param theMaxThreads number of threads to lock;
     //!                      -1 specifies that default number of threads
@@ -223,7 +243,21 @@ public:
     template<typename Functor>
     void Perform (int theBegin, int theEnd, const Functor& theFunctor)
     {
-      JobRange aData (theBegin, theEnd);
+      Perform (theBegin, theEnd, theFunctor, 0);
+    }
+
+    //! Same as Perform() above, but with explicit size of the chunks of indices given to the threads.
+    //! Small grain size is preferable for the tasks of unpredictable duration,
+    //! while large grain size reduces the overhead of scheduling of the fast tasks.
+    //! @param theBegin     the first data index (inclusive)
+    //! @param theEnd       the last  data index (exclusive)
+    //! @param theFunctor   functor performing task for specified index
+    //! @param theGrainSize number of indices in the chunk;
+    //!                     0 means decreasing size of the chunks defined by the number of remaining indices
+    template<typename Functor>
+    void Perform (int theBegin, int theEnd, const Functor& theFunctor, int theGrainSize)
+    {
+      JobRange aData (theBegin, theEnd, theGrainSize, myNbThreads);
       Job<Functor> aJob (theFunctor, aData);
       perform (aJob);
     }
@@ -231,6 +265,24 @@ public:
     //! Release threads before Launcher destruction.
     Standard_EXPORT void Release();
 
+    //! Returns the number of calls of WakeUpHelpers() to be passed to HelpNestedJobs().
+    Standard_EXPORT int HelpersStamp();
+
+    //! Performs the parts of the nested jobs sharing the threads of this launcher, and waits for them,
+    //! until WakeUpHelpers() is called after obtaining theStamp by HelpersStamp().
+    //! Should be called within the job of this launcher by the thread waiting for other threads of the job
+    //! (e.g. for the results of the dependent tasks), so that the nested jobs use this thread meanwhile:
+    //! @code
+    //!   // under the lock of the state of the job
+    //!   const int aStamp = theLauncher.HelpersStamp();
+    //!   if (!isWorkAvailable()) { unlock(); theLauncher.HelpNestedJobs (aStamp); lock(); }
+    //!   // the thread making the work available calls theLauncher.WakeUpHelpers() under the same lock
+    //! @endcode
+    Standard_EXPORT void HelpNestedJobs (const int theStamp);
+
+    //! Wakes up the threads waiting in HelpNestedJobs().
+    Standard_EXPORT void WakeUpHelpers();
+
   protected:
 
     //! Execute job.
@@ -242,6 +294,19 @@ public:
     //! Wait threads execution.
     Standard_EXPORT void wait();
 
+  private:
+
+    //! Execute job within the threads of the root launcher.
+    void performNested (JobInterface& theJob);
+
+    //! Perform the parts of the registered nested jobs until all threads of this root launcher finish;
+    //! called by each thread of the launcher after its part of the job.
+    void helpNestedJobs();
+
+    //! Perform the part of the registered nested job, if any; should be called under the lock of the nested jobs.
+    //! @return FALSE if no nested job needs the helpers
+    bool helpNestedJob();
+
   private:
     Launcher           (const Launcher& theCopy);
     Launcher& operator=(const Launcher& theCopy);
@@ -250,6 +315,24 @@ public:
     NCollection_Array1<EnumeratedThread*> myThreads; //!< array of locked threads (including self-thread)
     EnumeratedThread mySelfThread;
     int myNbThreads; //!< amount of locked threads
+    OSD_ThreadPool* myPool; //!< thread pool
+
+    // fields of the root launcher
+    Standard_Mutex     myNestedMutex;   //!< mutex protecting the list of nested jobs and the counters
+    Standard_Condition myNestedEvent;   //!< event signaling new nested job or completion of all threads
+    Launcher*          myNestedJobs;    //!< list of the nested launchers waiting for the helpers
+    int                myNbBusy;        //!< number of threads performing the jobs
+    int                myHelpersStamp;  //!< number of calls of WakeUpHelpers()
+
+    // fields of the nested launcher
+    Launcher*          myRoot;          //!< root launcher sharing its threads, or NULL
+    Launcher*          myNextNested;    //!< next nested launcher in the list of the root
+    JobInterface*      myNestedJob;     //!< nested job
+    int                myNbSlots;       //!< number of thread indices given to the helpers
+    int                myNbHelpers;     //!< number of helpers performing the job now
+    bool               myIsRegistered;  //!< flag indicating that the job is in the list of the root
+    Standard_Condition myHelpersEvent;  //!< event signaling that the last helper has left the job
+    NCollection_Array1<Handle(Standard_Failure)> myFailures; //!< failures caught by the helpers and self-thread
   };
 
 protected:
@@ -260,7 +343,17 @@ protected:
   public:
 
     //! Constructor
-    JobRange (const int& theBegin, const int& theEnd) : myBegin(theBegin), myEnd (theEnd), myIt (theBegin) {}
+    JobRange (const int& theBegin, const int& theEnd) : myBegin(theBegin), myEnd (theEnd), myIt (theBegin),
+      myGrainSize (1), myNbThreads (1) {}
+
+    //! Constructor.
+    //! @param theBegin     the first element of range
+    //! @param theEnd       the last element of range (exclusive)
+    //! @param theGrainSize number of elements in the chunk, or 0 for automatic size
+    //! @param theNbThreads number of threads processing the range
+    JobRange (const int& theBegin, const int& theEnd, int theGrainSize, int theNbThreads)
+    : myBegin(theBegin), myEnd (theEnd), myIt (theBegin),
+      myGrainSize (theGrainSize), myNbThreads (Max (theNbThreads, 1)) {}
 
     //! Returns const link on the first element.
     const int& Begin() const { return myBegin; }
@@ -270,16 +363,51 @@ protected:
 
     //! Returns first non processed element or end.
     //! Thread-safe method.
-    int It() const { return Standard_Atomic_Increment (reinterpret_cast<volatile int*>(&myIt)) - 1; }
+    int It() const { return Standard_Atomic_Increment (&myIt) - 1; }
+
+    //! Takes the next chunk of non processed elements [theFirst, theLast).
+    //! Thread-safe method.
+    //! @return FALSE if all elements have been taken
+    bool Next (int& theFirst, int& theLast) const
+    {
+      for (;;)
+      {
+        const int aFirst  = myIt;
+        const int aNbLeft = myEnd - aFirst;
+        if (aNbLeft <= 0)
+        {
+          return false;
+        }
+
+        int aChunk = aNbLeft;
+        if (myGrainSize > 0)
+        {
+          aChunk = Min (myGrainSize, aNbLeft);
+        }
+        else if (myNbThreads > 1)
+        {
+          // several chunks per thread to balance the tasks of different duration
+          aChunk = Max (aNbLeft / (8 * myNbThreads), 1);
+        }
+        if (Standard_Atomic_CompareAndSwap (&myIt, aFirst, aFirst + aChunk))
+        {
+          theFirst = aFirst;
+          theLast  = aFirst + aChunk;
+          return true;
+        }
+      }
+    }
 
   private:
     JobRange           (const JobRange& theCopy);
     JobRange& operator=(const JobRange& theCopy);
 
   private:
-    const   int& myBegin; //!< First element of range
-    const   int& myEnd;   //!< Last  element of range
-    mutable int  myIt;    //!< First non processed element of range
+    const   int& myBegin;     //!< First element of range
+    const   int& myEnd;       //!< Last  element of range
+    mutable volatile int myIt; //!< First non processed element of range
+    const   int  myGrainSize; //!< Number of elements in the chunk, 0 for automatic size
+    const   int  myNbThreads; //!< Number of threads processing the range
   };
 
   //! Auxiliary wrapper class for thread function.
@@ -294,9 +422,13 @@ protected:
     //! Method is executed in the context of thread.
     virtual void Perform (int theThreadIndex) Standard_OVERRIDE
     {
-      for (Standard_Integer anIter = myRange.It(); anIter < myRange.End(); anIter = myRange.It())
+      int aFirst = 0, aLast = 0;
+      while (myRange.Next (aFirst, aLast))
       {
-        myPerformer (theThreadIndex, anIter);
+        for (int anIter = aFirst; anIter < aLast; ++anIter)
+        {
+          myPerformer (theThreadIndex, anIter);
+        }
       }
     }
 
@@ -313,9 +445,11 @@ protected:
   void release();
 
   //! Perform the job and catch exceptions.
+  //! @param theLauncher root launcher, which threads could be shared by the launchers nested into the job
   static void performJob (Handle(Standard_Failure)& theFailure,
                           OSD_ThreadPool::JobInterface* theJob,
-                          int theThreadIndex);
+                          int theThreadIndex,
+                          Launcher* theLauncher);
 
 private:
   //! This method should not be called (prohibited).
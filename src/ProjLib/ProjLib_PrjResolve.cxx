@@ -18,7 +18,7 @@
 #include <Adaptor3d_Surface.hxx>
 #include <gp_Pnt2d.hxx>
 #include <math_FunctionSetRoot.hxx>
-#include <math_NewtonFunctionSetRoot.hxx>
+#include <math_NewtonFunctionSetRootN.hxx>
 #include <ProjLib_PrjFunc.hxx>
 #include <ProjLib_PrjResolve.hxx>
 #include <Standard_ConstructionError.hxx>
@@ -79,7 +79,7 @@ ProjLib_PrjResolve::ProjLib_PrjResolve(const Adaptor3d_Curve& C,const Adaptor3d_
 //    if (!S1.IsDone()) { return; }
 //  }
 //  else {
-  math_NewtonFunctionSetRoot SR (F, Tol, FuncTol);
+  math_NewtonFunctionSetRootN<2> SR (F, Tol, FuncTol);
   SR.Perform(F, Start, BInf, BSup);
 //    if (!SR.IsDone()) { return; }
   if (!SR.IsDone())
@@ -0,0 +1,432 @@
+// Copyright (c) 2024 OPEN CASCADE SAS
+//
+// This file is part of Open CASCADE Technology software library.
+//
+// This library is free software; you can redistribute it and/or modify it under
+// the terms of the GNU Lesser General Public License version 2.1 as published
+// by the Free Software Foundation, with special exception defined in the file
+// OCCT_LGPL_EXCEPTION.txt. Consult the file LICENSE_LGPL_21.txt included in OCCT
+// distribution for complete text of the license and disclaimer of any warranty.
+//
+// Alternatively, this file may be used under the terms of Open CASCADE
+// commercial license or contractual agreement.
+
+#include <ProjLib_ProjectionCache.hxx>
+
+#include <Geom2d_Curve.hxx>
+#include <Geom_BezierCurve.hxx>
+#include <Geom_BezierSurface.hxx>
+#include <Geom_BSplineCurve.hxx>
+#include <Geom_BSplineSurface.hxx>
+#include <Geom_OffsetCurve.hxx>
+#include <Geom_OffsetSurface.hxx>
+#include <Geom_RectangularTrimmedSurface.hxx>
+#include <Geom_SurfaceOfLinearExtrusion.hxx>
+#include <Geom_SurfaceOfRevolution.hxx>
+#include <Geom_TrimmedCurve.hxx>
+
+#include <string.h>
+
+IMPLEMENT_STANDARD_RTTIEXT(ProjLib_ProjectionCache, Standard_Transient)
+
+namespace
+{
+#if defined(Standard_HASTHREADLOCAL)
+  //! Current cache of the thread; the handle is released on exit of the thread.
+  static Standard_THREADLOCAL Handle(ProjLib_ProjectionCache) THE_CURRENT_CACHE;
+#endif
+
+  //! Combines the hash code of the value with the accumulated one.
+  static void combineHash (unsigned int& theHash, const Standard_Integer theValue)
+  {
+    theHash = (theHash * 31u) ^ static_cast<unsigned int> (theValue);
+  }
+
+  //! Accumulates the stamp of the geometry (FNV-1a hash of the values).
+  class GeometryStamp
+  {
+  public:
+    GeometryStamp() : myHash (14695981039346656037ULL) {}
+
+    Standard_Size Value() const { return static_cast<Standard_Size> (myHash); }
+
+    void Add (const Standard_Integer theValue) { add (&theValue, sizeof(theValue)); }
+
+    void Add (const Standard_Real theValue) { add (&theValue, sizeof(theValue)); }
+
+    void Add (const gp_XYZ& theXYZ) { Add (theXYZ.X()); Add (theXYZ.Y()); Add (theXYZ.Z()); }
+
+    void Add (const Handle(Standard_Type)& theType) { Add (theType->Name()); }
+
+    void Add (const Standard_CString theString) { add (theString, strlen (theString)); }
+
+    void Add (const TColStd_Array1OfReal& theValues)
+    {
+      for (TColStd_Array1OfReal::Iterator anIter (theValues); anIter.More(); anIter.Next()) { Add (anIter.Value()); }
+    }
+
+    void Add (const TColStd_Array1OfInteger& theValues)
+    {
+      for (TColStd_Array1OfInteger::Iterator anIter (theValues); anIter.More(); anIter.Next()) { Add (anIter.Value()); }
+    }
+
+    void Add (const TColgp_Array1OfPnt& thePoints)
+    {
+      for (TColgp_Array1OfPnt::Iterator anIter (thePoints); anIter.More(); anIter.Next()) { Add (anIter.Value().XYZ()); }
+    }
+
+    void Add (const TColgp_Array2OfPnt& thePoints)
+    {
+      for (Standard_Integer aRow = thePoints.LowerRow(); aRow <= thePoints.UpperRow(); ++aRow)
+      {
+        for (Standard_Integer aCol = thePoints.LowerCol(); aCol <= thePoints.UpperCol(); ++aCol) { Add (thePoints (aRow, aCol).XYZ()); }
+      }
+    }
+
+    void Add (const TColStd_Array2OfReal& theValues)
+    {
+      for (Standard_Integer aRow = theValues.LowerRow(); aRow <= theValues.UpperRow(); ++aRow)
+      {
+        for (Standard_Integer aCol = theValues.LowerCol(); aCol <= theValues.UpperCol(); ++aCol) { Add (theValues (aRow, aCol)); }
+      }
+    }
+
+    //! Adds the geometry of the curve.
+    void Add (const Handle(Geom_Curve)& theCurve)
+    {
+      if (theCurve.IsNull())
+      {
+        return;
+      }
+
+      Add (theCurve->DynamicType());
+      if (Handle(Geom_BSplineCurve) aBSpline = Handle(Geom_BSplineCurve)::DownCast (theCurve))
+      {
+        Add (aBSpline->Degree());
+        Add (aBSpline->IsPeriodic() ? 1 : 0);
+        Add (aBSpline->Poles());
+        if (const TColStd_Array1OfReal* aWeights = aBSpline->Weights())
+        {
+          Add (*aWeights);
+        }
+        Add (aBSpline->Knots());
+        Add (aBSpline->Multiplicities());
+      }
+      else if (Handle(Geom_BezierCurve) aBezier = Handle(Geom_BezierCurve)::DownCast (theCurve))
+      {
+        Add (aBezier->Poles());
+        if (const TColStd_Array1OfReal* aWeights = aBezier->Weights())
+        {
+          Add (*aWeights);
+        }
+      }
+      else if (Handle(Geom_TrimmedCurve) aTrimmed = Handle(Geom_TrimmedCurve)::DownCast (theCurve))
+      {
+        Add (aTrimmed->FirstParameter());
+        Add (aTrimmed->LastParameter());
+        Add (aTrimmed->BasisCurve());
+      }
+      else if (Handle(Geom_OffsetCurve) anOffset = Handle(Geom_OffsetCurve)::DownCast (theCurve))
+      {
+        Add (anOffset->Offset());
+        Add (anOffset->Direction().XYZ());
+        Add (anOffset->BasisCurve());
+      }
+      else
+      {
+        // the elementary curves are defined by the points at several parameters
+        for (Standard_Integer aParamIter = 0; aParamIter < 5; ++aParamIter)
+        {
+          Add (theCurve->Value (0.25 * aParamIter).XYZ());
+        }
+      }
+    }
+
+    //! Adds the geometry of the surface.
+    void Add (const Handle(Geom_Surface)& theSurface)
+    {
+      if (theSurface.IsNull())
+      {
+        return;
+      }
+
+      Add (theSurface->DynamicType());
+      if (Handle(Geom_BSplineSurface) aBSpline = Handle(Geom_BSplineSurface)::DownCast (theSurface))
+      {
+        Add (aBSpline->UDegree());
+        Add (aBSpline->VDegree());
+        Add ((aBSpline->IsUPeriodic() ? 1 : 0) + (aBSpline->IsVPeriodic() ? 2 : 0));
+        Add (aBSpline->Poles());
+        if (const TColStd_Array2OfReal* aWeights = aBSpline->Weights())
+        {
+          Add (*aWeights);
+        }
+        Add (aBSpline->UKnots());
+        Add (aBSpline->VKnots());
+        Add (aBSpline->UMultiplicities());
+        Add (aBSpline->VMultiplicities());
+      }
+      else if (Handle(Geom_BezierSurface) aBezier = Handle(Geom_BezierSurface)::DownCast (theSurface))
+      {
+        Add (aBezier->Poles());
+        if (const TColStd_Array2OfReal* aWeights = aBezier->Weights())
+        {
+          Add (*aWeights);
+        }
+      }
+      else if (Handle(Geom_RectangularTrimmedSurface) aTrimmed = Handle(Geom_RectangularTrimmedSurface)::DownCast (theSurface))
+      {
+        Standard_Real aBounds[4];
+        aTrimmed->Bounds (aBounds[0], aBounds[1], aBounds[2], aBounds[3]);
+        for (Standard_Integer aBoundIter = 0; aBoundIter < 4; ++aBoundIter)
+        {
+          Add (aBounds[aBoundIter]);
+        }
+        Add (aTrimmed->BasisSurface());
+      }
+      else if (Handle(Geom_OffsetSurface) anOffset = Handle(Geom_OffsetSurface)::DownCast (theSurface))
+      {
+        Add (anOffset->Offset());
+        Add (anOffset->BasisSurface());
+      }
+      else if (Handle(Geom_SurfaceOfRevolution) aRevolution = Handle(Geom_SurfaceOfRevolution)::DownCast (theSurface))
+      {
+        Add (aRevolution->Location().XYZ());
+        Add (aRevolution->Direction().XYZ());
+        Add (aRevolution->BasisCurve());
+      }
+      else if (Handle(Geom_SurfaceOfLinearExtrusion) anExtrusion = Handle(Geom_SurfaceOfLinearExtrusion)::DownCast (theSurface))
+      {
+        Add (anExtrusion->Direction().XYZ());
+        Add (anExtrusion->BasisCurve());
+      }
+      else
+      {
+        // the elementary surfaces are defined by the points at several parameters
+        for (Standard_Integer aUIter = 0; aUIter < 3; ++aUIter)
+        {
+          for (Standard_Integer aVIter = 0; aVIter < 3; ++aVIter)
+          {
+            Add (theSurface->Value (0.5 * aUIter, 0.5 * aVIter).XYZ());
+          }
+        }
+      }
+    }
+
+  private:
+
+    void add (const void* theData, const Standard_Size theSize)
+    {
+      const unsigned char* aBytes = static_cast<const unsigned char*> (theData);
+      for (Standard_Size aByteIter = 0; aByteIter < theSize; ++aByteIter)
+      {
+        myHash = (myHash ^ aBytes[aByteIter]) * 1099511628211ULL;
+      }
+    }
+
+  private:
+    unsigned long long myHash;
+  };
+}
+
+//=======================================================================
+//function : Key::ComputeStamps
+//purpose  :
+//=======================================================================
+void ProjLib_ProjectionCache::Key::ComputeStamps()
+{
+  GeometryStamp aCurveStamp;
+  aCurveStamp.Add (Handle(Geom_Curve)::DownCast (Curve));
+  CurveStamp = aCurveStamp.Value();
+
+  GeometryStamp aSurfaceStamp;
+  aSurfaceStamp.Add (Handle(Geom_Surface)::DownCast (Surface));
+  SurfaceStamp = aSurfaceStamp.Value();
+}
+
+//=======================================================================
+//function : Key::IsEqual
+//purpose  :
+//=======================================================================
+Standard_Boolean ProjLib_ProjectionCache::Key::IsEqual (const Key& theOther) const
+{
+  return Curve   == theOther.Curve
+      && Surface == theOther.Surface
+      && CurveLocation   == theOther.CurveLocation
+      && SurfaceLocation == theOther.SurfaceLocation
+      && First == theOther.First
+      && Last  == theOther.Last
+      && UMin  == theOther.UMin
+      && UMax  == theOther.UMax
+      && VMin  == theOther.VMin
+      && VMax  == theOther.VMax
+      && Tolerance == theOther.Tolerance
+      && CurveStamp   == theOther.CurveStamp
+      && SurfaceStamp == theOther.SurfaceStamp;
+}
+
+//=======================================================================
+//function : Key::HashCode
+//purpose  :
+//=======================================================================
+Standard_Integer ProjLib_ProjectionCache::Key::HashCode (const Standard_Integer theUpperBound) const
+{
+  const Standard_Integer aMax = IntegerLast();
+  unsigned int aHash = static_cast<unsigned int> (::HashCode (Curve.get(), aMax));
+  combineHash (aHash, ::HashCode (Surface.get(), aMax));
+  combineHash (aHash, CurveLocation.HashCode (aMax));
+  combineHash (aHash, SurfaceLocation.HashCode (aMax));
+  combineHash (aHash, ::HashCode (First, aMax));
+  combineHash (aHash, ::HashCode (Last,  aMax));
+  combineHash (aHash, ::HashCode (CurveStamp,   aMax));
+  combineHash (aHash, ::HashCode (SurfaceStamp, aMax));
+  return ::HashCode (aHash, theUpperBound);
+}
+
+//=======================================================================
+//function : Current
+//purpose  :
+//=======================================================================
+Handle(ProjLib_ProjectionCache) ProjLib_ProjectionCache::Current()
+{
+#if defined(Standard_HASTHREADLOCAL)
+  return THE_CURRENT_CACHE;
+#else
+  return Handle(ProjLib_ProjectionCache)();
+#endif
+}
+
+//=======================================================================
+//function : SetCurrent
+//purpose  :
+//=======================================================================
+Handle(ProjLib_ProjectionCache) ProjLib_ProjectionCache::SetCurrent (const Handle(ProjLib_ProjectionCache)& theCache)
+{
+#if defined(Standard_HASTHREADLOCAL)
+  Handle(ProjLib_ProjectionCache) aPrevious = THE_CURRENT_CACHE;
+  THE_CURRENT_CACHE = theCache;
+  return aPrevious;
+#else
+  (void )theCache;
+  return Handle(ProjLib_ProjectionCache)();
+#endif
+}
+
+//=======================================================================
+//function : ProjLib_ProjectionCache
+//purpose  :
+//=======================================================================
+ProjLib_ProjectionCache::ProjLib_ProjectionCache (const Standard_Integer theMaxSize)
+: myItems (Max (theMaxSize, 1)),
+  myOrder (0, Max (theMaxSize, 1) - 1),
+  myNext (0),
+  myNbHits (0),
+  myNbMisses (0),
+  myNbEvictions (0)
+{
+  //
+}
+
+//=======================================================================
+//function : Find
+//purpose  :
+//=======================================================================
+Standard_Boolean ProjLib_ProjectionCache::Find (const Key& theKey,
+                                                Handle(Geom2d_Curve)& theCurve2d,
+                                                Standard_Real& theTolerance)
+{
+  Handle(Geom2d_Curve) aCurve2d;
+  {
+    Standard_Mutex::Sentry aLock (myMutex);
+    const Item* anItem = myItems.Seek (theKey);
+    if (anItem == NULL)
+    {
+      ++myNbMisses;
+      return Standard_False;
+    }
+    ++myNbHits;
+    aCurve2d     = anItem->Curve2d;
+    theTolerance = anItem->Tolerance;
+  }
+
+  // the cached curve is never modified, so it can be copied out of the lock
+  theCurve2d = Handle(Geom2d_Curve)::DownCast (aCurve2d->Copy());
+  return Standard_True;
+}
+
+//=======================================================================
+//function : Add
+//purpose  :
+//=======================================================================
+void ProjLib_ProjectionCache::Add (const Key& theKey,
+                                   const Handle(Geom2d_Curve)& theCurve2d,
+                                   const Standard_Real theTolerance)
+{
+  if (theCurve2d.IsNull())
+  {
+    return;
+  }
+
+  Item anItem;
+  anItem.Curve2d   = Handle(Geom2d_Curve)::DownCast (theCurve2d->Copy());
+  anItem.Tolerance = theTolerance;
+
+  Standard_Mutex::Sentry aLock (myMutex);
+  if (myItems.IsBound (theKey))
+  {
+    return;
+  }
+
+  // remove the oldest key occupying the position in the ring
+  Key& aSlot = myOrder.ChangeValue (myNext);
+  if (myItems.UnBind (aSlot))
+  {
+    ++myNbEvictions;
+  }
+  aSlot  = theKey;
+  myNext = (myNext + 1) % myOrder.Size();
+  myItems.Bind (theKey, anItem);
+}
+
+//=======================================================================
+//function : Clear
+//purpose  :
+//=======================================================================
+void ProjLib_ProjectionCache::Clear()
+{
+  Standard_Mutex::Sentry aLock (myMutex);
+  myItems.Clear();
+  myOrder.Init (Key());
+  myNext = 0;
+}
+
+//=======================================================================
+//function : Size
+//purpose  :
+//=======================================================================
+Standard_Integer ProjLib_ProjectionCache::Size() const
+{
+  Standard_Mutex::Sentry aLock (myMutex);
+  return myItems.Extent();
+}
+
+//=======================================================================
+//function : ResetStatistics
+//purpose  :
+//=======================================================================
+void ProjLib_ProjectionCache::ResetStatistics()
+{
+  Standard_Mutex::Sentry aLock (myMutex);
+  myNbHits = myNbMisses = myNbEvictions = 0;
+}
+
+//=======================================================================
+//function : DumpStatistics
+//purpose  :
+//=======================================================================
+void ProjLib_ProjectionCache::DumpStatistics (Standard_OStream& theStream) const
+{
+  Standard_Mutex::Sentry aLock (myMutex);
+  theStream << "Projection cache: " << myItems.Extent() << " of " << myOrder.Size() << " pcurves, "
+            << myNbHits << " hits, " << myNbMisses << " misses, " << myNbEvictions << " evictions\n";
+}
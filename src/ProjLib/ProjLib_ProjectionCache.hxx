@@ -0,0 +1,186 @@
+// Copyright (c) 2024 OPEN CASCADE SAS
+//
+// This file is part of Open CASCADE Technology software library.
+//
+// This library is free software; you can redistribute it and/or modify it under
+// the terms of the GNU Lesser General Public License version 2.1 as published
+// by the Free Software Foundation, with special exception defined in the file
+// OCCT_LGPL_EXCEPTION.txt. Consult the file LICENSE_LGPL_21.txt included in OCCT
+// distribution for complete text of the license and disclaimer of any warranty.
+//
+// Alternatively, this file may be used under the terms of Open CASCADE
+// commercial license or contractual agreement.
+
+#ifndef _ProjLib_ProjectionCache_HeaderFile
+#define _ProjLib_ProjectionCache_HeaderFile
+
+#include <NCollection_Array1.hxx>
+#include <NCollection_DataMap.hxx>
+#include <Standard_Mutex.hxx>
+#include <Standard_Transient.hxx>
+#include <TopLoc_Location.hxx>
+
+class Geom2d_Curve;
+
+//! Cache of the 2d curves computed by projection of the 3d curves onto the surfaces,
+//! shared by the algorithms computing the same pcurves repeatedly (sewing, Boolean
+//! operations, healing).
+//!
+//! The pcurve is identified by the key composed of the 3d curve and the surface
+//! objects with their locations, the range of the curve, the parametric bounds of
+//! the surface and the tolerance of the projection; the algorithm consulting the
+//! cache defines the fields of the key significant for its result.
+//! The key keeps the curve and the surface alive, so that the addresses of the
+//! objects cannot be reused by other objects while the key is in the cache.
+//! The key also keeps the stamps of the geometry of the curve and the surface
+//! (Key::ComputeStamps()), so that the pcurve computed before the modification of the
+//! curve or the surface in place is not found for the same objects afterwards.
+//!
+//! The cache is thread-safe: the search and the addition are protected by the mutex,
+//! the projection itself is computed by the algorithm out of the lock.
+//! The pcurves are copied on addition and on search, so that the modification of
+//! the returned pcurve does not affect the cache.
+//!
+//! The number of the cached pcurves is bounded by MaxSize(): when it is reached,
+//! the oldest pcurve is removed on addition of the new one.
+//!
+//! The cache is not used by default; the algorithms consult the cache returned by
+//! Current(), which is set for the scope of the operation by ProjLib_ProjectionCacheScope.
+//! The current cache is local to the thread and is released on exit of the thread.
+//! The Boolean operations pass the cache to their parallel workers explicitly:
+//! IntTools_Context takes the current cache of the thread creating it, and the contexts
+//! of the workers take the cache of the context of the operation (see BOPTools_Parallel).
+//! Without support of thread-local storage by the compiler the cache is never current.
+class ProjLib_ProjectionCache : public Standard_Transient
+{
+  DEFINE_STANDARD_RTTIEXT(ProjLib_ProjectionCache, Standard_Transient)
+public:
+
+  //! Key of the projection.
+  struct Key
+  {
+    Handle(Standard_Transient) Curve;           //!< projected 3d curve
+    TopLoc_Location            CurveLocation;   //!< location of the 3d curve
+    Handle(Standard_Transient) Surface;         //!< surface
+    TopLoc_Location            SurfaceLocation; //!< location of the surface
+    Standard_Real              First;           //!< range of the 3d curve
+    Standard_Real              Last;
+    Standard_Real              UMin;            //!< parametric bounds of the surface
+    Standard_Real              UMax;
+    Standard_Real              VMin;
+    Standard_Real              VMax;
+    Standard_Real              Tolerance;       //!< tolerance of the projection
+    Standard_Size              CurveStamp;      //!< stamp of the geometry of the curve
+    Standard_Size              SurfaceStamp;    //!< stamp of the geometry of the surface
+
+    //! Empty constructor.
+    Key() : First (0.0), Last (0.0), UMin (0.0), UMax (0.0), VMin (0.0), VMax (0.0), Tolerance (0.0),
+            CurveStamp (0), SurfaceStamp (0) {}
+
+    //! Computes the stamps of the geometry of the curve and the surface of the key;
+    //! should be called after definition of the other fields of the key.
+    //! The stamp is the hash of the poles, weights and knots of B-spline and Bezier geometry,
+    //! or of the points evaluated at several parameters for the other geometry.
+    Standard_EXPORT void ComputeStamps();
+
+    //! Returns true if the keys are equal.
+    Standard_EXPORT Standard_Boolean IsEqual (const Key& theOther) const;
+
+    //! Returns the hash code of the key in the range [1, theUpperBound].
+    Standard_EXPORT Standard_Integer HashCode (const Standard_Integer theUpperBound) const;
+  };
+
+  //! Hasher of the keys.
+  struct Hasher
+  {
+    static Standard_Integer HashCode (const Key& theKey, const Standard_Integer theUpperBound)
+    {
+      return theKey.HashCode (theUpperBound);
+    }
+
+    static Standard_Boolean IsEqual (const Key& theKey1, const Key& theKey2)
+    {
+      return theKey1.IsEqual (theKey2);
+    }
+  };
+
+public:
+
+  //! Returns the cache of the current scope of the calling thread, or NULL if the cache is not used.
+  //! Does not lock anything.
+  Standard_EXPORT static Handle(ProjLib_ProjectionCache) Current();
+
+  //! Sets the cache of the current scope of the calling thread, NULL to stop using the cache.
+  //! Returns the previous one. The current cache is kept alive until it is replaced
+  //! or until the exit of the thread.
+  //! @sa ProjLib_ProjectionCacheScope
+  Standard_EXPORT static Handle(ProjLib_ProjectionCache) SetCurrent (const Handle(ProjLib_ProjectionCache)& theCache);
+
+public:
+
+  //! Constructor.
+  //! @param theMaxSize maximal number of the cached pcurves
+  Standard_EXPORT ProjLib_ProjectionCache (const Standard_Integer theMaxSize = 10000);
+
+  //! Searches the pcurve of the key; returns the copy of the pcurve
+  //! and the tolerance reached by the projection.
+  Standard_EXPORT Standard_Boolean Find (const Key& theKey,
+                                         Handle(Geom2d_Curve)& theCurve2d,
+                                         Standard_Real& theTolerance);
+
+  //! Adds the copy of the pcurve computed for the key; does nothing if the key is already cached.
+  //! The oldest pcurve is removed if the number of the pcurves reaches MaxSize().
+  Standard_EXPORT void Add (const Key& theKey,
+                            const Handle(Geom2d_Curve)& theCurve2d,
+                            const Standard_Real theTolerance);
+
+  //! Removes all pcurves; the statistics are kept.
+  Standard_EXPORT void Clear();
+
+  //! Returns the maximal number of the cached pcurves.
+  Standard_Integer MaxSize() const { return myOrder.Size(); }
+
+  //! Returns the number of the cached pcurves.
+  Standard_EXPORT Standard_Integer Size() const;
+
+  //! Returns the number of the searches which have found the pcurve.
+  Standard_Size NbHits() const { return myNbHits; }
+
+  //! Returns the number of the searches which have not found the pcurve.
+  Standard_Size NbMisses() const { return myNbMisses; }
+
+  //! Returns the number of the pcurves removed because of the size limit.
+  Standard_Size NbEvictions() const { return myNbEvictions; }
+
+  //! Resets the counters of the statistics.
+  Standard_EXPORT void ResetStatistics();
+
+  //! Dumps the statistics of the cache.
+  Standard_EXPORT void DumpStatistics (Standard_OStream& theStream) const;
+
+private:
+
+  //! Cached pcurve.
+  struct Item
+  {
+    Handle(Geom2d_Curve) Curve2d;   //!< pcurve
+    Standard_Real        Tolerance; //!< tolerance reached by the projection
+
+    Item() : Tolerance (0.0) {}
+  };
+
+private:
+
+  mutable Standard_Mutex                  myMutex;       //!< mutex protecting the cache
+  NCollection_DataMap<Key, Item, Hasher>  myItems;       //!< cached pcurves
+  NCollection_Array1<Key>                 myOrder;       //!< ring of the keys in the order of addition
+  Standard_Integer                        myNext;        //!< position of the next key in the ring
+  Standard_Size                           myNbHits;      //!< number of the found pcurves
+  Standard_Size                           myNbMisses;    //!< number of the missed pcurves
+  Standard_Size                           myNbEvictions; //!< number of the removed pcurves
+
+};
+
+DEFINE_STANDARD_HANDLE(ProjLib_ProjectionCache, Standard_Transient)
+
+#endif // _ProjLib_ProjectionCache_HeaderFile
@@ -0,0 +1,71 @@
+// Copyright (c) 2024 OPEN CASCADE SAS
+//
+// This file is part of Open CASCADE Technology software library.
+//
+// This library is free software; you can redistribute it and/or modify it under
+// the terms of the GNU Lesser General Public License version 2.1 as published
+// by the Free Software Foundation, with special exception defined in the file
+// OCCT_LGPL_EXCEPTION.txt. Consult the file LICENSE_LGPL_21.txt included in OCCT
+// distribution for complete text of the license and disclaimer of any warranty.
+//
+// Alternatively, this file may be used under the terms of Open CASCADE
+// commercial license or contractual agreement.
+
+#ifndef _ProjLib_ProjectionCacheScope_HeaderFile
+#define _ProjLib_ProjectionCacheScope_HeaderFile
+
+#include <ProjLib_ProjectionCache.hxx>
+
+//! Sets the projection cache as the current one for the lifetime of the scope object
+//! and restores the previous cache on destruction, e.g.:
+//! @code
+//!   ProjLib_ProjectionCacheScope aCacheScope;
+//!   ShapeFix_Shape aFixer (theShape);
+//!   aFixer.Perform();
+//!   BRepAlgoAPI_Fuse aFuser (aFixer.Shape(), theTool);
+//!   aCacheScope.Cache()->DumpStatistics (std::cout);
+//! @endcode
+//! The current cache is local to the thread, so the scope affects the operations
+//! run by the thread creating it, and should be destroyed by the same thread.
+//! The parallel workers of the Boolean operations started within the scope
+//! use the cache as well (see ProjLib_ProjectionCache).
+class ProjLib_ProjectionCacheScope
+{
+public:
+
+  //! Sets the new cache with default limit of the size as the current one.
+  ProjLib_ProjectionCacheScope()
+  : myCache (new ProjLib_ProjectionCache())
+  {
+    myPrevious = ProjLib_ProjectionCache::SetCurrent (myCache);
+  }
+
+  //! Sets the given cache as the current one.
+  explicit ProjLib_ProjectionCacheScope (const Handle(ProjLib_ProjectionCache)& theCache)
+  : myCache (theCache)
+  {
+    myPrevious = ProjLib_ProjectionCache::SetCurrent (myCache);
+  }
+
+  //! Restores the previous cache.
+  ~ProjLib_ProjectionCacheScope()
+  {
+    ProjLib_ProjectionCache::SetCurrent (myPrevious);
+  }
+
+  //! Returns the cache of the scope.
+  const Handle(ProjLib_ProjectionCache)& Cache() const { return myCache; }
+
+private:
+
+  ProjLib_ProjectionCacheScope (const ProjLib_ProjectionCacheScope& );
+  ProjLib_ProjectionCacheScope& operator= (const ProjLib_ProjectionCacheScope& );
+
+private:
+
+  Handle(ProjLib_ProjectionCache) myCache;    //!< cache of the scope
+  Handle(ProjLib_ProjectionCache) myPrevious; //!< cache to be restored
+
+};
+
+#endif // _ProjLib_ProjectionCacheScope_HeaderFile
@@ -2610,7 +2610,7 @@ static Standard_Integer OCC24826(Draw_Interpretor& theDI,
   }
 
   // Parallel processing
-  for (Standard_Integer aMode = 0; aMode <= 4; ++aMode)
+  for (Standard_Integer aMode = 0; aMode <= 6; ++aMode)
   {
     NCollection_Array1<Standard_Real> anY2 = anY;
     OSD_Timer aTimer;
@@ -2647,6 +2647,28 @@ static Standard_Integer OCC24826(Draw_Interpretor& theDI,
         break;
       }
       case 4:
+      {
+        aModeDesc = "OSD_Parallel::For(), grain size 4096";
+        OSD_Parallel::For (aFunctor1.Begin(), aFunctor1.End(), 4096, aFunctor1);
+        break;
+      }
+      case 5:
+      {
+        // the nested launchers share the threads of the outer one
+        aModeDesc = "OSD_ThreadPool::Launcher, nested";
+        const Standard_Integer aNbSlices = 16;
+        const Standard_Integer aSliceSize = (aLength + aNbSlices - 1) / aNbSlices;
+        OSD_ThreadPool::Launcher aLauncher (*OSD_ThreadPool::DefaultPool());
+        aLauncher.Perform (0, aNbSlices, [&](int , int theSliceIndex)
+        {
+          const Standard_Integer aBegin = Min (theSliceIndex * aSliceSize, aLength);
+          const Standard_Integer anEnd  = Min (aBegin + aSliceSize, aLength);
+          OSD_ThreadPool::Launcher aNestedLauncher (*OSD_ThreadPool::DefaultPool());
+          aNestedLauncher.Perform (aBegin, anEnd, aFunctor1);
+        });
+        break;
+      }
+      case 6:
       {
     #ifdef HAVE_TBB
         aModeDesc = "tbb::parallel_for";
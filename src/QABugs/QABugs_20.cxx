@@ -32,6 +32,8 @@
 
 #include <TopExp.hxx>
 #include <TopExp_Explorer.hxx>
+#include <TopExp_ShapeMapCache.hxx>
+#include <TopoDS_ShapeIndex.hxx>
 #include <TopoDS_Vertex.hxx>
 #include <BRep_Tool.hxx>
 #include <TopoDS_Compound.hxx>
@@ -4475,6 +4477,1949 @@ static Standard_Integer OCC26441(Draw_Interpretor& theDi, Standard_Integer theNb
 }
 
 
+//=======================================================================
+//function : QATopExpMapShapes
+//purpose  : Compares the maps of sub-shapes filled by TopExp in parallel
+//           and sequential modes
+//=======================================================================
+static Standard_Integer QATopExpMapShapes (Draw_Interpretor& theDI,
+                                           Standard_Integer theNbArgs,
+                                           const char** theArgVec)
+{
+  if (theNbArgs != 2)
+  {
+    theDI << "Syntax error: wrong number of arguments\n";
+    return 1;
+  }
+
+  const TopoDS_Shape aShape = DBRep::Get (theArgVec[1]);
+  if (aShape.IsNull())
+  {
+    theDI << "Error: " << theArgVec[1] << " is a null shape\n";
+    return 1;
+  }
+
+  OSD_Timer aTimerSeq, aTimerPar;
+  Standard_Integer aNbErrors = 0;
+  for (Standard_Integer aType = TopAbs_COMPOUND; aType <= TopAbs_SHAPE; ++aType)
+  {
+    const TopAbs_ShapeEnum aShapeType = (TopAbs_ShapeEnum )aType;
+    TopTools_IndexedMapOfShape aMapSeq, aMapPar;
+    aTimerSeq.Start();
+    if (aShapeType == TopAbs_SHAPE)
+      TopExp::MapShapes (aShape, aMapSeq);
+    else
+      TopExp::MapShapes (aShape, aShapeType, aMapSeq);
+    aTimerSeq.Stop();
+
+    aTimerPar.Start();
+    if (aShapeType == TopAbs_SHAPE)
+      TopExp::MapShapes (aShape, aMapPar, Standard_True, Standard_True, Standard_True);
+    else
+      TopExp::MapShapes (aShape, aShapeType, aMapPar, Standard_True);
+    aTimerPar.Stop();
+
+    Standard_Boolean isSame = aMapSeq.Extent() == aMapPar.Extent();
+    for (Standard_Integer anIndex = 1; isSame && anIndex <= aMapSeq.Extent(); ++anIndex)
+    {
+      isSame = aMapSeq (anIndex).IsEqual (aMapPar (anIndex));
+    }
+    if (!isSame)
+    {
+      ++aNbErrors;
+      theDI << "Error: different maps of " << TopAbs::ShapeTypeToString (aShapeType) << "\n";
+    }
+  }
+
+  const TopAbs_ShapeEnum aTypes[3][2] = { { TopAbs_VERTEX, TopAbs_EDGE },
+                                          { TopAbs_EDGE,   TopAbs_FACE },
+                                          { TopAbs_FACE,   TopAbs_SOLID } };
+  for (Standard_Integer aPairIter = 0; aPairIter < 3; ++aPairIter)
+  {
+    TopTools_IndexedDataMapOfShapeListOfShape aMapSeq, aMapPar;
+    aTimerSeq.Start();
+    TopExp::MapShapesAndAncestors (aShape, aTypes[aPairIter][0], aTypes[aPairIter][1], aMapSeq);
+    aTimerSeq.Stop();
+
+    aTimerPar.Start();
+    TopExp::MapShapesAndAncestors (aShape, aTypes[aPairIter][0], aTypes[aPairIter][1], aMapPar, Standard_True);
+    aTimerPar.Stop();
+
+    Standard_Boolean isSame = aMapSeq.Extent() == aMapPar.Extent();
+    for (Standard_Integer anIndex = 1; isSame && anIndex <= aMapSeq.Extent(); ++anIndex)
+    {
+      isSame = aMapSeq.FindKey (anIndex).IsEqual (aMapPar.FindKey (anIndex))
+            && aMapSeq (anIndex).Extent() == aMapPar (anIndex).Extent();
+      TopTools_ListIteratorOfListOfShape anItSeq (aMapSeq (anIndex)), anItPar (aMapPar (anIndex));
+      for (; isSame && anItSeq.More(); anItSeq.Next(), anItPar.Next())
+      {
+        isSame = anItSeq.Value().IsEqual (anItPar.Value());
+      }
+    }
+    if (!isSame)
+    {
+      ++aNbErrors;
+      theDI << "Error: different maps of " << TopAbs::ShapeTypeToString (aTypes[aPairIter][0])
+            << " and ancestors " << TopAbs::ShapeTypeToString (aTypes[aPairIter][1]) << "\n";
+    }
+  }
+
+  // the cache should return the same maps without exploration
+  Handle(TopExp_ShapeMapCache) aCache = new TopExp_ShapeMapCache (aShape, Standard_True);
+  const TopTools_IndexedMapOfShape& aFaces = aCache->Shapes (TopAbs_FACE);
+  if (&aFaces != &aCache->Shapes (TopAbs_FACE)
+   || &aCache->ShapesAndAncestors (TopAbs_EDGE, TopAbs_FACE) != &aCache->ShapesAndAncestors (TopAbs_EDGE, TopAbs_FACE))
+  {
+    ++aNbErrors;
+    theDI << "Error: the maps are not cached\n";
+  }
+
+  theDI << "Sequential time: " << aTimerSeq.ElapsedTime() << " s\n";
+  theDI << "Parallel time: " << aTimerPar.ElapsedTime() << " s\n";
+  if (aNbErrors == 0)
+  {
+    theDI << "The maps filled in parallel are the same as in sequential mode\n";
+  }
+  return 0;
+}
+
+//=======================================================================
+//function : QAShapeIndex
+//purpose  : Checks the topology index against the maps filled by TopExp
+//=======================================================================
+static Standard_Integer QAShapeIndex (Draw_Interpretor& theDI,
+                                      Standard_Integer theNbArgs,
+                                      const char** theArgVec)
+{
+  if (theNbArgs != 2)
+  {
+    theDI << "Syntax error: wrong number of arguments\n";
+    return 1;
+  }
+
+  const TopoDS_Shape aShape = DBRep::Get (theArgVec[1]);
+  if (aShape.IsNull())
+  {
+    theDI << "Error: " << theArgVec[1] << " is a null shape\n";
+    return 1;
+  }
+
+  OSD_Timer aTimerMaps, aTimerIndex;
+  aTimerIndex.Start();
+  Handle(TopoDS_ShapeIndex) anIndex = new TopoDS_ShapeIndex (aShape);
+  aTimerIndex.Stop();
+
+  Standard_Integer aNbErrors = 0;
+  TopTools_IndexedMapOfShape aMap;
+  aTimerMaps.Start();
+  TopExp::MapShapes (aShape, aMap);
+  aTimerMaps.Stop();
+  if (aMap.Extent() != anIndex->NbShapes())
+  {
+    ++aNbErrors;
+    theDI << "Error: wrong number of sub-shapes " << anIndex->NbShapes() << " instead of " << aMap.Extent() << "\n";
+  }
+
+  // the ids of the sub-shapes of each type should follow the order of the map
+  Standard_Integer aNbOfType[TopAbs_SHAPE] = {};
+  for (Standard_Integer aShapeIter = 1; aShapeIter <= aMap.Extent(); ++aShapeIter)
+  {
+    const TopoDS_Shape& aSubShape = aMap (aShapeIter);
+    const Standard_Integer anId = anIndex->FirstId (aSubShape.ShapeType()) + aNbOfType[aSubShape.ShapeType()]++;
+    if (anIndex->Id (aSubShape) != anId
+    || !anIndex->Shape (anId).IsSame (aSubShape))
+    {
+      ++aNbErrors;
+      theDI << "Error: wrong id of the sub-shape " << aShapeIter << "\n";
+      break;
+    }
+  }
+
+  // the children should be the same as given by the iterator
+  for (Standard_Integer anId = 1; anId <= anIndex->NbShapes(); ++anId)
+  {
+    Standard_Integer aChildIndex = 0;
+    Standard_Boolean isSame = Standard_True;
+    for (TopoDS_Iterator aChildIter (anIndex->Shape (anId), Standard_False); isSame && aChildIter.More(); aChildIter.Next())
+    {
+      ++aChildIndex;
+      isSame = aChildIndex <= anIndex->NbChildren (anId)
+            && anIndex->Child (anId, aChildIndex) == anIndex->Id (aChildIter.Value())
+            && anIndex->ChildOrientation (anId, aChildIndex) == aChildIter.Value().Orientation();
+    }
+    if (!isSame || aChildIndex != anIndex->NbChildren (anId))
+    {
+      ++aNbErrors;
+      theDI << "Error: wrong children of the sub-shape " << anId << "\n";
+      break;
+    }
+  }
+
+  // the ancestors should be the same as in the maps filled by TopExp
+  const TopAbs_ShapeEnum aTypes[3][2] = { { TopAbs_VERTEX, TopAbs_EDGE },
+                                          { TopAbs_EDGE,   TopAbs_FACE },
+                                          { TopAbs_FACE,   TopAbs_SOLID } };
+  for (Standard_Integer aPairIter = 0; aPairIter < 3; ++aPairIter)
+  {
+    TopTools_IndexedDataMapOfShapeListOfShape anAncMap;
+    aTimerMaps.Start();
+    TopExp::MapShapesAndUniqueAncestors (aShape, aTypes[aPairIter][0], aTypes[aPairIter][1], anAncMap);
+    aTimerMaps.Stop();
+
+    Standard_Boolean isSame = anAncMap.Extent() == anIndex->NbShapes (aTypes[aPairIter][0]);
+    NCollection_Vector<Standard_Integer> anAncestors;
+    for (Standard_Integer aShapeIter = 1; isSame && aShapeIter <= anAncMap.Extent(); ++aShapeIter)
+    {
+      anAncestors.Clear();
+      aTimerIndex.Start();
+      anIndex->Ancestors (anIndex->Id (anAncMap.FindKey (aShapeIter)), aTypes[aPairIter][1], anAncestors);
+      aTimerIndex.Stop();
+      isSame = anAncestors.Length() == anAncMap (aShapeIter).Extent();
+      for (TopTools_ListIteratorOfListOfShape anAncIter (anAncMap (aShapeIter)); isSame && anAncIter.More(); anAncIter.Next())
+      {
+        isSame = Standard_False;
+        for (NCollection_Vector<Standard_Integer>::Iterator anIdIter (anAncestors); anIdIter.More(); anIdIter.Next())
+        {
+          isSame = isSame || anIndex->Shape (anIdIter.Value()).IsSame (anAncIter.Value());
+        }
+      }
+    }
+    if (!isSame)
+    {
+      ++aNbErrors;
+      theDI << "Error: different ancestors " << TopAbs::ShapeTypeToString (aTypes[aPairIter][1])
+            << " of " << TopAbs::ShapeTypeToString (aTypes[aPairIter][0]) << "\n";
+    }
+  }
+
+  theDI << "TopExp maps time: " << aTimerMaps.ElapsedTime() << " s\n";
+  theDI << "Shape index time: " << aTimerIndex.ElapsedTime() << " s\n";
+  if (aNbErrors == 0)
+  {
+    theDI << "The shape index is consistent with the maps filled by TopExp\n";
+  }
+  return 0;
+}
+
+#include <BRepMesh_IncrementalMesh.hxx>
+#include <BRepPrimAPI_MakeSphere.hxx>
+#include <OSD_TaskGraph.hxx>
+
+namespace
+{
+  //! Returns the number of triangles of the faces of the shape.
+  static Standard_Integer countTriangles (const TopoDS_Shape& theShape)
+  {
+    Standard_Integer aNbTriangles = 0;
+    for (TopExp_Explorer aFaceIter (theShape, TopAbs_FACE); aFaceIter.More(); aFaceIter.Next())
+    {
+      TopLoc_Location aLoc;
+      const Handle(Poly_Triangulation)& aTris = BRep_Tool::Triangulation (TopoDS::Face (aFaceIter.Current()), aLoc);
+      aNbTriangles += !aTris.IsNull() ? aTris->NbTriangles() : 0;
+    }
+    return aNbTriangles;
+  }
+}
+
+//=======================================================================
+//function : QATaskGraph
+//purpose  : Streams the parts through the stages of the task graph
+//=======================================================================
+static Standard_Integer QATaskGraph (Draw_Interpretor& theDI,
+                                     Standard_Integer theNbArgs,
+                                     const char** theArgVec)
+{
+  if (theNbArgs < 2 || theNbArgs > 3)
+  {
+    theDI << "Syntax error: wrong number of arguments\n";
+    return 1;
+  }
+
+  const Standard_Integer aNbParts   = Draw::Atoi (theArgVec[1]);
+  const Standard_Integer aNbThreads = theNbArgs > 2 ? Draw::Atoi (theArgVec[2]) : -1;
+  if (aNbParts < 1)
+  {
+    theDI << "Syntax error: wrong number of parts\n";
+    return 1;
+  }
+
+  // reference result of the sequential processing
+  NCollection_Array1<Standard_Integer> aRefResult (0, aNbParts - 1);
+  for (Standard_Integer aPartIter = 0; aPartIter < aNbParts; ++aPartIter)
+  {
+    TopoDS_Shape aPart = BRepPrimAPI_MakeSphere (1.0 + aPartIter % 7).Shape();
+    BRepMesh_IncrementalMesh aMesher (aPart, 0.001 * (1 + aPartIter % 3));
+    aRefResult (aPartIter) = countTriangles (aPart);
+  }
+
+  // stages build -> mesh -> collect, the parts are collected in their order
+  NCollection_Array1<Standard_Integer> aResult (0, aNbParts - 1);
+  aResult.Init (0);
+  Standard_Integer aNbCollected = 0;
+  OSD_TaskGraph aGraph (OSD_ThreadPool::DefaultPool(), aNbThreads);
+  Handle(OSD_Task) aPrevCollect;
+  for (Standard_Integer aPartIter = 0; aPartIter < aNbParts; ++aPartIter)
+  {
+    Handle(OSD_Future<TopoDS_Shape>) aBuild = aGraph.AddFuture<TopoDS_Shape> ([aPartIter](const Message_ProgressRange& )
+    {
+      return BRepPrimAPI_MakeSphere (1.0 + aPartIter % 7).Shape();
+    });
+    Handle(OSD_Task) aMesh = aGraph.Add ([aBuild, aPartIter](const Message_ProgressRange& )
+    {
+      BRepMesh_IncrementalMesh aMesher (aBuild->Value(), 0.001 * (1 + aPartIter % 3));
+    });
+    Handle(OSD_Task) aCollect = aGraph.Add ([aBuild, aPartIter, &aResult, &aNbCollected](const Message_ProgressRange& )
+    {
+      if (aNbCollected++ != aPartIter)
+      {
+        throw Standard_ProgramError ("the parts are collected in wrong order");
+      }
+      aResult (aPartIter) = countTriangles (aBuild->Value());
+    });
+    aGraph.AddDependency (aMesh, aBuild);
+    aGraph.AddDependency (aCollect, aMesh);
+    aGraph.AddDependency (aCollect, aPrevCollect);
+    aPrevCollect = aCollect;
+  }
+
+  OSD_Timer aTimer;
+  aTimer.Start();
+  const Standard_Boolean isDone = aGraph.Perform();
+  aTimer.Stop();
+
+  Standard_Integer aNbErrors = 0;
+  if (!isDone)
+  {
+    ++aNbErrors;
+    for (Standard_Integer aTaskIter = 0; aTaskIter < aGraph.NbTasks(); ++aTaskIter)
+    {
+      if (!aGraph.Task (aTaskIter)->Failure().IsNull())
+      {
+        theDI << "Error: task " << aTaskIter << " failed: " << aGraph.Task (aTaskIter)->Failure()->GetMessageString() << "\n";
+      }
+    }
+  }
+  Standard_Integer aNbTriangles = 0;
+  for (Standard_Integer aPartIter = 0; aPartIter < aNbParts; ++aPartIter)
+  {
+    aNbTriangles += aResult (aPartIter);
+    if (aResult (aPartIter) != aRefResult (aPartIter))
+    {
+      ++aNbErrors;
+      theDI << "Error: part " << aPartIter << " has " << aResult (aPartIter)
+            << " triangles instead of " << aRefResult (aPartIter) << "\n";
+    }
+  }
+
+  theDI << "Number of triangles: " << aNbTriangles << "\n";
+  theDI << "Task graph time: " << aTimer.ElapsedTime() << " s\n";
+  if (aNbErrors == 0)
+  {
+    theDI << "The parts are processed by the task graph correctly\n";
+  }
+  return 0;
+}
+
+#include <NCollection_Map.hxx>
+
+namespace
+{
+  //! Functor of the nested parallel loop collecting the threads performing it.
+  struct NestedLoopFunctor
+  {
+    NestedLoopFunctor (NCollection_Map<Standard_ThreadId>& theThreads, Standard_Mutex& theMutex)
+    : Threads (theThreads), Mutex (theMutex) {}
+
+    void operator() (int , int ) const
+    {
+      OSD::MilliSecSleep (1);
+      Standard_Mutex::Sentry aLock (Mutex);
+      Threads.Add (OSD_Thread::Current());
+    }
+
+    NCollection_Map<Standard_ThreadId>& Threads;
+    Standard_Mutex& Mutex;
+  };
+}
+
+//=======================================================================
+//function : QATaskGraphNested
+//purpose  : Checks that the parallel loop nested into the task of the graph
+//           is performed by the threads of the graph waiting for the ready tasks
+//=======================================================================
+static Standard_Integer QATaskGraphNested (Draw_Interpretor& theDI,
+                                           Standard_Integer theNbArgs,
+                                           const char** theArgVec)
+{
+  if (theNbArgs > 2)
+  {
+    theDI << "Syntax error: wrong number of arguments\n";
+    return 1;
+  }
+
+  const Standard_Integer aNbThreads = theNbArgs > 1 ? Draw::Atoi (theArgVec[1]) : 4;
+  if (aNbThreads < 2)
+  {
+    theDI << "Syntax error: wrong number of threads\n";
+    return 1;
+  }
+
+  // the single task of the graph runs the parallel loop, the other threads of the graph have no task
+  Handle(OSD_ThreadPool) aPool = new OSD_ThreadPool (aNbThreads);
+  NCollection_Map<Standard_ThreadId> aThreads;
+  Standard_Mutex aMutex;
+  OSD_TaskGraph aGraph (aPool);
+  Handle(OSD_Task) aLoop = aGraph.Add ([&aPool, &aThreads, &aMutex](const Message_ProgressRange& )
+  {
+    OSD_ThreadPool::Launcher aLauncher (*aPool);
+    aLauncher.Perform (0, 200, NestedLoopFunctor (aThreads, aMutex));
+  });
+  Handle(OSD_Task) aNext = aGraph.Add ([](const Message_ProgressRange& ) {});
+  aGraph.AddDependency (aNext, aLoop);
+  if (!aGraph.Perform())
+  {
+    theDI << "Error: the tasks of the graph are not done\n";
+  }
+
+  theDI << "Number of threads of the nested loop: " << aThreads.Extent() << "\n";
+  if (aThreads.Extent() < 2)
+  {
+    theDI << "Error: the nested loop is performed by the single thread\n";
+  }
+  return 0;
+}
+
+#include <TColgp_Array2OfPnt.hxx>
+#include <TColgp_Array2OfVec.hxx>
+
+//=======================================================================
+//function : QASurfaceGrid
+//purpose  : Compares the evaluation of the surface on the grid with the evaluation by points
+//=======================================================================
+static Standard_Integer QASurfaceGrid (Draw_Interpretor& theDI,
+                                       Standard_Integer theNbArgs,
+                                       const char** theArgVec)
+{
+  if (theNbArgs != 4)
+  {
+    theDI << "Syntax error: wrong number of arguments\n";
+    return 1;
+  }
+
+  Handle(Geom_Surface) aSurf = DrawTrSurf::GetSurface (theArgVec[1]);
+  const Standard_Integer aNbU = Draw::Atoi (theArgVec[2]);
+  const Standard_Integer aNbV = Draw::Atoi (theArgVec[3]);
+  if (aSurf.IsNull())
+  {
+    theDI << "Syntax error: " << theArgVec[1] << " is not a surface\n";
+    return 1;
+  }
+  if (aNbU < 2 || aNbV < 2)
+  {
+    theDI << "Syntax error: wrong number of parameters\n";
+    return 1;
+  }
+
+  // the grid includes the boundaries and the knots of the surface in case of equal spans
+  GeomAdaptor_Surface anAdaptor (aSurf);
+  TColStd_Array1OfReal aU (1, aNbU), aV (1, aNbV);
+  for (Standard_Integer anUIter = 1; anUIter <= aNbU; ++anUIter)
+  {
+    aU (anUIter) = anAdaptor.FirstUParameter()
+                 + (anAdaptor.LastUParameter() - anAdaptor.FirstUParameter()) * (anUIter - 1) / (aNbU - 1);
+  }
+  for (Standard_Integer aVIter = 1; aVIter <= aNbV; ++aVIter)
+  {
+    aV (aVIter) = anAdaptor.FirstVParameter()
+                + (anAdaptor.LastVParameter() - anAdaptor.FirstVParameter()) * (aVIter - 1) / (aNbV - 1);
+  }
+
+  TColgp_Array2OfPnt aPnts (1, aNbU, 1, aNbV);
+  TColgp_Array2OfVec aD1U (1, aNbU, 1, aNbV), aD1V (1, aNbU, 1, aNbV);
+  TColgp_Array2OfVec aD2U (1, aNbU, 1, aNbV), aD2V (1, aNbU, 1, aNbV), aD2UV (1, aNbU, 1, aNbV);
+  OSD_Timer aTimerPnt, aTimerGrid;
+  aTimerPnt.Start();
+  for (Standard_Integer anUIter = 1; anUIter <= aNbU; ++anUIter)
+  {
+    for (Standard_Integer aVIter = 1; aVIter <= aNbV; ++aVIter)
+    {
+      anAdaptor.D2 (aU (anUIter), aV (aVIter), aPnts (anUIter, aVIter),
+                    aD1U (anUIter, aVIter), aD1V (anUIter, aVIter),
+                    aD2U (anUIter, aVIter), aD2V (anUIter, aVIter), aD2UV (anUIter, aVIter));
+    }
+  }
+  aTimerPnt.Stop();
+
+  TColgp_Array2OfPnt aGridPnts (1, aNbU, 1, aNbV);
+  TColgp_Array2OfVec aGridD1U (1, aNbU, 1, aNbV), aGridD1V (1, aNbU, 1, aNbV);
+  TColgp_Array2OfVec aGridD2U (1, aNbU, 1, aNbV), aGridD2V (1, aNbU, 1, aNbV), aGridD2UV (1, aNbU, 1, aNbV);
+  aTimerGrid.Start();
+  anAdaptor.D2Grid (aU, aV, aGridPnts, aGridD1U, aGridD1V, aGridD2U, aGridD2V, aGridD2UV);
+  aTimerGrid.Stop();
+
+  Standard_Integer aNbErrors = 0;
+  for (Standard_Integer anUIter = 1; anUIter <= aNbU; ++anUIter)
+  {
+    for (Standard_Integer aVIter = 1; aVIter <= aNbV; ++aVIter)
+    {
+      if (!aPnts (anUIter, aVIter).IsEqual (aGridPnts (anUIter, aVIter), Precision::Confusion())
+       || !aD1U  (anUIter, aVIter).IsEqual (aGridD1U  (anUIter, aVIter), Precision::Confusion(), Precision::Angular())
+       || !aD1V  (anUIter, aVIter).IsEqual (aGridD1V  (anUIter, aVIter), Precision::Confusion(), Precision::Angular())
+       || !aD2U  (anUIter, aVIter).IsEqual (aGridD2U  (anUIter, aVIter), Precision::Confusion(), Precision::Angular())
+       || !aD2V  (anUIter, aVIter).IsEqual (aGridD2V  (anUIter, aVIter), Precision::Confusion(), Precision::Angular())
+       || !aD2UV (anUIter, aVIter).IsEqual (aGridD2UV (anUIter, aVIter), Precision::Confusion(), Precision::Angular()))
+      {
+        if (++aNbErrors <= 10)
+        {
+          theDI << "Error: different result at (" << aU (anUIter) << ", " << aV (aVIter) << ")\n";
+        }
+      }
+    }
+  }
+
+  theDI << "Evaluation by points: " << aTimerPnt.ElapsedTime() << " s\n";
+  theDI << "Evaluation on grid: " << aTimerGrid.ElapsedTime() << " s\n";
+  if (aNbErrors == 0)
+  {
+    theDI << "The grid is evaluated correctly\n";
+  }
+  return 0;
+}
+
+#include <GeomAPI_ProjectPointOnSurf.hxx>
+#include <GeomAPI_ProjectPointsOnSurf.hxx>
+#include <math_BullardGenerator.hxx>
+
+//=======================================================================
+//function : QAProjectPoints
+//purpose  : Compares the batch projection of the points onto the surface with the projection by points
+//=======================================================================
+static Standard_Integer QAProjectPoints (Draw_Interpretor& theDI,
+                                         Standard_Integer theNbArgs,
+                                         const char** theArgVec)
+{
+  if (theNbArgs != 4)
+  {
+    theDI << "Syntax error: wrong number of arguments\n";
+    return 1;
+  }
+
+  Handle(Geom_Surface) aSurf = DrawTrSurf::GetSurface (theArgVec[1]);
+  const Standard_Integer aNbPoints = Draw::Atoi (theArgVec[2]);
+  const Standard_Real    aDeflection = Draw::Atof (theArgVec[3]);
+  if (aSurf.IsNull())
+  {
+    theDI << "Syntax error: " << theArgVec[1] << " is not a surface\n";
+    return 1;
+  }
+  if (aNbPoints < 1)
+  {
+    theDI << "Syntax error: wrong number of points\n";
+    return 1;
+  }
+
+  // the points are scattered around the random points of the surface,
+  // the infinite parameters are limited by the range [-100, 100]
+  Standard_Real aUMin = 0.0, aUMax = 0.0, aVMin = 0.0, aVMax = 0.0;
+  aSurf->Bounds (aUMin, aUMax, aVMin, aVMax);
+  const Standard_Boolean isInfinite = Precision::IsInfinite (aUMin) || Precision::IsInfinite (aUMax)
+                                   || Precision::IsInfinite (aVMin) || Precision::IsInfinite (aVMax);
+  const Standard_Real aUFirst = Max (aUMin, -100.0), aULast = Min (aUMax, 100.0);
+  const Standard_Real aVFirst = Max (aVMin, -100.0), aVLast = Min (aVMax, 100.0);
+  math_BullardGenerator aRandom;
+  TColgp_Array1OfPnt aPoints (1, aNbPoints);
+  for (Standard_Integer aPntIter = 1; aPntIter <= aNbPoints; ++aPntIter)
+  {
+    const gp_Pnt aPnt = aSurf->Value (aUFirst + (aULast - aUFirst) * aRandom.NextReal(),
+                                      aVFirst + (aVLast - aVFirst) * aRandom.NextReal());
+    aPoints (aPntIter) = aPnt.Translated (gp_Vec (aRandom.NextReal() - 0.5,
+                                                  aRandom.NextReal() - 0.5,
+                                                  aRandom.NextReal() - 0.5) * (2.0 * aDeflection));
+  }
+
+  const Standard_Real aTol = Precision::PConfusion();
+  OSD_Timer aTimerPnt, aTimerBatch;
+  aTimerBatch.Start();
+  GeomAPI_ProjectPointsOnSurf aBatch (aSurf, aTol);
+  aBatch.Perform (aPoints);
+  aTimerBatch.Stop();
+
+  // the infinite surface is not sampled
+  Standard_Integer aNbErrors = 0, aNbProjected = 0;
+  if (isInfinite && aBatch.NbSamples() != 0)
+  {
+    theDI << "Error: the infinite surface is sampled\n";
+    ++aNbErrors;
+  }
+
+  // the batch projection should not be farther than the nearest projection by points
+  Standard_Real aMaxDist = 0.0;
+  GeomAPI_ProjectPointOnSurf aProjector;
+  aProjector.Init (aSurf, aUMin, aUMax, aVMin, aVMax, aTol);
+  for (Standard_Integer aPntIter = 1; aPntIter <= aNbPoints; ++aPntIter)
+  {
+    aTimerPnt.Start();
+    aProjector.Perform (aPoints (aPntIter));
+    aTimerPnt.Stop();
+    if (!aProjector.IsDone() || aProjector.NbPoints() < 1)
+    {
+      continue;
+    }
+
+    ++aNbProjected;
+    if (!aBatch.IsDone (aPntIter)
+      || aBatch.Distance (aPntIter) > aProjector.LowerDistance() + Precision::Confusion())
+    {
+      if (++aNbErrors <= 10)
+      {
+        theDI << "Error: wrong projection of point " << aPntIter << "\n";
+      }
+      continue;
+    }
+    aMaxDist = Max (aMaxDist, aBatch.Distance (aPntIter));
+  }
+
+  theDI << "Number of projected points: " << aNbProjected << "\n";
+  theDI << "Maximal distance: " << aMaxDist << "\n";
+  theDI << "Projection by points: " << aTimerPnt.ElapsedTime() << " s\n";
+  theDI << "Batch projection: " << aTimerBatch.ElapsedTime() << " s\n";
+  if (aNbErrors == 0)
+  {
+    theDI << "The points are projected correctly\n";
+  }
+  return 0;
+}
+
+//=======================================================================
+//function : QAEvalArray
+//purpose  : Compares the evaluation of the curve or surface on the array of random parameters
+//           with the evaluation by points
+//=======================================================================
+static Standard_Integer QAEvalArray (Draw_Interpretor& theDI,
+                                     Standard_Integer theNbArgs,
+                                     const char** theArgVec)
+{
+  if (theNbArgs != 3)
+  {
+    theDI << "Syntax error: wrong number of arguments\n";
+    return 1;
+  }
+
+  Handle(Geom_Curve)   aCurve = DrawTrSurf::GetCurve (theArgVec[1]);
+  Handle(Geom_Surface) aSurf  = aCurve.IsNull() ? DrawTrSurf::GetSurface (theArgVec[1]) : Handle(Geom_Surface)();
+  const Standard_Integer aNbPoints = Draw::Atoi (theArgVec[2]);
+  if (aCurve.IsNull() && aSurf.IsNull())
+  {
+    theDI << "Syntax error: " << theArgVec[1] << " is neither a curve nor a surface\n";
+    return 1;
+  }
+  if (aNbPoints < 1)
+  {
+    theDI << "Syntax error: wrong number of points\n";
+    return 1;
+  }
+
+  math_BullardGenerator aRandom;
+  TColgp_Array1OfPnt aPnts (1, aNbPoints), anArrPnts (1, aNbPoints);
+  TColgp_Array1OfVec aD1U (1, aNbPoints), aD1V (1, aNbPoints), anArrD1U (1, aNbPoints), anArrD1V (1, aNbPoints);
+  TColgp_Array1OfVec aD2U (1, aNbPoints), aD2V (1, aNbPoints), anArrD2U (1, aNbPoints), anArrD2V (1, aNbPoints);
+  TColgp_Array1OfVec aD2UV (1, aNbPoints), anArrD2UV (1, aNbPoints);
+  OSD_Timer aTimerPnt, aTimerArray;
+  if (!aCurve.IsNull())
+  {
+    GeomAdaptor_Curve anAdaptor (aCurve);
+    TColStd_Array1OfReal aParams (1, aNbPoints);
+    for (Standard_Integer aPntIter = 1; aPntIter <= aNbPoints; ++aPntIter)
+    {
+      aParams (aPntIter) = anAdaptor.FirstParameter()
+                         + (anAdaptor.LastParameter() - anAdaptor.FirstParameter()) * aRandom.NextReal();
+    }
+
+    aTimerPnt.Start();
+    for (Standard_Integer aPntIter = 1; aPntIter <= aNbPoints; ++aPntIter)
+    {
+      anAdaptor.D2 (aParams (aPntIter), aPnts (aPntIter), aD1U (aPntIter), aD2U (aPntIter));
+    }
+    aTimerPnt.Stop();
+
+    aTimerArray.Start();
+    anAdaptor.D2Array (aParams, anArrPnts, anArrD1U, anArrD2U);
+    aTimerArray.Stop();
+  }
+  else
+  {
+    GeomAdaptor_Surface anAdaptor (aSurf);
+    TColgp_Array1OfPnt2d anUV (1, aNbPoints);
+    for (Standard_Integer aPntIter = 1; aPntIter <= aNbPoints; ++aPntIter)
+    {
+      anUV (aPntIter).SetCoord (anAdaptor.FirstUParameter()
+                                + (anAdaptor.LastUParameter() - anAdaptor.FirstUParameter()) * aRandom.NextReal(),
+                                anAdaptor.FirstVParameter()
+                                + (anAdaptor.LastVParameter() - anAdaptor.FirstVParameter()) * aRandom.NextReal());
+    }
+
+    aTimerPnt.Start();
+    for (Standard_Integer aPntIter = 1; aPntIter <= aNbPoints; ++aPntIter)
+    {
+      anAdaptor.D2 (anUV (aPntIter).X(), anUV (aPntIter).Y(), aPnts (aPntIter),
+                    aD1U (aPntIter), aD1V (aPntIter), aD2U (aPntIter), aD2V (aPntIter), aD2UV (aPntIter));
+    }
+    aTimerPnt.Stop();
+
+    aTimerArray.Start();
+    anAdaptor.D2Array (anUV, anArrPnts, anArrD1U, anArrD1V, anArrD2U, anArrD2V, anArrD2UV);
+    aTimerArray.Stop();
+  }
+
+  Standard_Integer aNbErrors = 0;
+  for (Standard_Integer aPntIter = 1; aPntIter <= aNbPoints; ++aPntIter)
+  {
+    if (!aPnts (aPntIter).IsEqual (anArrPnts (aPntIter), Precision::Confusion())
+     || !aD1U  (aPntIter).IsEqual (anArrD1U  (aPntIter), Precision::Confusion(), Precision::Angular())
+     || !aD2U  (aPntIter).IsEqual (anArrD2U  (aPntIter), Precision::Confusion(), Precision::Angular())
+     || (aCurve.IsNull()
+      && (!aD1V  (aPntIter).IsEqual (anArrD1V  (aPntIter), Precision::Confusion(), Precision::Angular())
+       || !aD2V  (aPntIter).IsEqual (anArrD2V  (aPntIter), Precision::Confusion(), Precision::Angular())
+       || !aD2UV (aPntIter).IsEqual (anArrD2UV (aPntIter), Precision::Confusion(), Precision::Angular()))))
+    {
+      if (++aNbErrors <= 10)
+      {
+        theDI << "Error: different result at point " << aPntIter << "\n";
+      }
+    }
+  }
+
+  theDI << "Evaluation by points: " << aTimerPnt.ElapsedTime() << " s\n";
+  theDI << "Evaluation of array: " << aTimerArray.ElapsedTime() << " s\n";
+  if (aNbErrors == 0)
+  {
+    theDI << "The array is evaluated correctly\n";
+  }
+  return 0;
+}
+
+#include <BRepAlgoAPI_Cut.hxx>
+#include <BRepGProp.hxx>
+#include <GProp_GProps.hxx>
+#include <ProjLib_ProjectionCacheScope.hxx>
+#include <BOPTools_Parallel.hxx>
+#include <BRepBuilderAPI_MakeEdge.hxx>
+#include <Geom_Plane.hxx>
+#include <Geom2d_Curve.hxx>
+#include <IntTools_Context.hxx>
+#include <NCollection_Vector.hxx>
+
+//! Returns the projection cache current in the thread,
+//! and leaves the given cache current on exit of the thread.
+static Standard_Address qaCurrentProjectionCache (Standard_Address theCache)
+{
+  Standard_Address aCurrent = ProjLib_ProjectionCache::Current().get();
+  ProjLib_ProjectionCache::SetCurrent (static_cast<ProjLib_ProjectionCache*> (theCache));
+  return aCurrent;
+}
+
+//! Solver keeping the projection caches seen by the parallel worker.
+class QAProjectionCacheSolver
+{
+public:
+
+  void SetContext (const Handle(IntTools_Context)& theContext) { myContext = theContext; }
+
+  void Perform()
+  {
+    myContextCache = myContext->ProjectionCache();
+    myCurrentCache = ProjLib_ProjectionCache::Current();
+  }
+
+  Standard_Boolean IsCacheUsed (const Handle(ProjLib_ProjectionCache)& theCache) const
+  {
+    return myContextCache == theCache
+        && myCurrentCache == theCache;
+  }
+
+private:
+  Handle(IntTools_Context) myContext;
+  Handle(ProjLib_ProjectionCache) myContextCache;
+  Handle(ProjLib_ProjectionCache) myCurrentCache;
+};
+
+//=======================================================================
+//function : QAProjectionCache
+//purpose  : Compares the Boolean cuts computed with and without the projection cache
+//=======================================================================
+static Standard_Integer QAProjectionCache (Draw_Interpretor& theDI,
+                                           Standard_Integer theNbArgs,
+                                           const char** theArgVec)
+{
+  if (theNbArgs != 4 && theNbArgs != 5)
+  {
+    theDI << "Syntax error: wrong number of arguments\n";
+    return 1;
+  }
+
+  const TopoDS_Shape anObject = DBRep::Get (theArgVec[2]);
+  const TopoDS_Shape aTool    = DBRep::Get (theArgVec[3]);
+  const Standard_Integer aNbRuns = theNbArgs > 4 ? Draw::Atoi (theArgVec[4]) : 3;
+  if (anObject.IsNull() || aTool.IsNull())
+  {
+    theDI << "Syntax error: null shape\n";
+    return 1;
+  }
+  if (aNbRuns < 1)
+  {
+    theDI << "Syntax error: wrong number of runs\n";
+    return 1;
+  }
+
+  OSD_Timer aTimerRef, aTimerCache;
+  aTimerRef.Start();
+  BRepAlgoAPI_Cut aRefCut (anObject, aTool);
+  aTimerRef.Stop();
+  if (aRefCut.HasErrors())
+  {
+    theDI << "Error: the cut has failed\n";
+    return 0;
+  }
+
+  GProp_GProps aRefProps;
+  BRepGProp::VolumeProperties (aRefCut.Shape(), aRefProps);
+  TopTools_IndexedMapOfShape aRefFaces, aRefEdges;
+  TopExp::MapShapes (aRefCut.Shape(), TopAbs_FACE, aRefFaces);
+  TopExp::MapShapes (aRefCut.Shape(), TopAbs_EDGE, aRefEdges);
+
+  ProjLib_ProjectionCacheScope aCacheScope;
+  Standard_Integer aNbErrors = 0;
+  TopoDS_Shape aResult;
+  for (Standard_Integer aRunIter = 1; aRunIter <= aNbRuns; ++aRunIter)
+  {
+    aTimerCache.Start();
+    BRepAlgoAPI_Cut aCut (anObject, aTool);
+    aTimerCache.Stop();
+    if (aCut.HasErrors())
+    {
+      theDI << "Error: the cut has failed in run " << aRunIter << "\n";
+      ++aNbErrors;
+      continue;
+    }
+
+    aResult = aCut.Shape();
+    GProp_GProps aProps;
+    BRepGProp::VolumeProperties (aResult, aProps);
+    TopTools_IndexedMapOfShape aFaces, anEdges;
+    TopExp::MapShapes (aResult, TopAbs_FACE, aFaces);
+    TopExp::MapShapes (aResult, TopAbs_EDGE, anEdges);
+    if (aFaces.Extent() != aRefFaces.Extent()
+     || anEdges.Extent() != aRefEdges.Extent()
+     || Abs (aProps.Mass() - aRefProps.Mass()) > 1.e-9 * Abs (aRefProps.Mass()))
+    {
+      theDI << "Error: the result of run " << aRunIter << " differs from the result without cache\n";
+      ++aNbErrors;
+    }
+  }
+  DBRep::Set (theArgVec[1], aResult);
+
+  const Handle(ProjLib_ProjectionCache)& aCache = aCacheScope.Cache();
+  theDI << "Number of cached pcurves: " << aCache->Size() << "\n";
+  theDI << "Number of hits: " << (Standard_Integer )aCache->NbHits() << "\n";
+  theDI << "Number of misses: " << (Standard_Integer )aCache->NbMisses() << "\n";
+  theDI << "Cut without cache: " << aTimerRef.ElapsedTime() << " s\n";
+  theDI << "Cut with cache: " << aTimerCache.ElapsedTime() / aNbRuns << " s per run\n";
+  if (aNbRuns > 1 && aCache->NbHits() == 0)
+  {
+    theDI << "Error: the cache is not used\n";
+    ++aNbErrors;
+  }
+
+  // the pcurve on the plane follows the modification of the curve in place
+  TColgp_Array1OfPnt aPoles (1, 4);
+  aPoles (1) = gp_Pnt (0.0, 0.0, 1.0);
+  aPoles (2) = gp_Pnt (1.0, 1.0, 1.0);
+  aPoles (3) = gp_Pnt (2.0, 1.0, 1.0);
+  aPoles (4) = gp_Pnt (3.0, 0.0, 1.0);
+  Handle(Geom_BezierCurve) aBezier = new Geom_BezierCurve (aPoles);
+  const TopoDS_Edge anEdge = BRepBuilderAPI_MakeEdge (aBezier);
+  const Handle(Geom_Plane) aPlane = new Geom_Plane (gp::XOY());
+  for (Standard_Integer aModifIter = 0; aModifIter < 2; ++aModifIter)
+  {
+    if (aModifIter == 1)
+    {
+      aBezier->SetPole (2, gp_Pnt (1.0, 3.0, 1.0));
+    }
+    Standard_Real aFirst = 0.0, aLast = 0.0;
+    const Handle(Geom2d_Curve) aPCurve = BRep_Tool::CurveOnSurface (anEdge, aPlane, TopLoc_Location(), aFirst, aLast);
+    const Standard_Real aMid = 0.5 * (aFirst + aLast);
+    const gp_Pnt aPnt3d = aBezier->Value (aMid);
+    if (aPCurve.IsNull()
+     || aPCurve->Value (aMid).Distance (gp_Pnt2d (aPnt3d.X(), aPnt3d.Y())) > Precision::Confusion())
+    {
+      theDI << "Error: the pcurve of the modified curve is wrong\n";
+      ++aNbErrors;
+    }
+  }
+
+  // the cache is not current in another thread,
+  // and the cache left current in the thread is released on exit of the thread
+  const Standard_Integer aNbRefs = aCache->GetRefCount();
+  OSD_Thread aThread (qaCurrentProjectionCache);
+  Standard_Address anOtherCache = NULL;
+  aThread.Run (aCache.get());
+  aThread.Wait (anOtherCache);
+  if (ProjLib_ProjectionCache::Current() != aCache
+   || anOtherCache != NULL)
+  {
+    theDI << "Error: the cache is current in another thread\n";
+    ++aNbErrors;
+  }
+  if (aCache->GetRefCount() != aNbRefs)
+  {
+    theDI << "Error: the cache is not released on exit of the thread\n";
+    ++aNbErrors;
+  }
+
+  // the parallel workers use the cache of the context of the algorithm,
+  // even if the cache is not current in the calling thread
+  NCollection_Vector<QAProjectionCacheSolver> aSolvers;
+  for (Standard_Integer aSolverIter = 0; aSolverIter < 64; ++aSolverIter)
+  {
+    aSolvers.Appended();
+  }
+  Handle(IntTools_Context) aContext = new IntTools_Context();
+  aContext->SetProjectionCache (aCache);
+  {
+    const Handle(ProjLib_ProjectionCache) aNoCache;
+    ProjLib_ProjectionCacheScope aNoCacheScope (aNoCache);
+    BOPTools_Parallel::Perform (Standard_True, aSolvers, aContext);
+  }
+  for (NCollection_Vector<QAProjectionCacheSolver>::Iterator aSolverIter (aSolvers); aSolverIter.More(); aSolverIter.Next())
+  {
+    if (!aSolverIter.Value().IsCacheUsed (aCache))
+    {
+      theDI << "Error: the cache is not used by the parallel workers\n";
+      ++aNbErrors;
+      break;
+    }
+  }
+  if (aNbErrors == 0)
+  {
+    theDI << "The results with cache are equal\n";
+  }
+  return 0;
+}
+
+#include <Extrema_ExtCC.hxx>
+#include <Extrema_GlobOptFuncCC.hxx>
+#include <math_GlobOptMin.hxx>
+#include <OSD_ThreadPool.hxx>
+
+//=======================================================================
+//function : QAGlobOptMin
+//purpose  : Compares the parallel global search of the distance between curves with the serial one
+//=======================================================================
+static Standard_Integer QAGlobOptMin (Draw_Interpretor& theDI,
+                                      Standard_Integer theNbArgs,
+                                      const char** theArgVec)
+{
+  if (theNbArgs != 3)
+  {
+    theDI << "Syntax error: wrong number of arguments\n";
+    return 1;
+  }
+
+  Handle(Geom_Curve) aCurve1 = DrawTrSurf::GetCurve (theArgVec[1]);
+  Handle(Geom_Curve) aCurve2 = DrawTrSurf::GetCurve (theArgVec[2]);
+  if (aCurve1.IsNull() || aCurve2.IsNull())
+  {
+    theDI << "Syntax error: null curve\n";
+    return 1;
+  }
+
+  GeomAdaptor_Curve anAdaptor1 (aCurve1), anAdaptor2 (aCurve2);
+  math_Vector aLower (1, 2), anUpper (1, 2);
+  aLower (1)  = anAdaptor1.FirstParameter();
+  aLower (2)  = anAdaptor2.FirstParameter();
+  anUpper (1) = anAdaptor1.LastParameter();
+  anUpper (2) = anAdaptor2.LastParameter();
+
+  // each thread evaluates the distance between its own copies of the curves
+  const Standard_Integer aNbThreads = OSD_ThreadPool::DefaultPool()->NbThreads();
+  NCollection_Array1<GeomAdaptor_Curve> aCopies (0, 2 * aNbThreads - 1);
+  NCollection_Array1<Extrema_GlobOptFuncCCC2*> aFuncs (0, aNbThreads - 1);
+  NCollection_Array1<math_MultipleVarFunction*> aThreadFuncs (0, aNbThreads - 1);
+  for (Standard_Integer aThreadIter = 0; aThreadIter < aNbThreads; ++aThreadIter)
+  {
+    aCopies (2 * aThreadIter).Load (aCurve1);
+    aCopies (2 * aThreadIter + 1).Load (aCurve2);
+    aFuncs (aThreadIter) = new Extrema_GlobOptFuncCCC2 (aCopies (2 * aThreadIter), aCopies (2 * aThreadIter + 1));
+    aThreadFuncs (aThreadIter) = aFuncs (aThreadIter);
+  }
+
+  Extrema_GlobOptFuncCCC2 aFunc (anAdaptor1, anAdaptor2);
+  Standard_Integer aNbErrors = 0;
+  for (Standard_Integer aMode = 0; aMode < 2; ++aMode)
+  {
+    const Standard_Boolean isSingle = aMode == 1;
+    math_GlobOptMin aSerial (&aFunc, aLower, anUpper);
+    aSerial.Perform (isSingle);
+    math_GlobOptMin aParallel (&aFunc, aLower, anUpper);
+    aParallel.Perform (aThreadFuncs, isSingle);
+
+    theDI << (isSingle ? "Single solution" : "All solutions") << ":\n";
+    theDI << "  serial:   F = " << aSerial.GetF() << ", " << aSerial.NbExtrema() << " extrema, "
+          << aSerial.NbEvaluations() << " evaluations, " << aSerial.NbLocalSearches() << " local searches, "
+          << aSerial.ElapsedTime() << " s\n";
+    theDI << "  parallel: F = " << aParallel.GetF() << ", " << aParallel.NbExtrema() << " extrema, "
+          << aParallel.NbEvaluations() << " evaluations, " << aParallel.NbLocalSearches() << " local searches, "
+          << aParallel.ElapsedTime() << " s\n";
+    if (!aSerial.isDone() || !aParallel.isDone()
+     || Abs (aSerial.GetF() - aParallel.GetF()) > Precision::Confusion())
+    {
+      theDI << "Error: different minimal values\n";
+      ++aNbErrors;
+    }
+  }
+
+  for (Standard_Integer aThreadIter = 0; aThreadIter < aNbThreads; ++aThreadIter)
+  {
+    delete aFuncs (aThreadIter);
+  }
+
+  // the extrema between the curves searched in parallel threads
+  Standard_Real aMinSqDist[2] = { RealLast(), RealLast() };
+  for (Standard_Integer aMode = 0; aMode < 2; ++aMode)
+  {
+    OSD_Timer aTimer;
+    aTimer.Start();
+    Extrema_ExtCC anExtrema (anAdaptor1, anAdaptor2);
+    anExtrema.SetMultiThread (aMode == 1);
+    anExtrema.Perform();
+    aTimer.Stop();
+    for (Standard_Integer anExtIter = 1; anExtrema.IsDone() && anExtIter <= anExtrema.NbExt(); ++anExtIter)
+    {
+      aMinSqDist[aMode] = Min (aMinSqDist[aMode], anExtrema.SquareDistance (anExtIter));
+    }
+    theDI << (aMode == 1 ? "Parallel" : "Serial") << " extrema: distance " << Sqrt (aMinSqDist[aMode])
+          << ", " << aTimer.ElapsedTime() << " s\n";
+  }
+  if (Abs (Sqrt (aMinSqDist[0]) - Sqrt (aMinSqDist[1])) > Precision::Confusion())
+  {
+    theDI << "Error: different distances between the curves\n";
+    ++aNbErrors;
+  }
+  if (aNbErrors == 0)
+  {
+    theDI << "The results of parallel search are equal\n";
+  }
+  return 0;
+}
+
+#include <Extrema_FuncPSNorm.hxx>
+#include <math_Gauss.hxx>
+#include <math_NewtonFunctionSetRoot.hxx>
+#include <math_NewtonFunctionSetRootN.hxx>
+
+//! Solves the random linear system of the fixed dimension by math_MatrixN
+//! and returns the maximal difference with the solution of math_Gauss.
+//! The matrix and the right part are multiplied by theScale, which keeps the solution.
+template<Standard_Integer N>
+static Standard_Real compareFixedSizeSolve (math_BullardGenerator& theRandom,
+                                            const Standard_Real theScale)
+{
+  math_MatrixN<N, N> aMat;
+  math_VectorN<N> aRhs, aSol;
+  for (Standard_Integer aRow = 1; aRow <= N; ++aRow)
+  {
+    for (Standard_Integer aCol = 1; aCol <= N; ++aCol)
+    {
+      aMat (aRow, aCol) = theScale * (theRandom.NextReal() - 0.5 + (aRow == aCol ? 2.0 : 0.0));
+    }
+    aRhs (aRow) = theScale * theRandom.NextReal();
+  }
+
+  math_Matrix aRefMat (1, N, 1, N);
+  math_Vector aRefRhs (1, N), aRefSol (1, N);
+  aMat.Get (aRefMat);
+  aRhs.Get (aRefRhs);
+  math_Gauss aGauss (aRefMat, 1.0e-30);
+  if (!aMat.Solve (aRhs, aSol) || !aGauss.IsDone())
+  {
+    return RealLast();
+  }
+  aGauss.Solve (aRefRhs, aRefSol);
+  return (aSol - math_VectorN<N> (aRefSol)).Norm();
+}
+
+static Standard_Integer QAMathNewtonN (Draw_Interpretor& theDI,
+                                       Standard_Integer theNbArgs,
+                                       const char** theArgVec)
+{
+  if (theNbArgs != 2 && theNbArgs != 3)
+  {
+    theDI << "Syntax error: wrong number of arguments\n";
+    return 1;
+  }
+
+  Handle(Geom_Surface) aSurf = DrawTrSurf::GetSurface (theArgVec[1]);
+  const Standard_Integer aNbPoints = theNbArgs > 2 ? Draw::Atoi (theArgVec[2]) : 10000;
+  if (aSurf.IsNull() || aNbPoints < 1)
+  {
+    theDI << "Syntax error: wrong arguments\n";
+    return 1;
+  }
+
+  // linear systems of different dimensions; the small scale gives the pivots
+  // of about 1e-16, which are accepted although the determinants are below 1e-30
+  math_BullardGenerator aRandom;
+  Standard_Real aMaxSolveDiff = 0.0;
+  const Standard_Real aScales[] = { 1.0, 1.0e-16 };
+  for (Standard_Integer aSysIter = 0; aSysIter < 100; ++aSysIter)
+  {
+    const Standard_Real aScale = aScales[aSysIter % 2];
+    aMaxSolveDiff = Max (aMaxSolveDiff, compareFixedSizeSolve<2> (aRandom, aScale));
+    aMaxSolveDiff = Max (aMaxSolveDiff, compareFixedSizeSolve<3> (aRandom, aScale));
+    aMaxSolveDiff = Max (aMaxSolveDiff, compareFixedSizeSolve<5> (aRandom, aScale));
+  }
+  theDI << "Maximal difference of the solutions of linear systems: " << aMaxSolveDiff << "\n";
+
+  // refinement of the projections of the points near the surface from the shifted parameters
+  Standard_Real aUMin = 0.0, aUMax = 0.0, aVMin = 0.0, aVMax = 0.0;
+  aSurf->Bounds (aUMin, aUMax, aVMin, aVMax);
+  GeomAdaptor_Surface anAdaptor (aSurf);
+  Extrema_FuncPSNorm aFunc;
+  aFunc.Initialize (anAdaptor);
+
+  math_Vector aTol (1, 2, Precision::PConfusion()), aStart (1, 2), anInf (1, 2), aSup (1, 2), aRoot (1, 2);
+  anInf (1) = aUMin; anInf (2) = aVMin;
+  aSup (1)  = aUMax; aSup (2)  = aVMax;
+
+  Standard_Integer aNbErrors = 0, aNbDone = 0;
+  OSD_Timer aTimerRef, aTimerFixed;
+  for (Standard_Integer aPntIter = 1; aPntIter <= aNbPoints; ++aPntIter)
+  {
+    const Standard_Real aU = aUMin + (aUMax - aUMin) * aRandom.NextReal();
+    const Standard_Real aV = aVMin + (aVMax - aVMin) * aRandom.NextReal();
+    aFunc.SetPoint (aSurf->Value (aU, aV).Translated (gp_Vec (0.0, 0.0, 0.1 * (aRandom.NextReal() - 0.5))));
+    aStart (1) = aU + 0.01 * (aUMax - aUMin) * (aRandom.NextReal() - 0.5);
+    aStart (2) = aV + 0.01 * (aVMax - aVMin) * (aRandom.NextReal() - 0.5);
+
+    aTimerRef.Start();
+    math_NewtonFunctionSetRoot aRef (aFunc, aTol, Precision::Confusion());
+    aRef.Perform (aFunc, aStart, anInf, aSup);
+    aTimerRef.Stop();
+
+    aTimerFixed.Start();
+    math_NewtonFunctionSetRootN<2> aFixed (aFunc, aTol, Precision::Confusion());
+    aFixed.Perform (aFunc, aStart, anInf, aSup);
+    aTimerFixed.Stop();
+
+    if (aRef.IsDone() != aFixed.IsDone())
+    {
+      if (++aNbErrors <= 10)
+      {
+        theDI << "Error: different status of the solvers for point " << aPntIter << "\n";
+      }
+      continue;
+    }
+    if (!aRef.IsDone())
+    {
+      continue;
+    }
+
+    ++aNbDone;
+    aFixed.Root (aRoot);
+    if ((aRoot - aRef.Root()).Norm() > Precision::PConfusion()
+     || aRef.NbIterations() != aFixed.NbIterations())
+    {
+      if (++aNbErrors <= 10)
+      {
+        theDI << "Error: different roots for point " << aPntIter << "\n";
+      }
+    }
+  }
+
+  theDI << "Number of roots: " << aNbDone << "\n";
+  theDI << "math_NewtonFunctionSetRoot: " << aTimerRef.ElapsedTime() << " s\n";
+  theDI << "math_NewtonFunctionSetRootN: " << aTimerFixed.ElapsedTime() << " s\n";
+  if (aNbErrors == 0 && aMaxSolveDiff < Precision::Confusion())
+  {
+    theDI << "The results of fixed-size solvers are equal\n";
+  }
+  return 0;
+}
+
+#include <Extrema_ECC.hxx>
+
+//=======================================================================
+//function : QAExtremaCurvesBVH
+//purpose  : Compares the extrema between the curves computed with and without
+//           the selection of the pairs of intervals by the BVH trees
+//=======================================================================
+static Standard_Integer QAExtremaCurvesBVH (Draw_Interpretor& theDI,
+                                            Standard_Integer theNbArgs,
+                                            const char** theArgVec)
+{
+  if (theNbArgs != 3)
+  {
+    theDI << "Syntax error: wrong number of arguments\n";
+    return 1;
+  }
+
+  Handle(Geom_Curve) aCurve1 = DrawTrSurf::GetCurve (theArgVec[1]);
+  Handle(Geom_Curve) aCurve2 = DrawTrSurf::GetCurve (theArgVec[2]);
+  if (aCurve1.IsNull() || aCurve2.IsNull())
+  {
+    theDI << "Syntax error: null curve\n";
+    return 1;
+  }
+
+  GeomAdaptor_Curve anAdaptor1 (aCurve1), anAdaptor2 (aCurve2);
+  Standard_Real    aMinSqDist[2] = { RealLast(), RealLast() };
+  Standard_Integer aNbExt[2] = { 0, 0 };
+  for (Standard_Integer aMode = 0; aMode < 2; ++aMode)
+  {
+    const Standard_Boolean isBVH = aMode == 1;
+    OSD_Timer aTimer;
+    aTimer.Start();
+    Extrema_ECC anExtrema (anAdaptor1, anAdaptor2);
+    anExtrema.SetBVHSearch (isBVH);
+    anExtrema.Perform();
+    aTimer.Stop();
+
+    if (anExtrema.IsDone() && !anExtrema.IsParallel())
+    {
+      aNbExt[aMode] = anExtrema.NbExt();
+      for (Standard_Integer anExtIter = 1; anExtIter <= aNbExt[aMode]; ++anExtIter)
+      {
+        aMinSqDist[aMode] = Min (aMinSqDist[aMode], anExtrema.SquareDistance (anExtIter));
+      }
+    }
+    theDI << (isBVH ? "BVH search:        " : "Exhaustive search: ")
+          << aNbExt[aMode] << " extrema, distance " << Sqrt (aMinSqDist[aMode]) << ", "
+          << aTimer.ElapsedTime() << " s\n";
+  }
+
+  if (aNbExt[0] == aNbExt[1]
+   && Abs (Sqrt (aMinSqDist[0]) - Sqrt (aMinSqDist[1])) < Precision::Confusion())
+  {
+    theDI << "The results of BVH search are equal\n";
+  }
+  else
+  {
+    theDI << "Error: different extrema\n";
+  }
+  return 0;
+}
+
+#include <BRepAdaptor_Surface.hxx>
+#include <IntTools_Context.hxx>
+#include <IntTools_Curve.hxx>
+#include <IntTools_FaceFace.hxx>
+#include <IntPatch_SurfaceSampling.hxx>
+
+//! Returns true if the intersections of the faces have the same curves.
+static Standard_Boolean isSameFaceFace (const IntTools_FaceFace& theFF1,
+                                        const IntTools_FaceFace& theFF2)
+{
+  if (theFF1.IsDone() != theFF2.IsDone()
+   || theFF1.TangentFaces() != theFF2.TangentFaces()
+   || theFF1.Lines().Length() != theFF2.Lines().Length()
+   || theFF1.Points().Length() != theFF2.Points().Length())
+  {
+    return Standard_False;
+  }
+  for (Standard_Integer aCurveIter = 1; aCurveIter <= theFF1.Lines().Length(); ++aCurveIter)
+  {
+    const Handle(Geom_Curve)& aCurve1 = theFF1.Lines().Value (aCurveIter).Curve();
+    const Handle(Geom_Curve)& aCurve2 = theFF2.Lines().Value (aCurveIter).Curve();
+    if (aCurve1.IsNull() || aCurve2.IsNull())
+    {
+      if (aCurve1.IsNull() != aCurve2.IsNull())
+      {
+        return Standard_False;
+      }
+      continue;
+    }
+    if (aCurve1->FirstParameter() != aCurve2->FirstParameter()
+     || aCurve1->LastParameter()  != aCurve2->LastParameter()
+     || !aCurve1->Value (aCurve1->FirstParameter()).IsEqual (aCurve2->Value (aCurve2->FirstParameter()), 0.0)
+     || !aCurve1->Value (aCurve1->LastParameter()) .IsEqual (aCurve2->Value (aCurve2->LastParameter()),  0.0))
+    {
+      return Standard_False;
+    }
+  }
+  return Standard_True;
+}
+
+//! Returns the maximal distance between the points of the sampling of the surface
+//! and the points evaluated one by one as by IntPatch_PrmPrmIntersection::PointDepart() before.
+static Standard_Real maxSamplingDeviation (const Handle(Adaptor3d_Surface)& theSurface,
+                                           const Standard_Integer theNbU,
+                                           const Standard_Integer theNbV,
+                                           const Standard_Boolean theToRunParallel)
+{
+  Handle(IntPatch_SurfaceSampling) aSampling = new IntPatch_SurfaceSampling();
+  aSampling->Perform (theSurface, theNbU, theNbV, theToRunParallel);
+  if (!aSampling->IsComputed (*theSurface, theNbU, theNbV))
+  {
+    return Precision::Infinite();
+  }
+
+  const Standard_Real aU0 = theSurface->FirstUParameter();
+  const Standard_Real aV0 = theSurface->FirstVParameter();
+  const Standard_Real aDU = (theSurface->LastUParameter() - aU0) / (theNbU - 1);
+  const Standard_Real aDV = (theSurface->LastVParameter() - aV0) / (theNbV - 1);
+  Standard_Real aMaxDist = 0.0, aU = aU0;
+  for (Standard_Integer i = 0; i < theNbU; ++i, aU += aDU)
+  {
+    Standard_Real aV = aV0;
+    for (Standard_Integer j = 0; j < theNbV; ++j, aV += aDV)
+    {
+      aMaxDist = Max (aMaxDist, theSurface->Value (aU, aV).Distance (aSampling->Points() (i, j)));
+    }
+  }
+  return aMaxDist;
+}
+
+//=======================================================================
+//function : QAFaceFaceSampling
+//purpose  : Compares the intersections of the face with the faces of the shape
+//           computed with the samplings of the surfaces kept in the context
+//           with the intersections computed in the separate contexts
+//=======================================================================
+static Standard_Integer QAFaceFaceSampling (Draw_Interpretor& theDI,
+                                            Standard_Integer theNbArgs,
+                                            const char** theArgVec)
+{
+  if (theNbArgs != 3)
+  {
+    theDI << "Syntax error: wrong number of arguments\n";
+    return 1;
+  }
+
+  const TopoDS_Shape aFaceShape = DBRep::Get (theArgVec[1], TopAbs_FACE);
+  const TopoDS_Shape aShape     = DBRep::Get (theArgVec[2]);
+  if (aFaceShape.IsNull() || aShape.IsNull())
+  {
+    theDI << "Syntax error: null shape\n";
+    return 1;
+  }
+  const TopoDS_Face& aFace = TopoDS::Face (aFaceShape);
+
+  TopTools_IndexedMapOfShape aFaces;
+  TopExp::MapShapes (aShape, TopAbs_FACE, aFaces);
+
+  const Handle(IntTools_Context) aSharedContext   = new IntTools_Context();
+  const Handle(IntTools_Context) aParallelContext = new IntTools_Context();
+  OSD_Timer aTimerRef, aTimerShared, aTimerParallel;
+  Standard_Integer aNbErrors = 0, aNbCurves = 0;
+  for (Standard_Integer aFaceIter = 1; aFaceIter <= aFaces.Extent(); ++aFaceIter)
+  {
+    const TopoDS_Face& anOtherFace = TopoDS::Face (aFaces (aFaceIter));
+
+    IntTools_FaceFace aRefFF, aSharedFF, aParallelFF;
+    aRefFF     .SetParameters (Standard_True, Standard_True, Standard_True, 1.e-7);
+    aSharedFF  .SetParameters (Standard_True, Standard_True, Standard_True, 1.e-7);
+    aParallelFF.SetParameters (Standard_True, Standard_True, Standard_True, 1.e-7);
+    aSharedFF  .SetContext (aSharedContext);
+    aParallelFF.SetContext (aParallelContext);
+
+    aTimerRef.Start();
+    aRefFF.Perform (aFace, anOtherFace);
+    aTimerRef.Stop();
+
+    aTimerShared.Start();
+    aSharedFF.Perform (aFace, anOtherFace);
+    aTimerShared.Stop();
+
+    aTimerParallel.Start();
+    aParallelFF.Perform (aFace, anOtherFace, Standard_True);
+    aTimerParallel.Stop();
+
+    if (aRefFF.IsDone())
+    {
+      aNbCurves += aRefFF.Lines().Length();
+    }
+    if (!isSameFaceFace (aRefFF, aSharedFF)
+     || !isSameFaceFace (aRefFF, aParallelFF))
+    {
+      theDI << "Error: the intersection with face " << aFaceIter << " differs\n";
+      ++aNbErrors;
+    }
+  }
+
+  // the samplings are equal to the points evaluated one by one
+  Standard_Real aMaxDeviation = 0.0;
+  for (Standard_Integer aFaceIter = 0; aFaceIter <= aFaces.Extent(); ++aFaceIter)
+  {
+    const TopoDS_Face& aSampledFace = aFaceIter == 0 ? aFace : TopoDS::Face (aFaces (aFaceIter));
+    const Handle(BRepAdaptor_Surface) aSurface = new BRepAdaptor_Surface (aSampledFace);
+    aMaxDeviation = Max (aMaxDeviation, maxSamplingDeviation (aSurface, 200, 150, Standard_False));
+    aMaxDeviation = Max (aMaxDeviation, maxSamplingDeviation (aSurface, 200, 150, Standard_True));
+  }
+  if (aMaxDeviation > Precision::Confusion())
+  {
+    theDI << "Error: the sampling differs from the evaluated points by " << aMaxDeviation << "\n";
+    ++aNbErrors;
+  }
+
+  theDI << "Number of intersected faces: " << aFaces.Extent() << "\n";
+  theDI << "Number of curves: " << aNbCurves << "\n";
+  theDI << "Deviation of the samplings: " << aMaxDeviation << "\n";
+  theDI << "Separate contexts: " << aTimerRef.ElapsedTime() << " s\n";
+  theDI << "Shared context: " << aTimerShared.ElapsedTime() << " s\n";
+  theDI << "Shared context, parallel: " << aTimerParallel.ElapsedTime() << " s\n";
+  if (aNbErrors == 0)
+  {
+    theDI << "The results with the surface samplings are equal\n";
+  }
+  return 0;
+}
+
+#include <BRepAdaptor_Surface.hxx>
+#include <IntPolyh_Intersection.hxx>
+#include <IntPolyh_Tools.hxx>
+
+//! Returns true if the polyhedral intersections have the same points.
+static Standard_Boolean isSamePolyhedralIntersection (const IntPolyh_Intersection& theInt1,
+                                                      const IntPolyh_Intersection& theInt2)
+{
+  if (theInt1.IsDone() != theInt2.IsDone()
+   || theInt1.IsParallel() != theInt2.IsParallel()
+   || theInt1.NbSectionLines() != theInt2.NbSectionLines()
+   || theInt1.NbTangentZones() != theInt2.NbTangentZones())
+  {
+    return Standard_False;
+  }
+  Standard_Real aCoords1[8], aCoords2[8];
+  for (Standard_Integer aLineIter = 1; aLineIter <= theInt1.NbSectionLines(); ++aLineIter)
+  {
+    if (theInt1.NbPointsInLine (aLineIter) != theInt2.NbPointsInLine (aLineIter))
+    {
+      return Standard_False;
+    }
+    for (Standard_Integer aPntIter = 1; aPntIter <= theInt1.NbPointsInLine (aLineIter); ++aPntIter)
+    {
+      theInt1.GetLinePoint (aLineIter, aPntIter, aCoords1[0], aCoords1[1], aCoords1[2],
+                            aCoords1[3], aCoords1[4], aCoords1[5], aCoords1[6], aCoords1[7]);
+      theInt2.GetLinePoint (aLineIter, aPntIter, aCoords2[0], aCoords2[1], aCoords2[2],
+                            aCoords2[3], aCoords2[4], aCoords2[5], aCoords2[6], aCoords2[7]);
+      for (Standard_Integer aCoordIter = 0; aCoordIter < 8; ++aCoordIter)
+      {
+        if (aCoords1[aCoordIter] != aCoords2[aCoordIter])
+        {
+          return Standard_False;
+        }
+      }
+    }
+  }
+  for (Standard_Integer aZoneIter = 1; aZoneIter <= theInt1.NbTangentZones(); ++aZoneIter)
+  {
+    theInt1.GetTangentZonePoint (aZoneIter, 1, aCoords1[0], aCoords1[1], aCoords1[2],
+                                 aCoords1[3], aCoords1[4], aCoords1[5], aCoords1[6]);
+    theInt2.GetTangentZonePoint (aZoneIter, 1, aCoords2[0], aCoords2[1], aCoords2[2],
+                                 aCoords2[3], aCoords2[4], aCoords2[5], aCoords2[6]);
+    for (Standard_Integer aCoordIter = 0; aCoordIter < 7; ++aCoordIter)
+    {
+      if (aCoords1[aCoordIter] != aCoords2[aCoordIter])
+      {
+        return Standard_False;
+      }
+    }
+  }
+  return Standard_True;
+}
+
+//=======================================================================
+//function : QAPolyhedralIntersection
+//purpose  : Compares the polyhedral intersections of the face with the faces
+//           of the shape computed sequentially and in parallel threads
+//=======================================================================
+static Standard_Integer QAPolyhedralIntersection (Draw_Interpretor& theDI,
+                                                  Standard_Integer theNbArgs,
+                                                  const char** theArgVec)
+{
+  if (theNbArgs != 3 && theNbArgs != 4)
+  {
+    theDI << "Syntax error: wrong number of arguments\n";
+    return 1;
+  }
+
+  const TopoDS_Shape aFaceShape = DBRep::Get (theArgVec[1], TopAbs_FACE);
+  const TopoDS_Shape aShape     = DBRep::Get (theArgVec[2]);
+  if (aFaceShape.IsNull() || aShape.IsNull())
+  {
+    theDI << "Syntax error: null shape\n";
+    return 1;
+  }
+  const Standard_Integer aNbSamples = theNbArgs == 4 ? Draw::Atoi (theArgVec[3]) : 30;
+  if (aNbSamples < 2)
+  {
+    theDI << "Syntax error: wrong number of samples\n";
+    return 1;
+  }
+
+  const Handle(Adaptor3d_Surface) aSurface = new BRepAdaptor_Surface (TopoDS::Face (aFaceShape));
+  TColStd_Array1OfReal aUPars1, aVPars1;
+  IntPolyh_Tools::MakeSampling (aSurface, aNbSamples, aNbSamples, Standard_False, aUPars1, aVPars1);
+
+  TopTools_IndexedMapOfShape aFaces;
+  TopExp::MapShapes (aShape, TopAbs_FACE, aFaces);
+
+  OSD_Timer aTimerSeq, aTimerPar;
+  Standard_Integer aNbErrors = 0, aNbLines = 0;
+  for (Standard_Integer aFaceIter = 1; aFaceIter <= aFaces.Extent(); ++aFaceIter)
+  {
+    const Handle(Adaptor3d_Surface) anOtherSurface = new BRepAdaptor_Surface (TopoDS::Face (aFaces (aFaceIter)));
+    TColStd_Array1OfReal aUPars2, aVPars2;
+    IntPolyh_Tools::MakeSampling (anOtherSurface, aNbSamples, aNbSamples, Standard_False, aUPars2, aVPars2);
+
+    aTimerSeq.Start();
+    IntPolyh_Intersection anIntSeq (aSurface, aUPars1, aVPars1, anOtherSurface, aUPars2, aVPars2, Standard_False);
+    aTimerSeq.Stop();
+
+    aTimerPar.Start();
+    IntPolyh_Intersection anIntPar (aSurface, aUPars1, aVPars1, anOtherSurface, aUPars2, aVPars2, Standard_True);
+    aTimerPar.Stop();
+
+    aNbLines += anIntSeq.NbSectionLines();
+    if (!isSamePolyhedralIntersection (anIntSeq, anIntPar))
+    {
+      theDI << "Error: the intersection with face " << aFaceIter << " differs\n";
+      ++aNbErrors;
+    }
+  }
+
+  theDI << "Number of intersected faces: " << aFaces.Extent() << "\n";
+  theDI << "Number of section lines: " << aNbLines << "\n";
+  theDI << "Sequential: " << aTimerSeq.ElapsedTime() << " s\n";
+  theDI << "Parallel: " << aTimerPar.ElapsedTime() << " s\n";
+  if (aNbErrors == 0)
+  {
+    theDI << "The polyhedral intersections are equal\n";
+  }
+  return 0;
+}
+
+#include <Standard_MMgrThreadCache.hxx>
+
+namespace
+{
+  //! Job of the thread allocating or freeing the range of the blocks.
+  struct QAMMgrThreadCacheJob
+  {
+    Standard_MMgrThreadCache*             Manager;
+    NCollection_Array1<Standard_Address>* Blocks;
+    Standard_Integer                      First;
+    Standard_Integer                      Last;
+    Standard_Boolean                      ToAllocate;
+    Standard_Integer                      NbErrors;
+  };
+
+  //! Returns the size of the block of the index, both small and large blocks are used.
+  static Standard_Size qaBlockSize (const Standard_Integer theIndex)
+  {
+    return theIndex % 64 == 0 ? Standard_Size (3000 + theIndex % 1000) : Standard_Size (1 + (theIndex * 37) % 1500);
+  }
+
+  //! Allocates the blocks filling them by the pattern, or checks the pattern and frees the blocks.
+  static Standard_Address qaMMgrThreadCacheJob (Standard_Address theData)
+  {
+    QAMMgrThreadCacheJob& aJob = *(QAMMgrThreadCacheJob* )theData;
+    for (Standard_Integer anIndex = aJob.First; anIndex <= aJob.Last; ++anIndex)
+    {
+      const Standard_Size aSize = qaBlockSize (anIndex);
+      const unsigned char aPattern = (unsigned char )(anIndex * 7);
+      if (aJob.ToAllocate)
+      {
+        unsigned char* aBlock = (unsigned char* )aJob.Manager->Allocate (aSize);
+        memset (aBlock, aPattern, aSize);
+        aJob.Blocks->ChangeValue (anIndex) = aBlock;
+        continue;
+      }
+
+      // free in the reverse order to mix the blocks of the lists
+      const Standard_Integer aRevIndex = aJob.First + aJob.Last - anIndex;
+      const unsigned char* aBlock = (const unsigned char* )aJob.Blocks->Value (aRevIndex);
+      const Standard_Size aRevSize = qaBlockSize (aRevIndex);
+      const unsigned char aRevPattern = (unsigned char )(aRevIndex * 7);
+      for (Standard_Size aByteIter = 0; aByteIter < aRevSize; ++aByteIter)
+      {
+        if (aBlock[aByteIter] != aRevPattern)
+        {
+          ++aJob.NbErrors;
+          break;
+        }
+      }
+      aJob.Manager->Free ((Standard_Address )aBlock);
+      aJob.Blocks->ChangeValue (aRevIndex) = NULL;
+    }
+    return NULL;
+  }
+
+  //! Runs the jobs in the separate threads and waits for their exit.
+  static void qaRunMMgrThreadCacheJobs (NCollection_Array1<QAMMgrThreadCacheJob>& theJobs)
+  {
+    NCollection_Array1<OSD_Thread> aThreads (theJobs.Lower(), theJobs.Upper());
+    for (Standard_Integer aThreadIter = theJobs.Lower(); aThreadIter <= theJobs.Upper(); ++aThreadIter)
+    {
+      aThreads.ChangeValue (aThreadIter).SetFunction (qaMMgrThreadCacheJob);
+      aThreads.ChangeValue (aThreadIter).Run (&theJobs.ChangeValue (aThreadIter));
+    }
+    for (Standard_Integer aThreadIter = theJobs.Lower(); aThreadIter <= theJobs.Upper(); ++aThreadIter)
+    {
+      aThreads.ChangeValue (aThreadIter).Wait();
+    }
+  }
+}
+
+//=======================================================================
+//function : QAMMgrThreadCache
+//purpose  : Allocates the blocks by the memory manager with the caches of the threads
+//           in some threads, frees them in other threads and checks the statistics
+//=======================================================================
+static Standard_Integer QAMMgrThreadCache (Draw_Interpretor& theDI,
+                                           Standard_Integer theNbArgs,
+                                           const char** theArgVec)
+{
+  if (theNbArgs > 3)
+  {
+    theDI << "Syntax error: wrong number of arguments\n";
+    return 1;
+  }
+  const Standard_Integer aNbThreads = theNbArgs > 1 ? Draw::Atoi (theArgVec[1]) : 4;
+  const Standard_Integer aNbBlocks  = theNbArgs > 2 ? Draw::Atoi (theArgVec[2]) : 100000;
+  if (aNbThreads < 2 || aNbBlocks < 1)
+  {
+    theDI << "Syntax error: wrong number of threads or blocks\n";
+    return 1;
+  }
+
+  Standard_MMgrThreadCache aManager (Standard_False);
+  NCollection_Array1<Standard_Address> aBlocks (0, aNbThreads * aNbBlocks - 1);
+  NCollection_Array1<QAMMgrThreadCacheJob> aJobs (0, aNbThreads - 1);
+  for (Standard_Integer aThreadIter = 0; aThreadIter < aNbThreads; ++aThreadIter)
+  {
+    QAMMgrThreadCacheJob& aJob = aJobs.ChangeValue (aThreadIter);
+    aJob.Manager    = &aManager;
+    aJob.Blocks     = &aBlocks;
+    aJob.First      = aThreadIter * aNbBlocks;
+    aJob.Last       = aJob.First + aNbBlocks - 1;
+    aJob.ToAllocate = Standard_True;
+    aJob.NbErrors   = 0;
+  }
+
+  Standard_Size anExpectedInUse = 0;
+  for (Standard_Integer anIndex = aBlocks.Lower(); anIndex <= aBlocks.Upper(); ++anIndex)
+  {
+    anExpectedInUse += qaBlockSize (anIndex);
+  }
+
+  // allocate the blocks
+  qaRunMMgrThreadCacheJobs (aJobs);
+  Standard_Size aReserved = 0, anInUse = 0;
+  aManager.Statistics (aReserved, anInUse);
+  theDI << "Memory after allocation: reserved " << (Standard_Integer )(aReserved / 1024)
+        << " KiB, in use " << (Standard_Integer )(anInUse / 1024) << " KiB\n";
+  if (anInUse < anExpectedInUse || anInUse > aReserved)
+  {
+    theDI << "Error: wrong size of the memory in use after allocation\n";
+  }
+
+  // free the blocks of the other threads
+  for (Standard_Integer aThreadIter = 0; aThreadIter < aNbThreads; ++aThreadIter)
+  {
+    QAMMgrThreadCacheJob& aJob = aJobs.ChangeValue (aThreadIter);
+    aJob.First      = ((aThreadIter + 1) % aNbThreads) * aNbBlocks;
+    aJob.Last       = aJob.First + aNbBlocks - 1;
+    aJob.ToAllocate = Standard_False;
+  }
+  qaRunMMgrThreadCacheJobs (aJobs);
+  Standard_Integer aNbErrors = 0;
+  for (Standard_Integer aThreadIter = 0; aThreadIter < aNbThreads; ++aThreadIter)
+  {
+    aNbErrors += aJobs.Value (aThreadIter).NbErrors;
+  }
+  if (aNbErrors != 0)
+  {
+    theDI << "Error: " << aNbErrors << " blocks are corrupted\n";
+  }
+
+  aManager.Statistics (aReserved, anInUse);
+  theDI << "Memory after deallocation: reserved " << (Standard_Integer )(aReserved / 1024)
+        << " KiB, in use " << (Standard_Integer )anInUse << " bytes\n";
+  if (anInUse != 0)
+  {
+    theDI << "Error: the memory in use is not zero after deallocation\n";
+  }
+  return 0;
+}
+
+#include <TopoDS_Iterator.hxx>
+
+//=======================================================================
+//function : QATopoDSIteratorRemove
+//purpose  : Replaces the sub-shapes of the compound while iterating it
+//           and checks that every sub-shape is visited
+//=======================================================================
+static Standard_Integer QATopoDSIteratorRemove (Draw_Interpretor& theDI,
+                                                Standard_Integer theNbArgs,
+                                                const char** )
+{
+  if (theNbArgs != 1)
+  {
+    theDI << "Syntax error: wrong number of arguments\n";
+    return 1;
+  }
+
+  const Standard_Integer aNbVertices = 10;
+  gp_Trsf aTrsf;
+  aTrsf.SetTranslation (gp_Vec (1.0, 2.0, 3.0));
+  Standard_Integer aNbErrors = 0;
+  for (Standard_Integer aCaseIter = 0; aCaseIter < 2; ++aCaseIter)
+  {
+    BRep_Builder aBuilder;
+    TopoDS_Compound aCompound;
+    aBuilder.MakeCompound (aCompound);
+    for (Standard_Integer aVertIter = 0; aVertIter < aNbVertices; ++aVertIter)
+    {
+      // the same vertex is added with both orientations to check their distinction
+      TopoDS_Shape aVertex = BRepBuilderAPI_MakeVertex (gp_Pnt (aVertIter / 2, 0.0, 0.0)).Shape();
+      aBuilder.Add (aCompound, aVertIter % 2 == 0 ? aVertex : aVertex.Reversed());
+    }
+    if (aCaseIter == 1)
+    {
+      // the location and orientation of the compound are applied by the iterator
+      aCompound.Move (TopLoc_Location (aTrsf));
+      aCompound.Reverse();
+    }
+
+    // each sub-shape is replaced by the new one added at the end
+    TopTools_IndexedMapOfShape anOriginals, aVisited;
+    for (TopoDS_Iterator anIter (aCompound); anIter.More(); anIter.Next())
+    {
+      anOriginals.Add (anIter.Value());
+    }
+    Standard_Integer aNbSteps = 0;
+    for (TopoDS_Iterator anIter (aCompound); anIter.More(); anIter.Next(), ++aNbSteps)
+    {
+      const TopoDS_Shape aCurrent = anIter.Value();
+      if (!anOriginals.Contains (aCurrent))
+      {
+        continue;
+      }
+      aVisited.Add (aCurrent);
+      aBuilder.Remove (aCompound, aCurrent);
+      aBuilder.Add (aCompound, BRepBuilderAPI_MakeVertex (gp_Pnt (0.0, 1.0, 0.0)).Shape());
+    }
+    aNbErrors += aVisited.Extent() != aNbVertices || aNbSteps != 2 * aNbVertices;
+
+    // the preceding sub-shape is removed, the following ones are still visited
+    Standard_Integer aNbVisited = 0;
+    for (TopoDS_Iterator anIter (aCompound); anIter.More(); anIter.Next(), ++aNbVisited)
+    {
+      if (aNbVisited == 2)
+      {
+        TopoDS_Iterator aFirst (aCompound);
+        aBuilder.Remove (aCompound, aFirst.Value());
+      }
+    }
+    aNbErrors += aNbVisited != aNbVertices || aCompound.NbChildren() != aNbVertices - 1;
+  }
+
+  if (aNbErrors != 0)
+  {
+    theDI << "Error: " << aNbErrors << " errors in the iteration of the modified shape\n";
+  }
+  else
+  {
+    theDI << "All sub-shapes of the modified shape are visited\n";
+  }
+  return 0;
+}
+
+#include <IntTools_Predicates.hxx>
+
+//=======================================================================
+//function : QAExactPredicates
+//purpose  : Checks the signs of the predicates on the nearly degenerated
+//           input, for which the exact signs are known
+//=======================================================================
+static Standard_Integer QAExactPredicates (Draw_Interpretor& theDI,
+                                           Standard_Integer theNbArgs,
+                                           const char** )
+{
+  if (theNbArgs != 1)
+  {
+    theDI << "Syntax error: wrong number of arguments\n";
+    return 1;
+  }
+
+  // (1 + e) * (1 + e) - (1 + 2 * e) = e^2 with e = 2^-27,
+  // while the rounded product (1 + e) * (1 + e) is equal to 1 + 2 * e
+  const Standard_Real aE  = ldexp (1.0, -27);
+  const Standard_Real a1E  = 1.0 + aE;
+  const Standard_Real a1E2 = 1.0 + 2.0 * aE;
+
+  // the Z component of V1 ^ V2 of the first cases is this nearly zero determinant
+  struct TripleCase
+  {
+    gp_XYZ V1, V2, V3;
+    Standard_Integer Sign;
+  };
+  const TripleCase aTripleCases[] =
+  {
+    { gp_XYZ (a1E,  a1E2, 0.0), gp_XYZ (1.0,  a1E, 0.0), gp_XYZ (0.0, 0.0, 1.0),  1 },
+    { gp_XYZ (1.0,  a1E,  0.0), gp_XYZ (a1E, a1E2, 0.0), gp_XYZ (0.0, 0.0, 1.0), -1 },
+    { gp_XYZ (a1E,  a1E2, 0.5), gp_XYZ (1.0,  a1E, 0.5), gp_XYZ (0.0, 0.0, 1.0),  1 },
+    { gp_XYZ (0.1,  0.2,  0.3), gp_XYZ (0.7,  1.1, 1.3), gp_XYZ (0.2, 0.4, 0.6),  0 },
+    { gp_XYZ (0.1,  0.2,  0.3), gp_XYZ (0.7,  1.1, 1.3), gp_XYZ (0.1, 0.2, 0.3),  0 }
+  };
+  Standard_Integer aNbErrors = 0;
+  const Standard_Integer aNbTripleCases = sizeof (aTripleCases) / sizeof (aTripleCases[0]);
+  for (Standard_Integer aCaseIter = 0; aCaseIter < aNbTripleCases; ++aCaseIter)
+  {
+    const TripleCase& aCase = aTripleCases[aCaseIter];
+    const Standard_Real aValue = IntTools_Predicates::TripleProduct (aCase.V1, aCase.V2, aCase.V3);
+    const Standard_Integer aSign = aValue > 0.0 ? 1 : (aValue < 0.0 ? -1 : 0);
+    if (aSign != aCase.Sign)
+    {
+      theDI << "Error: the sign of the triple product " << aCaseIter + 1 << " is " << aSign
+            << " instead of " << aCase.Sign << "\n";
+      ++aNbErrors;
+    }
+  }
+
+  if (aNbErrors == 0)
+  {
+    theDI << "The signs of the predicates are exact\n";
+  }
+  return 0;
+}
+
+#include <ElSLib.hxx>
+
+//! Computes the parameters of the points on the elementary surface
+//! of the given kind (0 - plane, 1 - cylinder, 2 - cone, 3 - sphere, 4 - torus) one by one.
+static void qaElementarySurfaceParamsByPoints (const Standard_Integer theKind,
+                                               const gp_Ax3& thePos,
+                                               const TColgp_Array1OfPnt& thePoints,
+                                               TColStd_Array1OfReal& theU,
+                                               TColStd_Array1OfReal& theV)
+{
+  for (Standard_Integer anIter = thePoints.Lower(); anIter <= thePoints.Upper(); ++anIter)
+  {
+    const gp_Pnt& aPnt = thePoints (anIter);
+    switch (theKind)
+    {
+      case 0:  ElSLib::PlaneParameters    (thePos,                 aPnt, theU (anIter), theV (anIter)); break;
+      case 1:  ElSLib::CylinderParameters (thePos, 2.0,            aPnt, theU (anIter), theV (anIter)); break;
+      case 2:  ElSLib::ConeParameters     (thePos, 1.5, M_PI / 6., aPnt, theU (anIter), theV (anIter)); break;
+      case 3:  ElSLib::SphereParameters   (thePos, 3.0,            aPnt, theU (anIter), theV (anIter)); break;
+      default: ElSLib::TorusParameters    (thePos, 5.0, 1.0,       aPnt, theU (anIter), theV (anIter)); break;
+    }
+  }
+}
+
+//! Computes the parameters of the points on the elementary surface
+//! of the given kind by the array functions.
+static void qaElementarySurfaceParamsByArray (const Standard_Integer theKind,
+                                              const gp_Ax3& thePos,
+                                              const TColgp_Array1OfPnt& thePoints,
+                                              TColStd_Array1OfReal& theU,
+                                              TColStd_Array1OfReal& theV)
+{
+  switch (theKind)
+  {
+    case 0:  ElSLib::PlaneParameters    (thePos,                 thePoints, theU, theV); break;
+    case 1:  ElSLib::CylinderParameters (thePos, 2.0,            thePoints, theU, theV); break;
+    case 2:  ElSLib::ConeParameters     (thePos, 1.5, M_PI / 6., thePoints, theU, theV); break;
+    case 3:  ElSLib::SphereParameters   (thePos, 3.0,            thePoints, theU, theV); break;
+    default: ElSLib::TorusParameters    (thePos, 5.0, 1.0,       thePoints, theU, theV); break;
+  }
+}
+
+//=======================================================================
+//function : QAElementaryParameters
+//purpose  : Compares the parameters of the arrays of points on the elementary surfaces
+//           computed by the array functions of ElSLib with the parameters computed
+//           point by point and measures the time of both
+//=======================================================================
+static Standard_Integer QAElementaryParameters (Draw_Interpretor& theDI,
+                                                Standard_Integer theNbArgs,
+                                                const char** theArgVec)
+{
+  if (theNbArgs > 3)
+  {
+    theDI << "Syntax error: wrong number of arguments\n";
+    return 1;
+  }
+
+  const Standard_Integer aNbPnts = theNbArgs > 1 ? Draw::Atoi (theArgVec[1]) : 100000;
+  const Standard_Integer aNbRuns = theNbArgs > 2 ? Draw::Atoi (theArgVec[2]) : 10;
+  if (aNbPnts < 1 || aNbRuns < 1)
+  {
+    theDI << "Syntax error: wrong number of points or runs\n";
+    return 1;
+  }
+
+  // the points near the surfaces, within the domains of the parameters
+  const gp_Ax3 aPos3 (gp_Pnt (1.0, 2.0, 3.0), gp_Dir (0.3, 0.5, 0.8));
+  math_BullardGenerator aRandom;
+  Standard_Integer aNbErrors = 0;
+  TColgp_Array1OfPnt aPnts (1, aNbPnts);
+  TColStd_Array1OfReal aU (1, aNbPnts), aV (1, aNbPnts), anArrU (1, aNbPnts), anArrV (1, aNbPnts);
+  const char* aSurfNames[5] = { "plane", "cylinder", "cone", "sphere", "torus" };
+  for (Standard_Integer aKind = 0; aKind < 5; ++aKind)
+  {
+    for (Standard_Integer anIter = 1; anIter <= aNbPnts; ++anIter)
+    {
+      const Standard_Real anU = 2.0 * M_PI * aRandom.NextReal();
+      const Standard_Real aV  = aKind == 3 ? M_PI * (aRandom.NextReal() - 0.5)
+                                           : 2.0 * M_PI * aRandom.NextReal();
+      gp_Pnt aPnt;
+      switch (aKind)
+      {
+        case 0:  aPnt = ElSLib::PlaneValue    (anU, aV, aPos3);                 break;
+        case 1:  aPnt = ElSLib::CylinderValue (anU, aV, aPos3, 2.0);            break;
+        case 2:  aPnt = ElSLib::ConeValue     (anU, aV, aPos3, 1.5, M_PI / 6.); break;
+        case 3:  aPnt = ElSLib::SphereValue   (anU, aV, aPos3, 3.0);            break;
+        default: aPnt = ElSLib::TorusValue    (anU, aV, aPos3, 5.0, 1.0);       break;
+      }
+      aPnts (anIter) = aPnt.Translated (gp_Vec (0.1 * (aRandom.NextReal() - 0.5),
+                                                0.1 * (aRandom.NextReal() - 0.5),
+                                                0.1 * (aRandom.NextReal() - 0.5)));
+    }
+
+    OSD_Timer aTimerPnt, aTimerArr;
+    for (Standard_Integer aRunIter = 0; aRunIter < aNbRuns; ++aRunIter)
+    {
+      aTimerPnt.Start();
+      qaElementarySurfaceParamsByPoints (aKind, aPos3, aPnts, aU, aV);
+      aTimerPnt.Stop();
+      aTimerArr.Start();
+      qaElementarySurfaceParamsByArray (aKind, aPos3, aPnts, anArrU, anArrV);
+      aTimerArr.Stop();
+    }
+    for (Standard_Integer anIter = 1; anIter <= aNbPnts; ++anIter)
+    {
+      if (aU (anIter) != anArrU (anIter)
+       || aV (anIter) != anArrV (anIter))
+      {
+        theDI << "Error: the array parameters on the " << aSurfNames[aKind] << " differ\n";
+        ++aNbErrors;
+        break;
+      }
+    }
+    theDI << aSurfNames[aKind] << " parameters: by points "
+          << aTimerPnt.ElapsedTime() << " s, by array " << aTimerArr.ElapsedTime() << " s\n";
+  }
+
+  if (aNbErrors == 0)
+  {
+    theDI << "The parameters are computed correctly\n";
+  }
+  return 0;
+}
+
 void QABugs::Commands_20(Draw_Interpretor& theCommands) {
   const char *group = "QABugs";
 
@@ -4585,5 +6530,90 @@ void QABugs::Commands_20(Draw_Interpretor& theCommands) {
     __FILE__,
     OCC26441, group);
 
+  theCommands.Add("QATopExpMapShapes",
+    "QATopExpMapShapes shape : compares the maps of sub-shapes filled by TopExp in parallel and sequential modes",
+    __FILE__,
+    QATopExpMapShapes, group);
+  theCommands.Add("QAShapeIndex",
+    "QAShapeIndex shape : checks the topology index of the shape against the maps filled by TopExp",
+    __FILE__,
+    QAShapeIndex, group);
+  theCommands.Add("QATaskGraph",
+    "QATaskGraph nbParts [nbThreads] : builds, meshes and collects the parts by the stages of the task graph",
+    __FILE__,
+    QATaskGraph, group);
+  theCommands.Add("QATaskGraphNested",
+    "QATaskGraphNested [nbThreads=4] : checks that the parallel loop nested into the task of the graph"
+    "\n\t\t: is performed by the threads of the graph waiting for the ready tasks",
+    __FILE__,
+    QATaskGraphNested, group);
+  theCommands.Add("QASurfaceGrid",
+    "QASurfaceGrid surface nbU nbV : compares the evaluation of the surface on the grid with the evaluation by points",
+    __FILE__,
+    QASurfaceGrid, group);
+  theCommands.Add("QAProjectPoints",
+    "QAProjectPoints surface nbPoints deflection : compares the batch projection of the random points"
+    "\n\t\t: within the deflection from the surface with the projection by points",
+    __FILE__,
+    QAProjectPoints, group);
+  theCommands.Add("QAEvalArray",
+    "QAEvalArray curve|surface nbPoints : compares the evaluation of the curve or surface"
+    "\n\t\t: on the array of random parameters with the evaluation by points",
+    __FILE__,
+    QAEvalArray, group);
+  theCommands.Add("QAProjectionCache",
+    "QAProjectionCache result object tool [nbRuns=3] : compares the cuts of the shapes"
+    "\n\t\t: computed in the scope of the projection cache with the cut computed without cache",
+    __FILE__,
+    QAProjectionCache, group);
+  theCommands.Add("QAGlobOptMin",
+    "QAGlobOptMin curve1 curve2 : compares the parallel global search of the minimal distance"
+    "\n\t\t: between the curves by math_GlobOptMin and Extrema_ExtCC with the serial search",
+    __FILE__,
+    QAGlobOptMin, group);
+  theCommands.Add("QAMathNewtonN",
+    "QAMathNewtonN surface [nbPoints=10000] : compares the fixed-size Newton solver and linear systems"
+    "\n\t\t: with math_NewtonFunctionSetRoot and math_Gauss on the projections of the points onto the surface",
+    __FILE__,
+    QAMathNewtonN, group);
+  theCommands.Add("QAExtremaCurvesBVH",
+    "QAExtremaCurvesBVH curve1 curve2 : compares the extrema between the curves computed"
+    "\n\t\t: with and without the selection of the pairs of intervals by the BVH trees",
+    __FILE__,
+    QAExtremaCurvesBVH, group);
+  theCommands.Add("QAFaceFaceSampling",
+    "QAFaceFaceSampling face shape : compares the intersections of the face with the faces of the shape"
+    "\n\t\t: computed with the surface samplings kept in the shared context and in the separate contexts",
+    __FILE__,
+    QAFaceFaceSampling, group);
+  theCommands.Add("QAPolyhedralIntersection",
+    "QAPolyhedralIntersection face shape [nbSamples=30] : compares the polyhedral intersections"
+    "\n\t\t: of the face with the faces of the shape computed sequentially and in parallel threads",
+    __FILE__,
+    QAPolyhedralIntersection, group);
+  theCommands.Add("QAMMgrThreadCache",
+    "QAMMgrThreadCache [nbThreads=4 [nbBlocks=100000]] : allocates the blocks by the memory manager"
+    "\n\t\t: with the caches of the threads in some threads, frees them in other threads and checks the statistics",
+    __FILE__,
+    QAMMgrThreadCache, group);
+  theCommands.Add("QATopoDSIteratorRemove",
+    "QATopoDSIteratorRemove : replaces the sub-shapes of the compound while iterating it"
+    "\n\t\t: and checks that every sub-shape is visited",
+    __FILE__,
+    QATopoDSIteratorRemove, group);
+
+  theCommands.Add("QAExactPredicates",
+    "QAExactPredicates : checks the signs of the exact predicates of IntTools_Predicates"
+    "\n\t\t: on the nearly degenerated input",
+    __FILE__,
+    QAExactPredicates, group);
+
+  theCommands.Add("QAElementaryParameters",
+    "QAElementaryParameters [nbPoints=100000 [nbRuns=10]]"
+    "\n\t\t: compares the parameters of the points on the elementary surfaces computed"
+    "\n\t\t: by the array functions of ElSLib and point by point and measures the time of both",
+    __FILE__,
+    QAElementaryParameters, group);
+
   return;
 }
@@ -198,8 +198,12 @@ static Standard_Integer QABVH_ShapeSelect (Draw_Interpretor& theDI,
 
   // Which selector to use
   Standard_Boolean useVoidSelector = Standard_False;
+  Standard_Boolean useQuadTree = Standard_False;
   if (theArgc > 4)
+  {
     useVoidSelector = !strcmp (theArgv[4], "-void");
+    useQuadTree = !strcmp (theArgv[4], "-quad");
+  }
 
   // Define BVH Builder
   opencascade::handle <BVH_LinearBuilder <Standard_Real, 3> > aLBuilder =
@@ -238,7 +242,18 @@ static Standard_Integer QABVH_ShapeSelect (Draw_Interpretor& theDI,
   BRepBndLib::Add (aBShape, aSelectionBox);
 
   // Perform selection
-  if (!useVoidSelector)
+  if (useQuadTree)
+  {
+    opencascade::handle<BVH_Tree<Standard_Real, 3, BVH_QuadTree>> aQBVH =
+      aShapeBoxSet->BVH()->CollapseToQuadTree();
+
+    ShapeSelector aSelector;
+    aSelector.SetBox (aSelectionBox);
+    aSelector.SetBVHSet (aShapeBoxSet.get());
+    aSelector.Select (aQBVH);
+    aSelectedShapes = aSelector.Shapes();
+  }
+  else if (!useVoidSelector)
   {
     ShapeSelector aSelector;
     aSelector.SetBox (aSelectionBox);
@@ -404,8 +419,12 @@ static Standard_Integer QABVH_PairSelect (Draw_Interpretor& theDI,
 
   // Which selector to use
   Standard_Boolean useVoidSelector = Standard_False;
+  Standard_Boolean useQuadTree = Standard_False;
   if (theArgc > 4)
+  {
     useVoidSelector = !strcmp (theArgv[4], "-void");
+    useQuadTree = !strcmp (theArgv[4], "-quad");
+  }
 
   // Define BVH Builder
   opencascade::handle <BVH_LinearBuilder <Standard_Real, 3> > aLBuilder =
@@ -437,7 +456,22 @@ static Standard_Integer QABVH_PairSelect (Draw_Interpretor& theDI,
   }
 
   NCollection_List <std::pair <TopoDS_Shape, TopoDS_Shape> > aPairs;
-  if (!useVoidSelector)
+  if (useQuadTree)
+  {
+    opencascade::handle<BVH_Tree<Standard_Real, 3, BVH_QuadTree>> aQBVH[2] =
+    {
+      aShapeBoxSet[0]->BVH()->CollapseToQuadTree(),
+      aShapeBoxSet[1]->BVH()->CollapseToQuadTree()
+    };
+
+    // Initialize selector
+    PairShapesSelector aSelector;
+    // Select the elements
+    aSelector.SetBVHSets (aShapeBoxSet[0].get(), aShapeBoxSet[1].get());
+    aSelector.Select (aQBVH[0], aQBVH[1]);
+    aPairs = aSelector.Pairs();
+  }
+  else if (!useVoidSelector)
   {
     // Initialize selector
     PairShapesSelector aSelector;
@@ -824,14 +858,16 @@ void QABugs::Commands_BVH (Draw_Interpretor& theCommands)
 
   theCommands.Add ("QABVH_ShapeSelect",
                    "Tests the work of BHV_BoxSet algorithm on the simple example of selection of shapes which boxes interfere with given box.\n"
-                   "Usage: QABVH_ShapeSelect result shape box (defined as a solid) [-void]\n"
-                   "\tResult should contain all sub-shapes of the shape interfering with given box",
+                   "Usage: QABVH_ShapeSelect result shape box (defined as a solid) [-void/-quad]\n"
+                   "\tResult should contain all sub-shapes of the shape interfering with given box\n"
+                   "\t-quad - performs selection from the quad tree (QBVH)",
                    __FILE__, QABVH_ShapeSelect, group);
 
   theCommands.Add ("QABVH_PairSelect",
                    "Tests the work of BHV_BoxSet algorithm on the simple example of selection of pairs of shapes with interfering bounding boxes.\n"
-                   "Usage: QABVH_PairSelect result shape1 shape2 [-void]\n"
-                   "\tResult should contain all interfering pairs (compound of pairs)",
+                   "Usage: QABVH_PairSelect result shape1 shape2 [-void/-quad]\n"
+                   "\tResult should contain all interfering pairs (compound of pairs)\n"
+                   "\t-quad - performs selection from the quad trees (QBVH)",
                    __FILE__, QABVH_PairSelect, group);
 
   theCommands.Add ("QABVH_PairDistance",
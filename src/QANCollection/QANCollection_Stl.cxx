@@ -19,6 +19,7 @@
 #endif
 
 #include <QANCollection.hxx>
+#include <Draw.hxx>
 #include <Draw_Interpretor.hxx>
 
 #include <NCollection_List.hxx>
@@ -28,6 +29,9 @@
 #include <NCollection_DataMap.hxx>
 #include <NCollection_IndexedMap.hxx>
 #include <NCollection_IndexedDataMap.hxx>
+#include <NCollection_FlatMap.hxx>
+#include <NCollection_FlatDataMap.hxx>
+#include <NCollection_FlatIndexedMap.hxx>
 #include <OSD_Timer.hxx>
 #include <OSD_Parallel.hxx>
 
@@ -1290,6 +1294,87 @@ static Standard_Integer QANTestNCollectionIndexedMap (Draw_Interpretor& di, Stan
   return 0;
 }
 
+//=======================================================================
+//function : TestPerformanceFlatMap
+//purpose  : Compares the time of addition and search of the keys
+//           in the regular map and in the map with open addressing
+//=======================================================================
+template<class MapType, class FlatMapType>
+void TestPerformanceFlatMap (Draw_Interpretor& theDI,
+                             const char*       theName,
+                             const std::vector<Standard_Integer>& theKeys,
+                             const std::vector<Standard_Integer>& theQueries)
+{
+  OSD_Timer aTimer;
+
+  Standard_Real aTimes[2][2];
+  Standard_Integer aNbFound[2] = { 0, 0 };
+  for (Standard_Integer aMapIter = 0; aMapIter < 2; ++aMapIter)
+  {
+    MapType aMap;
+    FlatMapType aFlatMap;
+
+    aTimer.Reset();
+    aTimer.Start();
+    for (size_t anIdx = 0; anIdx < theKeys.size(); ++anIdx)
+    {
+      if (aMapIter == 0)
+        aMap.Add (theKeys[anIdx]);
+      else
+        aFlatMap.Add (theKeys[anIdx]);
+    }
+    aTimer.Stop();
+    aTimes[aMapIter][0] = aTimer.ElapsedTime();
+
+    aTimer.Reset();
+    aTimer.Start();
+    for (size_t anIdx = 0; anIdx < theQueries.size(); ++anIdx)
+    {
+      if (aMapIter == 0 ? aMap.Contains (theQueries[anIdx]) : aFlatMap.Contains (theQueries[anIdx]))
+        ++aNbFound[aMapIter];
+    }
+    aTimer.Stop();
+    aTimes[aMapIter][1] = aTimer.ElapsedTime();
+  }
+
+  if (aNbFound[0] != aNbFound[1])
+  {
+    theDI << "Error: " << theName << " results of search are not the same\n";
+  }
+
+  theDI << theName << " add (flat/regular):    " << aTimes[1][0] / Max (aTimes[0][0], 1e-16) << "\n"
+        << theName << " search (flat/regular): " << aTimes[1][1] / Max (aTimes[0][1], 1e-16) << "\n";
+}
+
+//=======================================================================
+//function : QANTestNCollectionFlatMap
+//purpose  :
+//=======================================================================
+static Standard_Integer QANTestNCollectionFlatMap (Draw_Interpretor& di, Standard_Integer theNbArgs, const char** theArgVec)
+{
+  const Standard_Integer aNbItems = theNbArgs > 1 ? Draw::Atoi (theArgVec[1]) : 1000000;
+
+  // random keys and the queries for them, half of which are absent in the map
+  std::mt19937 aGen (1);
+  std::vector<Standard_Integer> aKeys, aQueries;
+  for (Standard_Integer anId = 0; anId < aNbItems; ++anId)
+  {
+    const Standard_Integer aKey = static_cast<Standard_Integer> (aGen() & 0x7FFFFFFF);
+    aKeys.push_back (aKey);
+    aQueries.push_back (aKey);
+    aQueries.push_back (static_cast<Standard_Integer> (aGen() & 0x7FFFFFFF));
+  }
+  std::shuffle (aQueries.begin(), aQueries.end(), aGen);
+
+  TestPerformanceFlatMap<NCollection_Map<Standard_Integer>,
+                         NCollection_FlatMap<Standard_Integer> > (di, "Map", aKeys, aQueries);
+
+  TestPerformanceFlatMap<NCollection_IndexedMap<Standard_Integer>,
+                         NCollection_FlatIndexedMap<Standard_Integer> > (di, "IndexedMap", aKeys, aQueries);
+
+  return 0;
+}
+
 //=======================================================================
 //function : QANTestNCollectionIndexedDataMap
 //purpose  :
@@ -1463,5 +1548,12 @@ void QANCollection::CommandsStl (Draw_Interpretor& theCommands)
                    QANTestNCollectionIndexedDataMap,
                    aGroup);
 
+  theCommands.Add ("QANTestNCollectionFlatMap",
+                   "QANTestNCollectionFlatMap [nbKeys=1000000]"
+                   "\n\t\t: Compares the performance of the maps with open addressing with the regular maps",
+                   __FILE__,
+                   QANTestNCollectionFlatMap,
+                   aGroup);
+
   return;
 }
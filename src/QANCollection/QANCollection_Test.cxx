@@ -1341,6 +1341,772 @@ static Standard_Integer QAOsdPathPart (Draw_Interpretor& theDI, Standard_Integer
 }
 
 
+#include <NCollection_FlatMap.hxx>
+#include <NCollection_FlatDataMap.hxx>
+#include <NCollection_FlatIndexedMap.hxx>
+#include <TCollection_AsciiString.hxx>
+
+namespace
+{
+  //! Hasher giving the full-width hash codes, which coincide after folding to 32 bits,
+  //! and counting the comparisons of the keys
+  struct QANColFoldedHasher
+  {
+    static Standard_Size HashCode (const Standard_Integer theKey)
+    {
+      const Standard_Size aKey = static_cast<Standard_Size> (theKey);
+      return sizeof (Standard_Size) > 4 ? (((aKey << 16) << 16) | aKey) : aKey;
+    }
+
+    static Standard_Boolean IsEqual (const Standard_Integer theKey1, const Standard_Integer theKey2)
+    {
+      ++NbComparisons;
+      return theKey1 == theKey2;
+    }
+
+    static Standard_Integer NbComparisons;
+  };
+
+  Standard_Integer QANColFoldedHasher::NbComparisons = 0;
+}
+
+//=======================================================================
+//function : QANColTestFlatMap
+//purpose  : Performs random operations on the maps with open addressing
+//           and compares the results with the ones of the regular maps
+//=======================================================================
+static Standard_Integer QANColTestFlatMap (Draw_Interpretor& theDI, Standard_Integer theNbArgs, const char** theArgVec)
+{
+  if (theNbArgs > 2)
+  {
+    theDI << "Syntax error: wrong number of arguments";
+    return 1;
+  }
+
+  const Standard_Integer aNbOperations = theNbArgs == 2 ? Draw::Atoi (theArgVec[1]) : 100000;
+  const Standard_Integer aNbKeys = Max (aNbOperations / 10, 10);
+
+  NCollection_Map<TCollection_AsciiString> aMap;
+  NCollection_FlatMap<TCollection_AsciiString> aFlatMap;
+  NCollection_DataMap<Standard_Integer, TCollection_AsciiString> aDataMap;
+  NCollection_FlatDataMap<Standard_Integer, TCollection_AsciiString> aFlatDataMap;
+  NCollection_IndexedMap<Standard_Integer> anIndexedMap;
+  NCollection_FlatIndexedMap<Standard_Integer> aFlatIndexedMap;
+
+  Standard_Integer aNbErrors = 0;
+  math_BullardGenerator aRandom;
+  for (Standard_Integer anOpIter = 0; anOpIter < aNbOperations; ++anOpIter)
+  {
+    const Standard_Integer aKey = aRandom.NextInt() % aNbKeys;
+    const TCollection_AsciiString aStrKey (aKey);
+    switch (aRandom.NextInt() % 5)
+    {
+      case 0:
+      case 1:
+      {
+        aNbErrors += (aMap.Add (aStrKey) != aFlatMap.Add (aStrKey));
+        aNbErrors += (aDataMap.Bind (aKey, aStrKey) != aFlatDataMap.Bind (aKey, aStrKey));
+        aNbErrors += (anIndexedMap.Add (aKey) != aFlatIndexedMap.Add (aKey));
+        break;
+      }
+      case 2:
+      {
+        aNbErrors += (aMap.Remove (aStrKey) != aFlatMap.Remove (aStrKey));
+        aNbErrors += (aDataMap.UnBind (aKey) != aFlatDataMap.UnBind (aKey));
+        aNbErrors += (anIndexedMap.RemoveKey (aKey) != aFlatIndexedMap.RemoveKey (aKey));
+        break;
+      }
+      case 3:
+      {
+        if (anIndexedMap.Extent() > 1)
+        {
+          const Standard_Integer anIndex1 = 1 + aRandom.NextInt() % anIndexedMap.Extent();
+          const Standard_Integer anIndex2 = 1 + aRandom.NextInt() % anIndexedMap.Extent();
+          anIndexedMap.Swap (anIndex1, anIndex2);
+          aFlatIndexedMap.Swap (anIndex1, anIndex2);
+          if (!anIndexedMap.Contains (aKey))
+          {
+            anIndexedMap.Substitute (anIndex1, aKey);
+            aFlatIndexedMap.Substitute (anIndex1, aKey);
+          }
+        }
+        break;
+      }
+      default:
+      {
+        aNbErrors += (aMap.Contains (aStrKey) != aFlatMap.Contains (aStrKey));
+        const TCollection_AsciiString* anItem = aFlatDataMap.Seek (aKey);
+        aNbErrors += (aDataMap.IsBound (aKey) != (anItem != NULL));
+        aNbErrors += (anItem != NULL && !anItem->IsEqual (aDataMap.Find (aKey)));
+        aNbErrors += (anIndexedMap.FindIndex (aKey) != aFlatIndexedMap.FindIndex (aKey));
+        break;
+      }
+    }
+  }
+
+  // check the final content
+  if (aMap.Extent() != aFlatMap.Extent()
+   || aDataMap.Extent() != aFlatDataMap.Extent()
+   || anIndexedMap.Extent() != aFlatIndexedMap.Extent())
+  {
+    theDI << "Error: wrong number of keys in the map\n";
+    return 0;
+  }
+  for (NCollection_FlatMap<TCollection_AsciiString>::Iterator anIter (aFlatMap); anIter.More(); anIter.Next())
+  {
+    aNbErrors += !aMap.Contains (anIter.Key());
+  }
+  for (NCollection_FlatDataMap<Standard_Integer, TCollection_AsciiString>::Iterator anIter (aFlatDataMap); anIter.More(); anIter.Next())
+  {
+    const TCollection_AsciiString* anItem = aDataMap.Seek (anIter.Key());
+    aNbErrors += (anItem == NULL || !anItem->IsEqual (anIter.Value()));
+  }
+  for (Standard_Integer anIndex = 1; anIndex <= anIndexedMap.Extent(); ++anIndex)
+  {
+    aNbErrors += (anIndexedMap.FindKey (anIndex) != aFlatIndexedMap.FindKey (anIndex));
+  }
+
+  // check copying
+  NCollection_FlatIndexedMap<Standard_Integer> aCopy (aFlatIndexedMap);
+  for (Standard_Integer anIndex = 1; anIndex <= aCopy.Extent(); ++anIndex)
+  {
+    aNbErrors += (aCopy.FindIndex (aFlatIndexedMap (anIndex)) != anIndex);
+  }
+
+  // the keys should be compared only if their full hash codes coincide
+  NCollection_FlatMap<Standard_Integer, QANColFoldedHasher> aFoldedMap;
+  const Standard_Integer aNbFoldedKeys = Min (aNbKeys, 1000);
+  for (Standard_Integer aKey = 0; aKey < aNbFoldedKeys; ++aKey)
+  {
+    aFoldedMap.Add (aKey);
+  }
+  QANColFoldedHasher::NbComparisons = 0;
+  for (Standard_Integer aKey = 0; aKey < 2 * aNbFoldedKeys; ++aKey)
+  {
+    aNbErrors += (aFoldedMap.Contains (aKey) != (aKey < aNbFoldedKeys));
+  }
+  if (QANColFoldedHasher::NbComparisons > aNbFoldedKeys)
+  {
+    theDI << "Error: the keys of different hash codes are compared\n";
+    ++aNbErrors;
+  }
+
+  if (aNbErrors != 0)
+  {
+    theDI << "Error: " << aNbErrors << " mismatches with the regular maps\n";
+  }
+  else
+  {
+    theDI << "Maps with open addressing are consistent with the regular maps\n";
+  }
+  return 0;
+}
+
+#include <NCollection_ConcurrentDataMap.hxx>
+#include <NCollection_ConcurrentMap.hxx>
+#include <OSD_Parallel.hxx>
+
+#include <atomic>
+
+namespace
+{
+  //! Functor binding and searching the keys of the concurrent map, or of the map guarded by mutex
+  struct ConcurrentMapFunctor
+  {
+    NCollection_ConcurrentDataMap<Standard_Integer, Standard_Integer>* ConcurrentMap;
+    NCollection_ConcurrentMap<TCollection_AsciiString>* ConcurrentSet;
+    NCollection_DataMap<Standard_Integer, Standard_Integer>* GuardedMap;
+    Standard_Mutex* Mutex;
+    Standard_Integer NbKeys;
+    mutable std::atomic<int> NbBound;
+    mutable std::atomic<int> NbErrors;
+
+    ConcurrentMapFunctor() : ConcurrentMap (NULL), ConcurrentSet (NULL), GuardedMap (NULL), Mutex (NULL), NbKeys (1), NbBound (0), NbErrors (0) {}
+
+    //! Each key is bound twice with the item depending on the key,
+    //! the search is made for the key which may be not bound yet
+    void operator() (const Standard_Integer theIndex) const
+    {
+      const Standard_Integer aKey  = Standard_Integer ((Standard_Size (theIndex) * 7919) % Standard_Size (NbKeys));
+      const Standard_Integer aSeek = Standard_Integer ((Standard_Size (theIndex) * 31)   % Standard_Size (NbKeys));
+      if (ConcurrentMap != NULL)
+      {
+        if (ConcurrentMap->TryBind (aKey, 2 * aKey + 1))
+        {
+          ++NbBound;
+        }
+        const Standard_Integer* anItem = ConcurrentMap->Seek (aSeek);
+        if ((anItem != NULL && *anItem != 2 * aSeek + 1)
+          || ConcurrentMap->TryBound (aKey, 0) != 2 * aKey + 1)
+        {
+          ++NbErrors;
+        }
+      }
+      else if (ConcurrentSet != NULL)
+      {
+        const TCollection_AsciiString aStrKey (aKey);
+        if (ConcurrentSet->Add (aStrKey))
+        {
+          ++NbBound;
+        }
+        if (!ConcurrentSet->Contains (aStrKey))
+        {
+          ++NbErrors;
+        }
+      }
+      else
+      {
+        Standard_Mutex::Sentry aSentry (*Mutex);
+        if (GuardedMap->Bind (aKey, 2 * aKey + 1))
+        {
+          ++NbBound;
+        }
+        const Standard_Integer* anItem = GuardedMap->Seek (aSeek);
+        if (anItem != NULL && *anItem != 2 * aSeek + 1)
+        {
+          ++NbErrors;
+        }
+      }
+    }
+  };
+}
+
+//=======================================================================
+//function : QANColTestConcurrentMap
+//purpose  : Fills the concurrent maps in parallel threads and checks
+//           the result; compares the time with the map guarded by mutex
+//=======================================================================
+static Standard_Integer QANColTestConcurrentMap (Draw_Interpretor& theDI, Standard_Integer theNbArgs, const char** theArgVec)
+{
+  if (theNbArgs > 2)
+  {
+    theDI << "Syntax error: wrong number of arguments";
+    return 1;
+  }
+
+  const Standard_Integer aNbKeys = theNbArgs == 2 ? Draw::Atoi (theArgVec[1]) : 100000;
+  if (aNbKeys < 1)
+  {
+    theDI << "Syntax error: wrong number of keys";
+    return 1;
+  }
+
+  Standard_Integer aNbErrors = 0;
+  OSD_Timer aTimer;
+  NCollection_ConcurrentDataMap<Standard_Integer, Standard_Integer> aConcurrentMap;
+  {
+    ConcurrentMapFunctor aFunctor;
+    aFunctor.ConcurrentMap = &aConcurrentMap;
+    aFunctor.NbKeys = aNbKeys;
+    aTimer.Start();
+    OSD_Parallel::For (0, 2 * aNbKeys, aFunctor);
+    aTimer.Stop();
+    aNbErrors += aFunctor.NbErrors + Abs (aFunctor.NbBound - aNbKeys);
+  }
+  const Standard_Real aConcurrentTime = aTimer.ElapsedTime();
+
+  aNbErrors += Abs (aConcurrentMap.Extent() - aNbKeys);
+  for (Standard_Integer aKey = 0; aKey < aNbKeys; ++aKey)
+  {
+    const Standard_Integer* anItem = aConcurrentMap.Seek (aKey);
+    aNbErrors += (anItem == NULL || *anItem != 2 * aKey + 1);
+  }
+  aNbErrors += aConcurrentMap.IsBound (aNbKeys);
+
+  NCollection_ConcurrentMap<TCollection_AsciiString> aConcurrentSet;
+  {
+    ConcurrentMapFunctor aFunctor;
+    aFunctor.ConcurrentSet = &aConcurrentSet;
+    aFunctor.NbKeys = aNbKeys;
+    OSD_Parallel::For (0, 2 * aNbKeys, aFunctor);
+    aNbErrors += aFunctor.NbErrors + Abs (aFunctor.NbBound - aNbKeys) + Abs (aConcurrentSet.Extent() - aNbKeys);
+  }
+
+  NCollection_DataMap<Standard_Integer, Standard_Integer> aGuardedMap;
+  {
+    Standard_Mutex aMutex;
+    ConcurrentMapFunctor aFunctor;
+    aFunctor.GuardedMap = &aGuardedMap;
+    aFunctor.Mutex = &aMutex;
+    aFunctor.NbKeys = aNbKeys;
+    aTimer.Reset();
+    aTimer.Start();
+    OSD_Parallel::For (0, 2 * aNbKeys, aFunctor);
+    aTimer.Stop();
+    aNbErrors += aFunctor.NbErrors + Abs (aFunctor.NbBound - aNbKeys);
+  }
+
+  aConcurrentMap.Clear();
+  aNbErrors += !aConcurrentMap.IsEmpty() || aConcurrentMap.IsBound (0);
+
+  theDI << "Concurrent map: " << aConcurrentTime << " s, map guarded by mutex: " << aTimer.ElapsedTime() << " s\n";
+  if (aNbErrors != 0)
+  {
+    theDI << "Error: " << aNbErrors << " errors in the concurrent maps\n";
+  }
+  else
+  {
+    theDI << "Concurrent maps are filled correctly\n";
+  }
+  return 0;
+}
+
+#include <NCollection_CompactVector.hxx>
+
+//=======================================================================
+//function : QANColTestCompactVector
+//purpose  : Performs random operations on the compact vector
+//           and compares the items with the ones of the sequence
+//=======================================================================
+static Standard_Integer QANColTestCompactVector (Draw_Interpretor& theDI, Standard_Integer theNbArgs, const char** theArgVec)
+{
+  if (theNbArgs > 2)
+  {
+    theDI << "Syntax error: wrong number of arguments";
+    return 1;
+  }
+
+  const Standard_Integer aNbOperations = theNbArgs == 2 ? Draw::Atoi (theArgVec[1]) : 10000;
+  if (aNbOperations < 1)
+  {
+    theDI << "Syntax error: wrong number of operations";
+    return 1;
+  }
+
+  Standard_Integer aNbErrors = 0;
+  math_BullardGenerator aRandom;
+  NCollection_CompactVector<TCollection_AsciiString> aVector;
+  NCollection_Sequence<TCollection_AsciiString> aSequence;
+  aNbErrors += !aVector.IsEmpty() || aVector.Capacity() != 0;
+  for (Standard_Integer anOperIter = 0; anOperIter < aNbOperations; ++anOperIter)
+  {
+    const Standard_Integer anOper = aRandom.NextInt() % 8;
+    if (anOper < 5 || aVector.IsEmpty())
+    {
+      // append the new item or the item of the vector itself
+      if (anOper == 4 && !aVector.IsEmpty())
+      {
+        const Standard_Integer anIndex = aRandom.NextInt() % aVector.Size();
+        aVector.Append (aVector.Value (anIndex));
+        aSequence.Append (aSequence.Value (anIndex + 1));
+      }
+      else
+      {
+        aVector.Append (TCollection_AsciiString (anOperIter));
+        aSequence.Append (TCollection_AsciiString (anOperIter));
+      }
+    }
+    else if (anOper < 7)
+    {
+      const Standard_Integer anIndex = aRandom.NextInt() % aVector.Size();
+      aVector.Remove (anIndex);
+      aSequence.Remove (anIndex + 1);
+    }
+    else
+    {
+      const Standard_Integer anIndex = aRandom.NextInt() % aVector.Size();
+      aVector.ChangeValue (anIndex) = TCollection_AsciiString (-anOperIter);
+      aSequence.ChangeValue (anIndex + 1) = TCollection_AsciiString (-anOperIter);
+    }
+  }
+
+  // the items keep the order of the sequence
+  aNbErrors += aVector.Size() != aSequence.Size() || aVector.Capacity() < aVector.Size();
+  NCollection_Sequence<TCollection_AsciiString>::Iterator aSeqIter (aSequence);
+  for (NCollection_CompactVector<TCollection_AsciiString>::Iterator aVecIter (aVector);
+       aVecIter.More() && aSeqIter.More(); aVecIter.Next(), aSeqIter.Next())
+  {
+    aNbErrors += aVecIter.Value() != aSeqIter.Value() || aVector (aVecIter.Index()) != aSeqIter.Value();
+  }
+
+  // the iterator remains valid on reallocation of the items
+  {
+    NCollection_CompactVector<Standard_Integer> aGrowing;
+    aGrowing.Append (0);
+    Standard_Integer aNbVisited = 0;
+    for (NCollection_CompactVector<Standard_Integer>::Iterator anIter (aGrowing); anIter.More(); anIter.Next(), ++aNbVisited)
+    {
+      aNbErrors += anIter.Value() != aNbVisited;
+      if (aGrowing.Size() < 100)
+      {
+        aGrowing.Append (aGrowing.Size());
+      }
+    }
+    aNbErrors += aNbVisited != 100 || aGrowing.Last() != 99;
+  }
+
+  // copy, exchange and clear
+  NCollection_CompactVector<TCollection_AsciiString> aCopy (aVector);
+  NCollection_CompactVector<TCollection_AsciiString> anOther;
+  anOther.Reserve (10);
+  aNbErrors += anOther.Capacity() != 10 || !anOther.IsEmpty();
+  anOther.Exchange (aCopy);
+  aNbErrors += anOther.Size() != aVector.Size() || !aCopy.IsEmpty() || aCopy.Capacity() != 10;
+  for (Standard_Integer anIndex = 0; anIndex < aVector.Size(); ++anIndex)
+  {
+    aNbErrors += anOther (anIndex) != aVector (anIndex);
+  }
+  aCopy = anOther;
+  anOther.Clear();
+  aNbErrors += aCopy.Size() != aVector.Size() || !anOther.IsEmpty() || anOther.Capacity() != 0;
+
+  if (aNbErrors != 0)
+  {
+    theDI << "Error: " << aNbErrors << " errors in the compact vector\n";
+  }
+  else
+  {
+    theDI << "Compact vector is consistent with the sequence\n";
+  }
+  return 0;
+}
+
+#include <NCollection_IncAllocator.hxx>
+#include <Standard_Transient.hxx>
+
+namespace
+{
+  //! Checks the move constructor and the move assignment of the map
+  //! with the shared and the separate allocators; returns the number of errors.
+  template<class MapType, class FillFunctor>
+  static Standard_Integer checkMapMove (const FillFunctor& theFill, const Standard_Integer theNbItems)
+  {
+    Standard_Integer aNbErrors = 0;
+    Handle(NCollection_BaseAllocator) anAlloc = new NCollection_IncAllocator();
+    MapType aMap (1, anAlloc);
+    theFill (aMap, theNbItems);
+
+    // the content is taken, the source map remains valid and empty
+    MapType aMoved (std::move (aMap));
+    aNbErrors += aMoved.Extent() != theNbItems || !aMap.IsEmpty();
+    theFill (aMap, 1);
+    aNbErrors += aMap.Extent() != 1;
+
+    // assignment with the same allocator takes the content
+    MapType aShared (1, anAlloc);
+    theFill (aShared, 2);
+    aShared = std::move (aMoved);
+    aNbErrors += aShared.Extent() != theNbItems || !aMoved.IsEmpty();
+
+    // assignment with another allocator copies the content
+    MapType aSeparate (1, new NCollection_IncAllocator());
+    aSeparate = std::move (aShared);
+    aNbErrors += aSeparate.Extent() != theNbItems || aShared.Extent() != theNbItems;
+    return aNbErrors;
+  }
+
+  //! Functors filling the maps by the items depending on the index.
+  struct MoveMapFiller
+  {
+    void operator() (NCollection_Map<Standard_Integer>& theMap, const Standard_Integer theNb) const
+    {
+      for (Standard_Integer anIter = 0; anIter < theNb; ++anIter) { theMap.Add (anIter); }
+    }
+    void operator() (NCollection_IndexedMap<Standard_Integer>& theMap, const Standard_Integer theNb) const
+    {
+      for (Standard_Integer anIter = 0; anIter < theNb; ++anIter) { theMap.Add (anIter); }
+    }
+    void operator() (NCollection_DataMap<Standard_Integer, TCollection_AsciiString>& theMap, const Standard_Integer theNb) const
+    {
+      for (Standard_Integer anIter = 0; anIter < theNb; ++anIter) { theMap.Bind (anIter, TCollection_AsciiString (anIter)); }
+    }
+    void operator() (NCollection_IndexedDataMap<Standard_Integer, TCollection_AsciiString>& theMap, const Standard_Integer theNb) const
+    {
+      for (Standard_Integer anIter = 0; anIter < theNb; ++anIter) { theMap.Add (anIter, TCollection_AsciiString (anIter)); }
+    }
+  };
+
+  //! Checks the move constructor, the move assignment and the moving Append() and Prepend()
+  //! of the list or the sequence of handles; returns the number of errors.
+  template<class ListType>
+  static Standard_Integer checkListMove (const Standard_Integer theNbItems)
+  {
+    Standard_Integer aNbErrors = 0;
+    const Handle(Standard_Transient) anObject = new Standard_Transient();
+    Handle(NCollection_BaseAllocator) anAlloc = new NCollection_IncAllocator();
+    ListType aList (anAlloc);
+    for (Standard_Integer anIter = 0; anIter < theNbItems; ++anIter)
+    {
+      // the moved handle leaves the counter of the object unchanged
+      Handle(Standard_Transient) aCopy = anObject;
+      if (anIter % 2 == 0)
+      {
+        aList.Append (std::move (aCopy));
+      }
+      else
+      {
+        aList.Prepend (std::move (aCopy));
+      }
+      aNbErrors += !aCopy.IsNull() || anObject->GetRefCount() != anIter + 2;
+    }
+
+    ListType aMoved (std::move (aList));
+    aNbErrors += aMoved.Size() != theNbItems || !aList.IsEmpty();
+    aNbErrors += anObject->GetRefCount() != theNbItems + 1;
+
+    ListType aShared (anAlloc);
+    aShared.Append (anObject);
+    aShared = std::move (aMoved);
+    aNbErrors += aShared.Size() != theNbItems || !aMoved.IsEmpty();
+
+    // the items are copied to the list with another allocator
+    ListType aSeparate (new NCollection_IncAllocator());
+    aSeparate = std::move (aShared);
+    aNbErrors += aSeparate.Size() != theNbItems;
+    for (typename ListType::Iterator anIter (aSeparate); anIter.More(); anIter.Next())
+    {
+      aNbErrors += anIter.Value() != anObject;
+    }
+
+    aSeparate.Clear();
+    aShared.Clear();
+    aNbErrors += anObject->GetRefCount() != 1;
+    return aNbErrors;
+  }
+}
+
+//=======================================================================
+//function : QANColTestMove
+//purpose  : Checks the move constructors and the move assignments
+//           of the lists, sequences and hash maps
+//=======================================================================
+static Standard_Integer QANColTestMove (Draw_Interpretor& theDI, Standard_Integer theNbArgs, const char** theArgVec)
+{
+  if (theNbArgs > 2)
+  {
+    theDI << "Syntax error: wrong number of arguments";
+    return 1;
+  }
+
+  const Standard_Integer aNbItems = theNbArgs == 2 ? Draw::Atoi (theArgVec[1]) : 1000;
+  if (aNbItems < 3)
+  {
+    theDI << "Syntax error: wrong number of items";
+    return 1;
+  }
+
+  Standard_Integer aNbErrors = 0;
+  const MoveMapFiller aFiller;
+  aNbErrors += checkMapMove<NCollection_Map<Standard_Integer> > (aFiller, aNbItems);
+  aNbErrors += checkMapMove<NCollection_IndexedMap<Standard_Integer> > (aFiller, aNbItems);
+  aNbErrors += checkMapMove<NCollection_DataMap<Standard_Integer, TCollection_AsciiString> > (aFiller, aNbItems);
+  aNbErrors += checkMapMove<NCollection_IndexedDataMap<Standard_Integer, TCollection_AsciiString> > (aFiller, aNbItems);
+  aNbErrors += checkListMove<NCollection_List<Handle(Standard_Transient)> > (aNbItems);
+  aNbErrors += checkListMove<NCollection_Sequence<Handle(Standard_Transient)> > (aNbItems);
+  if (aNbErrors != 0)
+  {
+    theDI << "Error: " << aNbErrors << " errors in moving of the collections\n";
+  }
+  else
+  {
+    theDI << "Collections are moved correctly\n";
+  }
+  return 0;
+}
+
+#include <gp.hxx>
+#include <gp_Trsf.hxx>
+#include <gp_Vec.hxx>
+#include <NCollection_DefaultHasher.hxx>
+#include <TopLoc_Datum3D.hxx>
+#include <TopLoc_Location.hxx>
+#include <TopLoc_MapLocationHasher.hxx>
+
+namespace
+{
+  //! Hasher of integers providing only the hash code reduced to the range [1, theUpperBound]
+  struct QALegacyIntegerHasher
+  {
+    static Standard_Integer HashCode (const Standard_Integer theKey, const Standard_Integer theUpperBound)
+    {
+      return ::HashCode (theKey, theUpperBound);
+    }
+    static Standard_Boolean IsEqual (const Standard_Integer theKey1, const Standard_Integer theKey2)
+    {
+      return theKey1 == theKey2;
+    }
+  };
+
+  //! Hasher of integers providing only the full-width hash code
+  struct QAFullWidthIntegerHasher
+  {
+    static Standard_Size HashCode (const Standard_Integer theKey)
+    {
+      return static_cast<Standard_Size> (theKey) * static_cast<Standard_Size> (0x9e3779b97f4a7c15ULL);
+    }
+    static Standard_Boolean IsEqual (const Standard_Integer theKey1, const Standard_Integer theKey2)
+    {
+      return theKey1 == theKey2;
+    }
+  };
+
+  //! Fills the hash maps with the given hasher, resizes them, removes the even keys
+  //! and checks the content; returns the number of errors.
+  template<class Hasher>
+  static Standard_Integer checkHasherMaps (const Standard_Integer theNbKeys)
+  {
+    Standard_Integer aNbErrors = 0;
+    NCollection_Map<Standard_Integer, Hasher> aMap;
+    NCollection_DataMap<Standard_Integer, Standard_Integer, Hasher> aDataMap;
+    NCollection_IndexedMap<Standard_Integer, Hasher> anIndexedMap;
+    NCollection_IndexedDataMap<Standard_Integer, Standard_Integer, Hasher> anIndexedDataMap;
+    NCollection_DoubleMap<Standard_Integer, Standard_Integer, Hasher, Hasher> aDoubleMap;
+    for (Standard_Integer aKey = 0; aKey < theNbKeys; ++aKey)
+    {
+      aMap.Add (aKey);
+      aDataMap.Bind (aKey, -aKey);
+      anIndexedMap.Add (aKey);
+      anIndexedDataMap.Add (aKey, -aKey);
+      aDoubleMap.Bind (aKey, theNbKeys + aKey);
+    }
+    aNbErrors += aDoubleMap.IsBound1 (theNbKeys) || aDoubleMap.IsBound2 (0);
+
+    // the keys are distributed in the larger number of buckets
+    aMap.ReSize (4 * theNbKeys);
+    aDataMap.ReSize (4 * theNbKeys);
+    anIndexedMap.ReSize (4 * theNbKeys);
+    anIndexedDataMap.ReSize (4 * theNbKeys);
+    aDoubleMap.ReSize (4 * theNbKeys);
+    for (Standard_Integer aKey = 0; aKey < theNbKeys; aKey += 2)
+    {
+      aNbErrors += !aMap.Remove (aKey);
+      aNbErrors += !aDataMap.UnBind (aKey);
+      aNbErrors += anIndexedMap.FindIndex (aKey) != aKey + 1;
+      aNbErrors += anIndexedDataMap.FindIndex (aKey) != aKey + 1;
+      aNbErrors += (aKey / 2) % 2 == 0 ? !aDoubleMap.UnBind1 (aKey) : !aDoubleMap.UnBind2 (theNbKeys + aKey);
+    }
+
+    const Standard_Integer aNbOdd = theNbKeys / 2;
+    aNbErrors += aMap.Extent() != aNbOdd || aDataMap.Extent() != aNbOdd || aDoubleMap.Extent() != aNbOdd;
+    for (Standard_Integer aKey = 0; aKey < theNbKeys; ++aKey)
+    {
+      const Standard_Boolean isBound = aKey % 2 != 0;
+      aNbErrors += aMap.Contains (aKey) != isBound;
+      aNbErrors += aDataMap.IsBound (aKey) != isBound;
+      aNbErrors += aDoubleMap.IsBound1 (aKey) != isBound;
+      aNbErrors += aDoubleMap.IsBound2 (theNbKeys + aKey) != isBound;
+      aNbErrors += aDoubleMap.AreBound (aKey, theNbKeys + aKey) != isBound;
+      if (isBound)
+      {
+        aNbErrors += aDataMap.Find (aKey) != -aKey;
+        aNbErrors += aDoubleMap.Find1 (aKey) != theNbKeys + aKey;
+        aNbErrors += aDoubleMap.Find2 (theNbKeys + aKey) != aKey;
+      }
+      aNbErrors += anIndexedMap.FindKey (aKey + 1) != aKey;
+      aNbErrors += anIndexedDataMap.FindFromKey (aKey) != -aKey;
+    }
+
+    // the indexed maps keep the keys findable after the removal of the last ones
+    anIndexedMap.RemoveLast();
+    anIndexedDataMap.RemoveLast();
+    aNbErrors += anIndexedMap.Contains (theNbKeys - 1) || anIndexedDataMap.Contains (theNbKeys - 1);
+    aNbErrors += !anIndexedMap.Contains (theNbKeys - 2) || !anIndexedDataMap.Contains (theNbKeys - 2);
+    return aNbErrors;
+  }
+
+  //! Computes the hash code of the location by iterating its elementary items
+  //! in the same way as it is computed on the construction of the location.
+  static Standard_Size qaLocationHashCode (const TopLoc_Location& theLocation)
+  {
+    if (theLocation.IsIdentity())
+    {
+      return 0;
+    }
+
+    const Standard_Size aDatum = reinterpret_cast<Standard_Size> (theLocation.FirstDatum().get());
+    Standard_Size aHash = qaLocationHashCode (theLocation.NextLocation());
+    aHash ^= aDatum + 0x9e3779b9 + (aHash << 6) + (aHash >> 2);
+    aHash ^= static_cast<Standard_Size> (theLocation.FirstPower()) + 0x9e3779b9 + (aHash << 6) + (aHash >> 2);
+    return aHash;
+  }
+}
+
+//=======================================================================
+//function : QANColTestHasherTraits
+//purpose  : Checks the hash maps with the legacy and the full-width hashers
+//           and the hash codes of the locations kept in their items
+//=======================================================================
+static Standard_Integer QANColTestHasherTraits (Draw_Interpretor& theDI, Standard_Integer theNbArgs, const char** theArgVec)
+{
+  if (theNbArgs > 2)
+  {
+    theDI << "Syntax error: wrong number of arguments";
+    return 1;
+  }
+
+  const Standard_Integer aNbKeys = theNbArgs == 2 ? Draw::Atoi (theArgVec[1]) : 1000;
+  if (aNbKeys < 2)
+  {
+    theDI << "Syntax error: wrong number of keys";
+    return 1;
+  }
+
+  Standard_Integer aNbErrors = 0;
+
+  // the legacy hasher distributes the keys in the same buckets as before,
+  // the full-width hash code is taken as is
+  typedef NCollection_HasherTraits<Standard_Integer, QALegacyIntegerHasher>    LegacyTraits;
+  typedef NCollection_HasherTraits<Standard_Integer, QAFullWidthIntegerHasher> FullWidthTraits;
+  const Standard_Integer aNbBuckets[] = { 1, 7, 101, 1009, 65537 };
+  for (Standard_Integer aKey = 0; aKey < aNbKeys; ++aKey)
+  {
+    for (Standard_Integer aBuckIter = 0; aBuckIter < 5; ++aBuckIter)
+    {
+      const Standard_Integer aNbBuck = aNbBuckets[aBuckIter];
+      aNbErrors += LegacyTraits::Bucket (LegacyTraits::HashCode (aKey), aNbBuck) != QALegacyIntegerHasher::HashCode (aKey, aNbBuck);
+      const Standard_Integer aBucket = FullWidthTraits::Bucket (FullWidthTraits::HashCode (aKey), aNbBuck);
+      aNbErrors += aBucket < 1 || aBucket > aNbBuck;
+    }
+    aNbErrors += FullWidthTraits::HashCode (aKey) != QAFullWidthIntegerHasher::HashCode (aKey);
+    aNbErrors += !LegacyTraits::IsEqual (LegacyTraits::HashCode (aKey), aKey, LegacyTraits::HashCode (aKey), aKey);
+  }
+  aNbErrors += checkHasherMaps<QALegacyIntegerHasher> (aNbKeys);
+  aNbErrors += checkHasherMaps<QAFullWidthIntegerHasher> (aNbKeys);
+
+  // the equal locations composed in different ways have the equal hash codes
+  gp_Trsf aTrsfs[3];
+  aTrsfs[0].SetTranslation (gp_Vec (1.0, 2.0, 3.0));
+  aTrsfs[1].SetRotation (gp::OZ(), 0.5);
+  aTrsfs[2].SetScale (gp::Origin(), 2.0);
+  const TopLoc_Location aLoc1 (new TopLoc_Datum3D (aTrsfs[0]));
+  const TopLoc_Location aLoc2 (new TopLoc_Datum3D (aTrsfs[1]));
+  const TopLoc_Location aLoc3 (new TopLoc_Datum3D (aTrsfs[2]));
+  const TopLoc_Location aLocs[] =
+  {
+    TopLoc_Location(), aLoc1, aLoc1 * aLoc2, aLoc2 * aLoc1, (aLoc1 * aLoc2) * aLoc3, aLoc1 * (aLoc2 * aLoc3),
+    aLoc1.Powered (3), aLoc1 * aLoc1 * aLoc1, aLoc3.Inverted(), aLoc1 * aLoc2 * aLoc2.Inverted(), aLoc2.Predivided (aLoc1 * aLoc2)
+  };
+  const Standard_Integer aNbLocs = sizeof (aLocs) / sizeof (aLocs[0]);
+  NCollection_Map<TopLoc_Location, TopLoc_MapLocationHasher> aLocMap;
+  for (Standard_Integer aLocIter = 0; aLocIter < aNbLocs; ++aLocIter)
+  {
+    const TopLoc_Location& aLoc = aLocs[aLocIter];
+    aNbErrors += aLoc.HashCode() != qaLocationHashCode (aLoc);
+    aNbErrors += aLoc.HashCode (1009) != static_cast<Standard_Integer> (aLoc.HashCode() % 1009) + 1;
+    aNbErrors += TopLoc_MapLocationHasher::HashCode (aLoc) != aLoc.HashCode();
+    for (Standard_Integer anOtherIter = 0; anOtherIter < aNbLocs; ++anOtherIter)
+    {
+      if (aLoc.IsEqual (aLocs[anOtherIter]))
+      {
+        aNbErrors += aLoc.HashCode() != aLocs[anOtherIter].HashCode();
+      }
+    }
+    aLocMap.Add (aLoc);
+  }
+  // the products of the same items composed in different ways are added once
+  aNbErrors += aLocMap.Extent() != aNbLocs - 3;
+
+  if (aNbErrors != 0)
+  {
+    theDI << "Error: " << aNbErrors << " errors in hashing of the keys\n";
+  }
+  else
+  {
+    theDI << "Keys are hashed correctly\n";
+  }
+  return 0;
+}
+
 void QANCollection::CommandsTest(Draw_Interpretor& theCommands) {
   const char *group = "QANCollection";
 
@@ -1353,6 +2119,21 @@ void QANCollection::CommandsTest(Draw_Interpretor& theCommands) {
   theCommands.Add("QANColTestDoubleMap",      "QANColTestDoubleMap",      __FILE__, QANColTestDoubleMap,      group);  
   theCommands.Add("QANColTestIndexedMap",     "QANColTestIndexedMap",     __FILE__, QANColTestIndexedMap,     group);  
   theCommands.Add("QANColTestIndexedDataMap", "QANColTestIndexedDataMap", __FILE__, QANColTestIndexedDataMap, group);  
+  theCommands.Add("QANColTestFlatMap",        "QANColTestFlatMap [nbOperations=100000]"
+                  "\n\t\t: Compares the maps with open addressing with the regular ones on random operations",
+                  __FILE__, QANColTestFlatMap, group);
+  theCommands.Add("QANColTestConcurrentMap",  "QANColTestConcurrentMap [nbKeys=100000]"
+                  "\n\t\t: Fills the concurrent maps in parallel threads and compares the time with the map guarded by mutex",
+                  __FILE__, QANColTestConcurrentMap, group);
+  theCommands.Add("QANColTestCompactVector",  "QANColTestCompactVector [nbOperations=10000]"
+                  "\n\t\t: Compares the compact vector with the sequence on random operations",
+                  __FILE__, QANColTestCompactVector, group);
+  theCommands.Add("QANColTestMove",           "QANColTestMove [nbItems=1000]"
+                  "\n\t\t: Checks the move constructors and the move assignments of the lists, sequences and hash maps",
+                  __FILE__, QANColTestMove, group);
+  theCommands.Add("QANColTestHasherTraits",   "QANColTestHasherTraits [nbKeys=1000]"
+                  "\n\t\t: Checks the hash maps with the legacy and the full-width hashers and the hash codes of the locations",
+                  __FILE__, QANColTestHasherTraits, group);
   theCommands.Add("QANColTestList",           "QANColTestList",           __FILE__, QANColTestList,           group);  
   theCommands.Add("QANColTestSequence",       "QANColTestSequence",       __FILE__, QANColTestSequence,       group);  
   theCommands.Add("QANColTestVector",         "QANColTestVector",         __FILE__, QANColTestVector,         group);  
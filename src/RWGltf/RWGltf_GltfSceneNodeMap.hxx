@@ -33,7 +33,8 @@ public:
       return 0;
     }
 
-    for (IndexedMapNode* aNode1Iter = (IndexedMapNode* )myData1[::HashCode (theNodeId, NbBuckets())]; aNode1Iter != NULL; aNode1Iter = (IndexedMapNode* )aNode1Iter->Next())
+    const Standard_Size aHash = NCollection_HasherTraits<TCollection_AsciiString, NCollection_DefaultHasher<TCollection_AsciiString> >::HashCode (theNodeId);
+    for (IndexedMapNode* aNode1Iter = (IndexedMapNode* )myData1[HasherTraits::Bucket (aHash, NbBuckets())]; aNode1Iter != NULL; aNode1Iter = (IndexedMapNode* )aNode1Iter->Next())
     {
       if (::IsEqual (aNode1Iter->Key1().Id, theNodeId))
       {
@@ -19,6 +19,7 @@
 #include <Standard_MMgrOpt.hxx>
 #include <Standard_MMgrRaw.hxx>
 #include <Standard_MMgrTBBalloc.hxx>
+#include <Standard_MMgrThreadCache.hxx>
 #include <Standard_Assert.hxx>
 
 #include <stdlib.h>
@@ -166,6 +167,14 @@ Standard_MMgrFactory::Standard_MMgrFactory()
     case 2:  // TBB memory allocator
       myFMMgr = new Standard_MMgrTBBalloc (toClear);
       break;
+    case 3:  // OCCT memory allocator with caches of the threads
+#if defined(Standard_HASTHREADLOCAL)
+      myFMMgr = new Standard_MMgrThreadCache (toClear);
+#else
+      // the caches of the threads cannot be used without thread-local storage
+      myFMMgr = new Standard_MMgrRaw (toClear);
+#endif
+      break;
     case 0:
     default: // system default memory allocator
       myFMMgr = new Standard_MMgrRaw (toClear);
@@ -271,6 +280,17 @@ Standard_Integer Standard::Purge()
   return Standard_MMgrFactory::GetMMgr()->Purge();
 }
 
+//=======================================================================
+//function : AllocatorStatistics
+//purpose  : 
+//=======================================================================
+
+Standard_Boolean Standard::AllocatorStatistics (Standard_Size& theReserved,
+                                                Standard_Size& theInUse)
+{
+  return Standard_MMgrFactory::GetMMgr()->Statistics (theReserved, theInUse);
+}
+
 //=======================================================================
 //function : AllocateAligned
 //purpose  :
@@ -80,6 +80,13 @@ public:
   //! Returns non-zero if some memory has been actually freed.
   Standard_EXPORT static Standard_Integer Purge();
 
+  //! Returns the size of memory reserved by the active memory manager from the system
+  //! and the size of memory blocks currently in use, both in bytes.
+  //! Returns false if the memory manager does not collect such statistics
+  //! (only the thread-caching manager, MMGT_OPT=3, does).
+  Standard_EXPORT static Standard_Boolean AllocatorStatistics (Standard_Size& theReserved,
+                                                               Standard_Size& theInUse);
+
   //! Appends backtrace to a message buffer.
   //! Stack information might be incomplete in case of stripped binaries.
   //! Implementation details:
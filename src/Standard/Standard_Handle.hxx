@@ -377,13 +377,13 @@ namespace opencascade {
     void BeginScope()
     {
       if (entity != 0)
-        entity->IncrementRefCounter();
+        entity->incrementRefCounter();
     }
 
     //! Decrement reference counter and if 0, destroy referred object
     void EndScope()
     {
-      if (entity != 0 && entity->DecrementRefCounter() == 0)
+      if (entity != 0 && entity->decrementRefCounter() == 0)
         entity->Delete();
       entity = 0;
     }
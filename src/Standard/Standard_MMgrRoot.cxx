@@ -32,3 +32,14 @@ Standard_Integer Standard_MMgrRoot::Purge(Standard_Boolean)
 {
   return 0;
 }
+
+//=======================================================================
+//function : Statistics
+//purpose  : 
+//=======================================================================
+
+Standard_Boolean Standard_MMgrRoot::Statistics (Standard_Size& ,
+                                                Standard_Size& ) const
+{
+  return Standard_False;
+}
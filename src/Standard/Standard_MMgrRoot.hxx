@@ -59,6 +59,14 @@ class Standard_MMgrRoot
   //!
   //! Default implementation does nothing and returns 0.
   Standard_EXPORT virtual Standard_Integer Purge(Standard_Boolean isDestroyed=Standard_False);
+
+  //! Returns the size of memory reserved by the memory manager from the system
+  //! and the size of memory blocks currently in use, both in bytes.
+  //! Returns false if the memory manager does not collect such statistics.
+  //!
+  //! Default implementation does nothing and returns false.
+  Standard_EXPORT virtual Standard_Boolean Statistics (Standard_Size& theReserved,
+                                                       Standard_Size& theInUse) const;
 };
 
 #endif
@@ -0,0 +1,570 @@
+// Copyright (c) 2024 OPEN CASCADE SAS
+//
+// This file is part of Open CASCADE Technology software library.
+//
+// This library is free software; you can redistribute it and/or modify it under
+// the terms of the GNU Lesser General Public License version 2.1 as published
+// by the Free Software Foundation, with special exception defined in the file
+// OCCT_LGPL_EXCEPTION.txt. Consult the file LICENSE_LGPL_21.txt included in OCCT
+// distribution for complete text of the license and disclaimer of any warranty.
+//
+// Alternatively, this file may be used under the terms of Open CASCADE
+// commercial license or contractual agreement.
+
+#include <Standard_MMgrThreadCache.hxx>
+#include <Standard_OutOfMemory.hxx>
+
+#include <stdlib.h>
+#include <string.h>
+
+//! Cache of the free blocks of the thread.
+//! It is trivially constructible so that the thread-local instance is zero-initialized
+//! without any initialization code and remains accessible during destruction of the thread.
+struct Standard_MMgrThreadCache::ThreadCache
+{
+  Standard_MMgrThreadCache*  Owner;                  //!< memory manager using the cache
+  Standard_Integer           State;                  //!< 0 - not initialized, 1 - active, 2 - released
+  void*                      Heads[THE_NB_CLASSES];  //!< free lists of the size classes
+  Standard_Integer           Counts[THE_NB_CLASSES]; //!< lengths of the free lists
+  std::atomic<Standard_Size> InUse;                  //!< size of the blocks allocated minus freed by the thread (modulo 2^N)
+  ThreadCache*               Prev;                   //!< previous cache in the list of active caches
+  ThreadCache*               Next;                   //!< next cache in the list of active caches
+};
+
+namespace
+{
+  //! Size of the header of the block.
+  static const Standard_Size THE_HEADER_SIZE = sizeof(Standard_Size);
+
+  //! Size of the slab of small blocks.
+  static const Standard_Size THE_SLAB_SIZE = 64 * 1024;
+
+  //! Approximate size of the memory of the batch of small blocks.
+  static const Standard_Size THE_BATCH_MEMORY = 4096;
+
+  //! Returns the size class of the small block.
+  static inline Standard_Integer sizeClass (const Standard_Size theSize)
+  {
+    if (theSize <= 128)
+    {
+      return theSize == 0 ? 0 : Standard_Integer ((theSize - 1) >> 3);
+    }
+    if (theSize <= 512)
+    {
+      return 16 + Standard_Integer ((theSize - 129) >> 5);
+    }
+    return 28 + Standard_Integer ((theSize - 513) >> 7);
+  }
+
+  //! Returns the size of the small block of the size class.
+  static inline Standard_Size classSize (const Standard_Integer theClass)
+  {
+    if (theClass < 16)
+    {
+      return Standard_Size (theClass + 1) << 3;
+    }
+    if (theClass < 28)
+    {
+      return 128 + (Standard_Size (theClass - 15) << 5);
+    }
+    return 512 + (Standard_Size (theClass - 27) << 7);
+  }
+
+  //! Returns the size of the small block of the size class with its header.
+  static inline Standard_Size classStride (const Standard_Integer theClass)
+  {
+    return classSize (theClass) + THE_HEADER_SIZE;
+  }
+
+  //! Returns the number of blocks moved at once between the thread and central lists.
+  static inline Standard_Integer batchLength (const Standard_Integer theClass)
+  {
+    const Standard_Size aNbBlocks = THE_BATCH_MEMORY / classStride (theClass);
+    return aNbBlocks < 4 ? 4 : (aNbBlocks > 64 ? 64 : Standard_Integer (aNbBlocks));
+  }
+
+  //! Returns the header of the block keeping the size class (plus one) of the small block
+  //! or the whole size of the large block.
+  static inline Standard_Size& blockHeader (void* theBlock)
+  {
+    return *((Standard_Size* )theBlock - 1);
+  }
+
+  //! Returns the link to the next free block in the list; the first word of the free block is used.
+  static inline void*& nextBlock (void* theBlock)
+  {
+    return *(void** )theBlock;
+  }
+
+  //! Returns the link to the next batch of free blocks; the header of the first block of the batch is used.
+  static inline void*& nextBatch (void* theBlock)
+  {
+    return *((void** )theBlock - 1);
+  }
+
+  //! Adds the value to the counter modified by the single thread only.
+  static inline void addInUse (std::atomic<Standard_Size>& theCounter, const Standard_Size theValue)
+  {
+    theCounter.store (theCounter.load (std::memory_order_relaxed) + theValue, std::memory_order_relaxed);
+  }
+
+#if defined(Standard_HASTHREADLOCAL)
+  //! Thread-local cache, zero-initialized.
+  static Standard_THREADLOCAL Standard_MMgrThreadCache::ThreadCache THE_THREAD_CACHE;
+
+  //! Object releasing the cache of the thread on its exit.
+  //! The cache is not destroyed itself so that the blocks freed later by the destructors
+  //! of other thread-local objects are passed to the central lists.
+  struct ThreadCacheGuard
+  {
+    Standard_Boolean IsRegistered;
+
+    ThreadCacheGuard() : IsRegistered (Standard_True) {}
+
+    ~ThreadCacheGuard()
+    {
+      if (THE_THREAD_CACHE.State == 1)
+      {
+        THE_THREAD_CACHE.Owner->releaseCache (THE_THREAD_CACHE);
+      }
+      THE_THREAD_CACHE.State = 2;
+    }
+  };
+
+  static Standard_THREADLOCAL ThreadCacheGuard THE_THREAD_CACHE_GUARD;
+#endif
+}
+
+//=======================================================================
+//function : Standard_MMgrThreadCache
+//purpose  :
+//=======================================================================
+Standard_MMgrThreadCache::Standard_MMgrThreadCache (const Standard_Boolean theToClear)
+: myClear (theToClear),
+  mySlabs (NULL),
+  mySlabNext (NULL),
+  mySlabEnd (NULL),
+  myCaches (NULL),
+  mySlabSize (0),
+  myLargeSize (0),
+  myOrphanInUse (0)
+{
+  //
+}
+
+//=======================================================================
+//function : ~Standard_MMgrThreadCache
+//purpose  :
+//=======================================================================
+Standard_MMgrThreadCache::~Standard_MMgrThreadCache()
+{
+  // detach the caches of the threads still registered, so that they
+  // neither refer to the destroyed manager nor keep the blocks of its slabs
+  {
+    Standard_Mutex::Sentry aSentry (myCachesMutex);
+    for (ThreadCache* aCache = myCaches; aCache != NULL;)
+    {
+      ThreadCache* aNext = aCache->Next;
+      memset (aCache->Heads,  0, sizeof(aCache->Heads));
+      memset (aCache->Counts, 0, sizeof(aCache->Counts));
+      aCache->InUse.store (0, std::memory_order_relaxed);
+      aCache->Prev  = NULL;
+      aCache->Next  = NULL;
+      aCache->Owner = NULL;
+      aCache->State = 0;
+      aCache = aNext;
+    }
+    myCaches = NULL;
+  }
+
+  for (void* aSlab = mySlabs; aSlab != NULL;)
+  {
+    void* aNext = nextBlock (aSlab);
+    free (aSlab);
+    aSlab = aNext;
+  }
+}
+
+//=======================================================================
+//function : threadCache
+//purpose  :
+//=======================================================================
+inline Standard_MMgrThreadCache::ThreadCache* Standard_MMgrThreadCache::threadCache()
+{
+#if !defined(Standard_HASTHREADLOCAL)
+  // without thread-local storage all blocks go through the central lists
+  return NULL;
+#else
+  ThreadCache& aCache = THE_THREAD_CACHE;
+  if (aCache.State == 1 && aCache.Owner == this)
+  {
+    return &aCache;
+  }
+  else if (aCache.State != 0)
+  {
+    // the thread is exiting or the cache is used by another memory manager
+    return NULL;
+  }
+
+  // the first access to the guard registers its destruction on exit of the thread
+  if (!THE_THREAD_CACHE_GUARD.IsRegistered)
+  {
+    return NULL;
+  }
+  aCache.Owner = this;
+  aCache.State = 1;
+
+  Standard_Mutex::Sentry aSentry (myCachesMutex);
+  aCache.Prev = NULL;
+  aCache.Next = myCaches;
+  if (myCaches != NULL)
+  {
+    myCaches->Prev = &aCache;
+  }
+  myCaches = &aCache;
+  return &aCache;
+#endif
+}
+
+//=======================================================================
+//function : Allocate
+//purpose  :
+//=======================================================================
+Standard_Address Standard_MMgrThreadCache::Allocate (const Standard_Size theSize)
+{
+  if (theSize > THE_MAX_SMALL_SIZE)
+  {
+    const Standard_Size aBlockSize = ((theSize + 7) & ~Standard_Size(7)) + THE_HEADER_SIZE;
+    void* aBlock = myClear ? calloc (aBlockSize, sizeof(char)) : malloc (aBlockSize);
+    if (aBlock == NULL)
+    {
+      throw Standard_OutOfMemory ("Standard_MMgrThreadCache::Allocate(): malloc failed");
+    }
+    myLargeSize.fetch_add (aBlockSize, std::memory_order_relaxed);
+    *(Standard_Size* )aBlock = aBlockSize;
+    return (char* )aBlock + THE_HEADER_SIZE;
+  }
+
+  const Standard_Integer aClass = sizeClass (theSize);
+  void* aBlock = NULL;
+  if (ThreadCache* aCache = threadCache())
+  {
+    aBlock = aCache->Heads[aClass];
+    if (aBlock == NULL)
+    {
+      aBlock = takeBatch (aClass, aCache->Counts[aClass]);
+    }
+    aCache->Heads[aClass] = nextBlock (aBlock);
+    --aCache->Counts[aClass];
+    addInUse (aCache->InUse, classStride (aClass));
+  }
+  else
+  {
+    aBlock = allocateCentral (aClass);
+    myOrphanInUse.fetch_add (classStride (aClass), std::memory_order_relaxed);
+  }
+
+  blockHeader (aBlock) = Standard_Size (aClass + 1);
+  if (myClear)
+  {
+    memset (aBlock, 0, classSize (aClass));
+  }
+  return aBlock;
+}
+
+//=======================================================================
+//function : Free
+//purpose  :
+//=======================================================================
+void Standard_MMgrThreadCache::Free (Standard_Address thePtr)
+{
+  if (thePtr == NULL)
+  {
+    return;
+  }
+
+  const Standard_Size aHeader = blockHeader (thePtr);
+  if (aHeader > Standard_Size (THE_NB_CLASSES))
+  {
+    myLargeSize.fetch_sub (aHeader, std::memory_order_relaxed);
+    free ((char* )thePtr - THE_HEADER_SIZE);
+    return;
+  }
+
+  const Standard_Integer aClass = Standard_Integer (aHeader) - 1;
+  ThreadCache* aCache = threadCache();
+  if (aCache == NULL)
+  {
+    nextBlock (thePtr) = NULL;
+    putBatch (aClass, thePtr, 1);
+    myOrphanInUse.fetch_sub (classStride (aClass), std::memory_order_relaxed);
+    return;
+  }
+
+  nextBlock (thePtr) = aCache->Heads[aClass];
+  aCache->Heads[aClass] = thePtr;
+  addInUse (aCache->InUse, Standard_Size(0) - classStride (aClass));
+
+  const Standard_Integer aBatchLength = batchLength (aClass);
+  if (++aCache->Counts[aClass] > 2 * aBatchLength)
+  {
+    // keep the recently freed blocks in the cache and move the batch of the older ones
+    void* aLastKept = aCache->Heads[aClass];
+    for (Standard_Integer anIter = aCache->Counts[aClass] - aBatchLength; anIter > 1; --anIter)
+    {
+      aLastKept = nextBlock (aLastKept);
+    }
+    void* aBatch = nextBlock (aLastKept);
+    nextBlock (aLastKept) = NULL;
+    aCache->Counts[aClass] -= aBatchLength;
+    putBatch (aClass, aBatch, aBatchLength);
+  }
+}
+
+//=======================================================================
+//function : Reallocate
+//purpose  :
+//=======================================================================
+Standard_Address Standard_MMgrThreadCache::Reallocate (Standard_Address thePtr,
+                                                       const Standard_Size theSize)
+{
+  if (thePtr == NULL)
+  {
+    return Allocate (theSize);
+  }
+
+  const Standard_Size aHeader = blockHeader (thePtr);
+  const Standard_Boolean isLarge = aHeader > Standard_Size (THE_NB_CLASSES);
+  const Standard_Size aCapacity = isLarge ? aHeader - THE_HEADER_SIZE : classSize (Standard_Integer (aHeader) - 1);
+  if (theSize <= aCapacity)
+  {
+    return thePtr;
+  }
+
+  if (isLarge)
+  {
+    // note that additional memory allocated by realloc is not cleared as in Standard_MMgrRaw
+    const Standard_Size aBlockSize = ((theSize + 7) & ~Standard_Size(7)) + THE_HEADER_SIZE;
+    void* aBlock = realloc ((char* )thePtr - THE_HEADER_SIZE, aBlockSize);
+    if (aBlock == NULL)
+    {
+      throw Standard_OutOfMemory ("Standard_MMgrThreadCache::Reallocate(): realloc failed");
+    }
+    myLargeSize.fetch_add (aBlockSize - aHeader, std::memory_order_relaxed);
+    *(Standard_Size* )aBlock = aBlockSize;
+    return (char* )aBlock + THE_HEADER_SIZE;
+  }
+
+  Standard_Address aNewPtr = Allocate (theSize);
+  memcpy (aNewPtr, thePtr, aCapacity);
+  Free (thePtr);
+  return aNewPtr;
+}
+
+//=======================================================================
+//function : Purge
+//purpose  :
+//=======================================================================
+Standard_Integer Standard_MMgrThreadCache::Purge (Standard_Boolean )
+{
+  if (ThreadCache* aCache = threadCache())
+  {
+    flushCache (*aCache);
+  }
+  return 0;
+}
+
+//=======================================================================
+//function : Statistics
+//purpose  :
+//=======================================================================
+Standard_Boolean Standard_MMgrThreadCache::Statistics (Standard_Size& theReserved,
+                                                       Standard_Size& theInUse) const
+{
+  const Standard_Size aLargeSize = myLargeSize.load (std::memory_order_relaxed);
+  Standard_Size anInUse = aLargeSize;
+  {
+    Standard_Mutex::Sentry aSentry (myCachesMutex);
+    anInUse += myOrphanInUse.load (std::memory_order_relaxed);
+    for (const ThreadCache* aCache = myCaches; aCache != NULL; aCache = aCache->Next)
+    {
+      anInUse += aCache->InUse.load (std::memory_order_relaxed);
+    }
+  }
+  theReserved = mySlabSize.load (std::memory_order_relaxed) + aLargeSize;
+  theInUse    = anInUse;
+  return Standard_True;
+}
+
+//=======================================================================
+//function : flushCache
+//purpose  :
+//=======================================================================
+void Standard_MMgrThreadCache::flushCache (ThreadCache& theCache)
+{
+  for (Standard_Integer aClass = 0; aClass < THE_NB_CLASSES; ++aClass)
+  {
+    if (theCache.Heads[aClass] != NULL)
+    {
+      putBatch (aClass, theCache.Heads[aClass], theCache.Counts[aClass]);
+      theCache.Heads[aClass]  = NULL;
+      theCache.Counts[aClass] = 0;
+    }
+  }
+}
+
+//=======================================================================
+//function : releaseCache
+//purpose  :
+//=======================================================================
+void Standard_MMgrThreadCache::releaseCache (ThreadCache& theCache)
+{
+  flushCache (theCache);
+
+  Standard_Mutex::Sentry aSentry (myCachesMutex);
+  myOrphanInUse.fetch_add (theCache.InUse.load (std::memory_order_relaxed), std::memory_order_relaxed);
+  theCache.InUse.store (0, std::memory_order_relaxed);
+  if (theCache.Prev != NULL)
+  {
+    theCache.Prev->Next = theCache.Next;
+  }
+  else
+  {
+    myCaches = theCache.Next;
+  }
+  if (theCache.Next != NULL)
+  {
+    theCache.Next->Prev = theCache.Prev;
+  }
+  theCache.Prev  = NULL;
+  theCache.Next  = NULL;
+  theCache.Owner = NULL;
+}
+
+//=======================================================================
+//function : takeBatch
+//purpose  :
+//=======================================================================
+void* Standard_MMgrThreadCache::takeBatch (const Standard_Integer theClass,
+                                           Standard_Integer& theNbBlocks)
+{
+  CentralList& aList = myCentral[theClass];
+  {
+    Standard_Mutex::Sentry aSentry (aList.Mutex);
+    if (aList.Batches != NULL)
+    {
+      void* aBatch = aList.Batches;
+      aList.Batches = nextBatch (aBatch);
+      theNbBlocks = batchLength (theClass);
+      return aBatch;
+    }
+    else if (aList.Loose != NULL)
+    {
+      // take not more than the batch from the loose list
+      void* aBatch = aList.Loose;
+      void* aLast  = aBatch;
+      theNbBlocks = 1;
+      for (const Standard_Integer aBatchLength = batchLength (theClass);
+           theNbBlocks < aBatchLength && nextBlock (aLast) != NULL; ++theNbBlocks)
+      {
+        aLast = nextBlock (aLast);
+      }
+      aList.Loose = nextBlock (aLast);
+      aList.NbLoose -= theNbBlocks;
+      nextBlock (aLast) = NULL;
+      return aBatch;
+    }
+  }
+  return carveBlocks (theClass, theNbBlocks);
+}
+
+//=======================================================================
+//function : putBatch
+//purpose  :
+//=======================================================================
+void Standard_MMgrThreadCache::putBatch (const Standard_Integer theClass,
+                                         void* theBlocks,
+                                         const Standard_Integer theNbBlocks)
+{
+  CentralList& aList = myCentral[theClass];
+  if (theNbBlocks == batchLength (theClass))
+  {
+    Standard_Mutex::Sentry aSentry (aList.Mutex);
+    nextBatch (theBlocks) = aList.Batches;
+    aList.Batches = theBlocks;
+    return;
+  }
+
+  void* aLast = theBlocks;
+  while (nextBlock (aLast) != NULL)
+  {
+    aLast = nextBlock (aLast);
+  }
+
+  Standard_Mutex::Sentry aSentry (aList.Mutex);
+  nextBlock (aLast) = aList.Loose;
+  aList.Loose = theBlocks;
+  aList.NbLoose += theNbBlocks;
+}
+
+//=======================================================================
+//function : carveBlocks
+//purpose  :
+//=======================================================================
+void* Standard_MMgrThreadCache::carveBlocks (const Standard_Integer theClass,
+                                             Standard_Integer& theNbBlocks)
+{
+  const Standard_Size aStride = classStride (theClass);
+  Standard_Size aNbBlocks = Standard_Size (batchLength (theClass));
+  char* aStart = NULL;
+  {
+    Standard_Mutex::Sentry aSentry (mySlabMutex);
+    if (Standard_Size (mySlabEnd - mySlabNext) < aStride)
+    {
+      // the tail of the active slab is lost, the first word of the slab links the slabs
+      char* aSlab = (char* )malloc (THE_SLAB_SIZE);
+      if (aSlab == NULL)
+      {
+        throw Standard_OutOfMemory ("Standard_MMgrThreadCache::Allocate(): malloc failed");
+      }
+      nextBlock (aSlab) = mySlabs;
+      mySlabs    = aSlab;
+      mySlabNext = aSlab + sizeof(void*);
+      mySlabEnd  = aSlab + THE_SLAB_SIZE;
+      mySlabSize.fetch_add (THE_SLAB_SIZE, std::memory_order_relaxed);
+    }
+
+    const Standard_Size aNbFit = Standard_Size (mySlabEnd - mySlabNext) / aStride;
+    if (aNbFit < aNbBlocks)
+    {
+      aNbBlocks = aNbFit;
+    }
+    aStart = mySlabNext;
+    mySlabNext += aNbBlocks * aStride;
+  }
+
+  // link the blocks into the list
+  char* aBlock = aStart + THE_HEADER_SIZE;
+  for (Standard_Size anIter = 1; anIter < aNbBlocks; ++anIter, aBlock += aStride)
+  {
+    nextBlock (aBlock) = aBlock + aStride;
+  }
+  nextBlock (aBlock) = NULL;
+  theNbBlocks = Standard_Integer (aNbBlocks);
+  return aStart + THE_HEADER_SIZE;
+}
+
+//=======================================================================
+//function : allocateCentral
+//purpose  :
+//=======================================================================
+void* Standard_MMgrThreadCache::allocateCentral (const Standard_Integer theClass)
+{
+  Standard_Integer aNbBlocks = 0;
+  void* aBlock = takeBatch (theClass, aNbBlocks);
+  if (aNbBlocks > 1)
+  {
+    putBatch (theClass, nextBlock (aBlock), aNbBlocks - 1);
+  }
+  return aBlock;
+}
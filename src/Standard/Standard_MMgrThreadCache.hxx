@@ -0,0 +1,170 @@
+// Copyright (c) 2024 OPEN CASCADE SAS
+//
+// This file is part of Open CASCADE Technology software library.
+//
+// This library is free software; you can redistribute it and/or modify it under
+// the terms of the GNU Lesser General Public License version 2.1 as published
+// by the Free Software Foundation, with special exception defined in the file
+// OCCT_LGPL_EXCEPTION.txt. Consult the file LICENSE_LGPL_21.txt included in OCCT
+// distribution for complete text of the license and disclaimer of any warranty.
+//
+// Alternatively, this file may be used under the terms of Open CASCADE
+// commercial license or contractual agreement.
+
+#ifndef _Standard_MMgrThreadCache_HeaderFile
+#define _Standard_MMgrThreadCache_HeaderFile
+
+#include <Standard_MMgrRoot.hxx>
+#include <Standard_Mutex.hxx>
+
+#include <atomic>
+
+/**
+* @brief Open CASCADE memory manager keeping the free small blocks in the caches of the threads.
+*
+* The behaviour is different for memory blocks of different sizes:
+*
+* - Small blocks with size less than or equal to 2048 bytes are rounded up
+*   to one of the size classes: 8 bytes step up to 128 bytes (handles, list
+*   and map nodes, small topological and geometric objects), 32 bytes step
+*   up to 512 bytes and 128 bytes step up to 2048 bytes (arrays of poles,
+*   knots and points). The blocks are carved from the slabs of 64 KiB.
+*   The freed block is put into the free list of its size class in the cache
+*   of the calling thread and reused by the next allocation of the same class
+*   in this thread without any synchronization.
+*   When the free list of the thread grows over the limit, the batch of blocks
+*   is moved to the central free list of the class shared by all threads;
+*   when the free list of the thread is empty, the batch of blocks is taken
+*   from the central list, or carved from the slab. Only these transfers of
+*   the batches are protected by the mutexes.
+*
+* - Large blocks are allocated and freed directly by malloc() and free().
+*
+* The block can be freed by any thread, not only by the thread allocated it:
+* the blocks of the same class are interchangeable, so the freed block just
+* goes into the cache of the freeing thread. The cache of the thread is
+* returned to the central lists when the thread exits.
+*
+* The slabs are never returned to the system (until the memory manager is
+* destroyed), however the free blocks kept by the threads can be reused by
+* any thread after method Purge() or the exit of the thread.
+*
+* 8 bytes are added at the beginning of every memory block to hold its size class.
+*
+* The caches of the threads require thread-local storage (Standard_HASTHREADLOCAL);
+* without it all blocks go through the central lists, and the memory manager
+* is not selected by MMGT_OPT=3 (the system allocator is used instead).
+*
+* The caches of the threads registered by the manager are detached from it
+* on its destruction; the manager should not be used by other threads at that time.
+*
+* The reserved memory and the memory in use are reported by method Statistics().
+*/
+class Standard_MMgrThreadCache : public Standard_MMgrRoot
+{
+public:
+
+  //! Number of the size classes of small blocks.
+  static const Standard_Integer THE_NB_CLASSES = 40;
+
+  //! Maximal size of the small block.
+  static const Standard_Size THE_MAX_SMALL_SIZE = 2048;
+
+  //! Cache of the free blocks of the thread, defined in the implementation.
+  struct ThreadCache;
+
+public:
+
+  //! Constructor. If theToClear is True, the allocated memory will be nullified.
+  Standard_EXPORT Standard_MMgrThreadCache (const Standard_Boolean theToClear = Standard_True);
+
+  //! Detaches the caches of the threads and releases the slabs of small blocks.
+  Standard_EXPORT virtual ~Standard_MMgrThreadCache();
+
+  //! Allocate theSize bytes; see class description above.
+  Standard_EXPORT virtual Standard_Address Allocate (const Standard_Size theSize) Standard_OVERRIDE;
+
+  //! Reallocate previously allocated thePtr to a new size; new address is returned.
+  //! In case that thePtr is null, the function behaves exactly as Allocate.
+  Standard_EXPORT virtual Standard_Address Reallocate (Standard_Address thePtr,
+                                                       const Standard_Size theSize) Standard_OVERRIDE;
+
+  //! Free previously allocated block.
+  Standard_EXPORT virtual void Free (Standard_Address thePtr) Standard_OVERRIDE;
+
+  //! Moves the free blocks of the cache of the calling thread to the central lists,
+  //! so that they become available to the other threads.
+  //! Returns 0 since the slabs are not released to the system.
+  Standard_EXPORT virtual Standard_Integer Purge (Standard_Boolean isDestroyed) Standard_OVERRIDE;
+
+  //! Returns the size of the slabs and large blocks obtained from the system
+  //! and the size of the blocks in use (rounded up to the size class and including the headers).
+  Standard_EXPORT virtual Standard_Boolean Statistics (Standard_Size& theReserved,
+                                                       Standard_Size& theInUse) const Standard_OVERRIDE;
+
+public:
+
+  //! Moves all free blocks of the cache to the central lists and unregisters it;
+  //! called on exit of the thread (internal).
+  void releaseCache (ThreadCache& theCache);
+
+private:
+
+  //! Returns the cache of the calling thread or NULL if it cannot be used.
+  ThreadCache* threadCache();
+
+  //! Moves all free blocks of the cache to the central lists.
+  void flushCache (ThreadCache& theCache);
+
+  //! Takes the batch of free blocks of the size class from the central list or the slab,
+  //! returns the list of the blocks linked through their first word and its length.
+  void* takeBatch (const Standard_Integer theClass, Standard_Integer& theNbBlocks);
+
+  //! Puts the list of the free blocks of the size class into the central list.
+  //! The list of exactly batch length is kept as is, other lists are merged into the loose list.
+  void putBatch (const Standard_Integer theClass, void* theBlocks, const Standard_Integer theNbBlocks);
+
+  //! Carves the blocks of the size class from the slab.
+  void* carveBlocks (const Standard_Integer theClass, Standard_Integer& theNbBlocks);
+
+  //! Allocates the block of the size class without the cache of the thread.
+  void* allocateCentral (const Standard_Integer theClass);
+
+private:
+
+  //! Central storage of the free blocks of the size class.
+  struct CentralList
+  {
+    Standard_Mutex   Mutex;       //!< mutex protecting the lists
+    void*            Batches;     //!< stack of the batches of free blocks, linked through the header of the first block
+    void*            Loose;       //!< list of free blocks of arbitrary length
+    Standard_Integer NbLoose;     //!< length of the loose list
+
+    CentralList() : Batches (NULL), Loose (NULL), NbLoose (0) {}
+  };
+
+private:
+
+  Standard_MMgrThreadCache (const Standard_MMgrThreadCache& );
+  Standard_MMgrThreadCache& operator= (const Standard_MMgrThreadCache& );
+
+private:
+
+  Standard_Boolean           myClear;                   //!< option to clear allocated memory
+  CentralList                myCentral[THE_NB_CLASSES]; //!< central free lists of the size classes
+
+  Standard_Mutex             mySlabMutex;               //!< mutex protecting the slabs
+  void*                      mySlabs;                   //!< list of the allocated slabs
+  char*                      mySlabNext;                //!< next free address in the active slab
+  char*                      mySlabEnd;                 //!< end of the active slab
+
+  mutable Standard_Mutex     myCachesMutex;             //!< mutex protecting the list of the caches of the threads
+  ThreadCache*               myCaches;                  //!< list of the caches of the active threads
+
+  std::atomic<Standard_Size> mySlabSize;                //!< total size of the slabs
+  std::atomic<Standard_Size> myLargeSize;               //!< total size of the large blocks in use
+  std::atomic<Standard_Size> myOrphanInUse;             //!< size of the blocks in use counted out of the caches
+
+};
+
+#endif
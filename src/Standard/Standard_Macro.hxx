@@ -140,7 +140,12 @@
   #define Standard_THREADLOCAL thread_local
 #endif
 
-#ifndef Standard_THREADLOCAL
+//! @def Standard_HASTHREADLOCAL
+//! Defined when Standard_THREADLOCAL is the thread_local keyword,
+//! i.e. when the variables declared with it are really local to the thread.
+#ifdef Standard_THREADLOCAL
+  #define Standard_HASTHREADLOCAL
+#else
   #define Standard_THREADLOCAL
 #endif
 
@@ -14,7 +14,6 @@
 
 #include <Standard_Type.hxx>
 #include <Standard_Transient.hxx>
-#include <Standard_Atomic.hxx>
 #include <Standard_CString.hxx>
 #include <Standard_ProgramError.hxx>
 
@@ -75,11 +74,11 @@ Standard_Transient* Standard_Transient::This() const
 // Increment reference counter
 void Standard_Transient::IncrementRefCounter() const
 {
-  Standard_Atomic_Increment (&myRefCount_);
+  incrementRefCounter();
 }
 
 // Decrement reference counter
 Standard_Integer Standard_Transient::DecrementRefCounter() const
 {
-  return Standard_Atomic_Decrement(&myRefCount_);
+  return decrementRefCounter();
 }
@@ -16,6 +16,7 @@
 #define _Standard_Transient_HeaderFile
 
 #include <Standard.hxx>
+#include <Standard_Atomic.hxx>
 #include <Standard_DefineAlloc.hxx>
 #include <Standard_PrimitiveTypes.hxx>
 
@@ -99,6 +100,15 @@ public:
   //! returns the decremented value
   Standard_EXPORT Standard_Integer DecrementRefCounter() const;
 
+private:
+
+  //! Inline versions of IncrementRefCounter() and DecrementRefCounter()
+  //! used by the handle on each copy of it.
+  void incrementRefCounter() const { Standard_Atomic_Increment (&myRefCount_); }
+  Standard_Integer decrementRefCounter() const { return Standard_Atomic_Decrement (&myRefCount_); }
+
+  template <class T> friend class opencascade::handle;
+
 private:
 
   //! Reference counter.
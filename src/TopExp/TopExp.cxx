@@ -29,6 +29,226 @@
 #include <TopoDS_Wire.hxx>
 #include <TopTools_ListOfShape.hxx>
 #include <TopTools_MapOfShape.hxx>
+#include <NCollection_Array1.hxx>
+#include <NCollection_Vector.hxx>
+#include <OSD_Parallel.hxx>
+
+namespace
+{
+  //! Number of parts of the shape per thread for balancing of the load
+  static const Standard_Integer THE_NB_PARTS_PER_THREAD = 4;
+
+  //! Part of the shape to be explored by a single task:
+  //! either the whole sub-tree of the sub-shape or only the sub-shape itself.
+  struct TopExp_Part
+  {
+    TopoDS_Shape     Shape;
+    Standard_Boolean IsSubTree;
+
+    TopExp_Part() : IsSubTree (Standard_False) {}
+    TopExp_Part (const TopoDS_Shape& theShape, const Standard_Boolean theIsSubTree)
+    : Shape (theShape), IsSubTree (theIsSubTree) {}
+  };
+
+  //! Splits the shape into the parts, so that the concatenation of the sub-shapes
+  //! of the parts collected in order gives the sub-shapes of the whole shape in the
+  //! same order as the sequential exploration.
+  //! @param theShape the shape to split
+  //! @param theType  the type of the sub-shapes to collect, TopAbs_SHAPE to collect all sub-shapes
+  //! @param theCumOri, theCumLoc flags of the exploration of the first level of the shape
+  //! @param theParts the parts of the shape
+  static void splitShape (const TopoDS_Shape& theShape,
+                          const TopAbs_ShapeEnum theType,
+                          const Standard_Boolean theCumOri,
+                          const Standard_Boolean theCumLoc,
+                          NCollection_Vector<TopExp_Part>& theParts)
+  {
+    const Standard_Integer aNbThreads = OSD_Parallel::NbLogicalProcessors();
+    const Standard_Integer aNbParts = aNbThreads * THE_NB_PARTS_PER_THREAD;
+    theParts.Clear();
+    theParts.Append (TopExp_Part (theShape, Standard_True));
+    if (aNbThreads < 2)
+    {
+      // there is no gain in splitting
+      return;
+    }
+    for (Standard_Boolean isFirstLevel = Standard_True, isSplit = Standard_True;
+         isSplit && theParts.Length() < aNbParts; isFirstLevel = Standard_False)
+    {
+      isSplit = Standard_False;
+      NCollection_Vector<TopExp_Part> aParts;
+      for (NCollection_Vector<TopExp_Part>::Iterator aPartIt (theParts); aPartIt.More(); aPartIt.Next())
+      {
+        const TopExp_Part& aPart = aPartIt.Value();
+        // the sub-shapes of the given type are not searched inside the shapes of this type
+        // and the shapes of the less complex types
+        const Standard_Boolean toSplit = aPart.IsSubTree
+                                      && aPart.Shape.NbChildren() > 0
+                                      && (theType == TopAbs_SHAPE || aPart.Shape.ShapeType() < theType);
+        if (!toSplit)
+        {
+          aParts.Append (aPart);
+          continue;
+        }
+
+        isSplit = Standard_True;
+        if (theType == TopAbs_SHAPE)
+        {
+          aParts.Append (TopExp_Part (aPart.Shape, Standard_False));
+        }
+        for (TopoDS_Iterator anIt (aPart.Shape,
+                                   !isFirstLevel || theCumOri,
+                                   !isFirstLevel || theCumLoc); anIt.More(); anIt.Next())
+        {
+          aParts.Append (TopExp_Part (anIt.Value(), Standard_True));
+        }
+      }
+      theParts = aParts;
+    }
+  }
+
+  //! Functor collecting the sub-shapes of the parts of the shape into separate maps.
+  class TopExp_PartsMapper
+  {
+  public:
+    TopExp_PartsMapper (const NCollection_Vector<TopExp_Part>& theParts,
+                        const TopAbs_ShapeEnum theType,
+                        NCollection_Array1<TopTools_IndexedMapOfShape>& theMaps)
+    : myParts (theParts), myType (theType), myMaps (theMaps) {}
+
+    void operator() (const Standard_Integer theIndex) const
+    {
+      const TopExp_Part& aPart = myParts (theIndex);
+      TopTools_IndexedMapOfShape& aMap = myMaps (theIndex);
+      if (!aPart.IsSubTree)
+      {
+        aMap.Add (aPart.Shape);
+      }
+      else if (myType == TopAbs_SHAPE)
+      {
+        TopExp::MapShapes (aPart.Shape, aMap);
+      }
+      else
+      {
+        TopExp::MapShapes (aPart.Shape, myType, aMap);
+      }
+    }
+
+  private:
+    TopExp_PartsMapper& operator= (const TopExp_PartsMapper&);
+
+  private:
+    const NCollection_Vector<TopExp_Part>&          myParts;
+    TopAbs_ShapeEnum                                myType;
+    NCollection_Array1<TopTools_IndexedMapOfShape>& myMaps;
+  };
+
+  //! Collects the sub-shapes of the shape in parallel.
+  //! Returns false if the shape cannot be split into several parts,
+  //! in this case the map is not changed.
+  template <class TheMapType>
+  static Standard_Boolean mapShapesParallel (const TopoDS_Shape& theShape,
+                                             const TopAbs_ShapeEnum theType,
+                                             const Standard_Boolean theCumOri,
+                                             const Standard_Boolean theCumLoc,
+                                             TheMapType& theMap)
+  {
+    NCollection_Vector<TopExp_Part> aParts;
+    splitShape (theShape, theType, theCumOri, theCumLoc, aParts);
+    if (aParts.Length() < 2)
+    {
+      return Standard_False;
+    }
+
+    NCollection_Array1<TopTools_IndexedMapOfShape> aMaps (0, aParts.Length() - 1);
+    OSD_Parallel::For (0, aParts.Length(), TopExp_PartsMapper (aParts, theType, aMaps));
+
+    // merge the maps in the order of the parts
+    for (Standard_Integer aPartIter = 0; aPartIter < aParts.Length(); ++aPartIter)
+    {
+      const TopTools_IndexedMapOfShape& aMap = aMaps (aPartIter);
+      for (Standard_Integer anIndex = 1; anIndex <= aMap.Extent(); ++anIndex)
+      {
+        theMap.Add (aMap (anIndex));
+      }
+    }
+    return Standard_True;
+  }
+
+  //! Functor collecting the sub-shapes of the given type of the ancestors.
+  class TopExp_AncestorsExplorer
+  {
+  public:
+    TopExp_AncestorsExplorer (const NCollection_Vector<TopoDS_Shape>& theAncestors,
+                              const TopAbs_ShapeEnum theType,
+                              NCollection_Array1<TopTools_ListOfShape>& theSubShapes)
+    : myAncestors (theAncestors), myType (theType), mySubShapes (theSubShapes) {}
+
+    void operator() (const Standard_Integer theIndex) const
+    {
+      TopTools_ListOfShape& aList = mySubShapes (theIndex);
+      for (TopExp_Explorer anExp (myAncestors (theIndex), myType); anExp.More(); anExp.Next())
+      {
+        aList.Append (anExp.Current());
+      }
+    }
+
+  private:
+    TopExp_AncestorsExplorer& operator= (const TopExp_AncestorsExplorer&);
+
+  private:
+    const NCollection_Vector<TopoDS_Shape>&   myAncestors;
+    TopAbs_ShapeEnum                          myType;
+    NCollection_Array1<TopTools_ListOfShape>& mySubShapes;
+  };
+
+  //! Appends the ancestor to the list of the sub-shape in the map,
+  //! if it is not in the list yet.
+  static void addUniqueAncestor (const TopoDS_Shape& theSubShape,
+                                 const TopoDS_Shape& theAncestor,
+                                 const Standard_Boolean theUseOrientation,
+                                 TopTools_IndexedDataMapOfShapeListOfShape& theMap)
+  {
+    Standard_Integer anIndex = theMap.FindIndex (theSubShape);
+    if (anIndex == 0)
+      anIndex = theMap.Add (theSubShape, TopTools_ListOfShape());
+    TopTools_ListOfShape& aList = theMap (anIndex);
+    // check if the ancestor already exists in a list
+    TopTools_ListIteratorOfListOfShape anIt (aList);
+    for (; anIt.More(); anIt.Next())
+      if (theUseOrientation ? theAncestor.IsEqual (anIt.Value()) : theAncestor.IsSame (anIt.Value()))
+        break;
+    if (!anIt.More())
+      aList.Append (theAncestor);
+  }
+
+  //! Collects the ancestors of type theTA and their sub-shapes of type theTS.
+  //! Returns false if there are less than two ancestors or threads,
+  //! in this case the sequential exploration is to be used.
+  static Standard_Boolean exploreAncestorsParallel (const TopoDS_Shape& theShape,
+                                                    const TopAbs_ShapeEnum theTS,
+                                                    const TopAbs_ShapeEnum theTA,
+                                                    NCollection_Vector<TopoDS_Shape>& theAncestors,
+                                                    NCollection_Array1<TopTools_ListOfShape>& theSubShapes)
+  {
+    if (OSD_Parallel::NbLogicalProcessors() < 2)
+    {
+      return Standard_False;
+    }
+    for (TopExp_Explorer anExpA (theShape, theTA); anExpA.More(); anExpA.Next())
+    {
+      theAncestors.Append (anExpA.Current());
+    }
+    if (theAncestors.Length() < 2)
+    {
+      return Standard_False;
+    }
+
+    theSubShapes.Resize (0, theAncestors.Length() - 1, Standard_False);
+    OSD_Parallel::For (0, theAncestors.Length(), TopExp_AncestorsExplorer (theAncestors, theTS, theSubShapes));
+    return Standard_True;
+  }
+}
 
 //=======================================================================
 //function : MapShapes
@@ -36,8 +256,16 @@
 //=======================================================================
 void TopExp::MapShapes(const TopoDS_Shape& S,
 		       const TopAbs_ShapeEnum T,
-		       TopTools_IndexedMapOfShape& M)
+		       TopTools_IndexedMapOfShape& M,
+                       const Standard_Boolean isParallel)
 {
+  if (isParallel
+   && T != TopAbs_SHAPE
+   && mapShapesParallel (S, T, Standard_True, Standard_True, M))
+  {
+    return;
+  }
+
   TopExp_Explorer Ex(S,T);
   while (Ex.More()) {
     M.Add(Ex.Current());
@@ -52,8 +280,15 @@ void TopExp::MapShapes(const TopoDS_Shape& S,
 
 void TopExp::MapShapes(const TopoDS_Shape& S,
 		       TopTools_IndexedMapOfShape& M,
-  const Standard_Boolean cumOri, const Standard_Boolean cumLoc)
+  const Standard_Boolean cumOri, const Standard_Boolean cumLoc,
+  const Standard_Boolean isParallel)
 {
+  if (isParallel
+   && mapShapesParallel (S, TopAbs_SHAPE, cumOri, cumLoc, M))
+  {
+    return;
+  }
+
   M.Add(S);
   TopoDS_Iterator It(S, cumOri, cumLoc);
   while (It.More()) {
@@ -68,8 +303,15 @@ void TopExp::MapShapes(const TopoDS_Shape& S,
 //=======================================================================
 void TopExp::MapShapes(const TopoDS_Shape& S,
                        TopTools_MapOfShape& M, 
-  const Standard_Boolean cumOri, const Standard_Boolean cumLoc)
+  const Standard_Boolean cumOri, const Standard_Boolean cumLoc,
+  const Standard_Boolean isParallel)
 {
+  if (isParallel
+   && mapShapesParallel (S, TopAbs_SHAPE, cumOri, cumLoc, M))
+  {
+    return;
+  }
+
   M.Add(S);
   TopoDS_Iterator It(S, cumOri, cumLoc);
   for (; It.More(); It.Next())
@@ -85,23 +327,43 @@ void  TopExp::MapShapesAndAncestors
   (const TopoDS_Shape& S, 
    const TopAbs_ShapeEnum TS, 
    const TopAbs_ShapeEnum TA, 
-   TopTools_IndexedDataMapOfShapeListOfShape& M)
+   TopTools_IndexedDataMapOfShapeListOfShape& M,
+   const Standard_Boolean isParallel)
 {
   TopTools_ListOfShape empty;
   
   // visit ancestors
-  TopExp_Explorer exa(S,TA);
-  while (exa.More()) {
-    // visit shapes
-    const TopoDS_Shape& anc = exa.Current();
-    TopExp_Explorer exs(anc,TS);
-    while (exs.More()) {
-      Standard_Integer index = M.FindIndex(exs.Current());
-      if (index == 0) index = M.Add(exs.Current(),empty);
-      M(index).Append(anc);
-      exs.Next();
+  NCollection_Vector<TopoDS_Shape> anAncestors;
+  NCollection_Array1<TopTools_ListOfShape> aSubShapes;
+  if (isParallel
+   && exploreAncestorsParallel (S, TS, TA, anAncestors, aSubShapes))
+  {
+    for (Standard_Integer anAncIter = 0; anAncIter < anAncestors.Length(); ++anAncIter)
+    {
+      const TopoDS_Shape& anc = anAncestors (anAncIter);
+      for (TopTools_ListIteratorOfListOfShape anIt (aSubShapes (anAncIter)); anIt.More(); anIt.Next())
+      {
+        Standard_Integer index = M.FindIndex(anIt.Value());
+        if (index == 0) index = M.Add(anIt.Value(),empty);
+        M(index).Append(anc);
+      }
+    }
+  }
+  else
+  {
+    TopExp_Explorer exa(S,TA);
+    while (exa.More()) {
+      // visit shapes
+      const TopoDS_Shape& anc = exa.Current();
+      TopExp_Explorer exs(anc,TS);
+      while (exs.More()) {
+        Standard_Integer index = M.FindIndex(exs.Current());
+        if (index == 0) index = M.Add(exs.Current(),empty);
+        M(index).Append(anc);
+        exs.Next();
+      }
+      exa.Next();
     }
-    exa.Next();
   }
   
   // visit shapes not under ancestors
@@ -123,33 +385,41 @@ void  TopExp::MapShapesAndUniqueAncestors
    const TopAbs_ShapeEnum TS, 
    const TopAbs_ShapeEnum TA, 
    TopTools_IndexedDataMapOfShapeListOfShape& M,
-   const Standard_Boolean useOrientation)
+   const Standard_Boolean useOrientation,
+   const Standard_Boolean isParallel)
 {
   TopTools_ListOfShape empty;
   
   // visit ancestors
-  TopExp_Explorer exa(S,TA);
-  while (exa.More())
+  NCollection_Vector<TopoDS_Shape> anAncestors;
+  NCollection_Array1<TopTools_ListOfShape> aSubShapes;
+  if (isParallel
+   && exploreAncestorsParallel (S, TS, TA, anAncestors, aSubShapes))
+  {
+    for (Standard_Integer anAncIter = 0; anAncIter < anAncestors.Length(); ++anAncIter)
+    {
+      const TopoDS_Shape& anc = anAncestors (anAncIter);
+      for (TopTools_ListIteratorOfListOfShape anIt (aSubShapes (anAncIter)); anIt.More(); anIt.Next())
+      {
+        addUniqueAncestor (anIt.Value(), anc, useOrientation, M);
+      }
+    }
+  }
+  else
   {
-    // visit shapes
-    const TopoDS_Shape& anc = exa.Current();
-    TopExp_Explorer exs(anc,TS);
-    while (exs.More())
+    TopExp_Explorer exa(S,TA);
+    while (exa.More())
     {
-      Standard_Integer index = M.FindIndex(exs.Current());
-      if (index == 0)
-        index = M.Add(exs.Current(),empty);
-      TopTools_ListOfShape& aList = M(index);
-      // check if anc already exists in a list
-      TopTools_ListIteratorOfListOfShape it(aList);
-      for (; it.More(); it.Next())
-        if (useOrientation? anc.IsEqual(it.Value()) : anc.IsSame(it.Value()))
-          break;
-      if (!it.More())
-        aList.Append(anc);
-      exs.Next();
+      // visit shapes
+      const TopoDS_Shape& anc = exa.Current();
+      TopExp_Explorer exs(anc,TS);
+      while (exs.More())
+      {
+        addUniqueAncestor (exs.Current(), anc, useOrientation, M);
+        exs.Next();
+      }
+      exa.Next();
     }
-    exa.Next();
   }
 
   // visit shapes not under ancestors
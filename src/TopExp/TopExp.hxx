@@ -52,9 +52,13 @@ public:
   //! Tool to explore a topological data structure.
   //! Stores in the map <M> all  the sub-shapes of <S>
   //! of type <T>.
+  //! - If isParallel is true, the sub-shapes of the parts of <S>
+  //! are collected in parallel threads and merged in the map
+  //! in the same order as in the sequential mode.
   //!
   //! Warning: The map is not cleared at first.
-  Standard_EXPORT static void MapShapes (const TopoDS_Shape& S, const TopAbs_ShapeEnum T, TopTools_IndexedMapOfShape& M);
+  Standard_EXPORT static void MapShapes (const TopoDS_Shape& S, const TopAbs_ShapeEnum T, TopTools_IndexedMapOfShape& M,
+    const Standard_Boolean isParallel = Standard_False);
   
   //! Stores in the map <M> all  the sub-shapes of <S>.
   //! - If cumOri is true, the function composes all
@@ -62,8 +66,12 @@ public:
   //! - If cumLoc is true, the function multiplies all
   //! sub-shapes by the location of S, i.e. it applies to
   //! each sub-shape the transformation that is associated with S.
+  //! - If isParallel is true, the sub-shapes of the parts of <S>
+  //! are collected in parallel threads and merged in the map
+  //! in the same order as in the sequential mode.
   Standard_EXPORT static void MapShapes (const TopoDS_Shape& S, TopTools_IndexedMapOfShape& M,
-    const Standard_Boolean cumOri = Standard_True, const Standard_Boolean cumLoc = Standard_True);
+    const Standard_Boolean cumOri = Standard_True, const Standard_Boolean cumLoc = Standard_True,
+    const Standard_Boolean isParallel = Standard_False);
 
   //! Stores in the map <M> all  the sub-shapes of <S>.
   //! - If cumOri is true, the function composes all
@@ -71,24 +79,33 @@ public:
   //! - If cumLoc is true, the function multiplies all
   //! sub-shapes by the location of S, i.e. it applies to
   //! each sub-shape the transformation that is associated with S.
+  //! - If isParallel is true, the sub-shapes of the parts of <S>
+  //! are collected in parallel threads.
   Standard_EXPORT static void MapShapes (const TopoDS_Shape& S, TopTools_MapOfShape& M,
-    const Standard_Boolean cumOri = Standard_True, const Standard_Boolean cumLoc = Standard_True);
+    const Standard_Boolean cumOri = Standard_True, const Standard_Boolean cumLoc = Standard_True,
+    const Standard_Boolean isParallel = Standard_False);
 
   //! Stores in the map <M> all the subshape of <S> of
   //! type <TS>  for each one append  to  the list all
   //! the ancestors of type <TA>.  For example map all
   //! the edges and bind the list of faces.
+  //! If isParallel is true, the sub-shapes of the ancestors are
+  //! explored in parallel threads, the content of the map is the
+  //! same as in the sequential mode.
   //! Warning: The map is not cleared at first.
-  Standard_EXPORT static void MapShapesAndAncestors (const TopoDS_Shape& S, const TopAbs_ShapeEnum TS, const TopAbs_ShapeEnum TA, TopTools_IndexedDataMapOfShapeListOfShape& M);
+  Standard_EXPORT static void MapShapesAndAncestors (const TopoDS_Shape& S, const TopAbs_ShapeEnum TS, const TopAbs_ShapeEnum TA, TopTools_IndexedDataMapOfShapeListOfShape& M,
+                                                     const Standard_Boolean isParallel = Standard_False);
   
   //! Stores in the map <M> all the subshape of <S> of
   //! type <TS> for each one append to the list all
   //! unique ancestors of type <TA>.  For example map all
   //! the edges and bind the list of faces.
   //! useOrientation = True : taking account the ancestor orientation
+  //! isParallel = True : exploring the ancestors in parallel threads
   //! Warning: The map is not cleared at first.
   Standard_EXPORT static void MapShapesAndUniqueAncestors (const TopoDS_Shape& S, const TopAbs_ShapeEnum TS, const TopAbs_ShapeEnum TA, TopTools_IndexedDataMapOfShapeListOfShape& M,
-                                                           const Standard_Boolean useOrientation = Standard_False);
+                                                           const Standard_Boolean useOrientation = Standard_False,
+                                                           const Standard_Boolean isParallel = Standard_False);
 
   //! Returns the Vertex of orientation FORWARD in E. If
   //! there is none returns a Null Shape.
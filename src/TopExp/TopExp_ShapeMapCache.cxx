@@ -0,0 +1,86 @@
+// Copyright (c) 2024 OPEN CASCADE SAS
+//
+// This file is part of Open CASCADE Technology software library.
+//
+// This library is free software; you can redistribute it and/or modify it under
+// the terms of the GNU Lesser General Public License version 2.1 as published
+// by the Free Software Foundation, with special exception defined in the file
+// OCCT_LGPL_EXCEPTION.txt. Consult the file LICENSE_LGPL_21.txt included in OCCT
+// distribution for complete text of the license and disclaimer of any warranty.
+//
+// Alternatively, this file may be used under the terms of Open CASCADE
+// commercial license or contractual agreement.
+
+#include <TopExp_ShapeMapCache.hxx>
+
+#include <TopExp.hxx>
+
+IMPLEMENT_STANDARD_RTTIEXT(TopExp_ShapeMapCache, Standard_Transient)
+
+//=======================================================================
+//function : TopExp_ShapeMapCache
+//purpose  :
+//=======================================================================
+TopExp_ShapeMapCache::TopExp_ShapeMapCache (const TopoDS_Shape& theShape,
+                                            const Standard_Boolean theIsParallel)
+: myShape (theShape),
+  myIsParallel (theIsParallel)
+{
+}
+
+//=======================================================================
+//function : Shapes
+//purpose  :
+//=======================================================================
+const TopTools_IndexedMapOfShape& TopExp_ShapeMapCache::Shapes (const TopAbs_ShapeEnum theType)
+{
+  Standard_Mutex::Sentry aSentry (myMutex);
+  if (const TopTools_IndexedMapOfShape* aMap = myShapes.Seek (theType))
+  {
+    return *aMap;
+  }
+
+  myShapes.Bind (theType, TopTools_IndexedMapOfShape());
+  TopTools_IndexedMapOfShape& aMap = myShapes.ChangeFind (theType);
+  if (theType == TopAbs_SHAPE)
+  {
+    TopExp::MapShapes (myShape, aMap, Standard_True, Standard_True, myIsParallel);
+  }
+  else
+  {
+    TopExp::MapShapes (myShape, theType, aMap, myIsParallel);
+  }
+  return aMap;
+}
+
+//=======================================================================
+//function : ShapesAndAncestors
+//purpose  :
+//=======================================================================
+const TopTools_IndexedDataMapOfShapeListOfShape& TopExp_ShapeMapCache::ShapesAndAncestors (const TopAbs_ShapeEnum theTS,
+                                                                                           const TopAbs_ShapeEnum theTA)
+{
+  const Standard_Integer aKey = theTS * (TopAbs_SHAPE + 1) + theTA;
+
+  Standard_Mutex::Sentry aSentry (myMutex);
+  if (const TopTools_IndexedDataMapOfShapeListOfShape* aMap = myAncestors.Seek (aKey))
+  {
+    return *aMap;
+  }
+
+  myAncestors.Bind (aKey, TopTools_IndexedDataMapOfShapeListOfShape());
+  TopTools_IndexedDataMapOfShapeListOfShape& aMap = myAncestors.ChangeFind (aKey);
+  TopExp::MapShapesAndAncestors (myShape, theTS, theTA, aMap, myIsParallel);
+  return aMap;
+}
+
+//=======================================================================
+//function : Clear
+//purpose  :
+//=======================================================================
+void TopExp_ShapeMapCache::Clear()
+{
+  Standard_Mutex::Sentry aSentry (myMutex);
+  myShapes.Clear();
+  myAncestors.Clear();
+}
@@ -0,0 +1,81 @@
+// Copyright (c) 2024 OPEN CASCADE SAS
+//
+// This file is part of Open CASCADE Technology software library.
+//
+// This library is free software; you can redistribute it and/or modify it under
+// the terms of the GNU Lesser General Public License version 2.1 as published
+// by the Free Software Foundation, with special exception defined in the file
+// OCCT_LGPL_EXCEPTION.txt. Consult the file LICENSE_LGPL_21.txt included in OCCT
+// distribution for complete text of the license and disclaimer of any warranty.
+//
+// Alternatively, this file may be used under the terms of Open CASCADE
+// commercial license or contractual agreement.
+
+#ifndef _TopExp_ShapeMapCache_HeaderFile
+#define _TopExp_ShapeMapCache_HeaderFile
+
+#include <NCollection_DataMap.hxx>
+#include <Standard_Mutex.hxx>
+#include <Standard_Transient.hxx>
+#include <TopoDS_Shape.hxx>
+#include <TopTools_IndexedDataMapOfShapeListOfShape.hxx>
+#include <TopTools_IndexedMapOfShape.hxx>
+
+//! Cache of the maps of sub-shapes of the shape, built by TopExp::MapShapes()
+//! and TopExp::MapShapesAndAncestors() on the first request and returned
+//! without exploring the shape on the subsequent requests.
+//!
+//! The cache is intended to be created once for the shape and shared by the
+//! algorithms working with this shape. The cache is not updated automatically
+//! on modification of the shape, Clear() should be called in this case.
+//! The requests of the maps are thread-safe.
+class TopExp_ShapeMapCache : public Standard_Transient
+{
+  DEFINE_STANDARD_RTTIEXT(TopExp_ShapeMapCache, Standard_Transient)
+public:
+
+  //! Creates the empty cache for the given shape.
+  //! @param theShape the shape to explore
+  //! @param theIsParallel flag to explore the shape in parallel threads
+  Standard_EXPORT TopExp_ShapeMapCache (const TopoDS_Shape& theShape,
+                                        const Standard_Boolean theIsParallel = Standard_False);
+
+  //! Returns the shape.
+  const TopoDS_Shape& Shape() const { return myShape; }
+
+  //! Returns true if the shape is explored in parallel threads.
+  Standard_Boolean IsParallel() const { return myIsParallel; }
+
+  //! Sets the flag to explore the shape in parallel threads.
+  void SetParallel (const Standard_Boolean theIsParallel) { myIsParallel = theIsParallel; }
+
+  //! Returns the map of the sub-shapes of the given type of the shape,
+  //! the same as filled by TopExp::MapShapes (Shape(), theType, M).
+  //! For TopAbs_SHAPE returns the map of all sub-shapes of the shape,
+  //! the same as filled by TopExp::MapShapes (Shape(), M).
+  Standard_EXPORT const TopTools_IndexedMapOfShape& Shapes (const TopAbs_ShapeEnum theType);
+
+  //! Returns the map of the sub-shapes of the type theTS with the lists of their
+  //! ancestors of the type theTA, the same as filled by
+  //! TopExp::MapShapesAndAncestors (Shape(), theTS, theTA, M).
+  Standard_EXPORT const TopTools_IndexedDataMapOfShapeListOfShape& ShapesAndAncestors (const TopAbs_ShapeEnum theTS,
+                                                                                       const TopAbs_ShapeEnum theTA);
+
+  //! Releases all cached maps.
+  //! Should be called after modification of the shape.
+  //! The references to the maps returned before become invalid.
+  Standard_EXPORT void Clear();
+
+private:
+
+  TopoDS_Shape myShape;
+  NCollection_DataMap<Standard_Integer, TopTools_IndexedMapOfShape>                myShapes;
+  NCollection_DataMap<Standard_Integer, TopTools_IndexedDataMapOfShapeListOfShape> myAncestors;
+  Standard_Mutex   myMutex;
+  Standard_Boolean myIsParallel;
+
+};
+
+DEFINE_STANDARD_HANDLE(TopExp_ShapeMapCache, Standard_Transient)
+
+#endif // _TopExp_ShapeMapCache_HeaderFile
@@ -172,31 +172,10 @@ TopLoc_Location TopLoc_Location::Powered (const Standard_Integer pwr) const
 //=======================================================================
 Standard_Integer TopLoc_Location::HashCode (const Standard_Integer theUpperBound) const
 {
-  // the HashCode computed for a Location is the bitwise exclusive or
-  // of values computed for each element of the list
-  // to compute this value, the depth of the element is computed 
-  // the depth is the position of the element in the list
-  // this depth is multiplied by 3
-  // each element is an elementary Datum raised to a Power
-  // the Power is bitwise left shifted by depth
-  // this is added to the HashCode of the Datum
-  // this value is biwise rotated by depth
-  // the use of depth avoids getting the same result for two permutated lists.
-
-  Standard_Integer           depth = 0;
-  unsigned int               h     = 0;
-  TopLoc_SListOfItemLocation items = myItems;
-  while (items.More())
-  {
-    depth += 3;
-    unsigned int           i             = ::HashCode (items.Value().myDatum, theUpperBound);
-    const Standard_Integer aClampedDepth = depth % 32;
-    unsigned int           j             = ((i + items.Value().myPower) << aClampedDepth);
-    j                                    = j >> (32 - aClampedDepth) | j << aClampedDepth;
-    h ^= j;
-    items.Next ();
-  }
-  return ::HashCode (h, theUpperBound);
+  // the hash code of the list of items is computed on its construction
+  // from the elementary Datums, their Powers and positions in the list,
+  // thus it is not necessary to iterate the list here
+  return static_cast<Standard_Integer> (HashCode() % static_cast<Standard_Size> (theUpperBound)) + 1;
 }
 
 //=======================================================================
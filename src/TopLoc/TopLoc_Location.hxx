@@ -118,6 +118,10 @@ Standard_NODISCARD TopLoc_Location operator/ (const TopLoc_Location& Other) cons
   //! @param theUpperBound the upper bound of the range a computing hash code must be within
   //! @return a computed hash code, in the range [1, theUpperBound]
   Standard_EXPORT Standard_Integer HashCode (Standard_Integer theUpperBound) const;
+
+  //! Returns a full-width hashed value for this local coordinate system.
+  //! The value is computed once on construction of the location, and is 0 for the identity.
+  Standard_Size HashCode() const { return myItems.HashCode(); }
   
   //! Returns true if this location and the location Other
   //! have the same elementary data, i.e. contain the same
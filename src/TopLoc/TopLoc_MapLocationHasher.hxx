@@ -18,9 +18,32 @@
 #define TopLoc_MapLocationHasher_HeaderFile
 
 #include <TopLoc_Location.hxx>
-#include <NCollection_DefaultHasher.hxx>
 
-typedef NCollection_DefaultHasher<TopLoc_Location> TopLoc_MapLocationHasher;
+//! Hash tool, used for generating maps of locations.
+class TopLoc_MapLocationHasher
+{
+public:
+
+  //! Returns the full-width hash code of the location, memoized in the location.
+  static Standard_Size HashCode (const TopLoc_Location& theLocation)
+  {
+    return theLocation.HashCode();
+  }
+
+  //! Computes a hash code for the given location, in the range [1, theUpperBound]
+  static Standard_Integer HashCode (const TopLoc_Location& theLocation,
+                                    const Standard_Integer theUpperBound)
+  {
+    return theLocation.HashCode (theUpperBound);
+  }
+
+  //! Returns True when the two locations are the same.
+  static Standard_Boolean IsEqual (const TopLoc_Location& theLocation1,
+                                   const TopLoc_Location& theLocation2)
+  {
+    return theLocation1.IsEqual (theLocation2);
+  }
+};
 
 
 #endif
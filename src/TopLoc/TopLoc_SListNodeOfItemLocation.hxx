@@ -40,6 +40,10 @@ public:
   
     TopLoc_ItemLocation& Value() const;
 
+    //! Returns the hash code of the list starting from this node,
+    //! computed once on construction of the list.
+    Standard_Size HashCode() const { return myHashCode; }
+
 
 
 
@@ -55,6 +59,9 @@ private:
 
   TopLoc_SListOfItemLocation myTail;
   TopLoc_ItemLocation myValue;
+  Standard_Size myHashCode;
+
+  friend class TopLoc_SListOfItemLocation;
 
 
 };
@@ -16,6 +16,7 @@
 
 
 #include <Standard_NoSuchObject.hxx>
+#include <TopLoc_Datum3D.hxx>
 #include <TopLoc_ItemLocation.hxx>
 #include <TopLoc_SListNodeOfItemLocation.hxx>
 #include <TopLoc_SListOfItemLocation.hxx>
@@ -32,6 +33,24 @@ TopLoc_SListOfItemLocation::TopLoc_SListOfItemLocation(const TopLoc_ItemLocation
     const gp_Trsf& aT = myNode->Tail().Value().myTrsf;
     myNode->Value().myTrsf.PreMultiply (aT);
   }
+
+  // combine the hash code of the tail with the item,
+  // so that the permutated lists get different hash codes
+  const Standard_Size aDatum = reinterpret_cast<Standard_Size> (anItem.myDatum.get());
+  Standard_Size aHash = aTail.HashCode();
+  aHash ^= aDatum + 0x9e3779b9 + (aHash << 6) + (aHash >> 2);
+  aHash ^= static_cast<Standard_Size> (anItem.myPower) + 0x9e3779b9 + (aHash << 6) + (aHash >> 2);
+  myNode->myHashCode = aHash;
+}
+
+//=======================================================================
+//function : HashCode
+//purpose  : 
+//=======================================================================
+
+Standard_Size TopLoc_SListOfItemLocation::HashCode() const
+{
+  return myNode.IsNull() ? 0 : myNode->HashCode();
 }
 
 //=======================================================================
@@ -108,6 +108,12 @@ public:
   //! list the tail is the list itself.
   Standard_EXPORT const TopLoc_SListOfItemLocation& Tail() const;
   
+  //! Returns the hash code of the list. It depends on the
+  //! elementary data and powers of the items and their order.
+  //! The hash code is computed once on construction of the list.
+  //! The hash code of the empty list is 0.
+  Standard_EXPORT Standard_Size HashCode() const;
+
   //! Replaces the list by a list with <anItem> as Value
   //! and the  list <me> as  tail.
   void Construct(const TopLoc_ItemLocation& anItem)
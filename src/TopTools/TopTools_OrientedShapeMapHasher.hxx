@@ -37,6 +37,10 @@ public:
   //! @return a computed hash code, in the range [1, theUpperBound]
   static Standard_Integer HashCode (const TopoDS_Shape& theShape, const Standard_Integer theUpperBound);
 
+  //! Returns the full-width hash code of the given shape
+  //! (see NCollection_HasherTraits)
+  static Standard_Size HashCode (const TopoDS_Shape& theShape);
+
   //! Returns True when the two keys are equal. Two same
   //! keys must have the same hashcode,  the contrary is
   //! not necessary.
@@ -18,7 +18,6 @@
 #include <Standard_NullObject.hxx>
 #include <TopoDS_Builder.hxx>
 #include <TopoDS_FrozenShape.hxx>
-#include <TopoDS_ListIteratorOfListOfShape.hxx>
 #include <TopoDS_Shape.hxx>
 #include <TopoDS_TShape.hxx>
 #include <TopoDS_TWire.hxx>
@@ -88,9 +87,7 @@ void TopoDS_Builder::Add (TopoDS_Shape& aShape,
     const unsigned int iS=(unsigned int)aShape.ShapeType();
     //
     if ((aTb[iC] & (1<<iS)) != 0) {
-      TopoDS_ListOfShape& L = aShape.TShape()->myShapes;
-      L.Append(aComponent);
-      TopoDS_Shape& S = L.Last();
+      TopoDS_Shape& S = aShape.TShape()->myShapes.Append(aComponent);
       //
       // compute the relative Orientation
       if (aShape.Orientation() == TopAbs_REVERSED)
@@ -131,14 +128,12 @@ void TopoDS_Builder::Remove (TopoDS_Shape& aShape,
     S.Reverse();
   S.Location(S.Location().Predivided(aShape.Location()), Standard_False);
 
-  TopoDS_ListOfShape& L = aShape.TShape()->myShapes;
-  TopoDS_ListIteratorOfListOfShape It(L);
-  while (It.More()) {
-    if (It.Value() == S) {
-      L.Remove(It);
+  NCollection_CompactVector<TopoDS_Shape>& L = aShape.TShape()->myShapes;
+  for (Standard_Integer i = 0; i < L.Size(); ++i) {
+    if (L(i) == S) {
+      L.Remove(i);
       aShape.TShape()->Modified(Standard_True);
       break;
     }
-    It.Next();
   }
 }
@@ -36,15 +36,17 @@ void TopoDS_Iterator::Initialize(const TopoDS_Shape& S,
     myOrientation = TopAbs_FORWARD;
 
   if (S.IsNull())
-    myShapes = TopoDS_ListIteratorOfListOfShape();
+    myShapes = NCollection_CompactVector<TopoDS_Shape>::Iterator();
   else
-    myShapes.Initialize(S.TShape()->myShapes);
+    myShapes.Init(S.TShape()->myShapes);
 
   if (More()) {
     myShape = myShapes.Value();
     myShape.Orientation(TopAbs::Compose(myOrientation,myShape.Orientation()));
-    if (!myLocation.IsIdentity())
+    if (!myLocation.IsIdentity()) {
+      myRawLocation = myShape.Location();
       myShape.Move(myLocation, Standard_False);
+    }
   }
 }
 
@@ -55,11 +57,28 @@ void TopoDS_Iterator::Initialize(const TopoDS_Shape& S,
 
 void TopoDS_Iterator::Next()
 {
-  myShapes.Next();
+  // if the current sub-shape or a preceding one has been removed from the shape,
+  // the following sub-shapes are shifted and the next one takes the current index
+  if (!myShapes.More() || isCurrent (myShapes.Value()))
+    myShapes.Next();
   if (More()) {
     myShape = myShapes.Value();
     myShape.Orientation(TopAbs::Compose(myOrientation,myShape.Orientation()));
-    if (!myLocation.IsIdentity())
+    if (!myLocation.IsIdentity()) {
+      myRawLocation = myShape.Location();
       myShape.Move(myLocation, Standard_False);
+    }
   }
 }
+
+//=======================================================================
+//function : isCurrent
+//purpose  : 
+//=======================================================================
+
+Standard_Boolean TopoDS_Iterator::isCurrent (const TopoDS_Shape& theSubShape) const
+{
+  return theSubShape.TShape() == myShape.TShape()
+      && TopAbs::Compose (myOrientation, theSubShape.Orientation()) == myShape.Orientation()
+      && theSubShape.Location() == (myLocation.IsIdentity() ? myShape.Location() : myRawLocation);
+}
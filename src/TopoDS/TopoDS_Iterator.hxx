@@ -19,7 +19,6 @@
 
 #include <Standard_NoSuchObject.hxx>
 #include <TopoDS_Shape.hxx>
-#include <TopoDS_ListIteratorOfListOfShape.hxx>
 #include <TopAbs_Orientation.hxx>
 #include <TopLoc_Location.hxx>
 
@@ -66,6 +65,11 @@ public:
 
   //! Moves on to the next sub-shape in the shape which
   //! this iterator is scanning.
+  //! The current sub-shape may be removed from the shape and new
+  //! sub-shapes may be added to it before the call; the iterator then
+  //! moves on to the sub-shape which followed the removed one.
+  //! Removing more than one sub-shape at or before the current one
+  //! between two calls makes the iterator skip sub-shapes.
   //! Exceptions
   //! Standard_NoMoreObject if there are no more sub-shapes in the shape.
   Standard_EXPORT void Next();
@@ -80,12 +84,18 @@ public:
     return myShape;
   }
 
+private:
+
+  //! Returns true if the sub-shape stored in the shape is the current one.
+  Standard_Boolean isCurrent (const TopoDS_Shape& theSubShape) const;
+
 private:
 
   TopoDS_Shape myShape;
-  TopoDS_ListIteratorOfListOfShape myShapes;
+  NCollection_CompactVector<TopoDS_Shape>::Iterator myShapes;
   TopAbs_Orientation myOrientation;
   TopLoc_Location myLocation;
+  TopLoc_Location myRawLocation;
 
 };
 
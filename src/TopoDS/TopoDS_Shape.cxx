@@ -28,10 +28,19 @@
 //=======================================================================
 Standard_Integer TopoDS_Shape::HashCode (const Standard_Integer theUpperBound) const
 {
-  // PKV
-  const Standard_Integer aHS = ::HashCode (myTShape.get(), theUpperBound);
-  const Standard_Integer aHL = myLocation.HashCode (theUpperBound);
-  return ::HashCode (aHS ^ aHL, theUpperBound);
+  return static_cast<Standard_Integer> (HashCode() % static_cast<Standard_Size> (theUpperBound)) + 1;
+}
+
+//=======================================================================
+// function : HashCode
+// purpose  :
+//=======================================================================
+Standard_Size TopoDS_Shape::HashCode() const
+{
+  // the TShapes are aligned in memory, thus the lower bits of the address are dropped
+  const Standard_Size aHS = reinterpret_cast<Standard_Size> (myTShape.get()) >> 3;
+  const Standard_Size aHL = myLocation.HashCode();
+  return aHS ^ (aHL + 0x9e3779b9 + (aHS << 6) + (aHS >> 2));
 }
 
 //=======================================================================
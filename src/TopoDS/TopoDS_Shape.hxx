@@ -285,6 +285,10 @@ public:
   //! @return a computed hash code, in the range [1, theUpperBound]
   Standard_EXPORT Standard_Integer HashCode (Standard_Integer theUpperBound) const;
 
+  //! Returns a full-width hashed value denoting <me>. It is computed from the
+  //! TShape and the memoized hash code of the Location. The Orientation is not used.
+  Standard_EXPORT Standard_Size HashCode() const;
+
   //! Replace   <me> by  a  new   Shape with the    same
   //! Orientation and Location and a new TShape with the
   //! same geometry and no sub-shapes.
@@ -0,0 +1,254 @@
+// Copyright (c) 2024 OPEN CASCADE SAS
+//
+// This file is part of Open CASCADE Technology software library.
+//
+// This library is free software; you can redistribute it and/or modify it under
+// the terms of the GNU Lesser General Public License version 2.1 as published
+// by the Free Software Foundation, with special exception defined in the file
+// OCCT_LGPL_EXCEPTION.txt. Consult the file LICENSE_LGPL_21.txt included in OCCT
+// distribution for complete text of the license and disclaimer of any warranty.
+//
+// Alternatively, this file may be used under the terms of Open CASCADE
+// commercial license or contractual agreement.
+
+#include <TopoDS_ShapeIndex.hxx>
+
+#include <NCollection_Map.hxx>
+#include <TopAbs.hxx>
+#include <TopoDS_Iterator.hxx>
+
+IMPLEMENT_STANDARD_RTTIEXT(TopoDS_ShapeIndex, Standard_Transient)
+
+namespace
+{
+  //! Packs the id and the orientation into the entry of the compressed row
+  static Standard_Integer packEntry (const Standard_Integer theId,
+                                     const TopAbs_Orientation theOrientation)
+  {
+    return (theId << 2) | (Standard_Integer )theOrientation;
+  }
+}
+
+//=======================================================================
+//function : TopoDS_ShapeIndex
+//purpose  :
+//=======================================================================
+TopoDS_ShapeIndex::TopoDS_ShapeIndex()
+{
+  for (Standard_Integer aTypeIter = 0; aTypeIter <= TopAbs_SHAPE + 1; ++aTypeIter)
+  {
+    myFirstIds[aTypeIter] = 1;
+  }
+}
+
+//=======================================================================
+//function : TopoDS_ShapeIndex
+//purpose  :
+//=======================================================================
+TopoDS_ShapeIndex::TopoDS_ShapeIndex (const TopoDS_Shape& theShape)
+{
+  Build (theShape);
+}
+
+//=======================================================================
+//function : Build
+//purpose  :
+//=======================================================================
+void TopoDS_ShapeIndex::Build (const TopoDS_Shape& theShape)
+{
+  myShape = theShape;
+  myIds.Clear();
+  for (Standard_Integer aTypeIter = 0; aTypeIter <= TopAbs_SHAPE + 1; ++aTypeIter)
+  {
+    myFirstIds[aTypeIter] = 1;
+  }
+  if (theShape.IsNull())
+  {
+    myShapes      = NCollection_Array1<TopoDS_Shape>();
+    myChildStart  = NCollection_Array1<Standard_Integer>();
+    myChildren    = NCollection_Array1<Standard_Integer>();
+    myParentStart = NCollection_Array1<Standard_Integer>();
+    myParents     = NCollection_Array1<Standard_Integer>();
+    return;
+  }
+
+  // collect the unique sub-shapes in the depth-first order of their first occurrence,
+  // the ids are assigned after grouping of the sub-shapes by type
+  NCollection_Vector<TopoDS_Shape> aShapes;
+  NCollection_Vector<TopoDS_Iterator> aStack;
+  Standard_Integer aDepth = 0;
+  Standard_Integer aNbEntries = 0;
+  myIds.Bind (theShape, 0);
+  aShapes.Append (theShape);
+  aStack.SetValue (aDepth, TopoDS_Iterator (theShape));
+  while (aDepth >= 0)
+  {
+    TopoDS_Iterator& anIter = aStack.ChangeValue (aDepth);
+    if (!anIter.More())
+    {
+      --aDepth;
+      continue;
+    }
+
+    const TopoDS_Shape& aChild = anIter.Value();
+    ++aNbEntries;
+    if (myIds.Bind (aChild, 0))
+    {
+      aShapes.Append (aChild);
+      anIter.Next();
+      aStack.SetValue (++aDepth, TopoDS_Iterator (aShapes.Last()));
+    }
+    else
+    {
+      anIter.Next();
+    }
+  }
+
+  // group the sub-shapes by type keeping their order
+  const Standard_Integer aNbShapes = aShapes.Length();
+  Standard_Integer aNbOfType[TopAbs_SHAPE + 1] = {};
+  for (NCollection_Vector<TopoDS_Shape>::Iterator aShapeIter (aShapes); aShapeIter.More(); aShapeIter.Next())
+  {
+    ++aNbOfType[aShapeIter.Value().ShapeType()];
+  }
+  for (Standard_Integer aTypeIter = 0; aTypeIter <= TopAbs_SHAPE; ++aTypeIter)
+  {
+    myFirstIds[aTypeIter + 1] = myFirstIds[aTypeIter] + aNbOfType[aTypeIter];
+  }
+
+  Standard_Integer aNextIds[TopAbs_SHAPE + 1];
+  for (Standard_Integer aTypeIter = 0; aTypeIter <= TopAbs_SHAPE; ++aTypeIter)
+  {
+    aNextIds[aTypeIter] = myFirstIds[aTypeIter];
+  }
+  myShapes.Resize (1, aNbShapes, Standard_False);
+  for (Standard_Integer anIndex = 0; anIndex < aNbShapes; ++anIndex)
+  {
+    const TopoDS_Shape& aShape = aShapes (anIndex);
+    const Standard_Integer anId = aNextIds[aShape.ShapeType()]++;
+    myShapes (anId) = aShape;
+    *myIds.ChangeSeek (aShape) = anId;
+  }
+
+  // fill the children with the orientations not composed with the parent one
+  myChildStart.Resize (0, aNbShapes, Standard_False);
+  myChildren.Resize (0, Max (aNbEntries - 1, 0), Standard_False);
+  NCollection_Array1<Standard_Integer> aNbParents (0, aNbShapes);
+  aNbParents.Init (0);
+  Standard_Integer anEntry = 0;
+  myChildStart (0) = 0;
+  for (Standard_Integer anId = 1; anId <= aNbShapes; ++anId)
+  {
+    for (TopoDS_Iterator aChildIter (myShapes (anId), Standard_False); aChildIter.More(); aChildIter.Next())
+    {
+      const TopoDS_Shape& aChild = aChildIter.Value();
+      const Standard_Integer aChildId = *myIds.Seek (aChild);
+      myChildren (anEntry++) = packEntry (aChildId, aChild.Orientation());
+      ++aNbParents (aChildId);
+    }
+    myChildStart (anId) = anEntry;
+  }
+
+  // fill the parents by inversion of the children
+  myParentStart.Resize (0, aNbShapes, Standard_False);
+  myParents.Resize (0, Max (aNbEntries - 1, 0), Standard_False);
+  myParentStart (0) = 0;
+  for (Standard_Integer anId = 1; anId <= aNbShapes; ++anId)
+  {
+    myParentStart (anId) = myParentStart (anId - 1) + aNbParents (anId);
+    aNbParents (anId) = myParentStart (anId - 1);
+  }
+  for (Standard_Integer anId = 1; anId <= aNbShapes; ++anId)
+  {
+    for (Standard_Integer anEntryIter = myChildStart (anId - 1); anEntryIter < myChildStart (anId); ++anEntryIter)
+    {
+      const Standard_Integer aChildEntry = myChildren (anEntryIter);
+      myParents (aNbParents (aChildEntry >> 2)++) = packEntry (anId, (TopAbs_Orientation )(aChildEntry & 3));
+    }
+  }
+}
+
+//=======================================================================
+//function : Ancestors
+//purpose  :
+//=======================================================================
+void TopoDS_ShapeIndex::Ancestors (const Standard_Integer theId,
+                                   const TopAbs_ShapeEnum theType,
+                                   NCollection_Vector<Standard_Integer>& theAncestors) const
+{
+  Standard_OutOfRange_Raise_if (theId < 1 || theId > NbShapes(), "TopoDS_ShapeIndex::Ancestors");
+
+  // breadth-first traversal of the parents
+  NCollection_Map<Standard_Integer> aVisited;
+  NCollection_Vector<Standard_Integer> aQueue;
+  aQueue.Append (theId);
+  for (Standard_Integer aQueueIter = 0; aQueueIter < aQueue.Length(); ++aQueueIter)
+  {
+    const Standard_Integer anId = aQueue (aQueueIter);
+    for (Standard_Integer anEntryIter = myParentStart (anId - 1); anEntryIter < myParentStart (anId); ++anEntryIter)
+    {
+      const Standard_Integer aParentId = myParents (anEntryIter) >> 2;
+      if (!aVisited.Add (aParentId))
+      {
+        continue;
+      }
+      if (myShapes (aParentId).ShapeType() == theType)
+      {
+        theAncestors.Append (aParentId);
+      }
+      aQueue.Append (aParentId);
+    }
+  }
+}
+
+//=======================================================================
+//function : SubShapes
+//purpose  :
+//=======================================================================
+void TopoDS_ShapeIndex::SubShapes (const Standard_Integer theId,
+                                   const TopAbs_ShapeEnum theType,
+                                   NCollection_Vector<Standard_Integer>& theSubShapes) const
+{
+  Standard_OutOfRange_Raise_if (theId < 1 || theId > NbShapes(), "TopoDS_ShapeIndex::SubShapes");
+
+  // depth-first traversal of the children not going deeper than the shapes of the given type,
+  // the pairs of the id and the position of its next child are kept in the stack
+  NCollection_Map<Standard_Integer> aVisited;
+  aVisited.Add (theId);
+  if (myShapes (theId).ShapeType() == theType)
+  {
+    theSubShapes.Append (theId);
+    return;
+  }
+
+  NCollection_Vector<Standard_Integer> aStack;
+  Standard_Integer aTop = 0;
+  aStack.SetValue (0, theId);
+  aStack.SetValue (1, myChildStart (theId - 1));
+  while (aTop >= 0)
+  {
+    const Standard_Integer anId = aStack (aTop);
+    if (myShapes (anId).ShapeType() >= theType
+     || aStack (aTop + 1) == myChildStart (anId))
+    {
+      aTop -= 2;
+      continue;
+    }
+
+    const Standard_Integer aChildId = myChildren (aStack (aTop + 1)++) >> 2;
+    if (!aVisited.Add (aChildId))
+    {
+      continue;
+    }
+    if (myShapes (aChildId).ShapeType() == theType)
+    {
+      theSubShapes.Append (aChildId);
+    }
+    else
+    {
+      aTop += 2;
+      aStack.SetValue (aTop, aChildId);
+      aStack.SetValue (aTop + 1, myChildStart (aChildId - 1));
+    }
+  }
+}
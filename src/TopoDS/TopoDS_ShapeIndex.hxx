@@ -0,0 +1,193 @@
+// Copyright (c) 2024 OPEN CASCADE SAS
+//
+// This file is part of Open CASCADE Technology software library.
+//
+// This library is free software; you can redistribute it and/or modify it under
+// the terms of the GNU Lesser General Public License version 2.1 as published
+// by the Free Software Foundation, with special exception defined in the file
+// OCCT_LGPL_EXCEPTION.txt. Consult the file LICENSE_LGPL_21.txt included in OCCT
+// distribution for complete text of the license and disclaimer of any warranty.
+//
+// Alternatively, this file may be used under the terms of Open CASCADE
+// commercial license or contractual agreement.
+
+#ifndef _TopoDS_ShapeIndex_HeaderFile
+#define _TopoDS_ShapeIndex_HeaderFile
+
+#include <NCollection_Array1.hxx>
+#include <NCollection_FlatDataMap.hxx>
+#include <NCollection_Vector.hxx>
+#include <Standard_OutOfRange.hxx>
+#include <Standard_Transient.hxx>
+#include <TopAbs_Orientation.hxx>
+#include <TopAbs_ShapeEnum.hxx>
+#include <TopoDS_Shape.hxx>
+
+//! Read-only index of the topology of the shape, built once from the shape.
+//!
+//! Each sub-shape of the shape (including the shape itself) gets the integer id
+//! in the range [1, NbShapes()]. The sub-shapes are identified as the same
+//! (TopoDS_Shape::IsSame()), i.e. by TShape and Location, so that the id does
+//! not depend on the orientation. The ids are grouped by the type of the
+//! sub-shapes: the ids of the sub-shapes of the type T are in the range
+//! [FirstId (T), FirstId (T) + NbShapes (T) - 1] and are ordered in the same way
+//! as the sub-shapes of the type T in the map filled by TopExp::MapShapes (theShape, M).
+//!
+//! The children and the parents of the sub-shapes are stored in the compressed
+//! sparse row arrays together with the orientation of the child in the parent,
+//! thus the access to them by id takes constant time without hashing. The
+//! ancestors of the given type (e.g. the faces of the edge) are found by the
+//! upward traversal of the parents.
+//!
+//! The index is not updated on modification of the shape.
+class TopoDS_ShapeIndex : public Standard_Transient
+{
+  DEFINE_STANDARD_RTTIEXT(TopoDS_ShapeIndex, Standard_Transient)
+public:
+
+  //! Creates the empty index.
+  Standard_EXPORT TopoDS_ShapeIndex();
+
+  //! Creates the index of the shape.
+  Standard_EXPORT TopoDS_ShapeIndex (const TopoDS_Shape& theShape);
+
+  //! Builds the index of the shape, the previous content is released.
+  Standard_EXPORT void Build (const TopoDS_Shape& theShape);
+
+  //! Returns the indexed shape.
+  const TopoDS_Shape& Shape() const { return myShape; }
+
+  //! Returns the number of the sub-shapes of the shape (including itself).
+  Standard_Integer NbShapes() const { return myShapes.Size(); }
+
+  //! Returns the number of the sub-shapes of the given type.
+  Standard_Integer NbShapes (const TopAbs_ShapeEnum theType) const
+  {
+    return myFirstIds[theType + 1] - myFirstIds[theType];
+  }
+
+  //! Returns the first id of the sub-shapes of the given type.
+  Standard_Integer FirstId (const TopAbs_ShapeEnum theType) const { return myFirstIds[theType]; }
+
+  //! Returns the sub-shape with the given id, with the orientation of its
+  //! first occurrence in the shape and with the composed location.
+  const TopoDS_Shape& Shape (const Standard_Integer theId) const { return myShapes (theId); }
+
+  //! Returns the type of the sub-shape with the given id.
+  TopAbs_ShapeEnum ShapeType (const Standard_Integer theId) const { return myShapes (theId).ShapeType(); }
+
+  //! Returns the id of the sub-shape, or 0 if it is not the sub-shape of the shape.
+  Standard_Integer Id (const TopoDS_Shape& theShape) const
+  {
+    const Standard_Integer* anId = myIds.Seek (theShape);
+    return anId != NULL ? *anId : 0;
+  }
+
+  //! Returns the number of the children of the sub-shape.
+  Standard_Integer NbChildren (const Standard_Integer theId) const
+  {
+    Standard_OutOfRange_Raise_if (theId < 1 || theId > NbShapes(), "TopoDS_ShapeIndex::NbChildren");
+    return myChildStart[theId] - myChildStart[theId - 1];
+  }
+
+  //! Returns the id of the child of the sub-shape, theIndex is in the range [1, NbChildren (theId)].
+  Standard_Integer Child (const Standard_Integer theId, const Standard_Integer theIndex) const
+  {
+    return entryId (myChildren, myChildStart, theId, theIndex);
+  }
+
+  //! Returns the orientation of the child in the sub-shape (not composed
+  //! with the orientation of the sub-shape itself).
+  TopAbs_Orientation ChildOrientation (const Standard_Integer theId, const Standard_Integer theIndex) const
+  {
+    return entryOrientation (myChildren, myChildStart, theId, theIndex);
+  }
+
+  //! Returns the number of the parents of the sub-shape.
+  Standard_Integer NbParents (const Standard_Integer theId) const
+  {
+    Standard_OutOfRange_Raise_if (theId < 1 || theId > NbShapes(), "TopoDS_ShapeIndex::NbParents");
+    return myParentStart[theId] - myParentStart[theId - 1];
+  }
+
+  //! Returns the id of the parent of the sub-shape, theIndex is in the range [1, NbParents (theId)].
+  //! The parent containing the sub-shape several times is returned for each occurrence.
+  Standard_Integer Parent (const Standard_Integer theId, const Standard_Integer theIndex) const
+  {
+    return entryId (myParents, myParentStart, theId, theIndex);
+  }
+
+  //! Returns the orientation of the sub-shape in the parent.
+  TopAbs_Orientation ParentOrientation (const Standard_Integer theId, const Standard_Integer theIndex) const
+  {
+    return entryOrientation (myParents, myParentStart, theId, theIndex);
+  }
+
+  //! Appends to the vector the ids of the unique ancestors of the given type of the sub-shape,
+  //! e.g. the faces of the edge or the edges of the vertex.
+  Standard_EXPORT void Ancestors (const Standard_Integer theId,
+                                  const TopAbs_ShapeEnum theType,
+                                  NCollection_Vector<Standard_Integer>& theAncestors) const;
+
+  //! Appends to the vector the ids of the unique sub-shapes of the given type of the sub-shape,
+  //! e.g. the edges of the face, in the order of exploration by TopExp_Explorer.
+  Standard_EXPORT void SubShapes (const Standard_Integer theId,
+                                  const TopAbs_ShapeEnum theType,
+                                  NCollection_Vector<Standard_Integer>& theSubShapes) const;
+
+private:
+
+  //! Returns the id of the entry of the compressed row
+  Standard_Integer entryId (const NCollection_Array1<Standard_Integer>& theEntries,
+                            const NCollection_Array1<Standard_Integer>& theStart,
+                            const Standard_Integer theId,
+                            const Standard_Integer theIndex) const
+  {
+    Standard_OutOfRange_Raise_if (theId < 1 || theId > NbShapes()
+                               || theIndex < 1 || theIndex > theStart[theId] - theStart[theId - 1],
+                                  "TopoDS_ShapeIndex, index out of range");
+    return theEntries[theStart[theId - 1] + theIndex - 1] >> 2;
+  }
+
+  //! Returns the orientation of the entry of the compressed row
+  TopAbs_Orientation entryOrientation (const NCollection_Array1<Standard_Integer>& theEntries,
+                                       const NCollection_Array1<Standard_Integer>& theStart,
+                                       const Standard_Integer theId,
+                                       const Standard_Integer theIndex) const
+  {
+    Standard_OutOfRange_Raise_if (theId < 1 || theId > NbShapes()
+                               || theIndex < 1 || theIndex > theStart[theId] - theStart[theId - 1],
+                                  "TopoDS_ShapeIndex, index out of range");
+    return (TopAbs_Orientation )(theEntries[theStart[theId - 1] + theIndex - 1] & 3);
+  }
+
+  //! Hasher identifying the same sub-shapes
+  struct ShapeHasher
+  {
+    static Standard_Size HashCode (const TopoDS_Shape& theShape) { return theShape.HashCode(); }
+    static Standard_Integer HashCode (const TopoDS_Shape& theShape, const Standard_Integer theUpperBound)
+    {
+      return theShape.HashCode (theUpperBound);
+    }
+    static Standard_Boolean IsEqual (const TopoDS_Shape& theShape1, const TopoDS_Shape& theShape2)
+    {
+      return theShape1.IsSame (theShape2);
+    }
+  };
+
+private:
+
+  TopoDS_Shape                         myShape;         //!< indexed shape
+  NCollection_Array1<TopoDS_Shape>     myShapes;        //!< sub-shapes by id
+  NCollection_FlatDataMap<TopoDS_Shape, Standard_Integer, ShapeHasher> myIds; //!< ids of the sub-shapes
+  Standard_Integer                     myFirstIds[TopAbs_SHAPE + 2]; //!< first ids of the types
+  NCollection_Array1<Standard_Integer> myChildStart;    //!< start of the children of the sub-shape with id (i + 1)
+  NCollection_Array1<Standard_Integer> myChildren;      //!< child id and orientation packed as (id << 2 | orientation)
+  NCollection_Array1<Standard_Integer> myParentStart;   //!< start of the parents of the sub-shape with id (i + 1)
+  NCollection_Array1<Standard_Integer> myParents;       //!< parent id and orientation packed as (id << 2 | orientation)
+
+};
+
+DEFINE_STANDARD_HANDLE(TopoDS_ShapeIndex, Standard_Transient)
+
+#endif // _TopoDS_ShapeIndex_HeaderFile
@@ -19,6 +19,7 @@
 
 #include <TopAbs.hxx>
 #include <TopAbs_ShapeEnum.hxx>
+#include <NCollection_CompactVector.hxx>
 #include <TopoDS_ListOfShape.hxx>
 
 
@@ -172,7 +173,7 @@ private:
 
 private:
 
-  TopoDS_ListOfShape myShapes;
+  NCollection_CompactVector<TopoDS_Shape> myShapes; //!< sub-shapes (children) in the contiguous memory block
   Standard_Integer   myFlags;
 };
 
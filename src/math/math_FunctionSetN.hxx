@@ -0,0 +1,80 @@
+// Copyright (c) 2024 OPEN CASCADE SAS
+//
+// This file is part of Open CASCADE Technology software library.
+//
+// This library is free software; you can redistribute it and/or modify it under
+// the terms of the GNU Lesser General Public License version 2.1 as published
+// by the Free Software Foundation, with special exception defined in the file
+// OCCT_LGPL_EXCEPTION.txt. Consult the file LICENSE_LGPL_21.txt included in OCCT
+// distribution for complete text of the license and disclaimer of any warranty.
+//
+// Alternatively, this file may be used under the terms of Open CASCADE
+// commercial license or contractual agreement.
+
+#ifndef _math_FunctionSetN_HeaderFile
+#define _math_FunctionSetN_HeaderFile
+
+#include <math_FunctionSetWithDerivatives.hxx>
+#include <math_MatrixN.hxx>
+
+//! Adapter of math_FunctionSetWithDerivatives with N variables and N equations
+//! to the vectors and matrices of the fixed dimension.
+//! The arguments are passed to the function as math_Vector and math_Matrix
+//! wrapping the storage of math_VectorN and math_MatrixN without copying,
+//! so that the evaluation does not allocate memory.
+template<Standard_Integer N>
+class math_FunctionSetN
+{
+public:
+
+  //! Constructor; the function must have N variables and N equations.
+  math_FunctionSetN (math_FunctionSetWithDerivatives& theFunction)
+  : myFunction (theFunction)
+  {
+    Standard_DimensionError_Raise_if (theFunction.NbVariables() != N || theFunction.NbEquations() != N,
+                                      "math_FunctionSetN - dimensions mismatch");
+  }
+
+  //! Returns the adapted function.
+  math_FunctionSetWithDerivatives& Function() const { return myFunction; }
+
+  //! Computes the values of the functions for the variable theX.
+  Standard_Boolean Value (const math_VectorN<N>& theX,
+                          math_VectorN<N>& theF) const
+  {
+    const math_Vector aX (theX.Data(), 1, N);
+    math_Vector aF (theF.ChangeData(), 1, N);
+    return myFunction.Value (aX, aF);
+  }
+
+  //! Computes the derivatives of the functions for the variable theX.
+  Standard_Boolean Derivatives (const math_VectorN<N>& theX,
+                                math_MatrixN<N, N>& theD) const
+  {
+    const math_Vector aX (theX.Data(), 1, N);
+    math_Matrix aD (theD.ChangeData(), 1, N, 1, N);
+    return myFunction.Derivatives (aX, aD);
+  }
+
+  //! Computes the values and the derivatives of the functions for the variable theX.
+  Standard_Boolean Values (const math_VectorN<N>& theX,
+                           math_VectorN<N>& theF,
+                           math_MatrixN<N, N>& theD) const
+  {
+    const math_Vector aX (theX.Data(), 1, N);
+    math_Vector aF (theF.ChangeData(), 1, N);
+    math_Matrix aD (theD.ChangeData(), 1, N, 1, N);
+    return myFunction.Values (aX, aF, aD);
+  }
+
+  //! Returns the state of the function corresponding to the latest call of any methods
+  //! associated with the function.
+  Standard_Integer GetStateNumber() const { return myFunction.GetStateNumber(); }
+
+private:
+
+  math_FunctionSetWithDerivatives& myFunction;
+
+};
+
+#endif // _math_FunctionSetN_HeaderFile
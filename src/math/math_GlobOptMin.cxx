@@ -19,10 +19,27 @@
 #include <math_MultipleVarFunctionWithHessian.hxx>
 #include <math_NewtonMinimum.hxx>
 #include <math_Powell.hxx>
+#include <OSD_ThreadPool.hxx>
+#include <OSD_Timer.hxx>
 #include <Standard_Integer.hxx>
 #include <Standard_Real.hxx>
 #include <Precision.hxx>
 
+namespace
+{
+  //! Result of the search in the slab of the box.
+  struct SlabResult
+  {
+    NCollection_Sequence<Standard_Real> Points; // Solutions.
+    Standard_Integer NbSol; // Count of solutions.
+    Standard_Real F; // Best functional value.
+    Standard_Integer NbEvaluations; // Count of functional evaluations.
+    Standard_Integer NbLocalSearches; // Count of local optimizations.
+
+    SlabResult() : NbSol(0), F(RealLast()), NbEvaluations(0), NbLocalSearches(0) {}
+  };
+}
+
 //=======================================================================
 //function : DistanceToBorder
 //purpose  :
@@ -68,7 +85,11 @@ math_GlobOptMin::math_GlobOptMin(math_MultipleVarFunction* theFunc,
   myCellSize(0, myN - 1),
   myFilter(theFunc->NbVariables()),
   myCont(2),
-  myF(Precision::Infinite())
+  myF(Precision::Infinite()),
+  mySharedF(NULL),
+  myNbEvaluations(0),
+  myNbLocalSearches(0),
+  myElapsedTime(0.0)
 {
   Standard_Integer i;
 
@@ -201,8 +222,212 @@ void math_GlobOptMin::GetTol(Standard_Real& theDiscretizationTol,
 // In this algo indexes started from 1, not from 0.
 void math_GlobOptMin::Perform(const Standard_Boolean isFindSingleSolution)
 {
+  OSD_Timer aTimer;
+  aTimer.Start();
+  myDone = Standard_False;
+  myNbEvaluations = 0;
+  myNbLocalSearches = 0;
+
+  if (!prepareSearch(isFindSingleSolution))
+  {
+    myElapsedTime = aTimer.ElapsedTime();
+    return;
+  }
+
+  // Search single solution and current solution in its neighborhood.
+  if (!CheckFunctionalStopCriteria())
+  {
+    myLastStep = 0.0;
+    isFirstCellFilterInvoke = Standard_True;
+    computeGlobalExtremum(myN);
+  }
+
+  myDone = Standard_True;
+  myElapsedTime = aTimer.ElapsedTime();
+}
+
+//=======================================================================
+//class    : SlabFunctor
+//purpose  : Searches the slabs of the box of the last variable,
+//           each thread uses its own copy of the functional
+//=======================================================================
+class math_GlobOptMin::SlabFunctor
+{
+public:
+
+  SlabFunctor(const math_GlobOptMin& theParent,
+              const NCollection_Array1<math_MultipleVarFunction*>& theFunctions,
+              NCollection_Array1<SlabResult>& theResults,
+              std::atomic<Standard_Real>& theSharedF)
+  : myParent(theParent),
+    myFunctions(theFunctions),
+    myResults(theResults),
+    mySharedF(theSharedF)
+  {
+    //
+  }
+
+  void operator()(int theThreadIndex,
+                  int theSlabIndex) const
+  {
+    const Standard_Integer aN = myParent.myN;
+    const Standard_Real aStep = (myParent.mySweepB - myParent.mySweepA) / myResults.Size();
+    const Standard_Real aSlabA = myParent.mySweepA + aStep * theSlabIndex;
+    const Standard_Real aSlabB = theSlabIndex == myResults.Upper() ? myParent.mySweepB : aSlabA + aStep;
+
+    math_GlobOptMin aSlab(myParent, myFunctions(myFunctions.Lower() + theThreadIndex),
+                          aSlabA, aSlabB, &mySharedF);
+    if (!aSlab.CheckFunctionalStopCriteria())
+    {
+      aSlab.computeGlobalExtremum(aN);
+    }
+
+    SlabResult& aResult = myResults.ChangeValue(theSlabIndex);
+    aResult.Points = aSlab.myY;
+    aResult.NbSol = aSlab.mySolCount;
+    aResult.F = aSlab.myF;
+    aResult.NbEvaluations = aSlab.myNbEvaluations;
+    aResult.NbLocalSearches = aSlab.myNbLocalSearches;
+  }
+
+private:
+  SlabFunctor(const SlabFunctor&);
+  SlabFunctor& operator=(const SlabFunctor&);
+
+private:
+  const math_GlobOptMin& myParent;
+  const NCollection_Array1<math_MultipleVarFunction*>& myFunctions;
+  NCollection_Array1<SlabResult>& myResults;
+  std::atomic<Standard_Real>& mySharedF;
+};
+
+//=======================================================================
+//function : Perform
+//purpose  : Compute Global extremum point in parallel threads
+//=======================================================================
+void math_GlobOptMin::Perform(const NCollection_Array1<math_MultipleVarFunction*>& theFunctions,
+                              const Standard_Boolean isFindSingleSolution)
+{
+  OSD_Timer aTimer;
+  aTimer.Start();
   myDone = Standard_False;
+  myNbEvaluations = 0;
+  myNbLocalSearches = 0;
+
+  if (!prepareSearch(isFindSingleSolution))
+  {
+    myElapsedTime = aTimer.ElapsedTime();
+    return;
+  }
+
+  if (CheckFunctionalStopCriteria())
+  {
+    myDone = Standard_True;
+    myElapsedTime = aTimer.ElapsedTime();
+    return;
+  }
+
+  // The cost of the search differs much between the slabs,
+  // so the slabs are more numerous than the threads to balance the load.
+  // The slab should be wide enough to have several steps of the search.
+  OSD_ThreadPool::Launcher aLauncher(*OSD_ThreadPool::DefaultPool(), theFunctions.Size());
+  const Standard_Real aLength = mySweepB - mySweepA;
+  const Standard_Integer aNbSlabs = (Standard_Integer)Min(4.0 * aLauncher.NbThreads(),
+                                                          aLength / (10.0 * myE2));
+  if (aLauncher.NbThreads() < 2 || aNbSlabs < 2)
+  {
+    myLastStep = 0.0;
+    isFirstCellFilterInvoke = Standard_True;
+    computeGlobalExtremum(myN);
+
+    myDone = Standard_True;
+    myElapsedTime = aTimer.ElapsedTime();
+    return;
+  }
+
+  std::atomic<Standard_Real> aSharedF(myF);
+  NCollection_Array1<SlabResult> aResults(0, aNbSlabs - 1);
+  SlabFunctor aFunctor(*this, theFunctions, aResults, aSharedF);
+  aLauncher.Perform(0, aNbSlabs, aFunctor, 1);
+
+  // Merge solutions of the slabs, the initial solution
+  // copied to the slabs is filtered as duplicate.
+  isFirstCellFilterInvoke = Standard_True;
+  math_Vector aPnt(1, myN);
+  for (Standard_Integer aSlabIdx = aResults.Lower(); aSlabIdx <= aResults.Upper(); ++aSlabIdx)
+  {
+    const SlabResult& aResult = aResults(aSlabIdx);
+    myNbEvaluations += aResult.NbEvaluations;
+    myNbLocalSearches += aResult.NbLocalSearches;
+    for (Standard_Integer aSolIdx = 0; aSolIdx < aResult.NbSol; ++aSolIdx)
+    {
+      for (Standard_Integer j = 1; j <= myN; j++)
+        aPnt(j) = aResult.Points(aSolIdx * myN + j);
+
+      checkAddCandidate(aPnt, aResult.F);
+    }
+  }
+
+  myDone = Standard_True;
+  myElapsedTime = aTimer.ElapsedTime();
+}
 
+//=======================================================================
+//function : math_GlobOptMin
+//purpose  : Constructor of the search in the slab of the box
+//=======================================================================
+math_GlobOptMin::math_GlobOptMin(const math_GlobOptMin& theParent,
+                                 math_MultipleVarFunction* theFunc,
+                                 const Standard_Real theSlabA,
+                                 const Standard_Real theSlabB,
+                                 std::atomic<Standard_Real>* theSharedF)
+: myFunc(theFunc),
+  myN(theParent.myN),
+  myA(theParent.myA),
+  myB(theParent.myB),
+  myGlobA(theParent.myGlobA),
+  myGlobB(theParent.myGlobB),
+  myTol(theParent.myTol),
+  mySameTol(theParent.mySameTol),
+  myC(theParent.myC),
+  myInitC(theParent.myInitC),
+  myIsFindSingleSolution(theParent.myIsFindSingleSolution),
+  myFunctionalMinimalValue(theParent.myFunctionalMinimalValue),
+  myIsConstLocked(Standard_True),
+  myDone(Standard_False),
+  myY(theParent.myY),
+  mySolCount(theParent.mySolCount),
+  myZ(theParent.myZ),
+  myE1(theParent.myE1),
+  myE2(theParent.myE2),
+  myE3(theParent.myE3),
+  myX(1, myN),
+  myTmp(1, myN),
+  myV(theParent.myV),
+  myMaxV(theParent.myMaxV),
+  myLastStep(0.0),
+  mySweepA(theSlabA),
+  mySweepB(theSlabB),
+  myCellSize(theParent.myCellSize),
+  myMinCellFilterSol(theParent.myMinCellFilterSol),
+  isFirstCellFilterInvoke(Standard_True),
+  myFilter(myN),
+  myCont(theParent.myCont),
+  myF(theParent.myF),
+  mySharedF(theSharedF),
+  myNbEvaluations(0),
+  myNbLocalSearches(0),
+  myElapsedTime(0.0)
+{
+  //
+}
+
+//=======================================================================
+//function : prepareSearch
+//purpose  :
+//=======================================================================
+Standard_Boolean math_GlobOptMin::prepareSearch(const Standard_Boolean isFindSingleSolution)
+{
   // Compute parameters range
   Standard_Real minLength = RealLast();
   Standard_Real maxLength = RealFirst();
@@ -223,7 +448,7 @@ void math_GlobOptMin::Perform(const Standard_Boolean isFindSingleSolution)
     std::cout << "math_GlobOptMin::Perform(): Degenerated parameters space" << std::endl;
     #endif
 
-    return;
+    return Standard_False;
   }
 
   if (!myIsConstLocked)
@@ -234,6 +459,8 @@ void math_GlobOptMin::Perform(const Standard_Boolean isFindSingleSolution)
 
   myE1 = minLength * myTol;
   myE2 = maxLength * myTol;
+  mySweepA = myA(myN);
+  mySweepB = myB(myN);
 
   myIsFindSingleSolution = isFindSingleSolution;
   if (isFindSingleSolution)
@@ -249,18 +476,45 @@ void math_GlobOptMin::Perform(const Standard_Boolean isFindSingleSolution)
       myE3 = - maxLength * myTol * myC / 4.0;
   }
 
-  // Search single solution and current solution in its neighborhood.
-  if (CheckFunctionalStopCriteria())
-  {
-    myDone = Standard_True;
+  return Standard_True;
+}
+
+//=======================================================================
+//function : takeSharedValue
+//purpose  :
+//=======================================================================
+void math_GlobOptMin::takeSharedValue()
+{
+  if (mySharedF == NULL)
     return;
+
+  // Solutions of this slab are dropped when worse than found in the other slabs.
+  const Standard_Real aSharedF = mySharedF->load(std::memory_order_relaxed);
+  const Standard_Real aTol = myIsFindSingleSolution ? 0.0 : mySameTol * 0.01;
+  if ((myF - aSharedF) * myZ < -aTol)
+  {
+    myF = aSharedF;
+    myY.Clear();
+    mySolCount = 0;
+    isFirstCellFilterInvoke = Standard_True;
   }
+}
 
-  myLastStep = 0.0;
-  isFirstCellFilterInvoke = Standard_True;
-  computeGlobalExtremum(myN);
+//=======================================================================
+//function : shareValue
+//purpose  :
+//=======================================================================
+void math_GlobOptMin::shareValue()
+{
+  if (mySharedF == NULL || mySolCount == 0)
+    return;
 
-  myDone = Standard_True;
+  Standard_Real aSharedF = mySharedF->load(std::memory_order_relaxed);
+  while ((myF - aSharedF) * myZ > 0.0 &&
+         !mySharedF->compare_exchange_weak(aSharedF, myF, std::memory_order_relaxed))
+  {
+    //
+  }
 }
 
 //=======================================================================
@@ -273,6 +527,8 @@ Standard_Boolean math_GlobOptMin::computeLocalExtremum(const math_Vector& thePnt
 {
   Standard_Integer i;
 
+  ++myNbLocalSearches;
+
   //Newton method
   if (myCont >= 2 &&
       dynamic_cast<math_MultipleVarFunctionWithHessian*>(myFunc))
@@ -356,6 +612,7 @@ void math_GlobOptMin::computeInitialValues()
   Standard_Real aLipConst = 0.0, aPrevValDiag, aPrevValProj;
   Standard_Integer aPntNb = 13;
   myFunc->Value(myA, aPrevValDiag);
+  ++myNbEvaluations;
   aPrevValProj = aPrevValDiag;
   Standard_Real aStep = (myB - myA).Norm() / aPntNb;
   aParamStep = (myB - myA) / aPntNb;
@@ -365,12 +622,14 @@ void math_GlobOptMin::computeInitialValues()
 
     // Walk over diagonal.
     myFunc->Value(aCurrPnt, aCurrVal);
+    ++myNbEvaluations;
     aLipConst = Max (Abs(aCurrVal - aPrevValDiag), aLipConst);
     aPrevValDiag = aCurrVal;
 
     // Walk over diag in projected space aPnt(1) = myA(1) = const.
     aCurrPnt(1) = myA(1);
     myFunc->Value(aCurrPnt, aCurrVal);
+    ++myNbEvaluations;
     aLipConst = Max (Abs(aCurrVal - aPrevValProj), aLipConst);
     aPrevValProj = aCurrVal;
   }
@@ -399,11 +658,14 @@ void math_GlobOptMin::computeGlobalExtremum(Standard_Integer j)
 
   Standard_Real r1, r2, r;
 
-  for(myX(j) = myA(j) + myE1; !isReached; myX(j) += myV(j))
+  // Last variable is swept in the slab of the box in parallel search.
+  const Standard_Real aFirst = (j == myN) ? mySweepA : myA(j);
+  const Standard_Real aLast  = (j == myN) ? mySweepB : myB(j);
+  for(myX(j) = aFirst + myE1; !isReached; myX(j) += myV(j))
   {
-    if (myX(j) > myB(j))
+    if (myX(j) > aLast)
     {
-      myX(j) = myB(j);
+      myX(j) = aLast;
       isReached = Standard_True;
     }
 
@@ -412,9 +674,13 @@ void math_GlobOptMin::computeGlobalExtremum(Standard_Integer j)
 
     if (j == 1)
     {
+      // Best value could be improved by the other threads.
+      takeSharedValue();
+
       isInside = Standard_False;
       aPrevVal = d;
       myFunc->Value(myX, d);
+      ++myNbEvaluations;
       r1 = (d + myZ * myC * myLastStep - myF) * myZ; // Evtushenko estimation.
       r2 = ((d + aPrevVal - myC * myLastStep) * 0.5 - myF) * myZ; // Shubert / Piyavsky estimation.
       r = Min(r1, r2);
@@ -430,6 +696,7 @@ void math_GlobOptMin::computeGlobalExtremum(Standard_Integer j)
         myX(1) = aParam;
         Standard_Real aVal = 0;
         myFunc->Value(myX, aVal);
+        ++myNbEvaluations;
         myX(1) = aSaveParam;
 
         if ( (aVal < d && aVal < aPrevVal) ||
@@ -443,6 +710,7 @@ void math_GlobOptMin::computeGlobalExtremum(Standard_Integer j)
 
       // Check point and value on the current step to be optimal.
       checkAddCandidate(aStepBestPoint, aStepBestValue);
+      shareValue();
 
       if (CheckFunctionalStopCriteria())
         return; // Best possible value is obtained.
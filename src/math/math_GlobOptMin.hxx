@@ -21,6 +21,8 @@
 #include <math_MultipleVarFunction.hxx>
 #include <NCollection_Sequence.hxx>
 
+#include <atomic>
+
 //! This class represents Evtushenko's algorithm of global optimization based on non-uniform mesh.
 //! Article: Yu. Evtushenko. Numerical methods for finding global extreme (case of a non-uniform mesh).
 //! U.S.S.R. Comput. Maths. Math. Phys., Vol. 11, N 6, pp. 38-54.
@@ -46,6 +48,12 @@
 //! It is possible to set / get minimal value of the functional.
 //! It works well together with single solution search.
 //! This functionality is covered by SetFunctionalMinimalValue and GetFunctionalMinimalValue API.
+//!
+//! It is possible to perform search in parallel threads, each evaluating its own copy of the functional.
+//! This functionality is covered by Perform method taking the array of functionals.
+//!
+//! The number of functional evaluations and the time of the last search are reported
+//! by NbEvaluations, NbLocalSearches and ElapsedTime API, to tune tolerances and Lipschitz constant.
 class math_GlobOptMin
 {
 public:
@@ -98,6 +106,17 @@ public:
   //! @param isFindSingleSolution - defines whether to find single solution or all solutions.
   Standard_EXPORT void Perform(const Standard_Boolean isFindSingleSolution = Standard_False);
 
+  //! Performs search in parallel threads.
+  //! The search box is split into slabs along the last variable, the slabs are searched
+  //! concurrently sharing the best functional value to skip the cells which cannot improve it.
+  //! The functional is not required to be thread-safe: each thread evaluates its own copy
+  //! of the functional, so the number of threads is limited by the number of the copies.
+  //! The functional given to the constructor is used for the computation of initial values.
+  //! @param theFunctions - copies of the objective functional, one per thread.
+  //! @param isFindSingleSolution - defines whether to find single solution or all solutions.
+  Standard_EXPORT void Perform(const NCollection_Array1<math_MultipleVarFunction*>& theFunctions,
+                               const Standard_Boolean isFindSingleSolution = Standard_False);
+
   //! Return solution theIndex, 1 <= theIndex <= NbExtrema.
   Standard_EXPORT void Points(const Standard_Integer theIndex, math_Vector& theSol);
 
@@ -124,8 +143,39 @@ public:
   //! Return count of global extremas.
   inline Standard_Integer NbExtrema() const {return mySolCount;}
 
+  //! Return count of functional evaluations by the last search,
+  //! evaluations made by local optimization methods are not counted.
+  inline Standard_Integer NbEvaluations() const { return myNbEvaluations; }
+
+  //! Return count of local optimizations run by the last search.
+  inline Standard_Integer NbLocalSearches() const { return myNbLocalSearches; }
+
+  //! Return elapsed time of the last search in seconds.
+  inline Standard_Real ElapsedTime() const { return myElapsedTime; }
+
 private:
 
+  //! Functor searching the slabs of the box in parallel threads.
+  class SlabFunctor;
+
+  //! Creates the algorithm searching the slab [theSlabA, theSlabB] of the last variable
+  //! in the box of theParent with the same parameters and initial solution.
+  math_GlobOptMin(const math_GlobOptMin& theParent,
+                  math_MultipleVarFunction* theFunc,
+                  const Standard_Real theSlabA,
+                  const Standard_Real theSlabB,
+                  std::atomic<Standard_Real>* theSharedF);
+
+  //! Computes algorithm data of the search box.
+  //! Returns false if the box is degenerated.
+  Standard_Boolean prepareSearch(const Standard_Boolean isFindSingleSolution);
+
+  //! Takes the best functional value found by the other threads.
+  void takeSharedValue();
+
+  //! Passes the best functional value to the other threads.
+  void shareValue();
+
   //! Class for duplicate fast search. For internal usage only.
   class NCollection_CellFilter_Inspector
   {
@@ -270,6 +320,8 @@ private:
   math_Vector myV; // Steps array.
   math_Vector myMaxV; // Max Steps array.
   Standard_Real myLastStep; // Last step.
+  Standard_Real mySweepA; // Range of the last variable, the slab of the box in parallel search.
+  Standard_Real mySweepB;
 
   NCollection_Array1<Standard_Real> myCellSize;
   Standard_Integer myMinCellFilterSol;
@@ -280,6 +332,14 @@ private:
   Standard_Integer myCont;
 
   Standard_Real myF; // Current value of Global optimum.
+
+  // Parallel search.
+  std::atomic<Standard_Real>* mySharedF; // Best value shared between threads, NULL in single thread.
+
+  // Statistics.
+  Standard_Integer myNbEvaluations; // Count of functional evaluations.
+  Standard_Integer myNbLocalSearches; // Count of local optimizations.
+  Standard_Real myElapsedTime; // Time of the last search.
 };
 
 #endif
@@ -0,0 +1,285 @@
+// Copyright (c) 2024 OPEN CASCADE SAS
+//
+// This file is part of Open CASCADE Technology software library.
+//
+// This library is free software; you can redistribute it and/or modify it under
+// the terms of the GNU Lesser General Public License version 2.1 as published
+// by the Free Software Foundation, with special exception defined in the file
+// OCCT_LGPL_EXCEPTION.txt. Consult the file LICENSE_LGPL_21.txt included in OCCT
+// distribution for complete text of the license and disclaimer of any warranty.
+//
+// Alternatively, this file may be used under the terms of Open CASCADE
+// commercial license or contractual agreement.
+
+#ifndef _math_MatrixN_HeaderFile
+#define _math_MatrixN_HeaderFile
+
+#include <math_Matrix.hxx>
+#include <math_VectorN.hxx>
+
+template<Standard_Integer R, Standard_Integer C> class math_MatrixN;
+
+//! Solver of the square linear system of the fixed dimension N used by math_MatrixN::Solve().
+//! The system is solved by Gauss elimination with the partial pivoting on the rows
+//! scaled by their largest values, in the same way as by math_Gauss, so the matrix
+//! is considered singular under the same conditions.
+template<Standard_Integer N>
+struct math_MatrixNSolver
+{
+  //! Solves the system theA * theX = theB.
+  //! Returns false if the absolute values of all items of some row
+  //! or of some pivot do not exceed theTolerance.
+  static Standard_Boolean Solve (const math_MatrixN<N, N>& theA,
+                                 const math_VectorN<N>& theB,
+                                 math_VectorN<N>& theX,
+                                 const Standard_Real theTolerance)
+  {
+    Standard_Real aA[N][N], aB[N], aScale[N];
+    for (Standard_Integer aRow = 0; aRow < N; ++aRow)
+    {
+      Standard_Real aMax = 0.0;
+      for (Standard_Integer aCol = 0; aCol < N; ++aCol)
+      {
+        aA[aRow][aCol] = theA.Value (aRow + 1, aCol + 1);
+        aMax = Max (aMax, Abs (aA[aRow][aCol]));
+      }
+      if (aMax <= theTolerance)
+      {
+        return Standard_False;
+      }
+      aScale[aRow] = 1.0 / aMax;
+      aB[aRow] = theB.Value (aRow + 1);
+    }
+
+    for (Standard_Integer aCol = 0; aCol < N; ++aCol)
+    {
+      Standard_Integer aPivot = aCol;
+      Standard_Real aPivotValue = aScale[aCol] * Abs (aA[aCol][aCol]);
+      for (Standard_Integer aRow = aCol + 1; aRow < N; ++aRow)
+      {
+        const Standard_Real aValue = aScale[aRow] * Abs (aA[aRow][aCol]);
+        if (aValue > aPivotValue)
+        {
+          aPivot = aRow;
+          aPivotValue = aValue;
+        }
+      }
+      if (Abs (aA[aPivot][aCol]) <= theTolerance)
+      {
+        return Standard_False;
+      }
+      if (aPivot != aCol)
+      {
+        for (Standard_Integer anIdx = aCol; anIdx < N; ++anIdx)
+        {
+          const Standard_Real aTmp = aA[aCol][anIdx];
+          aA[aCol][anIdx] = aA[aPivot][anIdx];
+          aA[aPivot][anIdx] = aTmp;
+        }
+        const Standard_Real aTmp = aB[aCol];
+        aB[aCol] = aB[aPivot];
+        aB[aPivot] = aTmp;
+        aScale[aPivot] = aScale[aCol];
+      }
+      for (Standard_Integer aRow = aCol + 1; aRow < N; ++aRow)
+      {
+        const Standard_Real aFactor = aA[aRow][aCol] / aA[aCol][aCol];
+        for (Standard_Integer anIdx = aCol + 1; anIdx < N; ++anIdx)
+        {
+          aA[aRow][anIdx] -= aFactor * aA[aCol][anIdx];
+        }
+        aB[aRow] -= aFactor * aB[aCol];
+      }
+    }
+
+    for (Standard_Integer aRow = N - 1; aRow >= 0; --aRow)
+    {
+      Standard_Real aSum = aB[aRow];
+      for (Standard_Integer anIdx = aRow + 1; anIdx < N; ++anIdx)
+      {
+        aSum -= aA[aRow][anIdx] * theX.Value (anIdx + 1);
+      }
+      theX.ChangeValue (aRow + 1) = aSum / aA[aRow][aRow];
+    }
+    return Standard_True;
+  }
+};
+
+//! Matrix of the fixed dimensions R x C, indexed in the ranges [1, R] x [1, C] like math_Matrix.
+//! The values are stored in the object itself by rows, so the matrix does not allocate memory.
+//! It is intended for the small systems solved in the inner loops of the algorithms:
+//! Solve() computes the solution of the square system without heap allocations.
+//!
+//! The matrix is converted to and from math_Matrix for the interfaces of math package;
+//! Data() gives the storage for wrapping by math_Matrix without copying (see math_FunctionSetN).
+template<Standard_Integer R, Standard_Integer C>
+class math_MatrixN
+{
+public:
+
+  //! Returns the number of rows.
+  static Standard_Integer RowNumber() { return R; }
+
+  //! Returns the number of columns.
+  static Standard_Integer ColNumber() { return C; }
+
+public:
+
+  //! Constructs a non-initialized matrix.
+  math_MatrixN() {}
+
+  //! Constructs a matrix with all elements equal to theInitialValue.
+  explicit math_MatrixN (const Standard_Real theInitialValue) { Init (theInitialValue); }
+
+  //! Constructs a matrix by copying math_Matrix of the same dimensions.
+  explicit math_MatrixN (const math_Matrix& theOther) { Set (theOther); }
+
+  //! Initializes all elements of the matrix with theInitialValue.
+  void Init (const Standard_Real theInitialValue)
+  {
+    for (Standard_Integer anIdx = 0; anIdx < R * C; ++anIdx)
+    {
+      myValues[anIdx] = theInitialValue;
+    }
+  }
+
+  //! Initializes the matrix with the identity one (the elements out of the diagonal are zero).
+  void SetIdentity()
+  {
+    Init (0.0);
+    for (Standard_Integer anIdx = 0; anIdx < R && anIdx < C; ++anIdx)
+    {
+      myValues[anIdx * C + anIdx] = 1.0;
+    }
+  }
+
+  //! Copies the values of math_Matrix of the same dimensions.
+  void Set (const math_Matrix& theOther)
+  {
+    Standard_DimensionError_Raise_if (theOther.RowNumber() != R || theOther.ColNumber() != C,
+                                      "math_MatrixN::Set() - dimensions mismatch");
+    for (Standard_Integer aRow = 0; aRow < R; ++aRow)
+    {
+      for (Standard_Integer aCol = 0; aCol < C; ++aCol)
+      {
+        myValues[aRow * C + aCol] = theOther (theOther.LowerRow() + aRow, theOther.LowerCol() + aCol);
+      }
+    }
+  }
+
+  //! Copies the values into math_Matrix of the same dimensions.
+  void Get (math_Matrix& theOther) const
+  {
+    Standard_DimensionError_Raise_if (theOther.RowNumber() != R || theOther.ColNumber() != C,
+                                      "math_MatrixN::Get() - dimensions mismatch");
+    for (Standard_Integer aRow = 0; aRow < R; ++aRow)
+    {
+      for (Standard_Integer aCol = 0; aCol < C; ++aCol)
+      {
+        theOther (theOther.LowerRow() + aRow, theOther.LowerCol() + aCol) = myValues[aRow * C + aCol];
+      }
+    }
+  }
+
+  //! Returns the value of the element with indices in the ranges [1, R] x [1, C].
+  const Standard_Real& Value (const Standard_Integer theRow,
+                              const Standard_Integer theCol) const
+  {
+    Standard_OutOfRange_Raise_if (theRow < 1 || theRow > R || theCol < 1 || theCol > C,
+                                  "math_MatrixN::Value() - index out of range");
+    return myValues[(theRow - 1) * C + theCol - 1];
+  }
+
+  //! Returns the value of the element with indices in the ranges [1, R] x [1, C].
+  Standard_Real& ChangeValue (const Standard_Integer theRow,
+                              const Standard_Integer theCol)
+  {
+    Standard_OutOfRange_Raise_if (theRow < 1 || theRow > R || theCol < 1 || theCol > C,
+                                  "math_MatrixN::ChangeValue() - index out of range");
+    return myValues[(theRow - 1) * C + theCol - 1];
+  }
+
+  const Standard_Real& operator() (const Standard_Integer theRow,
+                                   const Standard_Integer theCol) const { return Value (theRow, theCol); }
+
+  Standard_Real& operator() (const Standard_Integer theRow,
+                             const Standard_Integer theCol) { return ChangeValue (theRow, theCol); }
+
+  //! Returns the storage of the elements by rows.
+  const Standard_Real* Data() const { return myValues; }
+
+  //! Returns the storage of the elements by rows for modification.
+  Standard_Real* ChangeData() { return myValues; }
+
+  //! Returns the product of the matrix and the vector.
+  math_VectorN<R> Multiplied (const math_VectorN<C>& theVector) const
+  {
+    math_VectorN<R> aResult;
+    for (Standard_Integer aRow = 0; aRow < R; ++aRow)
+    {
+      Standard_Real aSum = 0.0;
+      for (Standard_Integer aCol = 0; aCol < C; ++aCol)
+      {
+        aSum += myValues[aRow * C + aCol] * theVector.Data()[aCol];
+      }
+      aResult.ChangeData()[aRow] = aSum;
+    }
+    return aResult;
+  }
+
+  math_VectorN<R> operator* (const math_VectorN<C>& theVector) const { return Multiplied (theVector); }
+
+  //! Returns the product of the matrices.
+  template<Standard_Integer C2>
+  math_MatrixN<R, C2> Multiplied (const math_MatrixN<C, C2>& theOther) const
+  {
+    math_MatrixN<R, C2> aResult (0.0);
+    for (Standard_Integer aRow = 1; aRow <= R; ++aRow)
+    {
+      for (Standard_Integer anIdx = 1; anIdx <= C; ++anIdx)
+      {
+        const Standard_Real aValue = Value (aRow, anIdx);
+        for (Standard_Integer aCol = 1; aCol <= C2; ++aCol)
+        {
+          aResult.ChangeValue (aRow, aCol) += aValue * theOther.Value (anIdx, aCol);
+        }
+      }
+    }
+    return aResult;
+  }
+
+  template<Standard_Integer C2>
+  math_MatrixN<R, C2> operator* (const math_MatrixN<C, C2>& theOther) const { return Multiplied (theOther); }
+
+  //! Returns the transposed matrix.
+  math_MatrixN<C, R> Transposed() const
+  {
+    math_MatrixN<C, R> aResult;
+    for (Standard_Integer aRow = 1; aRow <= R; ++aRow)
+    {
+      for (Standard_Integer aCol = 1; aCol <= C; ++aCol)
+      {
+        aResult.ChangeValue (aCol, aRow) = Value (aRow, aCol);
+      }
+    }
+    return aResult;
+  }
+
+  //! Solves the square system (*this) * theX = theB.
+  //! Returns false if the matrix is singular: the absolute value of some pivot
+  //! of Gauss elimination does not exceed theTolerance (see math_Gauss).
+  Standard_Boolean Solve (const math_VectorN<R>& theB,
+                          math_VectorN<C>& theX,
+                          const Standard_Real theTolerance = 1.0e-30) const
+  {
+    Standard_STATIC_ASSERT (R == C);
+    return math_MatrixNSolver<R>::Solve (*this, theB, theX, theTolerance);
+  }
+
+private:
+
+  Standard_Real myValues[R * C];
+
+};
+
+#endif // _math_MatrixN_HeaderFile
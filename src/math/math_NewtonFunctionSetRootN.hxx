@@ -0,0 +1,197 @@
+// Copyright (c) 2024 OPEN CASCADE SAS
+//
+// This file is part of Open CASCADE Technology software library.
+//
+// This library is free software; you can redistribute it and/or modify it under
+// the terms of the GNU Lesser General Public License version 2.1 as published
+// by the Free Software Foundation, with special exception defined in the file
+// OCCT_LGPL_EXCEPTION.txt. Consult the file LICENSE_LGPL_21.txt included in OCCT
+// distribution for complete text of the license and disclaimer of any warranty.
+//
+// Alternatively, this file may be used under the terms of Open CASCADE
+// commercial license or contractual agreement.
+
+#ifndef _math_NewtonFunctionSetRootN_HeaderFile
+#define _math_NewtonFunctionSetRootN_HeaderFile
+
+#include <math_FunctionSetN.hxx>
+#include <StdFail_NotDone.hxx>
+
+//! Computes the root of a set of N functions of N variables by the Newton Raphson
+//! algorithm in the same way as math_NewtonFunctionSetRoot, but for the dimension
+//! fixed at compile time: the solution, the values of the functions and the Jacobian
+//! are stored in the object itself and the linear systems are solved by math_MatrixN,
+//! so that the computation does not allocate memory.
+//! It is intended for the small systems (N = 2 or 3) solved repeatedly by the
+//! projection and intersection algorithms.
+template<Standard_Integer N>
+class math_NewtonFunctionSetRootN
+{
+public:
+
+  //! Constructor.
+  //! @param theFunction     function with N variables and N equations
+  //! @param theXTolerance   tolerances of the variables, in the range [1, N]
+  //! @param theFTolerance   tolerance of the values of the functions
+  //! @param theNbIterations maximal number of the iterations
+  math_NewtonFunctionSetRootN (math_FunctionSetWithDerivatives& theFunction,
+                               const math_Vector& theXTolerance,
+                               const Standard_Real theFTolerance,
+                               const Standard_Integer theNbIterations = 100)
+  : myTolX (theXTolerance),
+    myTolF (theFTolerance),
+    myDone (Standard_False),
+    myState (0),
+    myIter (0),
+    myIterMax (theNbIterations)
+  {
+    (void )theFunction;
+    Standard_DimensionError_Raise_if (theFunction.NbVariables() != N,
+                                      "math_NewtonFunctionSetRootN - dimensions mismatch");
+  }
+
+  //! Initializes the tolerances of the variables.
+  void SetTolerance (const math_Vector& theXTolerance) { myTolX.Set (theXTolerance); }
+
+  //! Improves the root of the function from the initial guess point.
+  //! The solution is found when abs(Xj - Xj-1)(i) <= XTol(i) and abs(Fi) <= FTol for all i.
+  void Perform (math_FunctionSetWithDerivatives& theFunction,
+                const math_Vector& theStartingPoint)
+  {
+    Perform (theFunction, math_VectorN<N> (theStartingPoint),
+             math_VectorN<N> (RealFirst()), math_VectorN<N> (RealLast()));
+  }
+
+  //! Improves the root of the function from the initial guess point,
+  //! constraining the solution by the bounds.
+  void Perform (math_FunctionSetWithDerivatives& theFunction,
+                const math_Vector& theStartingPoint,
+                const math_Vector& theInfBound,
+                const math_Vector& theSupBound)
+  {
+    Perform (theFunction, math_VectorN<N> (theStartingPoint),
+             math_VectorN<N> (theInfBound), math_VectorN<N> (theSupBound));
+  }
+
+  //! Improves the root of the function from the initial guess point,
+  //! constraining the solution by the bounds.
+  void Perform (math_FunctionSetWithDerivatives& theFunction,
+                const math_VectorN<N>& theStartingPoint,
+                const math_VectorN<N>& theInfBound,
+                const math_VectorN<N>& theSupBound)
+  {
+    const math_FunctionSetN<N> aFunction (theFunction);
+    myDone = Standard_False;
+    mySol  = theStartingPoint;
+    if (!aFunction.Values (mySol, myFValues, myJacobian))
+    {
+      return;
+    }
+
+    for (myIter = 1; myIter <= myIterMax; ++myIter)
+    {
+      if (!myJacobian.Solve (-myFValues, myDeltaX))
+      {
+        return;
+      }
+      for (Standard_Integer anIdx = 1; anIdx <= N; ++anIdx)
+      {
+        Standard_Real& aSol = mySol (anIdx);
+        aSol += myDeltaX (anIdx);
+
+        // keep the solution within the bounds
+        if (aSol <= theInfBound (anIdx)) aSol = theInfBound (anIdx);
+        if (aSol >= theSupBound (anIdx)) aSol = theSupBound (anIdx);
+      }
+
+      if (!aFunction.Values (mySol, myFValues, myJacobian))
+      {
+        return;
+      }
+      if (isSolutionReached())
+      {
+        myState = aFunction.GetStateNumber();
+        myDone  = Standard_True;
+        return;
+      }
+    }
+  }
+
+  //! Returns true if the computations are successful, otherwise returns false.
+  Standard_Boolean IsDone() const { return myDone; }
+
+  //! Returns the value of the root of the function.
+  //! Exception NotDone is raised if the root was not found.
+  const math_VectorN<N>& Root() const
+  {
+    StdFail_NotDone_Raise_if (!myDone, "math_NewtonFunctionSetRootN::Root() - no result");
+    return mySol;
+  }
+
+  //! Outputs the root vector in theRoot.
+  //! Exception NotDone is raised if the root was not found.
+  void Root (math_Vector& theRoot) const { Root().Get (theRoot); }
+
+  //! Returns the state number associated with the root.
+  Standard_Integer StateNumber() const
+  {
+    StdFail_NotDone_Raise_if (!myDone, "math_NewtonFunctionSetRootN::StateNumber() - no result");
+    return myState;
+  }
+
+  //! Returns the matrix value of the derivative at the root.
+  //! Exception NotDone is raised if the root was not found.
+  const math_MatrixN<N, N>& Derivative() const
+  {
+    StdFail_NotDone_Raise_if (!myDone, "math_NewtonFunctionSetRootN::Derivative() - no result");
+    return myJacobian;
+  }
+
+  //! Returns the values of the functions at the root.
+  //! Exception NotDone is raised if the root was not found.
+  const math_VectorN<N>& FunctionSetErrors() const
+  {
+    StdFail_NotDone_Raise_if (!myDone, "math_NewtonFunctionSetRootN::FunctionSetErrors() - no result");
+    return myFValues;
+  }
+
+  //! Returns the number of iterations really done during the computation of the root.
+  //! Exception NotDone is raised if the root was not found.
+  Standard_Integer NbIterations() const
+  {
+    StdFail_NotDone_Raise_if (!myDone, "math_NewtonFunctionSetRootN::NbIterations() - no result");
+    return myIter;
+  }
+
+private:
+
+  //! Checks the convergence criteria of math_NewtonFunctionSetRoot.
+  Standard_Boolean isSolutionReached() const
+  {
+    for (Standard_Integer anIdx = 1; anIdx <= N; ++anIdx)
+    {
+      if (Abs (myDeltaX (anIdx)) > myTolX (anIdx)
+       || Abs (myFValues (anIdx)) > myTolF)
+      {
+        return Standard_False;
+      }
+    }
+    return Standard_True;
+  }
+
+private:
+
+  math_VectorN<N>    myTolX;
+  Standard_Real      myTolF;
+  math_VectorN<N>    mySol;
+  math_VectorN<N>    myDeltaX;
+  math_VectorN<N>    myFValues;
+  math_MatrixN<N, N> myJacobian;
+  Standard_Boolean   myDone;
+  Standard_Integer   myState;
+  Standard_Integer   myIter;
+  Standard_Integer   myIterMax;
+
+};
+
+#endif // _math_NewtonFunctionSetRootN_HeaderFile
@@ -0,0 +1,201 @@
+// Copyright (c) 2024 OPEN CASCADE SAS
+//
+// This file is part of Open CASCADE Technology software library.
+//
+// This library is free software; you can redistribute it and/or modify it under
+// the terms of the GNU Lesser General Public License version 2.1 as published
+// by the Free Software Foundation, with special exception defined in the file
+// OCCT_LGPL_EXCEPTION.txt. Consult the file LICENSE_LGPL_21.txt included in OCCT
+// distribution for complete text of the license and disclaimer of any warranty.
+//
+// Alternatively, this file may be used under the terms of Open CASCADE
+// commercial license or contractual agreement.
+
+#ifndef _math_VectorN_HeaderFile
+#define _math_VectorN_HeaderFile
+
+#include <math_Vector.hxx>
+#include <Standard_Assert.hxx>
+#include <Standard_DimensionError.hxx>
+#include <Standard_OutOfRange.hxx>
+
+//! Vector of the fixed dimension N, indexed in the range [1, N] like math_Vector.
+//! The values are stored in the object itself, so the vector does not allocate memory
+//! and the loops over its elements have the number of iterations known at compile time.
+//! It is intended for the small systems solved in the inner loops of the algorithms,
+//! see math_MatrixN and math_NewtonFunctionSetRootN.
+//!
+//! The vector is converted to and from math_Vector for the interfaces of math package;
+//! Data() gives the storage for wrapping by math_Vector without copying (see math_FunctionSetN).
+template<Standard_Integer N>
+class math_VectorN
+{
+public:
+
+  //! Returns the dimension of the vector.
+  static Standard_Integer Length() { return N; }
+
+  //! Returns the lower index of the vector.
+  static Standard_Integer Lower() { return 1; }
+
+  //! Returns the upper index of the vector.
+  static Standard_Integer Upper() { return N; }
+
+public:
+
+  //! Constructs a non-initialized vector.
+  math_VectorN() {}
+
+  //! Constructs a vector with all elements equal to theInitialValue.
+  explicit math_VectorN (const Standard_Real theInitialValue) { Init (theInitialValue); }
+
+  //! Constructs a vector by copying math_Vector of the same length.
+  explicit math_VectorN (const math_Vector& theOther) { Set (theOther); }
+
+  //! Initializes all elements of the vector with theInitialValue.
+  void Init (const Standard_Real theInitialValue)
+  {
+    for (Standard_Integer anIdx = 0; anIdx < N; ++anIdx)
+    {
+      myValues[anIdx] = theInitialValue;
+    }
+  }
+
+  //! Copies the values of math_Vector of the same length.
+  void Set (const math_Vector& theOther)
+  {
+    Standard_DimensionError_Raise_if (theOther.Length() != N, "math_VectorN::Set() - dimensions mismatch");
+    for (Standard_Integer anIdx = 0; anIdx < N; ++anIdx)
+    {
+      myValues[anIdx] = theOther (theOther.Lower() + anIdx);
+    }
+  }
+
+  //! Copies the values into math_Vector of the same length.
+  void Get (math_Vector& theOther) const
+  {
+    Standard_DimensionError_Raise_if (theOther.Length() != N, "math_VectorN::Get() - dimensions mismatch");
+    for (Standard_Integer anIdx = 0; anIdx < N; ++anIdx)
+    {
+      theOther (theOther.Lower() + anIdx) = myValues[anIdx];
+    }
+  }
+
+  //! Returns the value of the element with index in the range [1, N].
+  const Standard_Real& Value (const Standard_Integer theIndex) const
+  {
+    Standard_OutOfRange_Raise_if (theIndex < 1 || theIndex > N, "math_VectorN::Value() - index out of range");
+    return myValues[theIndex - 1];
+  }
+
+  //! Returns the value of the element with index in the range [1, N].
+  Standard_Real& ChangeValue (const Standard_Integer theIndex)
+  {
+    Standard_OutOfRange_Raise_if (theIndex < 1 || theIndex > N, "math_VectorN::ChangeValue() - index out of range");
+    return myValues[theIndex - 1];
+  }
+
+  const Standard_Real& operator() (const Standard_Integer theIndex) const { return Value (theIndex); }
+
+  Standard_Real& operator() (const Standard_Integer theIndex) { return ChangeValue (theIndex); }
+
+  //! Returns the storage of the elements.
+  const Standard_Real* Data() const { return myValues; }
+
+  //! Returns the storage of the elements for modification.
+  Standard_Real* ChangeData() { return myValues; }
+
+  //! Returns the square of the norm of the vector.
+  Standard_Real Norm2() const { return Multiplied (*this); }
+
+  //! Returns the norm of the vector.
+  Standard_Real Norm() const { return Sqrt (Norm2()); }
+
+  //! Returns the dot product of the vectors.
+  Standard_Real Multiplied (const math_VectorN& theOther) const
+  {
+    Standard_Real aResult = 0.0;
+    for (Standard_Integer anIdx = 0; anIdx < N; ++anIdx)
+    {
+      aResult += myValues[anIdx] * theOther.myValues[anIdx];
+    }
+    return aResult;
+  }
+
+  Standard_Real operator* (const math_VectorN& theOther) const { return Multiplied (theOther); }
+
+  //! Multiplies the vector by the scalar.
+  void Multiply (const Standard_Real theScalar)
+  {
+    for (Standard_Integer anIdx = 0; anIdx < N; ++anIdx)
+    {
+      myValues[anIdx] *= theScalar;
+    }
+  }
+
+  void operator*= (const Standard_Real theScalar) { Multiply (theScalar); }
+
+  //! Returns the vector multiplied by the scalar.
+  math_VectorN Multiplied (const Standard_Real theScalar) const
+  {
+    math_VectorN aResult (*this);
+    aResult.Multiply (theScalar);
+    return aResult;
+  }
+
+  math_VectorN operator* (const Standard_Real theScalar) const { return Multiplied (theScalar); }
+
+  //! Adds the vector.
+  void Add (const math_VectorN& theOther)
+  {
+    for (Standard_Integer anIdx = 0; anIdx < N; ++anIdx)
+    {
+      myValues[anIdx] += theOther.myValues[anIdx];
+    }
+  }
+
+  void operator+= (const math_VectorN& theOther) { Add (theOther); }
+
+  //! Returns the sum of the vectors.
+  math_VectorN Added (const math_VectorN& theOther) const
+  {
+    math_VectorN aResult (*this);
+    aResult.Add (theOther);
+    return aResult;
+  }
+
+  math_VectorN operator+ (const math_VectorN& theOther) const { return Added (theOther); }
+
+  //! Subtracts the vector.
+  void Subtract (const math_VectorN& theOther)
+  {
+    for (Standard_Integer anIdx = 0; anIdx < N; ++anIdx)
+    {
+      myValues[anIdx] -= theOther.myValues[anIdx];
+    }
+  }
+
+  void operator-= (const math_VectorN& theOther) { Subtract (theOther); }
+
+  //! Returns the difference of the vectors.
+  math_VectorN Subtracted (const math_VectorN& theOther) const
+  {
+    math_VectorN aResult (*this);
+    aResult.Subtract (theOther);
+    return aResult;
+  }
+
+  math_VectorN operator- (const math_VectorN& theOther) const { return Subtracted (theOther); }
+
+  //! Returns the opposite vector.
+  math_VectorN Opposite() const { return Multiplied (-1.0); }
+
+  math_VectorN operator-() const { return Opposite(); }
+
+private:
+
+  Standard_Real myValues[N];
+
+};
+
+#endif // _math_VectorN_HeaderFile